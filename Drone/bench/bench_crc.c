@@ -0,0 +1,122 @@
+/*
+ * bench_crc.c - MAVLink校验和微基准测试
+ * 比较单字节查表与slicing-by-8实现，并测量完整帧校验（解析器）的每帧耗时
+ */
+
+#include "mavlink.h"
+#include "mavlink_crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_FRAMES 4096           // 样本帧数
+#define BENCH_ROUNDS 200            // 重复轮数
+
+/* 典型载荷长度：HEARTBEAT/ATTITUDE/COMMAND_LONG/PARAM_VALUE/GPS_RAW_INT/STATUSTEXT */
+static const struct {
+    uint32_t msgid;
+    uint8_t len;
+} g_sample_msgs[] = {
+    {0, 9}, {30, 28}, {76, 33}, {22, 25}, {24, 30}, {253, 51},
+};
+
+#define SAMPLE_COUNT (sizeof(g_sample_msgs) / sizeof(g_sample_msgs[0]))
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * 构造一个校验和正确的v2帧，返回帧长
+ */
+static size_t build_frame(uint8_t *out, uint32_t msgid, uint8_t len, uint8_t seq) {
+    out[0] = MAVLINK_STX_V2;
+    out[1] = len;
+    out[2] = 0;
+    out[3] = 0;
+    out[4] = seq;
+    out[5] = 255;
+    out[6] = 190;
+    out[7] = msgid & 0xFF;
+    out[8] = (msgid >> 8) & 0xFF;
+    out[9] = (msgid >> 16) & 0xFF;
+    for (int i = 0; i < len; i++) {
+        out[MAVLINK_HEADER_LEN_V2 + i] = (uint8_t)rand();
+    }
+    
+    uint8_t crc_extra = 0;
+    mavlink_get_crc_extra(msgid, &crc_extra);
+    uint16_t crc = mavlink_crc_calculate(&out[1], MAVLINK_HEADER_LEN_V2 - 1 + len, MAVLINK_CRC_INIT);
+    crc = mavlink_crc_accumulate(crc_extra, crc);
+    out[MAVLINK_HEADER_LEN_V2 + len] = crc & 0xFF;
+    out[MAVLINK_HEADER_LEN_V2 + len + 1] = crc >> 8;
+    
+    return MAVLINK_HEADER_LEN_V2 + len + MAVLINK_CHECKSUM_LEN;
+}
+
+static void count_frame(const mavlink_frame_t *frame, void *ctx) {
+    (void)frame;
+    (*(size_t *)ctx)++;
+}
+
+int main(void) {
+    mavlink_init();
+    srand(1);
+    
+    uint8_t *stream = malloc(BENCH_FRAMES * MAVLINK_MAX_FRAME_LEN);
+    size_t *offsets = malloc(BENCH_FRAMES * sizeof(size_t));
+    size_t *lengths = malloc(BENCH_FRAMES * sizeof(size_t));
+    size_t stream_len = 0;
+    
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        offsets[i] = stream_len;
+        lengths[i] = build_frame(stream + stream_len, g_sample_msgs[i % SAMPLE_COUNT].msgid,
+                                 g_sample_msgs[i % SAMPLE_COUNT].len, (uint8_t)i);
+        stream_len += lengths[i];
+    }
+    
+    printf("MAVLink校验和基准测试（%d帧 x %d轮，平均帧长%.1f字节）\n",
+           BENCH_FRAMES, BENCH_ROUNDS, (double)stream_len / BENCH_FRAMES);
+    
+    const mavlink_crc_impl_t impls[] = {MAVLINK_CRC_IMPL_SCALAR, MAVLINK_CRC_IMPL_SLICE8};
+    for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++) {
+        mavlink_crc_select(impls[k]);
+        
+        // 仅校验和计算
+        volatile uint16_t sink = 0;
+        double start = now_ns();
+        for (int r = 0; r < BENCH_ROUNDS; r++) {
+            for (int i = 0; i < BENCH_FRAMES; i++) {
+                sink ^= mavlink_crc_calculate(stream + offsets[i] + 1, lengths[i] - 3, MAVLINK_CRC_INIT);
+            }
+        }
+        double crc_ns = (now_ns() - start) / ((double)BENCH_FRAMES * BENCH_ROUNDS);
+        
+        // 解析器完整校验（同步、查CRC_EXTRA、比对校验和）
+        mavlink_parser_t parser;
+        size_t frames = 0;
+        start = now_ns();
+        for (int r = 0; r < BENCH_ROUNDS; r++) {
+            mavlink_parser_init(&parser);
+            mavlink_parser_feed(&parser, stream, stream_len, count_frame, &frames);
+        }
+        double parse_ns = (now_ns() - start) / ((double)BENCH_FRAMES * BENCH_ROUNDS);
+        
+        if (frames != (size_t)BENCH_FRAMES * BENCH_ROUNDS || parser.crc_errors != 0) {
+            fprintf(stderr, "[错误] 校验失败: %zu帧, %llu个CRC错误\n",
+                    frames, (unsigned long long)parser.crc_errors);
+            return 1;
+        }
+        
+        printf("  %-8s 校验和 %6.1f ns/帧 | 解析+校验 %6.1f ns/帧\n",
+               mavlink_crc_impl_name(), crc_ns, parse_ns);
+    }
+    
+    free(stream);
+    free(offsets);
+    free(lengths);
+    return 0;
+}
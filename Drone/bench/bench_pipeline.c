@@ -0,0 +1,525 @@
+/*
+ * bench_pipeline.c - 客户端消息处理流水线基准测试
+ * 分别测量解析（mavlink_parser_feed）、分类（filter_classify）和记录三个阶段，输出帧/秒、ns/帧和每帧内存分配次数。
+ * 记录分两行：入队是转发线程上logger_*的开销，写出是日志写出线程格式化并写完文件的整体吞吐。
+ *
+ * 流量场景：
+ *   QGC突发       地面站连接时的初始化突发（心跳、参数/任务列表、状态轮询命令），v1/v2混合
+ *   模糊垃圾      随机字节中夹杂有效帧和校验和被破坏的帧
+ *   COMMAND_LONG风暴  连续的控制命令（解锁、起飞、改模式、请求消息），v2载荷截零
+ *
+ * 分配计数通过链接选项 -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc 实现（见Makefile）。
+ */
+
+#include "mavlink.h"
+#include "mavlink_crc.h"
+#include "filter.h"
+#include "logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <arpa/inet.h>
+
+#define DATAGRAMS 20000             // 每个场景的数据报数
+#define PARSE_ROUNDS 20             // 解析/分类重复轮数
+#define LOG_LIMIT 20000             // 记录阶段最多记录的条数
+#define MAX_DATAGRAM 1024           // 单个数据报上限
+
+/* ========== 分配计数 ========== */
+
+static unsigned long long g_allocs = 0;          // 所有线程（日志写出线程也在分配）
+static __thread unsigned long long g_thread_allocs = 0; // 当前线程
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    __atomic_fetch_add(&g_allocs, 1, __ATOMIC_RELAXED);
+    g_thread_allocs++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    __atomic_fetch_add(&g_allocs, 1, __ATOMIC_RELAXED);
+    g_thread_allocs++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    __atomic_fetch_add(&g_allocs, 1, __ATOMIC_RELAXED);
+    g_thread_allocs++;
+    return __real_realloc(ptr, size);
+}
+
+/* ========== 流量生成 ========== */
+
+/* 一个场景的全部数据报，连续存放 */
+typedef struct {
+    const char *name;
+    uint8_t *data;
+    size_t *offsets;                // 第i个数据报起始偏移，offsets[count]为总长度
+    size_t count;
+    size_t frames;                  // 生成的有效帧数
+    size_t v1_frames;
+} traffic_t;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * 写入一帧校验和正确的消息，v2按协议截掉载荷末尾的零字节
+ * @return 帧长
+ */
+static size_t put_frame(uint8_t *out, int v2, uint32_t msgid, const uint8_t *payload, size_t len, uint8_t seq) {
+    uint8_t crc_extra = 0;
+    size_t header_len;
+    
+    if (v2) {
+        while (len > 1 && payload[len - 1] == 0) {
+            len--;
+        }
+        header_len = MAVLINK_HEADER_LEN_V2;
+        out[0] = MAVLINK_STX_V2;
+        out[1] = (uint8_t)len;
+        out[2] = 0;
+        out[3] = 0;
+        out[4] = seq;
+        out[5] = 255;
+        out[6] = 190;
+        out[7] = msgid & 0xFF;
+        out[8] = (msgid >> 8) & 0xFF;
+        out[9] = (msgid >> 16) & 0xFF;
+    } else {
+        header_len = MAVLINK_HEADER_LEN_V1;
+        out[0] = MAVLINK_STX_V1;
+        out[1] = (uint8_t)len;
+        out[2] = seq;
+        out[3] = 255;
+        out[4] = 190;
+        out[5] = (uint8_t)msgid;
+    }
+    memcpy(out + header_len, payload, len);
+    
+    mavlink_get_crc_extra(msgid, &crc_extra);
+    uint16_t crc = mavlink_crc_calculate(&out[1], header_len - 1 + len, MAVLINK_CRC_INIT);
+    crc = mavlink_crc_accumulate(crc_extra, crc);
+    out[header_len + len] = crc & 0xFF;
+    out[header_len + len + 1] = crc >> 8;
+    
+    return header_len + len + MAVLINK_CHECKSUM_LEN;
+}
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put_float(uint8_t *p, float v) {
+    memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * 随机生成一条地面站初始化阶段的消息
+ */
+static size_t put_qgc_message(uint8_t *out, uint8_t seq, int *is_v1) {
+    uint8_t payload[MAVLINK_MAX_PAYLOAD_LEN] = {0};
+    int v2 = rand() % 8 != 0;       // 约1/8为v1
+    uint32_t msgid;
+    size_t len;
+    
+    switch (rand() % 10) {
+        case 0:
+        case 1:
+            msgid = MAVLINK_MSG_ID_HEARTBEAT;
+            payload[MAVLINK_OFFSET_HEARTBEAT_TYPE] = 6;
+            payload[MAVLINK_OFFSET_HEARTBEAT_AUTOPILOT] = 8;
+            payload[MAVLINK_OFFSET_HEARTBEAT_MAVLINK_VERSION] = 3;
+            len = 9;
+            break;
+        case 2:
+            msgid = MAVLINK_MSG_ID_SYSTEM_TIME;
+            len = 12;
+            payload[0] = (uint8_t)rand();
+            break;
+        case 3:
+            msgid = MAVLINK_MSG_ID_PARAM_REQUEST_LIST;
+            payload[0] = payload[1] = 1;
+            len = 2;
+            break;
+        case 4:
+            msgid = MAVLINK_MSG_ID_PARAM_REQUEST_READ;
+            put_u16(payload + MAVLINK_OFFSET_PARAM_REQUEST_READ_PARAM_INDEX, 0xFFFF);
+            payload[MAVLINK_OFFSET_PARAM_REQUEST_READ_TARGET_SYSTEM] = 1;
+            memcpy(payload + MAVLINK_OFFSET_PARAM_REQUEST_READ_PARAM_ID, "SYSID_THISMAV", 13);
+            len = 20;
+            break;
+        case 5:
+            msgid = MAVLINK_MSG_ID_MISSION_REQUEST_LIST;
+            payload[0] = payload[1] = 1;
+            len = 3;
+            break;
+        case 6:
+            msgid = MAVLINK_MSG_ID_REQUEST_DATA_STREAM;
+            put_u16(payload, 4);
+            payload[2] = payload[3] = 1;
+            payload[5] = 1;
+            len = 6;
+            break;
+        case 7:
+            // 状态轮询：512 / 511请求242 / 521请求1
+            msgid = MAVLINK_MSG_ID_COMMAND_LONG;
+            {
+                static const uint16_t polls[3] = {512, 511, 521};
+                static const float polled[3] = {148, 242, 1};
+                int k = rand() % 3;
+                put_u16(payload + MAVLINK_OFFSET_COMMAND_LONG_COMMAND, polls[k]);
+                put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM1, polled[k]);
+            }
+            payload[MAVLINK_OFFSET_COMMAND_LONG_TARGET_SYSTEM] = 1;
+            len = 33;
+            break;
+        case 8:
+            msgid = MAVLINK_MSG_ID_TIMESYNC;
+            payload[0] = (uint8_t)rand();
+            len = 16;
+            break;
+        default:
+            msgid = MAVLINK_MSG_ID_MANUAL_CONTROL;
+            put_u16(payload + MAVLINK_OFFSET_MANUAL_CONTROL_Z, 500);
+            payload[MAVLINK_OFFSET_MANUAL_CONTROL_TARGET] = 1;
+            len = 11;
+            break;
+    }
+    
+    *is_v1 = !v2;
+    return put_frame(out, v2, msgid, payload, len, seq);
+}
+
+/**
+ * 随机生成一条COMMAND_LONG控制命令
+ */
+static size_t put_command(uint8_t *out, uint8_t seq, int *is_v1) {
+    static const uint16_t commands[] = {400, 176, 22, 21, 20, 192, 511, 521, 16, 246};
+    uint8_t payload[MAVLINK_MAX_PAYLOAD_LEN] = {0};
+    uint16_t command = commands[rand() % (sizeof(commands) / sizeof(commands[0]))];
+    int v2 = rand() % 16 != 0;
+    
+    put_u16(payload + MAVLINK_OFFSET_COMMAND_LONG_COMMAND, command);
+    payload[MAVLINK_OFFSET_COMMAND_LONG_TARGET_SYSTEM] = 1;
+    payload[MAVLINK_OFFSET_COMMAND_LONG_TARGET_COMPONENT] = 1;
+    switch (command) {
+        case 400: put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM1, (float)(rand() % 2)); break;
+        case 176: put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM2, (float)(rand() % 25)); break;
+        case 22: put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM7, 50.0f); break;
+        case 511:
+        case 521: put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM1, (float)(rand() % 300)); break;
+        default: put_float(payload + MAVLINK_OFFSET_COMMAND_LONG_PARAM5, 39.9f); break;
+    }
+    
+    *is_v1 = !v2;
+    return put_frame(out, v2, MAVLINK_MSG_ID_COMMAND_LONG, payload, 33, seq);
+}
+
+enum { SCENE_QGC, SCENE_FUZZ, SCENE_STORM, SCENE_COUNT };
+
+static void traffic_build(traffic_t *t, int scene) {
+    static const char *names[SCENE_COUNT] = {"QGC突发", "模糊垃圾", "COMMAND_LONG风暴"};
+    uint8_t seq = 0;
+    size_t pos = 0;
+    
+    memset(t, 0, sizeof(*t));
+    t->name = names[scene];
+    t->data = malloc((size_t)DATAGRAMS * MAX_DATAGRAM);
+    t->offsets = malloc((DATAGRAMS + 1) * sizeof(size_t));
+    
+    for (size_t d = 0; d < DATAGRAMS; d++) {
+        uint8_t *out = t->data + pos;
+        size_t len = 0;
+        int is_v1;
+        
+        t->offsets[d] = pos;
+        if (scene == SCENE_QGC) {
+            // 一个数据报1~4帧
+            int n = 1 + rand() % 4;
+            for (int i = 0; i < n; i++) {
+                len += put_qgc_message(out + len, seq++, &is_v1);
+                t->frames++;
+                t->v1_frames += is_v1;
+            }
+        } else if (scene == SCENE_STORM) {
+            len = put_command(out, seq++, &is_v1);
+            t->frames++;
+            t->v1_frames += is_v1;
+        } else {
+            // 64~512字节随机数据，1/4的数据报中间嵌入一帧有效消息，1/8嵌入一帧被破坏的消息
+            len = 64 + rand() % 448;
+            for (size_t i = 0; i < len; i++) {
+                out[i] = (uint8_t)rand();
+            }
+            int roll = rand() % 8;
+            if (roll < 3) {
+                size_t at = rand() % (len / 2);
+                size_t flen = (roll < 2) ? put_qgc_message(out + at, seq++, &is_v1)
+                                         : put_command(out + at, seq++, &is_v1);
+                if (at + flen > len) {
+                    len = at + flen;
+                }
+                if (roll == 2) {
+                    out[at + flen - 1] ^= 0x5A; // 破坏校验和
+                } else {
+                    t->frames++;
+                    t->v1_frames += is_v1;
+                }
+            }
+        }
+        pos += len;
+    }
+    t->offsets[DATAGRAMS] = pos;
+    t->count = DATAGRAMS;
+}
+
+/* ========== 测量 ========== */
+
+/* 收集帧视图（每个数据报单独解析，视图都指向流量缓冲区） */
+typedef struct {
+    mavlink_frame_t *frames;
+    size_t count;
+    size_t capacity;
+} frame_list_t;
+
+static void count_frame(const mavlink_frame_t *frame, void *ctx) {
+    (void)frame;
+    (*(size_t *)ctx)++;
+}
+
+static void collect_frame(const mavlink_frame_t *frame, void *ctx) {
+    frame_list_t *list = (frame_list_t *)ctx;
+    if (list->count < list->capacity) {
+        list->frames[list->count++] = *frame;
+    }
+}
+
+static void report(const char *stage, double total_ns, size_t items, unsigned long long allocs, const char *unit) {
+    double per = items ? total_ns / items : 0;
+    printf("  %-4s %8.2f 万%s/s %9.1f ns/%s %7.2f 次分配/%s\n", stage,
+           per > 0 ? 1e9 / per / 1e4 : 0.0, unit, per, unit,
+           items ? (double)allocs / items : 0.0, unit);
+}
+
+/* 记录阶段的日志写到临时目录，logger的控制台输出暂时重定向到/dev/null */
+static char g_log_dir[] = "/tmp/bench_pipeline_XXXXXX";
+static int g_saved_stdout = -1;
+
+static void stdout_mute(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    close(devnull);
+}
+
+static void stdout_restore(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static void remove_log_dir(void) {
+    DIR *dir = opendir("logs");
+    if (dir) {
+        struct dirent *ent;
+        while ((ent = readdir(dir)) != NULL) {
+            if (ent->d_name[0] != '.') {
+                char path[512];
+                snprintf(path, sizeof(path), "logs/%s", ent->d_name);
+                unlink(path);
+            }
+        }
+        closedir(dir);
+        rmdir("logs");
+    }
+}
+
+/* 换日志格式：关闭后按新格式重新初始化 */
+static void logger_restart(int format) {
+    stdout_mute();
+    logger_close();
+    logger_set_format(format);
+    if (logger_init() < 0) {
+        stdout_restore();
+        exit(1);
+    }
+    stdout_restore();
+}
+
+/*
+ * 记录：只对需要记录的帧调用logger，按记录条数统计。
+ * 每入队半个队列等一次写出，不让队列溢出（测的是写出线程的吞吐，不是丢弃）
+ */
+static void bench_log(const frame_list_t *list, const client_info_t *client, int format) {
+    filter_state_t filter;
+    size_t records = 0;
+    double log_ns = 0;
+    double start;
+    logger_stats_t log_stats;
+    
+    stdout_mute();
+    logger_get_stats(&log_stats);
+    uint64_t dropped = log_stats.dropped;
+    uint64_t bytes = log_stats.bytes;
+    unsigned long long thread_allocs = g_thread_allocs;
+    unsigned long long allocs = g_allocs;
+    double write_start = now_ns();
+    filter_init(&filter);
+    for (size_t i = 0; i < list->count && records < LOG_LIMIT; i++) {
+        const mavlink_frame_t *frame = &list->frames[i];
+        filter_action_t action = filter_classify(&filter, frame);
+        if (action == FILTER_DROP) {
+            continue;
+        }
+        start = now_ns();
+        switch (action) {
+            case FILTER_LOG_REQUEST: logger_request(client, frame); break;
+            case FILTER_LOG_COMMAND: logger_command(client, frame); break;
+            default: logger_unknown(client, frame); break;
+        }
+        log_ns += now_ns() - start;
+        if (++records % (LOGGER_RING_SIZE / 2) == 0) {
+            logger_flush();
+        }
+    }
+    logger_flush();
+    double write_ns = now_ns() - write_start;
+    thread_allocs = g_thread_allocs - thread_allocs;
+    allocs = g_allocs - allocs;
+    stdout_restore();
+    
+    logger_get_stats(&log_stats);
+    if (format == LOGGER_FORMAT_JSON) {
+        report("入队", log_ns, records, thread_allocs, "条");
+        report("写出", write_ns, records, allocs, "条");
+    } else {
+        report("二进制", write_ns, records, allocs, "条");
+    }
+    printf("       每条%.0f字节\n", records ? (double)(log_stats.bytes - bytes) / records : 0.0);
+    if (log_stats.dropped != dropped) {
+        printf("       队列满丢弃%llu条\n", (unsigned long long)(log_stats.dropped - dropped));
+    }
+}
+
+static void bench_scene(traffic_t *t, const client_info_t *client) {
+    size_t bytes = t->offsets[t->count];
+    
+    printf("场景 %s：%zu数据报 %zu KB，有效帧%zu（v1占%.0f%%）\n", t->name, t->count, bytes / 1024,
+           t->frames, t->frames ? 100.0 * t->v1_frames / t->frames : 0.0);
+    
+    // 解析：与代理相同，一个解析器连续处理全部数据报
+    mavlink_parser_t parser;
+    size_t parsed = 0;
+    unsigned long long allocs = g_allocs;
+    double start = now_ns();
+    for (int r = 0; r < PARSE_ROUNDS; r++) {
+        mavlink_parser_init(&parser);
+        for (size_t d = 0; d < t->count; d++) {
+            mavlink_parser_feed(&parser, t->data + t->offsets[d], t->offsets[d + 1] - t->offsets[d],
+                                count_frame, &parsed);
+        }
+    }
+    double parse_ns = now_ns() - start;
+    report("解析", parse_ns, parsed, g_allocs - allocs, "帧");
+    printf("       输入 %.0f MB/s，每轮解析出%zu帧，丢弃垃圾%llu字节\n",
+           (double)bytes * PARSE_ROUNDS / (1024.0 * 1024.0) / (parse_ns / 1e9), parsed / PARSE_ROUNDS,
+           (unsigned long long)parser.bytes_skipped);
+    
+    // 分类：在收集好的帧视图上单独测量
+    frame_list_t list;
+    list.capacity = parsed / PARSE_ROUNDS + 16;
+    list.frames = malloc(list.capacity * sizeof(mavlink_frame_t));
+    list.count = 0;
+    for (size_t d = 0; d < t->count; d++) {
+        mavlink_parser_init(&parser);
+        mavlink_parser_feed(&parser, t->data + t->offsets[d], t->offsets[d + 1] - t->offsets[d],
+                            collect_frame, &list);
+    }
+    
+    filter_state_t filter;
+    size_t logged = 0;
+    allocs = g_allocs;
+    start = now_ns();
+    for (int r = 0; r < PARSE_ROUNDS; r++) {
+        filter_init(&filter);
+        for (size_t i = 0; i < list.count; i++) {
+            logged += filter_classify(&filter, &list.frames[i]) != FILTER_DROP;
+        }
+    }
+    report("分类", now_ns() - start, list.count * PARSE_ROUNDS, g_allocs - allocs, "帧");
+    
+    // 记录：先按JSON格式，再换成二进制格式测一遍写出
+    bench_log(&list, client, LOGGER_FORMAT_JSON);
+    logger_restart(LOGGER_FORMAT_BINARY);
+    bench_log(&list, client, LOGGER_FORMAT_BINARY);
+    logger_restart(LOGGER_FORMAT_JSON);
+    printf("       需要记录的帧占%.1f%%\n", list.count ? 100.0 * logged / (list.count * PARSE_ROUNDS) : 0.0);
+    
+    free(list.frames);
+}
+
+int main(void) {
+    mavlink_init();
+    srand(10);
+    
+    // 日志写到临时目录，结束后删除
+    char cwd[512];
+    if (!getcwd(cwd, sizeof(cwd)) || !mkdtemp(g_log_dir) || chdir(g_log_dir) < 0) {
+        perror("无法创建临时日志目录");
+        return 1;
+    }
+    
+    // 换格式时不压缩上一个格式的文件，不和写出线程抢CPU
+    logarchive_policy_t archive = { 0, 0, 0 };
+    logger_set_rotation(0, &archive);
+    stdout_mute();
+    int ret = logger_init();
+    stdout_restore();
+    if (ret < 0) {
+        return 1;
+    }
+    
+    client_info_t client;
+    memset(&client, 0, sizeof(client));
+    client.addr.sin_family = AF_INET;
+    inet_pton(AF_INET, "203.0.113.7", &client.addr.sin_addr);
+    client.addr.sin_port = htons(14550);
+    client.addr_len = sizeof(client.addr);
+    strcpy(client.ip_str, "203.0.113.7");
+    client.port = 14550;
+    
+    printf("消息处理流水线基准测试（每场景%d数据报，解析/分类%d轮，记录最多%d条）\n",
+           DATAGRAMS, PARSE_ROUNDS, LOG_LIMIT);
+    
+    for (int scene = 0; scene < SCENE_COUNT; scene++) {
+        traffic_t traffic;
+        traffic_build(&traffic, scene);
+        bench_scene(&traffic, &client);
+        free(traffic.data);
+        free(traffic.offsets);
+    }
+    
+    stdout_mute();
+    logger_close();
+    stdout_restore();
+    
+    remove_log_dir();
+    if (chdir(cwd) == 0) {
+        rmdir(g_log_dir);
+    }
+    return 0;
+}
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+gen_msgdefs.py - 根据MAVLink XML方言生成消息描述符表
+
+读取 mavlink/*.xml（处理<include>）和 mavlink/labels_zh.txt，生成：
+  src/mavlink_msgdefs.h  消息ID、字段偏移宏，表大小
+  src/mavlink_msgdefs.c  消息元数据表、字段描述符数组
+
+用法: python3 scripts/gen_msgdefs.py [-o src] [--labels mavlink/labels_zh.txt] mavlink/ardupilotmega.xml ...
+只依赖Python标准库。
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+# 类型 -> (字段类型枚举, 元素字节数)
+TYPES = {
+    'char': ('MAVLINK_FIELD_CHAR', 1),
+    'uint8_t': ('MAVLINK_FIELD_UINT8', 1),
+    'int8_t': ('MAVLINK_FIELD_INT8', 1),
+    'uint16_t': ('MAVLINK_FIELD_UINT16', 2),
+    'int16_t': ('MAVLINK_FIELD_INT16', 2),
+    'uint32_t': ('MAVLINK_FIELD_UINT32', 4),
+    'int32_t': ('MAVLINK_FIELD_INT32', 4),
+    'uint64_t': ('MAVLINK_FIELD_UINT64', 8),
+    'int64_t': ('MAVLINK_FIELD_INT64', 8),
+    'float': ('MAVLINK_FIELD_FLOAT', 4),
+    'double': ('MAVLINK_FIELD_DOUBLE', 8),
+}
+
+CATEGORIES = ('CONNECTION', 'SYSTEM', 'TELEMETRY', 'PARAM', 'MISSION',
+              'COMMAND', 'POSITION', 'MANUAL', 'REQUEST', 'TERRAIN', 'OTHER')
+POLICIES = ('OTHER', 'SKIP', 'REQUEST', 'COMMAND')
+
+MAX_PAYLOAD_LEN = 255
+PAGE_BITS = 8           # 与mavlink_msgs.c的两级索引一致
+PAGE_COUNT = 256
+
+
+class Field:
+    def __init__(self, msg, elem, extension):
+        self.name = elem.get('name')
+        raw_type = elem.get('type')
+        m = re.match(r'^(\w+)\[(\d+)\]$', raw_type)
+        base = m.group(1) if m else raw_type
+        self.array_len = int(m.group(2)) if m else 0
+        # uint8_t_mavlink_version在线上就是uint8_t，CRC_EXTRA也按uint8_t计算
+        if base == 'uint8_t_mavlink_version':
+            base = 'uint8_t'
+        if base not in TYPES:
+            fail('%s.%s: 不支持的字段类型 %s' % (msg, self.name, raw_type))
+        self.type = base
+        self.enum, self.size = TYPES[base]
+        self.extension = extension
+        self.offset = 0
+        self.label = None
+
+    @property
+    def wire_len(self):
+        return self.size * max(self.array_len, 1)
+
+
+class Message:
+    def __init__(self, elem, source):
+        self.id = int(elem.get('id'))
+        self.name = elem.get('name')
+        self.source = source
+        self.fields = []
+        extension = False
+        for child in elem:
+            if child.tag == 'extensions':
+                extension = True
+            elif child.tag == 'field':
+                self.fields.append(Field(self.name, child, extension))
+        if self.id < 0 or self.id > 0xFFFFFF:
+            fail('%s: 消息ID %d 超出24位范围' % (self.name, self.id))
+
+        # 线上顺序：基础字段按元素大小降序稳定排序，扩展字段保持声明顺序追加在后
+        base = [f for f in self.fields if not f.extension]
+        ext = [f for f in self.fields if f.extension]
+        self.wire = sorted(base, key=lambda f: -f.size) + ext
+        offset = 0
+        for f in self.wire:
+            f.offset = offset
+            offset += f.wire_len
+        self.max_len = offset
+        self.min_len = sum(f.wire_len for f in base)
+        if self.max_len > MAX_PAYLOAD_LEN:
+            fail('%s: 载荷长度 %d 超过 %d' % (self.name, self.max_len, MAX_PAYLOAD_LEN))
+        self.crc_extra = self.compute_crc_extra(base)
+        self.name_zh = None
+        self.category = 'OTHER'
+        self.policy = 'OTHER'
+
+    def compute_crc_extra(self, base):
+        crc = x25(0xFFFF, self.name + ' ')
+        for f in sorted(base, key=lambda f: -f.size):
+            crc = x25(crc, f.type + ' ')
+            crc = x25(crc, f.name + ' ')
+            if f.array_len:
+                crc = x25(crc, bytes([f.array_len]))
+        return (crc & 0xFF) ^ (crc >> 8)
+
+
+def fail(text):
+    sys.stderr.write('gen_msgdefs: %s\n' % text)
+    sys.exit(1)
+
+
+def x25(crc, data):
+    """CRC-16/MCRF4XX，与mavlink_crc_accumulate相同"""
+    if isinstance(data, str):
+        data = data.encode('ascii')
+    for b in data:
+        tmp = b ^ (crc & 0xFF)
+        tmp = (tmp ^ (tmp << 4)) & 0xFF
+        crc = ((crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4)) & 0xFFFF
+    return crc
+
+
+def load_dialect(path, messages, seen):
+    path = os.path.normpath(path)
+    if path in seen:
+        return
+    seen.add(path)
+    try:
+        root = ET.parse(path).getroot()
+    except (OSError, ET.ParseError) as e:
+        fail('无法读取方言文件 %s: %s' % (path, e))
+    for inc in root.findall('include'):
+        load_dialect(os.path.join(os.path.dirname(path), inc.text.strip()), messages, seen)
+    block = root.find('messages')
+    if block is None:
+        return
+    for elem in block.findall('message'):
+        msg = Message(elem, os.path.basename(path))
+        if msg.id in messages:
+            old = messages[msg.id]
+            fail('消息ID %d 重复定义: %s(%s) 与 %s(%s)' % (msg.id, old.name, old.source, msg.name, msg.source))
+        messages[msg.id] = msg
+
+
+def load_labels(path, messages):
+    by_name = {m.name: m for m in messages.values()}
+    generic = {}
+    specific = {}
+    with open(path, encoding='utf-8') as fp:
+        for lineno, line in enumerate(fp, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            where = '%s:%d' % (path, lineno)
+            if parts[0] == 'message' and len(parts) == 5:
+                _, name, zh, category, policy = parts
+                if category not in CATEGORIES or policy not in POLICIES:
+                    fail('%s: 未知的类别或日志策略' % where)
+                msg = by_name.get(name)
+                if msg is None:
+                    continue  # 标注了XML里没有的消息，忽略
+                msg.name_zh, msg.category, msg.policy = zh, category, policy
+            elif parts[0] == 'field' and len(parts) == 3:
+                target, label = parts[1], parts[2]
+                if '.' in target:
+                    specific[tuple(target.split('.', 1))] = label
+                else:
+                    generic[target] = label
+            else:
+                fail('%s: 无法解析: %s' % (where, line))
+    for msg in messages.values():
+        for f in msg.fields:
+            f.label = specific.get((msg.name, f.name), generic.get(f.name, f.name))
+
+
+def c_string(text):
+    return '"%s"' % text.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path, encoding='utf-8') as fp:
+            if fp.read() == text:
+                return
+    except OSError:
+        pass
+    with open(path, 'w', encoding='utf-8') as fp:
+        fp.write(text)
+
+
+def generate(messages, sources, out_dir):
+    msgs = [messages[k] for k in sorted(messages)]
+    pages = sorted({m.id >> PAGE_BITS for m in msgs})
+    if pages and pages[-1] >= PAGE_COUNT:
+        fail('消息ID %d 超出两级索引覆盖范围' % msgs[-1].id)
+    banner = ('/*\n'
+              ' * %s - 由 scripts/gen_msgdefs.py 根据 %s 生成\n'
+              ' * 请勿手工修改，修改XML或 mavlink/labels_zh.txt 后执行 make msgdefs\n'
+              ' */\n')
+    src_list = ', '.join(sources)
+
+    h = [banner % ('mavlink_msgdefs.h', src_list),
+         '#ifndef MAVLINK_MSGDEFS_H',
+         '#define MAVLINK_MSGDEFS_H',
+         '',
+         '#define MAVLINK_MSGDEF_COUNT %d       // 元数据表项数（含0号占位项）' % (len(msgs) + 1),
+         '#define MAVLINK_MSGDEF_PAGES %d        // 两级索引需要的页数（含0号空页）' % (len(pages) + 1),
+         '',
+         '/* 消息ID */']
+    for m in msgs:
+        h.append('#define MAVLINK_MSG_ID_%s %d' % (m.name, m.id))
+    h.append('')
+    h.append('/* 字段在载荷中的偏移（线上顺序） */')
+    for m in msgs:
+        for f in m.fields:
+            h.append('#define MAVLINK_OFFSET_%s_%s %d' % (m.name, f.name.upper(), f.offset))
+    h.append('')
+    h.append('#endif /* MAVLINK_MSGDEFS_H */')
+
+    c = [banner % ('mavlink_msgdefs.c', src_list),
+         '#include "mavlink_msgs.h"',
+         '',
+         '/* 字段描述符，按XML声明顺序：名称、中文标签、类型、偏移、元素字节数、数组长度、是否扩展字段 */']
+    for m in msgs:
+        c.append('static const mavlink_field_info_t g_fields_%s[] = {' % m.name)
+        for f in m.fields:
+            c.append('    {%s, %s, %s, %d, %d, %d, %d},' % (
+                c_string(f.name), c_string(f.label), f.enum, f.offset, f.size,
+                f.array_len, 1 if f.extension else 0))
+        c.append('};')
+    c.append('')
+    c.append('/* 元数据表，0号为未知消息占位项 */')
+    c.append('const mavlink_msg_info_t g_mavlink_msg_info[MAVLINK_MSGDEF_COUNT] __attribute__((aligned(64))) = {')
+    c.append('    {0, 0, MAVLINK_MAX_PAYLOAD_LEN, 0, MAVLINK_CAT_UNKNOWN, MAVLINK_LOG_OTHER, 0, 0, "UNKNOWN", "未识别消息"},')
+    for m in msgs:
+        c.append('    {%d, %d, %d, %d, MAVLINK_CAT_%s, MAVLINK_LOG_%s, 1, %d, %s, %s},' % (
+            m.id, m.min_len, m.max_len, m.crc_extra, m.category, m.policy,
+            len(m.fields), c_string(m.name), c_string(m.name_zh or m.name)))
+    c.append('};')
+    c.append('')
+    c.append('/* 字段描述符数组，与元数据表下标一一对应 */')
+    c.append('const mavlink_field_info_t *const g_mavlink_msg_fields[MAVLINK_MSGDEF_COUNT] = {')
+    c.append('    NULL,')
+    for m in msgs:
+        c.append('    g_fields_%s,' % m.name)
+    c.append('};')
+
+    write_if_changed(os.path.join(out_dir, 'mavlink_msgdefs.h'), '\n'.join(h) + '\n')
+    write_if_changed(os.path.join(out_dir, 'mavlink_msgdefs.c'), '\n'.join(c) + '\n')
+    return len(msgs), sum(len(m.fields) for m in msgs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='根据MAVLink XML方言生成消息描述符表')
+    parser.add_argument('xml', nargs='+', help='方言XML文件（自动处理include）')
+    parser.add_argument('-o', '--out-dir', default='src', help='输出目录')
+    parser.add_argument('--labels', default='mavlink/labels_zh.txt', help='中文标注文件')
+    args = parser.parse_args()
+
+    messages = {}
+    seen = set()
+    for path in args.xml:
+        load_dialect(path, messages, seen)
+    load_labels(args.labels, messages)
+    sources = sorted(os.path.relpath(p) for p in seen)
+    count, fields = generate(messages, sources, args.out_dir)
+    print('生成 %d 条消息、%d 个字段描述符' % (count, fields))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,522 @@
+/*
+ * backend.c - SITL后端池
+ */
+
+#include "backend.h"
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/* 以下在创建工作线程前由backend_pool_configure设置，之后只读 */
+static char g_args_buf[512];            // PROXY_SITL_ARGS拆分后的存储
+static char *g_args[BACKEND_MAX_ARGS];
+static int g_arg_count = 0;
+static int g_enabled = 0;
+
+static void backend_pool_adjust(backend_pool_t *pool);
+static void backend_on_io(void *ctx, int fd, uint32_t events);
+static void backend_on_exit(void *ctx, int fd, uint32_t events);
+
+/* 多个工作线程各自管理子进程，不能用SIGCHLD+waitpid(-1)，改为每个进程一个pidfd */
+static int pidfd_open(pid_t pid) {
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+}
+
+/**
+ * 逐级创建目录
+ */
+static int make_dirs(const char *path) {
+    char buf[PATH_MAX];
+    
+    snprintf(buf, sizeof(buf), "%s", path);
+    for (char *p = buf + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            if (mkdir(buf, 0755) < 0 && errno != EEXIST) {
+                return -1;
+            }
+            *p = '/';
+        }
+    }
+    if (mkdir(buf, 0755) < 0 && errno != EEXIST) {
+        return -1;
+    }
+    return 0;
+}
+
+static void backend_arm(backend_t *backend, uint64_t delay_ms) {
+    evloop_timer_set(&backend->timer, delay_ms ? delay_ms : 1, 0);
+}
+
+static void backend_disconnect(backend_t *backend) {
+    evloop_del(backend->pool->loop, &backend->io);
+    if (backend->fd >= 0) {
+        close(backend->fd);
+        backend->fd = -1;
+    }
+    txq_clear(&backend->txq);
+    backend->want_write = 0;
+}
+
+/**
+ * 结束实例：断开连接、结束进程（pidfd可读时回收，回收前槽位不会重新启动），回到STOPPED
+ */
+static void backend_stop(backend_t *backend) {
+    backend_disconnect(backend);
+    evloop_timer_set(&backend->timer, 0, 0);
+    if (backend->pid > 0) {
+        kill(backend->pid, SIGKILL);
+    }
+    backend->state = BACKEND_STOPPED;
+    backend->owner = NULL;
+}
+
+/**
+ * 实例异常（启动超时、进程退出、连接断开）：通知会话并回收
+ */
+static void backend_fail(backend_t *backend, const char *reason) {
+    backend_pool_t *pool = backend->pool;
+    
+    printf("SITL实例%d %s\n", backend->instance, reason);
+    pool->stats.failures++;
+    if (backend->state == BACKEND_BUSY && pool->ops->on_lost) {
+        pool->ops->on_lost(backend);
+    }
+    backend_stop(backend);
+    
+    // 冷却一段时间再重新启动该槽位，避免程序或参数有误时反复拉起进程
+    backend->cooldown = 1;
+    backend_arm(backend, BACKEND_COOLDOWN_MS);
+    backend_pool_adjust(pool);
+}
+
+/**
+ * 启动SITL进程：每个实例使用独立的工作目录，启动前删除eeprom.bin，保证参数和状态都是初始值
+ */
+static int backend_spawn(backend_t *backend) {
+    const honeypot_config_t *config = config_get();
+    char dir[sizeof(config->pool_dir) + 16];
+    char instance_arg[16];
+    char *argv[BACKEND_MAX_ARGS + 3];
+    int argc = 0;
+    
+    snprintf(dir, sizeof(dir), "%s/%d", config->pool_dir, backend->instance);
+    if (make_dirs(dir) < 0) {
+        perror("创建SITL实例目录失败");
+        return -1;
+    }
+    
+    snprintf(instance_arg, sizeof(instance_arg), "-I%d", backend->instance);
+    argv[argc++] = (char *)config->sitl_bin;
+    for (int i = 0; i < g_arg_count; i++) {
+        argv[argc++] = g_args[i];
+    }
+    argv[argc++] = instance_arg;
+    argv[argc] = NULL;
+    
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork失败");
+        return -1;
+    }
+    
+    if (pid == 0) {
+        // 子进程：恢复被事件循环屏蔽的信号
+        sigset_t empty;
+        sigemptyset(&empty);
+        sigprocmask(SIG_SETMASK, &empty, NULL);
+        
+        if (chdir(dir) < 0) {
+            _exit(127);
+        }
+        unlink("eeprom.bin");
+        int log_fd = open("sitl.log", O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (log_fd >= 0) {
+            dup2(log_fd, STDOUT_FILENO);
+            dup2(log_fd, STDERR_FILENO);
+            close(log_fd);
+        }
+        execv(argv[0], argv);
+        _exit(127);
+    }
+    
+    int pidfd = pidfd_open(pid);
+    if (pidfd < 0 ||
+        evloop_add(backend->pool->loop, &backend->exit_src, pidfd, EPOLLIN, backend_on_exit, backend) < 0) {
+        perror("pidfd_open失败");
+        if (pidfd >= 0) {
+            close(pidfd);
+        }
+        kill(pid, SIGKILL);
+        waitpid(pid, NULL, 0);
+        return -1;
+    }
+    
+    mavlink_parser_init(&backend->parser);
+    backend->pid = pid;
+    backend->state = BACKEND_STARTING;
+    backend->heartbeat_seen = 0;
+    backend->started = time(NULL);
+    backend->owner = NULL;
+    backend->pool->stats.spawned++;
+    
+    // SITL需要一点时间才开始监听
+    backend_arm(backend, BACKEND_RETRY_MS);
+    return 0;
+}
+
+/**
+ * 连接建立：连接保持非阻塞（实例卡住时数据在发送队列中排队，不阻塞事件循环），开始预热
+ */
+static void backend_connected(backend_t *backend) {
+    evloop_del(backend->pool->loop, &backend->io);
+    if (evloop_add(backend->pool->loop, &backend->io, backend->fd, EPOLLIN, backend_on_io, backend) < 0) {
+        backend_fail(backend, "无法注册连接");
+        return;
+    }
+    
+    backend->state = BACKEND_WARMING;
+    backend->ready_at = time(NULL) + config_get()->pool_warmup;
+    backend_arm(backend, BACKEND_RETRY_MS);
+}
+
+/**
+ * 非阻塞connect完成
+ */
+static void backend_on_connect(void *ctx, int fd, uint32_t events) {
+    backend_t *backend = (backend_t *)ctx;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    (void)events;
+    
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+        // 还没开始监听，稍后重试
+        backend_disconnect(backend);
+        backend_arm(backend, BACKEND_RETRY_MS);
+        return;
+    }
+    backend_connected(backend);
+}
+
+/**
+ * 尝试连接SITL（非阻塞）
+ */
+static void backend_try_connect(backend_t *backend) {
+    struct sockaddr_in addr;
+    
+    backend->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (backend->fd < 0) {
+        perror("TCP socket创建失败");
+        backend_arm(backend, BACKEND_RETRY_MS);
+        return;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(backend->port);
+    
+    if (connect(backend->fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+        backend_connected(backend);
+        return;
+    }
+    if (errno == EINPROGRESS &&
+        evloop_add(backend->pool->loop, &backend->io, backend->fd, EPOLLOUT, backend_on_connect, backend) == 0) {
+        return;
+    }
+    backend_disconnect(backend);
+    backend_arm(backend, BACKEND_RETRY_MS);
+}
+
+/**
+ * 实例定时器：启动阶段重试连接，预热阶段检查是否就绪，失败后冷却结束时补足空闲实例
+ */
+static void backend_on_timer(void *ctx, int fd, uint32_t expirations) {
+    backend_t *backend = (backend_t *)ctx;
+    time_t now = time(NULL);
+    (void)fd;
+    (void)expirations;
+    
+    if (backend->state == BACKEND_STOPPED && backend->cooldown) {
+        backend->cooldown = 0;
+        backend_pool_adjust(backend->pool);
+        return;
+    }
+    if (backend->state != BACKEND_STARTING && backend->state != BACKEND_WARMING) {
+        return;
+    }
+    if (now - backend->started > BACKEND_START_TIMEOUT) {
+        backend_fail(backend, "启动超时");
+        return;
+    }
+    
+    if (backend->state == BACKEND_STARTING) {
+        if (backend->fd < 0) {
+            backend_try_connect(backend);
+        }
+        if (backend->state == BACKEND_STARTING) {
+            backend_arm(backend, BACKEND_RETRY_MS); // 兼顾启动超时检查
+        }
+        return;
+    }
+    
+    if (backend->heartbeat_seen && now >= backend->ready_at) {
+        backend->state = BACKEND_IDLE;
+        backend->pool->stats.ready++;
+        printf("SITL实例%d就绪 (端口%d, 用时%ld秒)\n", backend->instance, backend->port,
+               (long)(now - backend->started));
+        return;
+    }
+    backend_arm(backend, BACKEND_RETRY_MS);
+}
+
+/* 预热和空闲阶段只关心飞控心跳 */
+static void backend_on_idle_frame(const mavlink_frame_t *frame, void *ctx) {
+    backend_t *backend = (backend_t *)ctx;
+    if (frame->msgid == MAVLINK_MSG_ID_HEARTBEAT) {
+        backend->heartbeat_seen = 1;
+    }
+}
+
+/**
+ * 连接可写：发出排队的数据，发完后不再关注EPOLLOUT
+ * @return 0成功，-1连接错误（实例已按失败处理）
+ */
+static int backend_on_writable(backend_t *backend) {
+    if (txq_flush(&backend->txq, backend->fd) < 0) {
+        backend_fail(backend, "发送失败");
+        return -1;
+    }
+    if (txq_empty(&backend->txq) && backend->want_write) {
+        evloop_mod(backend->pool->loop, &backend->io, EPOLLIN);
+        backend->want_write = 0;
+    }
+    return 0;
+}
+
+/**
+ * 连接事件：可写时发出排队的数据；可读时BUSY实例交给代理转发，其余状态读出后丢弃（避免SITL发送阻塞）
+ */
+static void backend_on_io(void *ctx, int fd, uint32_t events) {
+    backend_t *backend = (backend_t *)ctx;
+    const backend_ops_t *ops = backend->pool->ops;
+    uint8_t buffer[2048];
+    
+    if ((events & EPOLLOUT) && backend_on_writable(backend) < 0) {
+        return;
+    }
+    if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+        return;
+    }
+    
+    for (;;) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (n > 0) {
+            if (backend->state == BACKEND_BUSY) {
+                ops->on_data(backend, buffer, (size_t)n);
+            } else {
+                mavlink_parser_feed(&backend->parser, buffer, (size_t)n, backend_on_idle_frame, backend);
+            }
+            continue;
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (backend->state == BACKEND_BUSY && ops->on_drained) {
+                ops->on_drained(backend);
+            }
+            return;
+        }
+        backend_fail(backend, n == 0 ? "连接断开" : "接收失败");
+        return;
+    }
+}
+
+/**
+ * 进程退出：回收进程，还在使用中的实例按失败处理，已结束的槽位可以重新启动
+ */
+static void backend_on_exit(void *ctx, int fd, uint32_t events) {
+    backend_t *backend = (backend_t *)ctx;
+    (void)fd;
+    (void)events;
+    
+    waitpid(backend->pid, NULL, WNOHANG);
+    evloop_del(backend->pool->loop, &backend->exit_src);
+    close(fd);
+    backend->pid = 0;
+    
+    if (backend->state != BACKEND_STOPPED) {
+        backend_fail(backend, "进程意外退出");
+    } else {
+        backend_pool_adjust(backend->pool);
+    }
+}
+
+/**
+ * 补足空闲实例：启动中、预热中和空闲的实例合计不少于idle_target，总数不超过本池槽数。
+ * 会话结束的实例直接结束进程，不再补回，池随需求自然收缩。
+ */
+static void backend_pool_adjust(backend_pool_t *pool) {
+    size_t counts[BACKEND_STATE_COUNT];
+    
+    backend_pool_counts(pool, counts);
+    size_t spare = counts[BACKEND_STARTING] + counts[BACKEND_WARMING] + counts[BACKEND_IDLE];
+    
+    for (size_t i = 0; i < pool->count && spare < pool->idle_target; i++) {
+        backend_t *backend = &pool->backends[i];
+        if (backend->state == BACKEND_STOPPED && backend->pid == 0 && !backend->cooldown) {
+            if (backend_spawn(backend) == 0) {
+                spare++;
+            }
+        }
+    }
+}
+
+int backend_pool_configure(void) {
+    const honeypot_config_t *config = config_get();
+    
+    g_enabled = config->sitl_bin[0] != '\0';
+    if (!g_enabled) {
+        return 0;
+    }
+    
+    if (access(config->sitl_bin, X_OK) < 0) {
+        fprintf(stderr, "SITL程序不可执行: %s\n", config->sitl_bin);
+        g_enabled = 0;
+        return -1;
+    }
+    
+    // 拆分PROXY_SITL_ARGS（空格分隔，不支持引号）
+    char *save = NULL;
+    snprintf(g_args_buf, sizeof(g_args_buf), "%s", config->sitl_args);
+    g_arg_count = 0;
+    for (char *tok = strtok_r(g_args_buf, " \t", &save); tok && g_arg_count < BACKEND_MAX_ARGS;
+         tok = strtok_r(NULL, " \t", &save)) {
+        g_args[g_arg_count++] = tok;
+    }
+    
+    printf("SITL后端池: 最多%u个实例, 保持%u个空闲, 端口%d起每实例+%d, 预热%u秒\n",
+           config->pool_max, config->pool_idle, config->sitl_port, BACKEND_PORT_STRIDE,
+           config->pool_warmup);
+    return 0;
+}
+
+int backend_pool_enabled(void) {
+    return g_enabled;
+}
+
+int backend_pool_init(backend_pool_t *pool, evloop_t *loop, const backend_ops_t *ops, void *ctx,
+                      int first_instance, size_t count, unsigned idle_target) {
+    const honeypot_config_t *config = config_get();
+    
+    memset(pool, 0, sizeof(*pool));
+    pool->loop = loop;
+    pool->ops = ops;
+    pool->ctx = ctx;
+    pool->idle_target = idle_target;
+    
+    for (size_t i = 0; i < count && i < BACKEND_MAX; i++) {
+        backend_t *backend = &pool->backends[i];
+        backend->instance = first_instance + (int)i;
+        backend->port = (uint16_t)(config->sitl_port + backend->instance * BACKEND_PORT_STRIDE);
+        backend->fd = -1;
+        backend->io.fd = -1;
+        backend->exit_src.fd = -1;
+        backend->pool = pool;
+        txq_init(&backend->txq, &pool->txq_stats);
+        if (evloop_add_timer(loop, &backend->timer, 0, backend_on_timer, backend) < 0) {
+            backend_pool_close(pool);
+            return -1;
+        }
+        pool->count++;
+    }
+    
+    backend_pool_adjust(pool);
+    return 0;
+}
+
+backend_t *backend_acquire(backend_pool_t *pool, void *owner) {
+    backend_t *found = NULL;
+    
+    for (size_t i = 0; i < pool->count; i++) {
+        if (pool->backends[i].state == BACKEND_IDLE) {
+            found = &pool->backends[i];
+            break;
+        }
+    }
+    
+    if (found) {
+        found->state = BACKEND_BUSY;
+        found->owner = owner;
+        pool->stats.acquired++;
+    } else {
+        pool->stats.misses++;
+    }
+    backend_pool_adjust(pool);
+    return found;
+}
+
+void backend_release(backend_t *backend) {
+    if (backend->state != BACKEND_BUSY) {
+        return;
+    }
+    backend_stop(backend);
+    backend->pool->stats.recycled++;
+    backend_pool_adjust(backend->pool);
+}
+
+ssize_t backend_sendv(backend_t *backend, const struct iovec *iov, const uint8_t *prio, unsigned count) {
+    if (backend->fd < 0) {
+        return -1;
+    }
+    ssize_t sent = txq_sendv(&backend->txq, backend->fd, iov, prio, count);
+    if (sent < 0) {
+        return -1;
+    }
+    
+    // 有数据排队时等连接可写再发
+    if (!txq_empty(&backend->txq) && !backend->want_write) {
+        if (evloop_mod(backend->pool->loop, &backend->io, EPOLLIN | EPOLLOUT) == 0) {
+            backend->want_write = 1;
+        }
+    }
+    return sent;
+}
+
+void backend_pool_counts(const backend_pool_t *pool, size_t counts[BACKEND_STATE_COUNT]) {
+    memset(counts, 0, sizeof(size_t) * BACKEND_STATE_COUNT);
+    for (size_t i = 0; i < pool->count; i++) {
+        counts[pool->backends[i].state]++;
+    }
+}
+
+void backend_pool_close(backend_pool_t *pool) {
+    for (size_t i = 0; i < pool->count; i++) {
+        backend_t *backend = &pool->backends[i];
+        backend_stop(backend);
+        evloop_del(pool->loop, &backend->timer);
+        if (backend->pid > 0) {
+            waitpid(backend->pid, NULL, 0);
+            backend->pid = 0;
+        }
+        if (backend->exit_src.fd >= 0) {
+            int fd = backend->exit_src.fd;
+            evloop_del(pool->loop, &backend->exit_src);
+            close(fd);
+        }
+    }
+    pool->count = 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * backend.h - SITL后端池
+ * 为每个会话分配独占的、预先启动好的SITL实例（-I n，TCP端口为基准端口+10n），
+ * 会话结束后结束该实例，按需补足空闲实例。
+ * 每个工作线程一个池，各自管理一段不重叠的实例编号，池内操作都在所属线程的事件循环中进行。
+ */
+
+#ifndef BACKEND_H
+#define BACKEND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <time.h>
+#include "mavlink.h"
+#include "txq.h"
+#include "evloop.h"
+
+#define BACKEND_MAX 64                  // 实例数上限
+#define BACKEND_POOL_MAX 8              // 默认实例数上限（PROXY_POOL_MAX）
+#define BACKEND_POOL_IDLE 2             // 默认保持的空闲实例数（PROXY_POOL_IDLE）
+#define BACKEND_POOL_WARMUP 10          // 默认预热秒数，覆盖EKF初始化和GPS定位（PROXY_POOL_WARMUP）
+#define BACKEND_POOL_DIR "./sitl/pool"  // 默认实例工作目录（PROXY_POOL_DIR）
+#define BACKEND_PORT_STRIDE 10          // 相邻实例的端口间隔（与SITL的-I约定一致）
+#define BACKEND_RETRY_MS 250            // 等待SITL监听端口时的连接重试间隔（毫秒）
+#define BACKEND_START_TIMEOUT 60        // 启动后多少秒仍未就绪视为失败
+#define BACKEND_COOLDOWN_MS 5000        // 实例失败后多久才重新启动该槽位（毫秒）
+#define BACKEND_MAX_ARGS 32             // PROXY_SITL_ARGS最多拆分的参数个数
+
+/* 实例状态 */
+typedef enum {
+    BACKEND_STOPPED = 0,            // 未运行
+    BACKEND_STARTING,               // 进程已启动，等待TCP端口可连接
+    BACKEND_WARMING,                // 已连接，等待首个心跳和预热时间
+    BACKEND_IDLE,                   // 就绪，可以分配
+    BACKEND_BUSY,                   // 已分配给会话
+    BACKEND_STATE_COUNT
+} backend_state_t;
+
+/* SITL实例 */
+typedef struct backend {
+    int instance;                   // SITL实例编号（-I）
+    uint16_t port;                  // TCP端口
+    uint8_t state;                  // backend_state_t
+    uint8_t heartbeat_seen;         // 已收到飞控心跳
+    uint8_t cooldown;               // 失败后冷却中，暂不重新启动
+    uint8_t want_write;             // 发送队列不空，连接上关注了EPOLLOUT
+    pid_t pid;                      // SITL进程号，0表示没有进程（或已回收）
+    int fd;                         // 到SITL的TCP连接，-1表示未连接
+    evloop_source_t io;             // 连接事件源
+    txq_t txq;                      // 发往SITL的发送队列（连接为非阻塞）
+    evloop_source_t timer;          // 连接重试、预热定时器
+    evloop_source_t exit_src;       // 进程退出事件（pidfd）
+    mavlink_parser_t parser;        // SITL TCP流重组解析器
+    time_t started;                 // 进程启动时间
+    time_t ready_at;                // 预热结束时间
+    void *owner;                    // 绑定的会话（BUSY时）
+    struct backend_pool *pool;      // 所属的池
+} backend_t;
+
+/* 代理侧回调 */
+typedef struct {
+    void (*on_data)(backend_t *backend, const uint8_t *data, size_t len); // BUSY实例收到数据
+    void (*on_drained)(backend_t *backend);                               // BUSY实例本轮数据已读完
+    void (*on_lost)(backend_t *backend);    // BUSY实例的进程退出或连接断开，回调后实例被回收
+} backend_ops_t;
+
+/* 后端池统计 */
+typedef struct {
+    uint64_t spawned;               // 启动的SITL进程数
+    uint64_t ready;                 // 预热完成的次数
+    uint64_t acquired;              // 分配给会话的次数
+    uint64_t misses;                // 需要实例但没有空闲实例的次数
+    uint64_t recycled;              // 会话结束后回收的实例数
+    uint64_t failures;              // 启动超时、意外退出或断开的次数
+} backend_pool_stats_t;
+
+/* 后端池 */
+typedef struct backend_pool {
+    backend_t backends[BACKEND_MAX];
+    size_t count;                   // 本池的实例槽数
+    unsigned idle_target;           // 保持的空闲实例数
+    evloop_t *loop;                 // 所属线程的事件循环
+    const backend_ops_t *ops;       // 代理侧回调
+    void *ctx;                      // 代理侧上下文（工作线程）
+    backend_pool_stats_t stats;
+    txq_stats_t txq_stats;          // 本池所有实例发送队列的合计
+} backend_pool_t;
+
+/**
+ * 读取后端池配置（PROXY_SITL_BIN、PROXY_SITL_ARGS），在创建工作线程前调用一次
+ * @return 0成功（包括未启用），-1配置无效
+ */
+int backend_pool_configure(void);
+
+/**
+ * 后端池是否启用
+ * @return 1启用，0为共享SITL模式
+ */
+int backend_pool_enabled(void);
+
+/**
+ * 初始化一个池并启动预热实例
+ * @param pool 后端池
+ * @param loop 所属线程的事件循环
+ * @param ops 代理侧回调
+ * @param ctx 代理侧上下文
+ * @param first_instance 本池第一个实例编号
+ * @param count 本池实例槽数
+ * @param idle_target 保持的空闲实例数
+ * @return 0成功，-1失败
+ */
+int backend_pool_init(backend_pool_t *pool, evloop_t *loop, const backend_ops_t *ops, void *ctx,
+                      int first_instance, size_t count, unsigned idle_target);
+
+/**
+ * 取一个空闲实例分配给会话，并按需补充空闲实例
+ * @param pool 后端池
+ * @param owner 会话
+ * @return 实例，没有空闲实例时返回NULL
+ */
+backend_t *backend_acquire(backend_pool_t *pool, void *owner);
+
+/**
+ * 会话结束，回收实例（结束进程，状态不会留给下一个会话）
+ * @param backend 实例
+ */
+void backend_release(backend_t *backend);
+
+/**
+ * 向实例发送一组数据报（非阻塞，发不完的排队，队列满时按优先级丢弃）
+ * @param backend 实例
+ * @param iov 数据报
+ * @param prio 各数据报的优先级（txq_prio_t）
+ * @param count 数据报数
+ * @return 直接写出的字节数，-1为未连接或连接错误（断开由连接事件处理）
+ */
+ssize_t backend_sendv(backend_t *backend, const struct iovec *iov, const uint8_t *prio, unsigned count);
+
+/**
+ * 统计各状态的实例数
+ * @param pool 后端池
+ * @param counts 输出，按backend_state_t下标
+ */
+void backend_pool_counts(const backend_pool_t *pool, size_t counts[BACKEND_STATE_COUNT]);
+
+/**
+ * 结束池中所有实例并等待进程退出
+ * @param pool 后端池
+ */
+void backend_pool_close(backend_pool_t *pool);
+
+#endif /* BACKEND_H */
@@ -0,0 +1,182 @@
+/*
+ * config.c - 运行时配置
+ * 环境变量与honeypot.conf / docker-compose.yml中的变量同名
+ */
+
+#include "config.h"
+#include "proxy.h"
+#include "mavlink.h"
+#include "backend.h"
+#include "decoy.h"
+#include "logger.h"
+#include "timestamp.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+static honeypot_config_t g_config;
+
+/**
+ * 读取整数型环境变量并检查范围
+ * @return 0成功（未设置时写入默认值），-1无效
+ */
+static int config_env_long(const char *name, long def, long min, long max, long *out) {
+    const char *value = getenv(name);
+    if (!value || !*value) {
+        *out = def;
+        return 0;
+    }
+    
+    char *end;
+    errno = 0;
+    long parsed = strtol(value, &end, 10);
+    if (errno != 0 || *end != '\0' || parsed < min || parsed > max) {
+        fprintf(stderr, "[配置] %s=%s 无效，取值范围%ld~%ld\n", name, value, min, max);
+        return -1;
+    }
+    
+    *out = parsed;
+    return 0;
+}
+
+static void config_env_str(const char *name, const char *def, char *out, size_t size) {
+    const char *value = getenv(name);
+    snprintf(out, size, "%s", (value && *value) ? value : def);
+}
+
+int config_load(void) {
+    long value;
+    int ret = 0;
+    
+    memset(&g_config, 0, sizeof(g_config));
+    
+    config_env_str("PROXY_SITL_HOST", PROXY_SITL_HOST, g_config.sitl_host, sizeof(g_config.sitl_host));
+    
+    ret |= config_env_long("PROXY_SITL_PORT", PROXY_INTERNAL_PORT, 1, 65535, &value);
+    g_config.sitl_port = (uint16_t)value;
+    
+    ret |= config_env_long("PROXY_PORT", PROXY_EXTERNAL_PORT, 1, 65535, &value);
+    g_config.listen_port = (uint16_t)value;
+    
+    // 至少能容纳一个最大帧
+    ret |= config_env_long("PROXY_EGRESS_MTU", PROXY_EGRESS_MTU, MAVLINK_MAX_FRAME_LEN,
+                           PROXY_MAX_EGRESS_MTU, &value);
+    g_config.egress_mtu = (size_t)value;
+    
+    ret |= config_env_long("PROXY_UDP_BATCH", PROXY_UDP_BATCH, 1, PROXY_MAX_UDP_BATCH, &value);
+    g_config.udp_batch = (unsigned)value;
+    
+    // 多个工作线程各自用SO_REUSEPORT绑定同一端口，内核按来源地址分配
+    ret |= config_env_long("PROXY_WORKERS", PROXY_WORKERS, 0, PROXY_MAX_WORKERS, &value);
+    if (value == 0) {
+        value = sysconf(_SC_NPROCESSORS_ONLN);
+        if (value < 1) {
+            value = 1;
+        } else if (value > PROXY_MAX_WORKERS) {
+            value = PROXY_MAX_WORKERS;
+        }
+    }
+    g_config.workers = (unsigned)value;
+    
+    char io[16];
+    config_env_str("PROXY_IO", "epoll", io, sizeof(io));
+    if (strcmp(io, "uring") == 0) {
+        g_config.io_uring = 1;
+    } else if (strcmp(io, "epoll") != 0) {
+        fprintf(stderr, "[配置] PROXY_IO=%s 无效，可选epoll或uring\n", io);
+        ret = -1;
+    }
+    
+    config_env_str("PROXY_SIGNING_KEYS", "", g_config.signing_keys, sizeof(g_config.signing_keys));
+    
+    // 后端池
+    config_env_str("PROXY_SITL_BIN", "", g_config.sitl_bin, sizeof(g_config.sitl_bin));
+    config_env_str("PROXY_SITL_ARGS", "", g_config.sitl_args, sizeof(g_config.sitl_args));
+    config_env_str("PROXY_POOL_DIR", BACKEND_POOL_DIR, g_config.pool_dir, sizeof(g_config.pool_dir));
+    
+    ret |= config_env_long("PROXY_POOL_MAX", BACKEND_POOL_MAX, 1, BACKEND_MAX, &value);
+    g_config.pool_max = (unsigned)value;
+    
+    ret |= config_env_long("PROXY_POOL_IDLE", BACKEND_POOL_IDLE, 0, g_config.pool_max, &value);
+    g_config.pool_idle = (unsigned)value;
+    
+    ret |= config_env_long("PROXY_POOL_WARMUP", BACKEND_POOL_WARMUP, 0, BACKEND_START_TIMEOUT / 2, &value);
+    g_config.pool_warmup = (unsigned)value;
+    
+    // 实例端口不能超出范围
+    if (g_config.sitl_bin[0] &&
+        g_config.sitl_port + (g_config.pool_max - 1) * BACKEND_PORT_STRIDE > 65535) {
+        fprintf(stderr, "[配置] PROXY_SITL_PORT=%u 加上%u个实例后端口超出范围\n",
+                g_config.sitl_port, g_config.pool_max);
+        ret = -1;
+    }
+    
+    // 日志写出
+    ret |= config_env_long("PROXY_LOG_FLUSH_MS", LOGGER_FLUSH_MS, 1, 10000, &value);
+    g_config.log_flush_ms = (unsigned)value;
+    
+    char sync[16];
+    config_env_str("PROXY_LOG_SYNC", "interval", sync, sizeof(sync));
+    if (strcmp(sync, "interval") == 0) {
+        g_config.log_sync = LOGGER_SYNC_INTERVAL;
+    } else if (strcmp(sync, "always") == 0) {
+        g_config.log_sync = LOGGER_SYNC_ALWAYS;
+    } else if (strcmp(sync, "fsync") == 0) {
+        g_config.log_sync = LOGGER_SYNC_FSYNC;
+    } else {
+        fprintf(stderr, "[配置] PROXY_LOG_SYNC=%s 无效，可选interval、always或fsync\n", sync);
+        ret = -1;
+    }
+    
+    char precision[16];
+    config_env_str("PROXY_LOG_TIME_PRECISION", "s", precision, sizeof(precision));
+    if (strcmp(precision, "s") == 0) {
+        g_config.log_time_precision = TIMESTAMP_SEC;
+    } else if (strcmp(precision, "ms") == 0) {
+        g_config.log_time_precision = TIMESTAMP_MS;
+    } else if (strcmp(precision, "us") == 0) {
+        g_config.log_time_precision = TIMESTAMP_US;
+    } else {
+        fprintf(stderr, "[配置] PROXY_LOG_TIME_PRECISION=%s 无效，可选s、ms或us\n", precision);
+        ret = -1;
+    }
+    
+    char format[16];
+    config_env_str("PROXY_LOG_FORMAT", "json", format, sizeof(format));
+    if (strcmp(format, "json") == 0) {
+        g_config.log_format = LOGGER_FORMAT_JSON;
+    } else if (strcmp(format, "binary") == 0) {
+        g_config.log_format = LOGGER_FORMAT_BINARY;
+    } else {
+        fprintf(stderr, "[配置] PROXY_LOG_FORMAT=%s 无效，可选json或binary\n", format);
+        ret = -1;
+    }
+    
+    // 日志轮转和归档
+    ret |= config_env_long("PROXY_LOG_ROTATE_MB", LOGGER_ROTATE_MB, 0, 1024 * 1024, &value);
+    g_config.log_rotate_mb = (unsigned)value;
+    ret |= config_env_long("PROXY_LOG_COMPRESS_LEVEL", LOGGER_COMPRESS_LEVEL, 0, 9, &value);
+    g_config.log_compress_level = (int)value;
+    ret |= config_env_long("PROXY_LOG_RETENTION_DAYS", 0, 0, 36500, &value);
+    g_config.log_retention_days = (unsigned)value;
+    ret |= config_env_long("PROXY_LOG_QUOTA_MB", 0, 0, 1024 * 1024 * 1024, &value);
+    g_config.log_quota_mb = (unsigned)value;
+    if (g_config.log_quota_mb > 0 &&
+        (g_config.log_rotate_mb == 0 || g_config.log_rotate_mb > g_config.log_quota_mb / 2)) {
+        fprintf(stderr, "[配置] 警告: PROXY_LOG_ROTATE_MB最好不超过PROXY_LOG_QUOTA_MB的一半，否则正在写的文件可能单独超出配额\n");
+    }
+    
+    // 诱饵端口
+    config_env_str("PROXY_DECOYS", "", g_config.decoys, sizeof(g_config.decoys));
+    if (decoy_validate(g_config.decoys) < 0) {
+        ret = -1;
+    }
+    
+    return ret ? -1 : 0;
+}
+
+const honeypot_config_t *config_get(void) {
+    return &g_config;
+}
@@ -5,6 +5,9 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 /* 网络配置 */
 #define UDP_PORT 14550              // 对外监听端口 (QGC连接)
 #define SITL_PORT 5760              // SITL 连接端口
@@ -14,5 +17,44 @@
 #define LOG_DIR "./logs"            // 日志目录
 #define LOG_FILE_PREFIX "drone_honeypot" // 日志文件前缀
 
+/* 运行时配置（默认值来自上面的宏和proxy.h，可由环境变量覆盖） */
+typedef struct {
+    char sitl_host[64];             // PROXY_SITL_HOST  SITL地址
+    uint16_t sitl_port;             // PROXY_SITL_PORT  SITL TCP端口
+    uint16_t listen_port;           // PROXY_PORT       对外UDP端口
+    size_t egress_mtu;              // PROXY_EGRESS_MTU 发往客户端的单个数据报上限
+    unsigned udp_batch;             // PROXY_UDP_BATCH  每次系统调用收发的数据报数上限
+    unsigned workers;               // PROXY_WORKERS    工作线程数（0表示按CPU核数）
+    int io_uring;                   // PROXY_IO         客户端数据路径：epoll（默认）或uring
+    char signing_keys[256];         // PROXY_SIGNING_KEYS v2签名密钥文件（空表示只识别不校验）
+    char sitl_bin[256];             // PROXY_SITL_BIN   SITL程序路径（设置后启用后端池，每个会话独占一个实例）
+    char sitl_args[512];            // PROXY_SITL_ARGS  SITL启动参数（空格分隔，-I由代理追加）
+    char pool_dir[256];             // PROXY_POOL_DIR   实例工作目录
+    unsigned pool_idle;             // PROXY_POOL_IDLE  保持预热的空闲实例数
+    unsigned pool_max;              // PROXY_POOL_MAX   实例数上限
+    unsigned pool_warmup;           // PROXY_POOL_WARMUP 连接SITL后的预热秒数
+    unsigned log_flush_ms;          // PROXY_LOG_FLUSH_MS 日志写出间隔（毫秒）
+    int log_sync;                   // PROXY_LOG_SYNC   日志写出策略：interval（默认）、always或fsync
+    int log_time_precision;         // PROXY_LOG_TIME_PRECISION 日志时间精度：s（默认）、ms或us
+    int log_format;                 // PROXY_LOG_FORMAT 日志文件格式：json（默认）或binary
+    unsigned log_rotate_mb;         // PROXY_LOG_ROTATE_MB 日志文件超过多少MB时轮转（0表示只按日期）
+    int log_compress_level;         // PROXY_LOG_COMPRESS_LEVEL 轮转出的段的gzip级别（0表示不压缩）
+    unsigned log_retention_days;    // PROXY_LOG_RETENTION_DAYS 日志保留天数（0表示不限）
+    unsigned log_quota_mb;          // PROXY_LOG_QUOTA_MB 日志总量上限（0表示不限）
+    char decoys[4096];              // PROXY_DECOYS     诱饵端口表（如udp:14551:mavlink,tcp:554:rtsp，空表示不开启）
+} honeypot_config_t;
+
+/**
+ * 从环境变量加载配置，未设置的项使用默认值
+ * @return 0成功，-1存在无效配置
+ */
+int config_load(void);
+
+/**
+ * 获取当前配置
+ * @return 配置指针
+ */
+const honeypot_config_t *config_get(void);
+
 #endif /* CONFIG_H */
 
@@ -0,0 +1,644 @@
+/*
+ * decoy.c - 诱饵端口
+ */
+
+#include "decoy.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <arpa/inet.h>
+
+#define DECOY_RECV_MAX 2048             // 单次接收缓冲区
+#define DECOY_RECV_BURST 64             // 每次可读事件最多处理的UDP数据报数（其余留给下一轮）
+#define DECOY_SERVER "Hipcam RealServer/V1.0" // RTSP应答的Server头（常见的IP摄像头固件）
+
+static const char *g_service_names[DECOY_SVC_COUNT] = { "mavlink", "rtsp", "http", "telnet", "raw" };
+
+static const char g_http_body[] =
+    "<html><head><title>FPV Camera</title></head><body>"
+    "<form method=\"post\" action=\"/login.cgi\">"
+    "用户名 <input name=\"username\"> 密码 <input type=\"password\" name=\"password\">"
+    "<input type=\"submit\" value=\"登录\"></form></body></html>";
+
+const char *decoy_service_name(uint8_t service) {
+    return service < DECOY_SVC_COUNT ? g_service_names[service] : "unknown";
+}
+
+/* 一条端口表项：协议、端口范围和服务 */
+typedef struct {
+    uint8_t proto;
+    uint8_t service;
+    uint16_t first;
+    uint16_t last;
+} decoy_entry_t;
+
+/**
+ * 解析一条“协议:端口[-端口]:服务”
+ * @return 0成功，-1无效（已打印原因）
+ */
+static int decoy_parse_entry(char *item, decoy_entry_t *entry) {
+    char *proto = item;
+    char *ports = strchr(proto, ':');
+    char *service = ports ? strchr(ports + 1, ':') : NULL;
+    char *end;
+    
+    if (!service) {
+        fprintf(stderr, "[配置] 诱饵端口 %s 格式无效，应为 协议:端口[-端口]:服务\n", item);
+        return -1;
+    }
+    *ports++ = '\0';
+    *service++ = '\0';
+    
+    if (strcasecmp(proto, "udp") == 0) {
+        entry->proto = DECOY_PROTO_UDP;
+    } else if (strcasecmp(proto, "tcp") == 0) {
+        entry->proto = DECOY_PROTO_TCP;
+    } else {
+        fprintf(stderr, "[配置] 诱饵端口协议 %s 无效，可选udp或tcp\n", proto);
+        return -1;
+    }
+    
+    long first = strtol(ports, &end, 10);
+    long last = first;
+    if (*end == '-') {
+        last = strtol(end + 1, &end, 10);
+    }
+    if (*end != '\0' || first < 1 || last > 65535 || first > last) {
+        fprintf(stderr, "[配置] 诱饵端口 %s 无效，取值范围1~65535\n", ports);
+        return -1;
+    }
+    entry->first = (uint16_t)first;
+    entry->last = (uint16_t)last;
+    
+    entry->service = DECOY_SVC_COUNT;
+    for (uint8_t i = 0; i < DECOY_SVC_COUNT; i++) {
+        if (strcasecmp(service, g_service_names[i]) == 0) {
+            entry->service = i;
+        }
+    }
+    if (entry->service == DECOY_SVC_COUNT) {
+        fprintf(stderr, "[配置] 诱饵端口服务 %s 无效，可选mavlink、rtsp、http、telnet、raw\n", service);
+        return -1;
+    }
+    // 请求-应答式的服务只有TCP
+    if (entry->proto == DECOY_PROTO_UDP && entry->service != DECOY_SVC_MAVLINK && entry->service != DECOY_SVC_RAW) {
+        fprintf(stderr, "[配置] 诱饵端口服务 %s 只能用于TCP\n", service);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * 逐条解析端口表
+ * @param spec 端口表
+ * @param entries 输出（可为NULL，只检查格式）
+ * @param max 输出上限
+ * @return 表项数，-1为格式错误或端口总数超过上限
+ */
+static int decoy_parse(const char *spec, decoy_entry_t *entries, size_t max) {
+    char *copy = strdup(spec);
+    char *saveptr = NULL;
+    size_t ports = 0;
+    int count = 0;
+    
+    if (!copy) {
+        return -1;
+    }
+    for (char *item = strtok_r(copy, ", ", &saveptr); item; item = strtok_r(NULL, ", ", &saveptr)) {
+        decoy_entry_t entry;
+        if (decoy_parse_entry(item, &entry) < 0) {
+            free(copy);
+            return -1;
+        }
+        ports += (size_t)(entry.last - entry.first) + 1;
+        if (ports > DECOY_MAX_LISTENERS) {
+            fprintf(stderr, "[配置] 诱饵端口超过%d个\n", DECOY_MAX_LISTENERS);
+            free(copy);
+            return -1;
+        }
+        if (entries && (size_t)count < max) {
+            entries[count] = entry;
+        }
+        count++;
+    }
+    free(copy);
+    return count;
+}
+
+int decoy_validate(const char *spec) {
+    return decoy_parse(spec, NULL, 0) < 0 ? -1 : 0;
+}
+
+/* 填写客户端信息（日志直接使用） */
+static void decoy_client_info(client_info_t *client, const struct sockaddr_in *addr, socklen_t addr_len,
+                              uint16_t local_port) {
+    memset(client, 0, sizeof(*client));
+    memcpy(&client->addr, addr, sizeof(*addr));
+    client->addr_len = addr_len;
+    inet_ntop(AF_INET, &addr->sin_addr, client->ip_str, sizeof(client->ip_str));
+    client->port = ntohs(addr->sin_port);
+    client->local_port = local_port;
+}
+
+static const char *decoy_proto_name(uint8_t proto) {
+    return proto == DECOY_PROTO_TCP ? "TCP" : "UDP";
+}
+
+/* ---------- TCP连接 ---------- */
+
+static void decoy_conn_on_io(void *ctx, int fd, uint32_t events);
+
+/* 记录一次探测（每个连接至少一条：有请求时按请求记录，没有数据的连接在关闭时记录） */
+static void decoy_conn_log(decoy_conn_t *conn, const uint8_t *data, size_t len) {
+    logger_probe(&conn->client, "TCP", decoy_service_name(conn->listener->service), data, len);
+    conn->logged = 1;
+}
+
+/* 发出固定应答（很短，写不下的部分直接放弃） */
+static void decoy_conn_reply(decoy_conn_t *conn, const char *text, size_t len) {
+    if (send(conn->src.fd, text, len, MSG_DONTWAIT | MSG_NOSIGNAL) > 0) {
+        conn->listener->engine->stats.replies++;
+    }
+    conn->replies++;
+}
+
+void decoy_conn_close(decoy_conn_t *conn) {
+    decoy_engine_t *engine = conn->listener->engine;
+    
+    if (conn->src.fd < 0) {
+        return;
+    }
+    if (conn->listener->service != DECOY_SVC_MAVLINK && !conn->logged) {
+        decoy_conn_log(conn, conn->request, conn->request_len);
+    }
+    // 先通知代理解除会话，此时连接仍可用
+    if (conn->owner && engine->ops && engine->ops->on_stream_closed) {
+        engine->ops->on_stream_closed(engine->ctx, conn);
+    }
+    
+    int fd = conn->src.fd;
+    evloop_del(engine->loop, &conn->src);
+    close(fd);
+    if (conn->txq) {
+        txq_clear(conn->txq);
+        free(conn->txq);
+        conn->txq = NULL;
+    }
+    conn->owner = NULL;
+    
+    // 最后一个连接移到空出的位置
+    decoy_conn_t *last = engine->conns[--engine->conn_count];
+    engine->conns[conn->index] = last;
+    last->index = conn->index;
+    engine->free_slots[engine->free_count++] = conn;
+}
+
+void decoy_conn_sendv(decoy_conn_t *conn, const struct iovec *iov, unsigned count) {
+    decoy_engine_t *engine = conn->listener->engine;
+    uint8_t prio[TXQ_WRITEV_MAX];
+    
+    if (conn->src.fd < 0 || !conn->txq) {
+        return;
+    }
+    memset(prio, TXQ_PRIO_NORMAL, sizeof(prio));
+    
+    while (count > 0) {
+        unsigned n = count < TXQ_WRITEV_MAX ? count : TXQ_WRITEV_MAX;
+        uint64_t dropped = engine->txq_stats.dropped[TXQ_PRIO_NORMAL];
+        if (txq_sendv(conn->txq, conn->src.fd, iov, prio, n) < 0) {
+            txq_clear(conn->txq); // 连接已出错，事件循环随后报告并关闭
+            return;
+        }
+        engine->stats.stream_drops += engine->txq_stats.dropped[TXQ_PRIO_NORMAL] - dropped;
+        iov += n;
+        count -= n;
+    }
+    if (!txq_empty(conn->txq) && !conn->want_write &&
+        evloop_mod(engine->loop, &conn->src, EPOLLIN | EPOLLOUT) == 0) {
+        conn->want_write = 1;
+    }
+}
+
+/**
+ * 在请求中查找头字段（不区分大小写），值复制到out
+ * @return 1找到，0没有
+ */
+static int decoy_find_header(const char *request, const char *name, char *out, size_t size) {
+    size_t name_len = strlen(name);
+    
+    for (const char *line = strstr(request, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, name, name_len) == 0 && line[2 + name_len] == ':') {
+            const char *value = line + 3 + name_len;
+            size_t len = 0;
+            while (*value == ' ') {
+                value++;
+            }
+            while (value[len] && value[len] != '\r' && len + 1 < size) {
+                len++;
+            }
+            memcpy(out, value, len);
+            out[len] = '\0';
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* RTSP：OPTIONS如实列出方法，其余一律要求认证（认证信息记录在探测日志中） */
+static void decoy_reply_rtsp(decoy_conn_t *conn, const char *request) {
+    char cseq[16] = "1";
+    char reply[512];
+    int len;
+    
+    if (!strstr(request, "RTSP/1.0")) {
+        len = snprintf(reply, sizeof(reply), "RTSP/1.0 400 Bad Request\r\nServer: %s\r\n\r\n", DECOY_SERVER);
+        decoy_conn_reply(conn, reply, (size_t)len);
+        decoy_conn_close(conn);
+        return;
+    }
+    decoy_find_header(request, "CSeq", cseq, sizeof(cseq));
+    if (strncmp(request, "OPTIONS ", 8) == 0) {
+        len = snprintf(reply, sizeof(reply),
+                       "RTSP/1.0 200 OK\r\nCSeq: %s\r\nServer: %s\r\n"
+                       "Public: OPTIONS, DESCRIBE, SETUP, TEARDOWN, PLAY, PAUSE, GET_PARAMETER, SET_PARAMETER\r\n\r\n",
+                       cseq, DECOY_SERVER);
+    } else {
+        len = snprintf(reply, sizeof(reply),
+                       "RTSP/1.0 401 Unauthorized\r\nCSeq: %s\r\nServer: %s\r\n"
+                       "WWW-Authenticate: Basic realm=\"IPCamera\"\r\n\r\n",
+                       cseq, DECOY_SERVER);
+    }
+    decoy_conn_reply(conn, reply, (size_t)len);
+}
+
+/* HTTP：返回登录页后关闭 */
+static void decoy_reply_http(decoy_conn_t *conn) {
+    char reply[1024];
+    int len = snprintf(reply, sizeof(reply),
+                       "HTTP/1.1 200 OK\r\nServer: lighttpd/1.4.35\r\nContent-Type: text/html; charset=utf-8\r\n"
+                       "Content-Length: %zu\r\nConnection: close\r\n\r\n%s",
+                       sizeof(g_http_body) - 1, g_http_body);
+    decoy_conn_reply(conn, reply, (size_t)len);
+    decoy_conn_close(conn);
+}
+
+/* telnet：用户名和密码交替提示，永远登录失败 */
+static void decoy_reply_telnet(decoy_conn_t *conn) {
+    static const char password[] = "Password: ";
+    static const char failed[] = "\r\nLogin incorrect\r\nlogin: ";
+    
+    if (conn->replies % 2 == 1) {
+        decoy_conn_reply(conn, password, sizeof(password) - 1);
+    } else {
+        decoy_conn_reply(conn, failed, sizeof(failed) - 1);
+    }
+}
+
+/**
+ * 处理缓存的请求：按服务的请求边界（RTSP/HTTP为空行，telnet为换行）逐个记录并应答
+ * 缓存满仍不完整时记录后关闭
+ */
+static void decoy_conn_process(decoy_conn_t *conn) {
+    uint8_t service = conn->listener->service;
+    const char *terminator = service == DECOY_SVC_TELNET ? "\n" : "\r\n\r\n";
+    
+    while (conn->src.fd >= 0 && conn->request_len > 0) {
+        if (service == DECOY_SVC_RAW) {
+            // 只记录每个连接的首段数据
+            if (!conn->logged) {
+                decoy_conn_log(conn, conn->request, conn->request_len);
+            }
+            conn->request_len = 0;
+            return;
+        }
+        
+        conn->request[conn->request_len] = '\0';
+        char *end = strstr((char *)conn->request, terminator);
+        if (!end) {
+            if (conn->request_len == DECOY_REQUEST_MAX - 1) {
+                decoy_conn_log(conn, conn->request, conn->request_len);
+                decoy_conn_close(conn);
+            }
+            return;
+        }
+        size_t len = (size_t)(end - (char *)conn->request) + strlen(terminator);
+        decoy_conn_log(conn, conn->request, len);
+        
+        switch (service) {
+            case DECOY_SVC_RTSP:
+                decoy_reply_rtsp(conn, (const char *)conn->request);
+                break;
+            case DECOY_SVC_HTTP:
+                decoy_reply_http(conn);
+                break;
+            default:
+                decoy_reply_telnet(conn);
+                break;
+        }
+        if (conn->src.fd < 0) {
+            return;
+        }
+        memmove(conn->request, conn->request + len, conn->request_len - len);
+        conn->request_len -= len;
+    }
+}
+
+static void decoy_conn_on_io(void *ctx, int fd, uint32_t events) {
+    decoy_conn_t *conn = (decoy_conn_t *)ctx;
+    decoy_engine_t *engine = conn->listener->engine;
+    uint8_t buffer[DECOY_RECV_MAX];
+    
+    if (events & EPOLLOUT) {
+        if (txq_flush(conn->txq, fd) < 0) {
+            decoy_conn_close(conn);
+            return;
+        }
+        if (txq_empty(conn->txq) && evloop_mod(engine->loop, &conn->src, EPOLLIN) == 0) {
+            conn->want_write = 0;
+        }
+        if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+            return;
+        }
+    }
+    
+    for (;;) {
+        ssize_t n;
+        if (conn->listener->service == DECOY_SVC_MAVLINK) {
+            n = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        } else {
+            // 请求直接读进缓存，留一个字节放结尾的'\0'
+            size_t room = DECOY_REQUEST_MAX - 1 - conn->request_len;
+            n = recv(fd, conn->request + conn->request_len, room, MSG_DONTWAIT);
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        }
+        if (n <= 0) {
+            decoy_conn_close(conn);
+            return;
+        }
+        
+        conn->bytes_in += (size_t)n;
+        conn->last_active = time(NULL);
+        if (conn->listener->service == DECOY_SVC_MAVLINK) {
+            engine->ops->on_stream(engine->ctx, conn, buffer, (size_t)n);
+        } else {
+            conn->request_len += (size_t)n;
+            decoy_conn_process(conn);
+        }
+        if (conn->src.fd < 0) {
+            return;
+        }
+    }
+}
+
+/* 连接数满时关闭最久没有数据的连接 */
+static void decoy_evict_oldest(decoy_engine_t *engine) {
+    decoy_conn_t *oldest = engine->conns[0];
+    
+    for (size_t i = 1; i < engine->conn_count; i++) {
+        if (engine->conns[i]->last_active < oldest->last_active) {
+            oldest = engine->conns[i];
+        }
+    }
+    engine->stats.evicted++;
+    decoy_conn_close(oldest);
+}
+
+static void decoy_accept(decoy_listener_t *listener, int fd, const struct sockaddr_in *addr, socklen_t addr_len) {
+    decoy_engine_t *engine = listener->engine;
+    
+    if (engine->free_count == 0) {
+        decoy_evict_oldest(engine);
+    }
+    decoy_conn_t *conn = engine->free_slots[--engine->free_count];
+    
+    memset(conn, 0, sizeof(*conn));
+    conn->listener = listener;
+    conn->src.fd = -1;
+    conn->opened = time(NULL);
+    conn->last_active = conn->opened;
+    decoy_client_info(&conn->client, addr, addr_len, listener->port);
+    
+    if (listener->service == DECOY_SVC_MAVLINK) {
+        conn->txq = malloc(sizeof(*conn->txq));
+        if (!conn->txq) {
+            close(fd);
+            engine->free_slots[engine->free_count++] = conn;
+            return;
+        }
+        txq_init(conn->txq, &engine->txq_stats);
+    }
+    if (evloop_add(engine->loop, &conn->src, fd, EPOLLIN, decoy_conn_on_io, conn) < 0) {
+        free(conn->txq);
+        conn->txq = NULL;
+        close(fd);
+        engine->free_slots[engine->free_count++] = conn;
+        return;
+    }
+    conn->index = (uint16_t)engine->conn_count;
+    engine->conns[engine->conn_count++] = conn;
+    listener->probes++;
+    
+    if (listener->service == DECOY_SVC_MAVLINK) {
+        engine->stats.mavlink_conns++;
+        printf("TCP MAVLink连接: %s:%d (端口%u)\n", conn->client.ip_str, conn->client.port, listener->port);
+    } else {
+        engine->stats.tcp_probes++;
+        if (listener->service == DECOY_SVC_TELNET) {
+            static const char banner[] = "\r\nUbuntu 18.04.6 LTS\r\nlogin: ";
+            decoy_conn_reply(conn, banner, sizeof(banner) - 1);
+        }
+    }
+}
+
+/* ---------- 监听端口 ---------- */
+
+static void decoy_on_tcp_listener(void *ctx, int fd, uint32_t events) {
+    decoy_listener_t *listener = (decoy_listener_t *)ctx;
+    (void)events;
+    
+    for (;;) {
+        struct sockaddr_in addr;
+        socklen_t addr_len = sizeof(addr);
+        int conn_fd = accept4(fd, (struct sockaddr *)&addr, &addr_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (conn_fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return; // EAGAIN，或描述符耗尽（留到下一次可读再试）
+        }
+        decoy_accept(listener, conn_fd, &addr, addr_len);
+    }
+}
+
+static void decoy_on_udp_listener(void *ctx, int fd, uint32_t events) {
+    decoy_listener_t *listener = (decoy_listener_t *)ctx;
+    decoy_engine_t *engine = listener->engine;
+    uint8_t buffer[DECOY_RECV_MAX];
+    (void)events;
+    
+    for (int i = 0; i < DECOY_RECV_BURST; i++) {
+        struct sockaddr_in addr;
+        socklen_t addr_len = sizeof(addr);
+        ssize_t n = recvfrom(fd, buffer, sizeof(buffer), MSG_DONTWAIT, (struct sockaddr *)&addr, &addr_len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        listener->probes++;
+        
+        if (listener->service == DECOY_SVC_MAVLINK) {
+            engine->stats.mavlink_datagrams++;
+            engine->ops->on_datagram(engine->ctx, listener, buffer, (size_t)n, &addr, addr_len);
+        } else {
+            client_info_t client;
+            decoy_client_info(&client, &addr, addr_len, listener->port);
+            engine->stats.udp_probes++;
+            logger_probe(&client, "UDP", decoy_service_name(listener->service), buffer, (size_t)n);
+        }
+    }
+}
+
+/* 关闭空闲连接 */
+static void decoy_on_sweep(void *ctx, int fd, uint32_t expirations) {
+    decoy_engine_t *engine = (decoy_engine_t *)ctx;
+    time_t now = time(NULL);
+    size_t i = 0;
+    (void)fd;
+    (void)expirations;
+    
+    while (i < engine->conn_count) {
+        decoy_conn_t *conn = engine->conns[i];
+        time_t timeout = conn->listener->service == DECOY_SVC_MAVLINK ? DECOY_MAVLINK_IDLE_TIMEOUT
+                                                                        : DECOY_CONN_IDLE_TIMEOUT;
+        if (now - conn->last_active >= timeout) {
+            decoy_conn_close(conn); // 最后一个连接移到位置i，不前进
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * 打开一个监听端口
+ * @return 0成功，-1失败（已打印原因）
+ */
+static int decoy_listen(decoy_engine_t *engine, decoy_listener_t *listener) {
+    int type = listener->proto == DECOY_PROTO_TCP ? SOCK_STREAM : SOCK_DGRAM;
+    int fd = socket(AF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int opt = 1;
+    struct sockaddr_in addr;
+    
+    if (fd < 0) {
+        perror("诱饵端口socket创建失败");
+        return -1;
+    }
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = INADDR_ANY;
+    addr.sin_port = htons(listener->port);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        (type == SOCK_STREAM && listen(fd, SOMAXCONN) < 0)) {
+        fprintf(stderr, "诱饵端口 %s/%u 打开失败: %s，跳过\n", decoy_proto_name(listener->proto), listener->port,
+                strerror(errno));
+        close(fd);
+        return -1;
+    }
+    
+    evloop_cb_t cb = type == SOCK_STREAM ? decoy_on_tcp_listener : decoy_on_udp_listener;
+    if (evloop_add(engine->loop, &listener->src, fd, EPOLLIN, cb, listener) < 0) {
+        close(fd);
+        return -1;
+    }
+    return 0;
+}
+
+int decoy_init(decoy_engine_t *engine, evloop_t *loop, const char *spec, uint16_t skip_udp_port,
+               const decoy_ops_t *ops, void *ctx) {
+    decoy_entry_t entries[DECOY_MAX_LISTENERS];
+    int has_tcp = 0;
+    
+    memset(engine, 0, sizeof(*engine));
+    engine->loop = loop;
+    engine->ops = ops;
+    engine->ctx = ctx;
+    engine->sweep_timer.fd = -1;
+    
+    int entry_count = decoy_parse(spec, entries, DECOY_MAX_LISTENERS);
+    if (entry_count <= 0) {
+        return entry_count;
+    }
+    
+    engine->listeners = calloc(DECOY_MAX_LISTENERS, sizeof(*engine->listeners));
+    engine->slots = calloc(DECOY_MAX_CONNS, sizeof(*engine->slots));
+    if (!engine->listeners || !engine->slots) {
+        perror("分配诱饵端口失败");
+        decoy_close(engine);
+        return -1;
+    }
+    for (size_t i = 0; i < DECOY_MAX_CONNS; i++) {
+        engine->slots[i].src.fd = -1;
+        engine->free_slots[engine->free_count++] = &engine->slots[DECOY_MAX_CONNS - 1 - i];
+    }
+    
+    for (int e = 0; e < entry_count; e++) {
+        for (uint32_t port = entries[e].first; port <= entries[e].last; port++) {
+            if (entries[e].proto == DECOY_PROTO_UDP && port == skip_udp_port) {
+                fprintf(stderr, "诱饵端口 UDP/%u 与代理主端口相同，跳过\n", skip_udp_port);
+                continue;
+            }
+            decoy_listener_t *listener = &engine->listeners[engine->count];
+            listener->engine = engine;
+            listener->port = (uint16_t)port;
+            listener->proto = entries[e].proto;
+            listener->service = entries[e].service;
+            if (decoy_listen(engine, listener) == 0) {
+                engine->count++;
+                has_tcp |= listener->proto == DECOY_PROTO_TCP;
+            }
+        }
+    }
+    
+    // 只有TCP连接需要检查空闲
+    if (has_tcp && evloop_add_timer(loop, &engine->sweep_timer, DECOY_SWEEP_MS, decoy_on_sweep, engine) < 0) {
+        decoy_close(engine);
+        return -1;
+    }
+    return (int)engine->count;
+}
+
+void decoy_close(decoy_engine_t *engine) {
+    if (!engine->loop) {
+        return; // 没有初始化
+    }
+    while (engine->conn_count > 0) {
+        decoy_conn_close(engine->conns[engine->conn_count - 1]);
+    }
+    evloop_del(engine->loop, &engine->sweep_timer);
+    for (size_t i = 0; i < engine->count; i++) {
+        int fd = engine->listeners[i].src.fd;
+        if (fd >= 0) {
+            evloop_del(engine->loop, &engine->listeners[i].src);
+            close(fd);
+        }
+    }
+    engine->count = 0;
+    free(engine->listeners);
+    free(engine->slots);
+    engine->listeners = NULL;
+    engine->slots = NULL;
+    engine->loop = NULL;
+}
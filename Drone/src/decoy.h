@@ -0,0 +1,169 @@
+/*
+ * decoy.h - 诱饵端口
+ * 真实无人机除了MAVLink遥测端口，还开放TCP 5760/5763、RTSP视频、HTTP管理页等端口。
+ * 这里在同一个事件循环里挂一张监听表（UDP和TCP，每个端口标注服务类型）：
+ * MAVLink端口交给代理转发路径，其他端口用固定的应答打发，每次探测都记录日志。
+ * 空闲端口只占一个描述符和一个epoll注册，没有定时器和缓冲区，几百个端口也几乎没有开销。
+ */
+
+#ifndef DECOY_H
+#define DECOY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#include <netinet/in.h>
+#include "evloop.h"
+#include "logger.h"
+#include "txq.h"
+
+#define DECOY_MAX_LISTENERS 1024        // 监听端口上限
+#define DECOY_MAX_CONNS 256             // 同时存在的TCP连接上限（满时关闭最旧的）
+#define DECOY_CONN_IDLE_TIMEOUT 30      // 非MAVLink的TCP连接无数据多少秒后关闭
+#define DECOY_MAVLINK_IDLE_TIMEOUT 120  // MAVLink的TCP连接无数据多少秒后关闭
+#define DECOY_REQUEST_MAX 1024          // 应答前缓存的请求字节数上限（只用于识别请求和记录）
+#define DECOY_SWEEP_MS 1000             // 空闲连接检查周期（毫秒）
+
+/* 传输协议 */
+typedef enum {
+    DECOY_PROTO_UDP = 0,
+    DECOY_PROTO_TCP
+} decoy_proto_t;
+
+/* 服务类型 */
+typedef enum {
+    DECOY_SVC_MAVLINK = 0,          // MAVLink遥测：交给代理转发路径
+    DECOY_SVC_RTSP,                 // 视频流（RTSP）：应答OPTIONS，其余要求认证
+    DECOY_SVC_HTTP,                 // 摄像头/飞控管理页（HTTP）：返回登录页
+    DECOY_SVC_TELNET,               // 调试终端：发出登录提示
+    DECOY_SVC_RAW,                  // 只记录不应答（RTP视频、数传电台等）
+    DECOY_SVC_COUNT
+} decoy_service_t;
+
+struct decoy_engine;
+
+/* 监听端口 */
+typedef struct decoy_listener {
+    struct decoy_engine *engine;
+    evloop_source_t src;
+    uint16_t port;
+    uint8_t proto;                  // decoy_proto_t
+    uint8_t service;                // decoy_service_t
+    uint64_t probes;                // UDP为数据报数，TCP为连接数
+} decoy_listener_t;
+
+/* TCP连接 */
+typedef struct decoy_conn {
+    decoy_listener_t *listener;
+    evloop_source_t src;
+    client_info_t client;
+    time_t opened;
+    time_t last_active;
+    size_t bytes_in;
+    uint8_t request[DECOY_REQUEST_MAX]; // 应答前收到的请求（非MAVLink服务）
+    size_t request_len;
+    int logged;                     // 已记录探测日志
+    int want_write;                 // 关注了EPOLLOUT（MAVLink连接的发送队列不空）
+    txq_t *txq;                     // MAVLink连接发往客户端的发送队列（其他服务为NULL）
+    void *owner;                    // MAVLink连接对应的会话（由代理设置）
+    uint16_t index;                 // 在conns[]中的位置
+    uint8_t replies;                // 已发出的应答数（telnet按此交替提示）
+} decoy_conn_t;
+
+/* MAVLink端口的回调（在事件循环线程中调用） */
+typedef struct {
+    /**
+     * UDP MAVLink数据报
+     * @param ctx 上下文
+     * @param listener 收到数据报的端口（应答需从listener->src.fd发出）
+     */
+    void (*on_datagram)(void *ctx, decoy_listener_t *listener, const uint8_t *data, size_t len,
+                        const struct sockaddr_in *addr, socklen_t addr_len);
+    /**
+     * TCP MAVLink连接上的数据（字节流，帧可能跨越多次调用）
+     */
+    void (*on_stream)(void *ctx, decoy_conn_t *conn, const uint8_t *data, size_t len);
+    /**
+     * TCP MAVLink连接关闭（对端关闭、出错或空闲超时），之后conn不再有效
+     */
+    void (*on_stream_closed)(void *ctx, decoy_conn_t *conn);
+} decoy_ops_t;
+
+/* 统计 */
+typedef struct {
+    uint64_t udp_probes;            // 非MAVLink端口收到的UDP数据报数
+    uint64_t tcp_probes;            // 接受的TCP连接数
+    uint64_t replies;               // 发出的固定应答数
+    uint64_t mavlink_datagrams;     // MAVLink端口转交代理的UDP数据报数
+    uint64_t mavlink_conns;         // MAVLink端口的TCP连接数
+    uint64_t evicted;               // 连接数满时关闭的最旧连接数
+    uint64_t stream_drops;          // MAVLink连接发送队列满时丢弃的数据报数
+} decoy_stats_t;
+
+/* 诱饵端口引擎 */
+typedef struct decoy_engine {
+    evloop_t *loop;
+    const decoy_ops_t *ops;
+    void *ctx;
+    decoy_listener_t *listeners;
+    size_t count;
+    decoy_conn_t *slots;            // 连接槽（预先分配，关闭后留到同一批事件处理完也不会失效）
+    decoy_conn_t *conns[DECOY_MAX_CONNS]; // 活跃连接（紧凑数组）
+    size_t conn_count;
+    decoy_conn_t *free_slots[DECOY_MAX_CONNS];
+    size_t free_count;
+    evloop_source_t sweep_timer;
+    txq_stats_t txq_stats;          // MAVLink连接的发送队列统计
+    decoy_stats_t stats;
+} decoy_engine_t;
+
+/**
+ * 解析端口表并打开监听（某个端口打开失败只打印警告并跳过）
+ * 格式：逗号分隔的“协议:端口[-端口]:服务”，如 udp:14550:mavlink,tcp:5760:mavlink,tcp:554:rtsp,tcp:8000-8100:http
+ * @param engine 引擎
+ * @param loop 事件循环
+ * @param spec 端口表（空串表示不开启）
+ * @param skip_udp_port 代理主端口，UDP不能重复监听（0表示不检查）
+ * @param ops MAVLink端口的回调
+ * @param ctx 回调上下文
+ * @return 打开的端口数，-1为端口表格式错误
+ */
+int decoy_init(decoy_engine_t *engine, evloop_t *loop, const char *spec, uint16_t skip_udp_port,
+               const decoy_ops_t *ops, void *ctx);
+
+/**
+ * 检查端口表格式（加载配置时调用，不打开端口）
+ * @param spec 端口表
+ * @return 0有效，-1无效（已打印原因）
+ */
+int decoy_validate(const char *spec);
+
+/**
+ * 向TCP MAVLink连接写出一组数据报（不阻塞，写不下的进入连接的发送队列，满时丢弃）
+ * 出错时不在这里关闭连接（调用者可能正在使用连接对应的会话），由事件循环报告错误后关闭
+ * @param conn 连接
+ * @param iov 数据报
+ * @param count 数据报数
+ */
+void decoy_conn_sendv(decoy_conn_t *conn, const struct iovec *iov, unsigned count);
+
+/**
+ * 关闭TCP连接（MAVLink连接会回调on_stream_closed）
+ * @param conn 连接
+ */
+void decoy_conn_close(decoy_conn_t *conn);
+
+/**
+ * 服务类型名称
+ * @param service decoy_service_t
+ * @return 名称
+ */
+const char *decoy_service_name(uint8_t service);
+
+/**
+ * 关闭所有端口和连接
+ * @param engine 引擎
+ */
+void decoy_close(decoy_engine_t *engine);
+
+#endif /* DECOY_H */
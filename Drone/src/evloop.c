@@ -0,0 +1,217 @@
+/*
+ * evloop.c - 基于epoll的事件循环
+ */
+
+#include "evloop.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sys/signalfd.h>
+
+static int evloop_register(evloop_t *loop, evloop_source_t *src, int fd, uint8_t kind,
+                           uint32_t events, evloop_cb_t cb, void *ctx);
+
+/* 唤醒事件只需清空计数，退出由running判断 */
+static void evloop_on_wake(void *ctx, int fd, uint32_t events) {
+    uint64_t count;
+    (void)ctx;
+    (void)events;
+    if (read(fd, &count, sizeof(count)) < 0) {
+        return;
+    }
+}
+
+int evloop_init(evloop_t *loop) {
+    memset(loop, 0, sizeof(*loop));
+    loop->wake.fd = -1;
+    loop->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (loop->epfd < 0) {
+        perror("epoll_create1失败");
+        return -1;
+    }
+    
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) {
+        perror("eventfd失败");
+        evloop_close(loop);
+        return -1;
+    }
+    if (evloop_register(loop, &loop->wake, fd, EVLOOP_IO, EPOLLIN, evloop_on_wake, loop) < 0) {
+        close(fd);
+        evloop_close(loop);
+        return -1;
+    }
+    loop->running = 1;
+    return 0;
+}
+
+static int evloop_register(evloop_t *loop, evloop_source_t *src, int fd, uint8_t kind,
+                           uint32_t events, evloop_cb_t cb, void *ctx) {
+    struct epoll_event ev;
+    
+    src->fd = fd;
+    src->kind = kind;
+    src->cb = cb;
+    src->ctx = ctx;
+    
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = src;
+    if (epoll_ctl(loop->epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        perror("epoll_ctl(ADD)失败");
+        src->fd = -1;
+        return -1;
+    }
+    loop->sources++;
+    return 0;
+}
+
+int evloop_add(evloop_t *loop, evloop_source_t *src, int fd, uint32_t events, evloop_cb_t cb, void *ctx) {
+    return evloop_register(loop, src, fd, EVLOOP_IO, events, cb, ctx);
+}
+
+int evloop_mod(evloop_t *loop, evloop_source_t *src, uint32_t events) {
+    struct epoll_event ev;
+    
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = src;
+    if (epoll_ctl(loop->epfd, EPOLL_CTL_MOD, src->fd, &ev) < 0) {
+        perror("epoll_ctl(MOD)失败");
+        return -1;
+    }
+    return 0;
+}
+
+void evloop_del(evloop_t *loop, evloop_source_t *src) {
+    if (src->fd < 0) {
+        return;
+    }
+    epoll_ctl(loop->epfd, EPOLL_CTL_DEL, src->fd, NULL);
+    if (src->kind != EVLOOP_IO) {
+        close(src->fd); // timerfd/signalfd由事件循环创建
+    }
+    src->fd = -1;
+    loop->sources--;
+}
+
+int evloop_timer_set(evloop_source_t *src, uint64_t delay_ms, uint64_t interval_ms) {
+    struct itimerspec spec;
+    
+    spec.it_value.tv_sec = delay_ms / 1000;
+    spec.it_value.tv_nsec = (delay_ms % 1000) * 1000000;
+    spec.it_interval.tv_sec = interval_ms / 1000;
+    spec.it_interval.tv_nsec = (interval_ms % 1000) * 1000000;
+    return timerfd_settime(src->fd, 0, &spec, NULL);
+}
+
+int evloop_add_timer(evloop_t *loop, evloop_source_t *src, uint64_t interval_ms, evloop_cb_t cb, void *ctx) {
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        perror("timerfd_create失败");
+        return -1;
+    }
+    if (evloop_register(loop, src, fd, EVLOOP_TIMER, EPOLLIN, cb, ctx) < 0) {
+        close(fd);
+        return -1;
+    }
+    if (interval_ms > 0 && evloop_timer_set(src, interval_ms, interval_ms) < 0) {
+        perror("timerfd_settime失败");
+        evloop_del(loop, src);
+        return -1;
+    }
+    return 0;
+}
+
+int evloop_add_signals(evloop_t *loop, evloop_source_t *src, const int *signals, size_t count,
+                       evloop_cb_t cb, void *ctx) {
+    sigset_t mask;
+    
+    sigemptyset(&mask);
+    for (size_t i = 0; i < count; i++) {
+        sigaddset(&mask, signals[i]);
+    }
+    // 屏蔽后信号只能通过signalfd读取，不会打断系统调用
+    if (sigprocmask(SIG_BLOCK, &mask, NULL) < 0) {
+        perror("sigprocmask失败");
+        return -1;
+    }
+    
+    int fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd < 0) {
+        perror("signalfd失败");
+        return -1;
+    }
+    if (evloop_register(loop, src, fd, EVLOOP_SIGNAL, EPOLLIN, cb, ctx) < 0) {
+        close(fd);
+        return -1;
+    }
+    return 0;
+}
+
+/* 分发一个就绪事件 */
+static void evloop_dispatch(evloop_source_t *src, uint32_t events) {
+    if (src->kind == EVLOOP_TIMER) {
+        uint64_t expirations;
+        if (read(src->fd, &expirations, sizeof(expirations)) == sizeof(expirations)) {
+            src->cb(src->ctx, src->fd, (uint32_t)expirations);
+        }
+    } else if (src->kind == EVLOOP_SIGNAL) {
+        struct signalfd_siginfo info;
+        while (src->fd >= 0 && read(src->fd, &info, sizeof(info)) == sizeof(info)) {
+            src->cb(src->ctx, src->fd, info.ssi_signo);
+        }
+    } else {
+        src->cb(src->ctx, src->fd, events);
+    }
+}
+
+void evloop_run(evloop_t *loop) {
+    struct epoll_event events[EVLOOP_MAX_EVENTS];
+    
+    while (loop->running) {
+        int n = epoll_wait(loop->epfd, events, EVLOOP_MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait失败");
+            break;
+        }
+        loop->wakeups++;
+        
+        for (int i = 0; i < n && loop->running; i++) {
+            evloop_source_t *src = (evloop_source_t *)events[i].data.ptr;
+            // 同一批事件中已被前面的回调注销的事件源直接跳过
+            if (src->fd < 0) {
+                continue;
+            }
+            evloop_dispatch(src, events[i].events);
+            loop->dispatched++;
+        }
+    }
+}
+
+void evloop_stop(evloop_t *loop) {
+    uint64_t one = 1;
+    
+    loop->running = 0;
+    if (loop->wake.fd >= 0 && write(loop->wake.fd, &one, sizeof(one)) < 0) {
+        return; // 计数已满时循环本来就会被唤醒
+    }
+}
+
+void evloop_close(evloop_t *loop) {
+    if (loop->wake.fd >= 0) {
+        close(loop->wake.fd);
+        loop->wake.fd = -1;
+    }
+    if (loop->epfd >= 0) {
+        close(loop->epfd);
+        loop->epfd = -1;
+    }
+}
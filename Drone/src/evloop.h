@@ -0,0 +1,134 @@
+/*
+ * evloop.h - 基于epoll的事件循环
+ * 套接字、定时器（timerfd）和信号（signalfd）统一作为文件描述符注册
+ */
+
+#ifndef EVLOOP_H
+#define EVLOOP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/epoll.h>
+
+#define EVLOOP_MAX_EVENTS 256       // 每次epoll_wait最多取回的事件数
+
+/**
+ * 事件回调
+ * @param ctx 注册时传入的上下文
+ * @param fd 就绪的文件描述符
+ * @param arg 套接字为epoll事件位，定时器为到期次数，信号为信号编号
+ */
+typedef void (*evloop_cb_t)(void *ctx, int fd, uint32_t arg);
+
+/* 事件源类型 */
+typedef enum {
+    EVLOOP_IO = 0,                  // 普通文件描述符
+    EVLOOP_TIMER,                   // timerfd，回调前已读出到期次数
+    EVLOOP_SIGNAL                   // signalfd，每个信号调用一次回调
+} evloop_kind_t;
+
+/*
+ * 事件源：由调用者分配（通常嵌在所属对象中），注册期间地址不能变化。
+ * 回调中可以删除任意事件源，但其内存要保留到回调返回。
+ */
+typedef struct {
+    int fd;                         // 文件描述符，未注册时为-1
+    uint8_t kind;                   // evloop_kind_t
+    evloop_cb_t cb;                 // 回调
+    void *ctx;                      // 回调上下文
+} evloop_source_t;
+
+/* 事件循环 */
+typedef struct {
+    int epfd;                       // epoll描述符
+    volatile int running;           // 0表示退出循环
+    evloop_source_t wake;           // eventfd，其他线程调用evloop_stop时唤醒epoll_wait
+    size_t sources;                 // 已注册的事件源数
+    uint64_t wakeups;               // epoll_wait返回次数
+    uint64_t dispatched;            // 已分发的事件数
+} evloop_t;
+
+/**
+ * 初始化事件循环
+ * @param loop 事件循环
+ * @return 0成功，-1失败
+ */
+int evloop_init(evloop_t *loop);
+
+/**
+ * 注册文件描述符（默认水平触发）
+ * @param loop 事件循环
+ * @param src 事件源（调用者分配）
+ * @param fd 文件描述符
+ * @param events EPOLLIN/EPOLLOUT等
+ * @param cb 回调
+ * @param ctx 回调上下文
+ * @return 0成功，-1失败
+ */
+int evloop_add(evloop_t *loop, evloop_source_t *src, int fd, uint32_t events, evloop_cb_t cb, void *ctx);
+
+/**
+ * 修改关注的事件
+ * @return 0成功，-1失败
+ */
+int evloop_mod(evloop_t *loop, evloop_source_t *src, uint32_t events);
+
+/**
+ * 注销事件源（不关闭文件描述符，定时器和信号源除外）
+ * @param loop 事件循环
+ * @param src 事件源
+ */
+void evloop_del(evloop_t *loop, evloop_source_t *src);
+
+/**
+ * 注册周期定时器（timerfd）
+ * @param loop 事件循环
+ * @param src 事件源
+ * @param interval_ms 周期（毫秒）
+ * @param cb 回调，arg为到期次数
+ * @param ctx 回调上下文
+ * @return 0成功，-1失败
+ */
+int evloop_add_timer(evloop_t *loop, evloop_source_t *src, uint64_t interval_ms, evloop_cb_t cb, void *ctx);
+
+/**
+ * 重新设置定时器
+ * @param src 定时器事件源
+ * @param delay_ms 首次到期延迟（毫秒），0表示停止
+ * @param interval_ms 之后的周期（毫秒），0表示只触发一次
+ * @return 0成功，-1失败
+ */
+int evloop_timer_set(evloop_source_t *src, uint64_t delay_ms, uint64_t interval_ms);
+
+/**
+ * 通过signalfd接收信号（会在当前线程屏蔽这些信号）
+ * @param loop 事件循环
+ * @param src 事件源
+ * @param signals 信号列表
+ * @param count 信号个数
+ * @param cb 回调，arg为信号编号
+ * @param ctx 回调上下文
+ * @return 0成功，-1失败
+ */
+int evloop_add_signals(evloop_t *loop, evloop_source_t *src, const int *signals, size_t count,
+                       evloop_cb_t cb, void *ctx);
+
+/**
+ * 运行事件循环，直到evloop_stop()
+ * @param loop 事件循环
+ */
+void evloop_run(evloop_t *loop);
+
+/**
+ * 请求退出事件循环（可以在回调中或其他线程调用）
+ * @param loop 事件循环
+ */
+void evloop_stop(evloop_t *loop);
+
+/**
+ * 关闭事件循环（不会注销或关闭事件源）
+ * @param loop 事件循环
+ */
+void evloop_close(evloop_t *loop);
+
+#endif /* EVLOOP_H */
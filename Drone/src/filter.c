@@ -0,0 +1,62 @@
+/*
+ * filter.c - 客户端消息过滤
+ */
+
+#include "filter.h"
+#include <string.h>
+
+void filter_init(filter_state_t *state) {
+    memset(state, 0, sizeof(*state));
+}
+
+/**
+ * COMMAND_LONG过滤：跳过频繁的状态轮询命令，只保留真正的控制命令
+ */
+static filter_action_t filter_command_long(filter_state_t *state, const mavlink_frame_t *frame) {
+    uint16_t command = mavlink_frame_u16(frame, MAVLINK_OFFSET_COMMAND_LONG_COMMAND);
+    int req_msg_id = (int)mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM1);
+    
+    // 过滤状态轮询命令
+    if (command == 512) {
+        // 命令512：请求自动驾驶仪能力，跳过
+        return FILTER_DROP;
+    }
+    if (command == 511 && (req_msg_id == 242 || req_msg_id == 245)) {
+        // 命令511请求消息242(返航位置)/245(扩展状态)，跳过
+        return FILTER_DROP;
+    }
+    if (command == 521 && req_msg_id == 1) {
+        // 命令521请求消息1(系统状态)，跳过
+        return FILTER_DROP;
+    }
+    
+    // 过滤紧随位置命令后的模式确认命令
+    if (command == 176 && state->last_cmd_id == 192) {
+        // 命令176(设置模式)紧随命令192(设置位置)后，跳过
+        state->last_cmd_id = command;
+        return FILTER_DROP;
+    }
+    
+    state->last_cmd_id = command;
+    return FILTER_LOG_COMMAND;
+}
+
+filter_action_t filter_classify(filter_state_t *state, const mavlink_frame_t *frame) {
+    // 按元数据表中的日志策略分流（解析时已完成查表）
+    switch (frame->info->log_policy) {
+        case MAVLINK_LOG_SKIP:
+            // 心跳、时间同步、任务初始化等高频消息，跳过不记录
+            return FILTER_DROP;
+        case MAVLINK_LOG_REQUEST:
+            return FILTER_LOG_REQUEST;
+        case MAVLINK_LOG_COMMAND:
+            if (frame->msgid == MAVLINK_MSG_ID_COMMAND_LONG) {
+                return filter_command_long(state, frame);
+            }
+            // COMMAND_INT：记录命令ID供过滤使用
+            state->last_cmd_id = mavlink_frame_u16(frame, MAVLINK_OFFSET_COMMAND_INT_COMMAND);
+            return FILTER_LOG_COMMAND;
+        default:
+            return FILTER_LOG_OTHER;
+    }
+}
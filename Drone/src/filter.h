@@ -0,0 +1,39 @@
+/*
+ * filter.h - 客户端消息过滤（决定每条消息是否记录、如何记录）
+ */
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#include "mavlink.h"
+
+/* 过滤结果 */
+typedef enum {
+    FILTER_DROP = 0,                // 不记录（高频消息、状态轮询命令）
+    FILTER_LOG_REQUEST,             // 数据请求（logger_request）
+    FILTER_LOG_COMMAND,             // 控制命令（logger_command）
+    FILTER_LOG_OTHER                // 按类别记录（logger_unknown）
+} filter_action_t;
+
+/* 过滤状态（跨消息保留） */
+typedef struct {
+    uint16_t last_cmd_id;           // 上一条命令ID，用于过滤紧随其后的确认命令
+} filter_state_t;
+
+/**
+ * 初始化过滤状态
+ * @param state 过滤状态
+ */
+void filter_init(filter_state_t *state);
+
+/**
+ * 对一条客户端消息分类
+ * 先按元数据表中的日志策略分流，COMMAND_LONG再过滤地面站的状态轮询命令。
+ * 只读取帧视图，不拷贝载荷、不分配内存。
+ * @param state 过滤状态
+ * @param frame 帧视图
+ * @return filter_action_t
+ */
+filter_action_t filter_classify(filter_state_t *state, const mavlink_frame_t *frame);
+
+#endif /* FILTER_H */
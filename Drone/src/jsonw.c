@@ -0,0 +1,213 @@
+/*
+ * jsonw.c - 流式JSON写出
+ */
+
+#include "jsonw.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+static const char g_hex_digits[] = "0123456789abcdef";
+
+/* 需要转义的字节：控制字符、引号和反斜杠 */
+static inline int needs_escape(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+static void put(jsonw_t *w, const char *data, size_t len) {
+    if (w->overflow || len > w->cap - w->len) {
+        w->overflow = 1;
+        return;
+    }
+    memcpy(w->buf + w->len, data, len);
+    w->len += len;
+}
+
+static inline void put_char(jsonw_t *w, char c) {
+    if (w->len < w->cap) {
+        w->buf[w->len++] = c;
+    } else {
+        w->overflow = 1;
+    }
+}
+
+/* 成员之间的逗号 */
+static void separate(jsonw_t *w) {
+    uint32_t bit = 1u << w->depth;
+    
+    if (w->after_key) {
+        w->after_key = 0;
+        return;
+    }
+    if (w->has_items & bit) {
+        put_char(w, ',');
+    }
+    w->has_items |= bit;
+}
+
+/* 带引号的转义字符串，不需要转义的连续字节整段拷贝 */
+static void put_quoted(jsonw_t *w, const char *str) {
+    const unsigned char *p = (const unsigned char *)str;
+    
+    put_char(w, '"');
+    for (;;) {
+        const unsigned char *run = p;
+        while (*p && !needs_escape(*p)) {
+            p++;
+        }
+        put(w, (const char *)run, (size_t)(p - run));
+        if (!*p) {
+            break;
+        }
+        
+        char esc[6] = { '\\', 0 };
+        size_t len = 2;
+        switch (*p) {
+            case '"': esc[1] = '"'; break;
+            case '\\': esc[1] = '\\'; break;
+            case '\b': esc[1] = 'b'; break;
+            case '\f': esc[1] = 'f'; break;
+            case '\n': esc[1] = 'n'; break;
+            case '\r': esc[1] = 'r'; break;
+            case '\t': esc[1] = 't'; break;
+            default:
+                esc[1] = 'u';
+                esc[2] = '0';
+                esc[3] = '0';
+                esc[4] = g_hex_digits[*p >> 4];
+                esc[5] = g_hex_digits[*p & 0x0F];
+                len = 6;
+                break;
+        }
+        put(w, esc, len);
+        p++;
+    }
+    put_char(w, '"');
+}
+
+/* 整数转十进制 */
+static size_t format_int(int value, char *out) {
+    char tmp[16];
+    size_t n = 0;
+    size_t len = 0;
+    unsigned int u = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    
+    do {
+        tmp[n++] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u > 0);
+    if (value < 0) {
+        out[len++] = '-';
+    }
+    while (n > 0) {
+        out[len++] = tmp[--n];
+    }
+    return len;
+}
+
+/* 相对误差在DBL_EPSILON以内视为相等 */
+static int same_double(double a, double b) {
+    double max = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+    return fabs(a - b) <= max * DBL_EPSILON;
+}
+
+void jsonw_init(jsonw_t *w, char *buf, size_t cap) {
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->cap = cap;
+}
+
+int jsonw_key_prepare(jsonw_key_t *key) {
+    jsonw_t w;
+    
+    jsonw_init(&w, key->text, sizeof(key->text));
+    put_quoted(&w, key->name);
+    put_char(&w, ':');
+    if (!jsonw_ok(&w)) {
+        key->len = 0;
+        return -1;
+    }
+    key->len = (uint8_t)w.len;
+    return 0;
+}
+
+void jsonw_object_begin(jsonw_t *w) {
+    separate(w);
+    put_char(w, '{');
+    if (w->depth + 1 >= JSONW_MAX_DEPTH) {
+        w->overflow = 1;
+        return;
+    }
+    w->depth++;
+    w->has_items &= ~(1u << w->depth);
+}
+
+void jsonw_object_end(jsonw_t *w) {
+    put_char(w, '}');
+    if (w->depth > 0) {
+        w->depth--;
+    }
+}
+
+void jsonw_array_begin(jsonw_t *w) {
+    separate(w);
+    put_char(w, '[');
+    if (w->depth + 1 >= JSONW_MAX_DEPTH) {
+        w->overflow = 1;
+        return;
+    }
+    w->depth++;
+    w->has_items &= ~(1u << w->depth);
+}
+
+void jsonw_array_end(jsonw_t *w) {
+    put_char(w, ']');
+    if (w->depth > 0) {
+        w->depth--;
+    }
+}
+
+void jsonw_key(jsonw_t *w, const jsonw_key_t *key) {
+    separate(w);
+    put(w, key->text, key->len);
+    w->after_key = 1;
+}
+
+void jsonw_key_str(jsonw_t *w, const char *name) {
+    separate(w);
+    put_quoted(w, name);
+    put_char(w, ':');
+    w->after_key = 1;
+}
+
+void jsonw_string(jsonw_t *w, const char *str) {
+    separate(w);
+    put_quoted(w, str);
+}
+
+void jsonw_number(jsonw_t *w, double value) {
+    char num[32];
+    size_t len;
+    
+    separate(w);
+    if (isnan(value) || isinf(value)) {
+        put(w, "null", 4);
+        return;
+    }
+    
+    // 先按int饱和取整：相等时输出整数（超出int范围的整数值走下面的%g）
+    int i = value >= INT_MAX ? INT_MAX : value <= (double)INT_MIN ? INT_MIN : (int)value;
+    if (value == (double)i) {
+        len = format_int(i, num);
+    } else {
+        // 15位有效数字不能还原时用17位
+        len = (size_t)snprintf(num, sizeof(num), "%1.15g", value);
+        if (!same_double(strtod(num, NULL), value)) {
+            len = (size_t)snprintf(num, sizeof(num), "%1.17g", value);
+        }
+    }
+    put(w, num, len);
+}
@@ -0,0 +1,94 @@
+/*
+ * jsonw.h - 流式JSON写出
+ * 直接把JSON写进调用者提供的缓冲区，不建树、不分配内存；输出与cJSON_PrintUnformatted逐字节相同
+ * （键按写入顺序，数字和字符串的格式规则见jsonw_number/jsonw_string）。
+ * 固定的键名在启动时用jsonw_key_prepare转义一次，写出时直接拷贝。
+ */
+
+#ifndef JSONW_H
+#define JSONW_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JSONW_KEY_MAX 64                // 预转义键（含引号和冒号）的长度上限
+#define JSONW_MAX_DEPTH 32              // 嵌套层数上限
+
+/* 预转义的键 */
+typedef struct {
+    const char *name;               // 键名（UTF-8）
+    char text[JSONW_KEY_MAX];       // "键名":
+    uint8_t len;                    // text长度，0表示未准备
+} jsonw_key_t;
+
+/* 写出状态 */
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t len;
+    uint32_t has_items;             // 按层记录已有成员（下一个成员前加逗号）
+    uint8_t depth;
+    uint8_t after_key;              // 刚写完键，下一个值前不加逗号
+    uint8_t overflow;               // 缓冲区或层数不够，输出不完整
+} jsonw_t;
+
+/**
+ * 开始写出
+ * @param w 写出状态
+ * @param buf 输出缓冲区
+ * @param cap 缓冲区大小
+ */
+void jsonw_init(jsonw_t *w, char *buf, size_t cap);
+
+/**
+ * 转义键名，生成"键名":
+ * @param key 键（name已设置）
+ * @return 0成功，-1键名转义后超过JSONW_KEY_MAX
+ */
+int jsonw_key_prepare(jsonw_key_t *key);
+
+/* 对象和数组（成员之间的逗号自动添加） */
+void jsonw_object_begin(jsonw_t *w);
+void jsonw_object_end(jsonw_t *w);
+void jsonw_array_begin(jsonw_t *w);
+void jsonw_array_end(jsonw_t *w);
+
+/**
+ * 写出预转义的键，之后写一个值
+ * @param w 写出状态
+ * @param key jsonw_key_prepare准备好的键
+ */
+void jsonw_key(jsonw_t *w, const jsonw_key_t *key);
+
+/**
+ * 写出键（写出时转义，用于不固定的键名，如载荷字段标签）
+ * @param w 写出状态
+ * @param name 键名
+ */
+void jsonw_key_str(jsonw_t *w, const char *name);
+
+/**
+ * 写出字符串：转义引号、反斜杠和控制字符（\b\f\n\r\t，其余写成\u00XX），其他字节原样输出
+ * @param w 写出状态
+ * @param str 字符串
+ */
+void jsonw_string(jsonw_t *w, const char *str);
+
+/**
+ * 写出数字：NaN/Inf写成null，整数值（按int饱和后相等）写成整数，
+ * 其他先用15位有效数字，读回不相等时用17位
+ * @param w 写出状态
+ * @param value 数值
+ */
+void jsonw_number(jsonw_t *w, double value);
+
+/**
+ * 输出是否完整
+ * @param w 写出状态
+ * @return 1完整，0缓冲区或层数不够
+ */
+static inline int jsonw_ok(const jsonw_t *w) {
+    return !w->overflow;
+}
+
+#endif /* JSONW_H */
@@ -0,0 +1,384 @@
+/*
+ * logarchive.c - 日志归档
+ * 段文件名：drone_honeypot_YYYYMMDD.json（当天最后一段）和drone_honeypot_YYYYMMDD.N.json（按大小轮转出的段），
+ * 二进制格式的扩展名为.bin；压缩后加.gz；压缩先写到.gz.tmp，完成后改名并删除原文件，中途退出只会留下.tmp（下次启动时清理）。
+ */
+
+#include "logarchive.h"
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <zlib.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+#define LOGARCHIVE_PATH_MAX 256
+#define LOGARCHIVE_CHUNK (64 * 1024)    // 压缩时每次读取的字节数
+#define LOGARCHIVE_NICE 10              // 归档线程的nice值（压缩不和转发线程抢CPU）
+
+/* 目录中的一个段 */
+typedef struct {
+    char name[LOGARCHIVE_PATH_MAX];
+    time_t mtime;
+    uint64_t size;
+} logarchive_segment_t;
+
+static logarchive_policy_t g_policy;
+static pthread_t g_thread;
+static int g_running = 0;
+static int g_stopping = 0;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_cond;
+static char g_queue[LOGARCHIVE_QUEUE][LOGARCHIVE_PATH_MAX]; // 等待压缩的段（环形）
+static unsigned g_queue_head = 0;
+static unsigned g_queue_count = 0;
+static char g_active[LOGARCHIVE_PATH_MAX];  // 正在写的文件
+static logarchive_stats_t g_stats;
+static uint8_t g_chunk[LOGARCHIVE_CHUNK];
+static int g_quota_warned = 0;
+
+static int stopping(void) {
+    return __atomic_load_n(&g_stopping, __ATOMIC_ACQUIRE);
+}
+
+/* 文件名是否属于本程序的日志段，suffix为".json"、".json.gz"等 */
+static int is_segment(const char *name, const char *suffix) {
+    size_t prefix_len = strlen(LOG_FILE_PREFIX);
+    size_t len = strlen(name);
+    size_t suffix_len = strlen(suffix);
+    
+    return strncmp(name, LOG_FILE_PREFIX, prefix_len) == 0 && name[prefix_len] == '_' &&
+           len > prefix_len + 1 + suffix_len && strcmp(name + len - suffix_len, suffix) == 0;
+}
+
+/* 未压缩的段（JSON或二进制格式） */
+static int is_plain_segment(const char *name) {
+    return is_segment(name, ".json") || is_segment(name, ".bin");
+}
+
+/* 压缩后的段 */
+static int is_gz_segment(const char *name) {
+    return is_segment(name, ".json.gz") || is_segment(name, ".bin.gz");
+}
+
+/* 是否正在写的文件 */
+static int is_active(const char *name) {
+    const char *base;
+    int active;
+    
+    pthread_mutex_lock(&g_lock);
+    base = strrchr(g_active, '/');
+    active = strcmp(base ? base + 1 : g_active, name) == 0;
+    pthread_mutex_unlock(&g_lock);
+    return active;
+}
+
+/**
+ * gzip压缩一个段，成功后删除原文件
+ * @param path 段路径
+ * @return 0成功（或原文件已不存在），-1失败或被停止
+ */
+static int compress_file(const char *path) {
+    char tmp_path[LOGARCHIVE_PATH_MAX + 16];
+    char gz_path[LOGARCHIVE_PATH_MAX + 16];
+    char mode[8];
+    struct stat st;
+    uint64_t bytes_in = 0;
+    int ok = 1;
+    
+    int in = open(path, O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        return errno == ENOENT ? 0 : -1; // 已被配额检查删除
+    }
+    fstat(in, &st);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.gz.tmp", path);
+    snprintf(gz_path, sizeof(gz_path), "%s.gz", path);
+    snprintf(mode, sizeof(mode), "wb%de", g_policy.level); // e: O_CLOEXEC，不泄漏给后端池启动的SITL
+    
+    gzFile out = gzopen(tmp_path, mode);
+    if (!out) {
+        close(in);
+        return -1;
+    }
+    gzbuffer(out, LOGARCHIVE_CHUNK);
+    for (;;) {
+        ssize_t n = read(in, g_chunk, sizeof(g_chunk));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            ok = n == 0;
+            break;
+        }
+        if (gzwrite(out, g_chunk, (unsigned)n) != (int)n || stopping()) {
+            ok = 0;
+            break;
+        }
+        bytes_in += (uint64_t)n;
+    }
+    close(in);
+    if (gzclose(out) != Z_OK) {
+        ok = 0;
+    }
+    if (!ok) {
+        unlink(tmp_path);
+        return -1;
+    }
+    
+    // 保留原文件的修改时间，保留天数按日志的最后写入时间计算
+    struct timespec times[2] = { st.st_atim, st.st_mtim };
+    utimensat(AT_FDCWD, tmp_path, times, 0);
+    if (rename(tmp_path, gz_path) < 0) {
+        unlink(tmp_path);
+        return -1;
+    }
+    unlink(path);
+    
+    struct stat gz_st;
+    pthread_mutex_lock(&g_lock);
+    g_stats.compressed++;
+    g_stats.bytes_in += bytes_in;
+    g_stats.bytes_out += stat(gz_path, &gz_st) == 0 ? (uint64_t)gz_st.st_size : 0;
+    pthread_mutex_unlock(&g_lock);
+    printf("[日志] 已压缩 %s (%llu字节)\n", gz_path, (unsigned long long)bytes_in);
+    return 0;
+}
+
+static void count_error(void) {
+    pthread_mutex_lock(&g_lock);
+    g_stats.errors++;
+    pthread_mutex_unlock(&g_lock);
+}
+
+static void archive(const char *path) {
+    if (g_policy.level > 0 && compress_file(path) < 0 && !stopping()) {
+        count_error();
+        fprintf(stderr, "[日志] 压缩 %s 失败\n", path);
+    }
+}
+
+/* 启动时：删除中途退出留下的.tmp，压缩上次运行留下的未压缩段 */
+static void recover(void) {
+    DIR *dir = opendir(LOG_DIR);
+    struct dirent *ent;
+    char path[LOGARCHIVE_PATH_MAX + 8];
+    
+    if (!dir) {
+        return;
+    }
+    while ((ent = readdir(dir)) != NULL && !stopping()) {
+        if (snprintf(path, sizeof(path), "%s/%s", LOG_DIR, ent->d_name) >= LOGARCHIVE_PATH_MAX) {
+            continue;
+        }
+        if (is_segment(ent->d_name, ".json.gz.tmp") || is_segment(ent->d_name, ".bin.gz.tmp")) {
+            unlink(path);
+        } else if (is_plain_segment(ent->d_name) && !is_active(ent->d_name)) {
+            archive(path);
+        }
+    }
+    closedir(dir);
+}
+
+static int segment_cmp(const void *a, const void *b) {
+    const logarchive_segment_t *sa = a;
+    const logarchive_segment_t *sb = b;
+    if (sa->mtime != sb->mtime) {
+        return sa->mtime < sb->mtime ? -1 : 1;
+    }
+    return strcmp(sa->name, sb->name);
+}
+
+/* 按保留天数和配额删除最旧的段（正在写的文件只计入总量） */
+static void enforce_retention(void) {
+    if (g_policy.retention_days == 0 && g_policy.quota_bytes == 0) {
+        return;
+    }
+    
+    DIR *dir = opendir(LOG_DIR);
+    if (!dir) {
+        return;
+    }
+    
+    logarchive_segment_t *segs = NULL;
+    size_t count = 0, cap = 0;
+    uint64_t total = 0;
+    struct dirent *ent;
+    char path[LOGARCHIVE_PATH_MAX + 8];
+    struct stat st;
+    
+    while ((ent = readdir(dir)) != NULL) {
+        if (!is_plain_segment(ent->d_name) && !is_gz_segment(ent->d_name)) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", LOG_DIR, ent->d_name);
+        if (strlen(ent->d_name) >= LOGARCHIVE_PATH_MAX || stat(path, &st) < 0) {
+            continue;
+        }
+        total += (uint64_t)st.st_size;
+        if (is_active(ent->d_name)) {
+            continue;
+        }
+        if (count == cap) {
+            size_t new_cap = cap ? cap * 2 : 64;
+            logarchive_segment_t *grown = realloc(segs, new_cap * sizeof(*segs));
+            if (!grown) {
+                break;
+            }
+            segs = grown;
+            cap = new_cap;
+        }
+        snprintf(segs[count].name, sizeof(segs[count].name), "%s", ent->d_name);
+        segs[count].mtime = st.st_mtime;
+        segs[count].size = (uint64_t)st.st_size;
+        count++;
+    }
+    closedir(dir);
+    if (count > 1) {
+        qsort(segs, count, sizeof(*segs), segment_cmp);
+    }
+    
+    time_t cutoff = time(NULL) - (time_t)g_policy.retention_days * 86400;
+    for (size_t i = 0; i < count; i++) {
+        int expired = g_policy.retention_days > 0 && segs[i].mtime < cutoff;
+        int over_quota = g_policy.quota_bytes > 0 && total > g_policy.quota_bytes;
+        if (!expired && !over_quota) {
+            break; // 按时间排序，后面的更新
+        }
+        snprintf(path, sizeof(path), "%s/%s", LOG_DIR, segs[i].name);
+        if (unlink(path) < 0 && errno != ENOENT) {
+            count_error();
+            continue;
+        }
+        total -= segs[i].size;
+        pthread_mutex_lock(&g_lock);
+        g_stats.deleted++;
+        pthread_mutex_unlock(&g_lock);
+        printf("[日志] 删除%s的日志 %s\n", expired ? "过期" : "超出配额", path);
+    }
+    // 旧段删完仍超过配额：只能等正在写的文件轮转，提示一次
+    int over = g_policy.quota_bytes > 0 && total > g_policy.quota_bytes;
+    if (over && !g_quota_warned) {
+        fprintf(stderr, "[日志] 正在写的日志已超过配额，请调小PROXY_LOG_ROTATE_MB\n");
+    }
+    g_quota_warned = over;
+    free(segs);
+}
+
+static void *archive_main(void *arg) {
+    struct timespec deadline;
+    (void)arg;
+    
+    // 只降低本线程的优先级
+    setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), LOGARCHIVE_NICE);
+    recover();
+    enforce_retention();
+    
+    pthread_mutex_lock(&g_lock);
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += LOGARCHIVE_CHECK_MS / 1000;
+    while (!g_stopping) {
+        if (g_queue_count > 0) {
+            char path[LOGARCHIVE_PATH_MAX];
+            memcpy(path, g_queue[g_queue_head], sizeof(path));
+            g_queue_head = (g_queue_head + 1) % LOGARCHIVE_QUEUE;
+            g_queue_count--;
+            pthread_mutex_unlock(&g_lock);
+            archive(path);
+            enforce_retention();
+            pthread_mutex_lock(&g_lock);
+            continue;
+        }
+        if (pthread_cond_timedwait(&g_cond, &g_lock, &deadline) == ETIMEDOUT) {
+            pthread_mutex_unlock(&g_lock);
+            enforce_retention();
+            pthread_mutex_lock(&g_lock);
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += LOGARCHIVE_CHECK_MS / 1000;
+        }
+    }
+    pthread_mutex_unlock(&g_lock);
+    fflush(stdout);
+    return NULL;
+}
+
+int logarchive_start(const logarchive_policy_t *policy, const char *active) {
+    pthread_condattr_t attr;
+    sigset_t all, old;
+    
+    g_policy = *policy;
+    g_stopping = 0;
+    g_queue_head = g_queue_count = 0;
+    memset(&g_stats, 0, sizeof(g_stats));
+    snprintf(g_active, sizeof(g_active), "%s", active);
+    
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    
+    // 与日志写出线程相同：屏蔽所有信号
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    int err = pthread_create(&g_thread, NULL, archive_main, NULL);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (err != 0) {
+        errno = err;
+        perror("创建日志归档线程失败");
+        pthread_cond_destroy(&g_cond);
+        return -1;
+    }
+    g_running = 1;
+    return 0;
+}
+
+void logarchive_set_active(const char *path) {
+    pthread_mutex_lock(&g_lock);
+    snprintf(g_active, sizeof(g_active), "%s", path);
+    pthread_mutex_unlock(&g_lock);
+}
+
+void logarchive_submit(const char *path) {
+    if (!g_running) {
+        return;
+    }
+    
+    pthread_mutex_lock(&g_lock);
+    if (g_queue_count < LOGARCHIVE_QUEUE) {
+        unsigned tail = (g_queue_head + g_queue_count) % LOGARCHIVE_QUEUE;
+        snprintf(g_queue[tail], sizeof(g_queue[tail]), "%s", path);
+        g_queue_count++;
+        pthread_cond_signal(&g_cond);
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+void logarchive_get_stats(logarchive_stats_t *stats) {
+    pthread_mutex_lock(&g_lock);
+    *stats = g_stats;
+    pthread_mutex_unlock(&g_lock);
+}
+
+void logarchive_stop(void) {
+    if (!g_running) {
+        return;
+    }
+    
+    pthread_mutex_lock(&g_lock);
+    __atomic_store_n(&g_stopping, 1, __ATOMIC_RELEASE);
+    pthread_cond_signal(&g_cond);
+    pthread_mutex_unlock(&g_lock);
+    pthread_join(g_thread, NULL);
+    pthread_cond_destroy(&g_cond);
+    g_running = 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * logarchive.h - 日志归档
+ * 日志写出线程轮转出的段文件交给后台归档线程：gzip压缩（压缩完再删除原文件），
+ * 然后按保留天数和磁盘配额从最旧的段开始删除。正在写的日志文件不会被压缩或删除。
+ */
+
+#ifndef LOGARCHIVE_H
+#define LOGARCHIVE_H
+
+#include <stdint.h>
+
+#define LOGARCHIVE_QUEUE 64             // 等待压缩的段数上限（满时留到下次启动时压缩）
+#define LOGARCHIVE_CHECK_MS 60000       // 检查保留天数和配额的周期（毫秒）
+
+/* 归档策略 */
+typedef struct {
+    int level;                      // gzip压缩级别1~9，0表示不压缩
+    unsigned retention_days;        // 保留天数（按修改时间），0表示不限
+    uint64_t quota_bytes;           // 日志目录中本程序日志的总字节数上限（含正在写的文件），0表示不限
+} logarchive_policy_t;
+
+/* 归档统计 */
+typedef struct {
+    uint64_t compressed;            // 压缩完成的段数
+    uint64_t bytes_in;              // 压缩前字节数
+    uint64_t bytes_out;             // 压缩后字节数
+    uint64_t deleted;               // 因保留天数或配额删除的段数
+    uint64_t errors;                // 压缩或删除失败次数
+} logarchive_stats_t;
+
+/**
+ * 启动归档线程：先压缩上次运行留下的未压缩段，再检查保留天数和配额
+ * @param policy 策略
+ * @param active 正在写的日志文件路径
+ * @return 0成功，-1失败
+ */
+int logarchive_start(const logarchive_policy_t *policy, const char *active);
+
+/**
+ * 更换正在写的日志文件（轮转后调用）
+ * @param path 新文件路径
+ */
+void logarchive_set_active(const char *path);
+
+/**
+ * 提交已关闭的段（不阻塞，队列满时留待下次启动处理）
+ * @param path 段文件路径
+ */
+void logarchive_submit(const char *path);
+
+/**
+ * 获取归档统计
+ * @param stats 输出
+ */
+void logarchive_get_stats(logarchive_stats_t *stats);
+
+/**
+ * 停止归档线程（正在压缩的段放弃，下次启动时重新压缩）
+ */
+void logarchive_stop(void);
+
+#endif /* LOGARCHIVE_H */
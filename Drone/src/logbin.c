@@ -0,0 +1,413 @@
+/*
+ * logbin.c - 紧凑二进制日志
+ */
+
+#include "logbin.h"
+#include "timestamp.h"
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#define LOGBIN_SLOT_MASK (LOGBIN_STRINGS * 2 - 1)
+#define LOGBIN_EVENT_STRINGS 2          // 一个事件最多引用的字符串数（探测的协议和服务）
+
+/* ---------- 编码 ---------- */
+
+static size_t put_varint(uint8_t *out, uint64_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+static uint64_t zigzag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/* 追加一条记录：类型、内容长度、内容 */
+static int put_record(uint8_t *out, size_t cap, size_t *pos, uint8_t type, const uint8_t *body, size_t len) {
+    uint8_t head[1 + 10];
+    size_t head_len;
+    
+    head[0] = type;
+    head_len = 1 + put_varint(head + 1, len);
+    if (cap - *pos < head_len + len) {
+        return -1;
+    }
+    memcpy(out + *pos, head, head_len);
+    memcpy(out + *pos + head_len, body, len);
+    *pos += head_len + len;
+    return 0;
+}
+
+/* 清空字符串表，之后用到的字符串从0重新编号（读取端以最后一次定义为准） */
+static void forget_strings(logbin_writer_t *w) {
+    memset(w->strings, 0, sizeof(w->strings));
+    w->string_count = 0;
+}
+
+/* 清空字符串表和时区状态，之后用到的字符串和时区重新定义 */
+static void writer_forget(logbin_writer_t *w) {
+    forget_strings(w);
+    w->tz_valid = 0;
+}
+
+static size_t string_slot(const char *str) {
+    return (size_t)(((uintptr_t)str >> 3) * 0x9E3779B1u) & LOGBIN_SLOT_MASK;
+}
+
+/**
+ * 取字符串的编号，第一次出现时先写一条定义（调用前保证表中还有空位）
+ * @return 编号，-1表示容量不够
+ */
+static int intern(logbin_writer_t *w, const char *str, uint8_t *out, size_t cap, size_t *pos) {
+    size_t slot = string_slot(str);
+    
+    while (w->strings[slot]) {
+        if (w->strings[slot] == str) {
+            return w->ids[slot];
+        }
+        slot = (slot + 1) & LOGBIN_SLOT_MASK;
+    }
+    
+    uint8_t body[10 + LOGBIN_STRING_MAX];
+    size_t len = strnlen(str, LOGBIN_STRING_MAX - 1);
+    size_t n = put_varint(body, w->string_count);
+    memcpy(body + n, str, len);
+    if (put_record(out, cap, pos, LOGBIN_REC_STRING, body, n + len) < 0) {
+        return -1;
+    }
+    w->strings[slot] = str;
+    w->ids[slot] = (uint16_t)w->string_count;
+    return (int)w->string_count++;
+}
+
+/* 本地时间偏移变化时写一条时区记录（每秒最多查询一次） */
+static int put_tz(logbin_writer_t *w, time_t sec, uint8_t *out, size_t cap, size_t *pos) {
+    if (w->tz_valid && w->tz_checked == sec) {
+        return 0;
+    }
+    
+    long offset = timestamp_utc_offset(sec);
+    w->tz_checked = sec;
+    if (w->tz_valid && offset == w->utc_offset) {
+        return 0;
+    }
+    
+    uint8_t body[10];
+    if (put_record(out, cap, pos, LOGBIN_REC_TZ, body, put_varint(body, zigzag(offset))) < 0) {
+        return -1;
+    }
+    w->utc_offset = offset;
+    w->tz_valid = 1;
+    return 0;
+}
+
+size_t logbin_header(logbin_writer_t *w, int precision, uint8_t *out) {
+    writer_forget(w);
+    w->last_us = 0;
+    
+    memcpy(out, LOGBIN_MAGIC, 4);
+    out[4] = LOGBIN_VERSION;
+    out[5] = (uint8_t)precision;
+    out[6] = 0;
+    out[7] = 0;
+    return LOGBIN_HEADER_LEN;
+}
+
+size_t logbin_encode(logbin_writer_t *w, const logger_record_t *record, uint8_t *out, size_t cap) {
+    const client_info_t *client = &record->client;
+    uint8_t body[LOGBIN_RECORD_MAX];
+    size_t pos = 0;
+    size_t n = 0;
+    int64_t us = (int64_t)record->time.tv_sec * 1000000 + record->time.tv_nsec / 1000;
+    
+    if (put_tz(w, record->time.tv_sec, out, cap, &pos) < 0) {
+        goto fail;
+    }
+    // 表快满时在事件开始前清空，不让同一事件先取到的编号被重新分配
+    if (w->string_count > LOGBIN_STRINGS - LOGBIN_EVENT_STRINGS) {
+        forget_strings(w);
+    }
+    
+    n += put_varint(body + n, zigzag(us - w->last_us));
+    memcpy(body + n, &client->addr.sin_addr.s_addr, 4);
+    n += 4;
+    n += put_varint(body + n, client->port);
+    n += put_varint(body + n, client->local_port);
+    
+    if (record->type == LOGGER_EV_PROBE) {
+        int proto = intern(w, record->u.probe.proto, out, cap, &pos);
+        int service = intern(w, record->u.probe.service, out, cap, &pos);
+        size_t preview = record->u.probe.len < LOGGER_PROBE_PREVIEW ? record->u.probe.len : LOGGER_PROBE_PREVIEW;
+        if (proto < 0 || service < 0) {
+            goto fail;
+        }
+        n += put_varint(body + n, (uint64_t)proto);
+        n += put_varint(body + n, (uint64_t)service);
+        n += put_varint(body + n, record->u.probe.len);
+        memcpy(body + n, record->u.probe.preview, preview);
+        n += preview;
+    } else if (record->type != LOGGER_EV_CONNECTION) {
+        const mavlink_frame_t *frame = &record->u.mav.frame;
+        if (record->type == LOGGER_EV_SIGNED) {
+            const mavlink_sign_result_t *sign = &record->u.mav.sign;
+            int key = -1;
+            if (sign->key_index >= 0 && (key = intern(w, record->u.mav.sign_key, out, cap, &pos)) < 0) {
+                goto fail;
+            }
+            body[n++] = sign->status;
+            body[n++] = sign->link_id;
+            n += put_varint(body + n, sign->timestamp);
+            n += put_varint(body + n, (uint64_t)(key + 1));
+        }
+        memcpy(body + n, frame->data, frame->frame_len);
+        n += frame->frame_len;
+    }
+    
+    if (put_record(out, cap, &pos, record->type, body, n) < 0) {
+        goto fail;
+    }
+    w->last_us = us;
+    return pos;
+
+fail:
+    // 已写入out的定义随事件一起丢弃，之后重新定义
+    writer_forget(w);
+    return 0;
+}
+
+/* ---------- 解码 ---------- */
+
+void logbin_reader_init(logbin_reader_t *r) {
+    memset(r, 0, sizeof(*r));
+}
+
+/**
+ * 读一个varint
+ * @return 0成功，-1数据不足，-2超过10字节（数据损坏）
+ */
+static int get_varint(const uint8_t *data, size_t len, size_t *pos, uint64_t *value) {
+    uint64_t result = 0;
+    
+    for (int shift = 0; shift < 70; shift += 7) {
+        if (*pos >= len) {
+            return -1;
+        }
+        uint8_t b = data[(*pos)++];
+        result |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *value = result;
+            return 0;
+        }
+    }
+    return -2;
+}
+
+static int64_t unzigzag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static int is_header(const uint8_t *data) {
+    return memcmp(data, LOGBIN_MAGIC, 4) == 0 && data[4] == LOGBIN_VERSION && data[5] <= TIMESTAMP_US &&
+           data[6] == 0 && data[7] == 0;
+}
+
+/* 编号对应的字符串，未定义时返回NULL */
+static const char *reader_string(logbin_reader_t *r, uint64_t id) {
+    return id < LOGBIN_STRINGS && r->defined[id] ? r->strings[id] : NULL;
+}
+
+/**
+ * 解码事件内容
+ * @return LOGBIN_EVENT成功，LOGBIN_SKIP无法还原（格式正确，跳过这一条），-2数据损坏
+ */
+static int decode_event(logbin_reader_t *r, uint8_t type, const uint8_t *body, size_t len,
+                        logger_record_t *record) {
+    client_info_t *client = &record->client;
+    size_t pos = 0;
+    uint64_t delta, port, local_port;
+    
+    if (get_varint(body, len, &pos, &delta) < 0 || len - pos < 4) {
+        return -2;
+    }
+    int64_t us = r->last_us + unzigzag(delta);
+    r->last_us = us;
+    
+    memset(client, 0, sizeof(*client));
+    client->addr.sin_family = AF_INET;
+    memcpy(&client->addr.sin_addr.s_addr, body + pos, 4);
+    pos += 4;
+    if (get_varint(body, len, &pos, &port) < 0 || get_varint(body, len, &pos, &local_port) < 0 ||
+        port > 65535 || local_port > 65535) {
+        return -2;
+    }
+    client->addr.sin_port = htons((uint16_t)port);
+    client->addr_len = sizeof(client->addr);
+    inet_ntop(AF_INET, &client->addr.sin_addr, client->ip_str, sizeof(client->ip_str));
+    client->port = (uint16_t)port;
+    client->local_port = (uint16_t)local_port;
+    
+    record->type = type;
+    record->time.tv_sec = (time_t)(us / 1000000);
+    record->time.tv_nsec = (long)(us % 1000000) * 1000;
+    if (record->time.tv_nsec < 0) {
+        record->time.tv_sec--;
+        record->time.tv_nsec += 1000000000;
+    }
+    
+    if (type == LOGGER_EV_CONNECTION) {
+        return pos == len ? LOGBIN_EVENT : -2;
+    }
+    if (type == LOGGER_EV_PROBE) {
+        uint64_t proto, service, bytes;
+        if (get_varint(body, len, &pos, &proto) < 0 || get_varint(body, len, &pos, &service) < 0 ||
+            get_varint(body, len, &pos, &bytes) < 0 ||
+            len - pos != (bytes < LOGGER_PROBE_PREVIEW ? bytes : LOGGER_PROBE_PREVIEW)) {
+            return -2;
+        }
+        record->u.probe.proto = reader_string(r, proto);
+        record->u.probe.service = reader_string(r, service);
+        record->u.probe.len = (size_t)bytes;
+        memcpy(record->u.probe.preview, body + pos, len - pos);
+        return record->u.probe.proto && record->u.probe.service ? LOGBIN_EVENT : LOGBIN_SKIP;
+    }
+    
+    const char *sign_key = NULL;
+    if (type == LOGGER_EV_SIGNED) {
+        mavlink_sign_result_t *sign = &record->u.mav.sign;
+        uint64_t timestamp, key;
+        if (len - pos < 2) {
+            return -2;
+        }
+        memset(sign, 0, sizeof(*sign));
+        sign->status = body[pos++];
+        sign->link_id = body[pos++];
+        if (get_varint(body, len, &pos, &timestamp) < 0 || get_varint(body, len, &pos, &key) < 0) {
+            return -2;
+        }
+        sign->timestamp = timestamp;
+        sign->changed = 1;
+        sign->key_index = key > 0 ? 0 : -1;
+        if (key > 0 && !(sign_key = reader_string(r, key - 1))) {
+            return LOGBIN_SKIP;
+        }
+    }
+    record->u.mav.sign_key = sign_key;
+    
+    // 帧重新解析得到视图（消息元数据按本程序的消息表查找）
+    size_t frame_len = len - pos;
+    if (frame_len > MAVLINK_MAX_FRAME_LEN) {
+        return -2;
+    }
+    memcpy(record->u.mav.bytes, body + pos, frame_len);
+    if (mavlink_frame_parse(record->u.mav.bytes, frame_len, &record->u.mav.frame) == MAVLINK_FRAME_BAD_CRC ||
+        record->u.mav.frame.frame_len != frame_len) {
+        return LOGBIN_SKIP;
+    }
+    return LOGBIN_EVENT;
+}
+
+int logbin_decode(logbin_reader_t *r, const uint8_t *data, size_t len, logger_record_t *record, size_t *used) {
+    *used = 0;
+    
+    // 查找文件头（末尾不足一个文件头的部分留到下次）
+    if (!r->synced) {
+        size_t i = 0;
+        while (i + LOGBIN_HEADER_LEN <= len && !is_header(data + i)) {
+            i++;
+        }
+        if (i + LOGBIN_HEADER_LEN > len) {
+            i = len >= LOGBIN_HEADER_LEN ? len - (LOGBIN_HEADER_LEN - 1) : 0;
+            if (i == 0) {
+                return LOGBIN_MORE;
+            }
+        }
+        if (i > 0) {
+            r->skipped += i;
+            *used = i;
+            return LOGBIN_SKIP;
+        }
+    }
+    if (len == 0) {
+        return LOGBIN_MORE;
+    }
+    
+    // 记录类型不会是'D'，以它开头的只能是文件头
+    if (data[0] == (uint8_t)LOGBIN_MAGIC[0]) {
+        if (len < LOGBIN_HEADER_LEN) {
+            return LOGBIN_MORE;
+        }
+        if (!is_header(data)) {
+            goto corrupt;
+        }
+        memset(r->defined, 0, sizeof(r->defined));
+        r->precision = data[5];
+        r->utc_offset = 0;
+        r->last_us = 0;
+        r->synced = 1;
+        *used = LOGBIN_HEADER_LEN;
+        return LOGBIN_SKIP;
+    }
+    
+    size_t pos = 1;
+    uint64_t body_len = 0;
+    int ret = get_varint(data, len, &pos, &body_len);
+    if (ret == -1) {
+        return LOGBIN_MORE;
+    }
+    if (ret < 0 || body_len > LOGBIN_RECORD_MAX) {
+        goto corrupt;
+    }
+    if (len - pos < body_len) {
+        return LOGBIN_MORE;
+    }
+    
+    const uint8_t *body = data + pos;
+    size_t body_end = (size_t)body_len;
+    uint8_t type = data[0];
+    *used = pos + body_end;
+    
+    if (type == LOGBIN_REC_STRING) {
+        uint64_t id;
+        size_t p = 0;
+        if (get_varint(body, body_end, &p, &id) < 0 || id >= LOGBIN_STRINGS ||
+            body_end - p >= LOGBIN_STRING_MAX) {
+            goto corrupt;
+        }
+        memcpy(r->strings[id], body + p, body_end - p);
+        r->strings[id][body_end - p] = '\0';
+        r->defined[id] = 1;
+        return LOGBIN_SKIP;
+    }
+    if (type == LOGBIN_REC_TZ) {
+        uint64_t offset;
+        size_t p = 0;
+        if (get_varint(body, body_end, &p, &offset) < 0) {
+            goto corrupt;
+        }
+        r->utc_offset = (long)unzigzag(offset);
+        return LOGBIN_SKIP;
+    }
+    if (type < LOGGER_EV_COUNT) {
+        ret = decode_event(r, type, body, body_end, record);
+        if (ret == -2) {
+            goto corrupt;
+        }
+        if (ret == LOGBIN_SKIP) {
+            r->bad_records++;
+        }
+        return ret;
+    }
+    // 以后版本增加的记录类型：按长度跳过
+    return LOGBIN_SKIP;
+
+corrupt:
+    r->synced = 0;
+    r->skipped++;
+    *used = 1;
+    return LOGBIN_SKIP;
+}
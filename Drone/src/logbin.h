@@ -0,0 +1,107 @@
+/*
+ * logbin.h - 紧凑二进制日志
+ * 写出线程把事件的原始数据顺序追加到.bin文件，不做JSON格式化；drone_logcat离线解码后用logfmt还原成
+ * 与JSON格式逐字节相同的日志行。
+ *
+ * 文件 = 文件头 记录...
+ *   文件头（8字节）："DHLG" 版本(1) 时间精度(1，timestamp_precision_t) 保留(2，为0)
+ *   记录 = 类型(1字节) 内容长度(varint) 内容
+ * 记录类型：
+ *   LOGBIN_REC_STRING 字符串定义：编号(varint) 字节...（之后的记录用编号引用，重复定义以最后一次为准）
+ *   LOGBIN_REC_TZ     时区偏移：相对UTC的秒数(zigzag varint)，本地时间偏移变化时（夏令时）重新写一条
+ *   0~6（logger_event_t）事件：
+ *     时间差(zigzag varint，微秒，相对上一条事件；文件头之后的第一条相对0)
+ *     来源IPv4(4字节，网络序) 来源端口(varint) 目标端口(varint)
+ *     探测：协议(字符串编号) 服务(字符串编号) 字节数(varint) 前缀(到内容末尾)
+ *     其他事件：原始帧字节（含签名块，到内容末尾）
+ *     签名流量在帧之前另有：校验结果(1) 链路ID(1) 签名时间戳(varint) 密钥(字符串编号+1，0表示无)
+ * varint为LEB128（低7位在前）。每次打开文件（包括重启后追加到已有文件、写失败之后）都重新写文件头，
+ * 读取时遇到文件头就重置字符串表和时间基准；数据损坏（如进程崩溃留下的半条记录）时向后查找下一个文件头。
+ */
+
+#ifndef LOGBIN_H
+#define LOGBIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "logfmt.h"
+
+#define LOGBIN_MAGIC "DHLG"
+#define LOGBIN_VERSION 1
+#define LOGBIN_HEADER_LEN 8
+#define LOGBIN_STRINGS 256              // 字符串表容量（写满后清空重新编号）
+#define LOGBIN_STRING_MAX 64            // 单个字符串的上限（含结尾的0）
+#define LOGBIN_RECORD_MAX 1024          // 单条记录内容的上限（超出视为数据损坏）
+#define LOGBIN_EVENT_MAX 2048           // 编码一个事件最多需要的字节数（含字符串定义和时区记录）
+
+/* 记录类型（事件记录直接用logger_event_t） */
+#define LOGBIN_REC_STRING 0x40
+#define LOGBIN_REC_TZ 0x41
+
+/* 写出端状态（只由写出线程访问） */
+typedef struct {
+    const char *strings[LOGBIN_STRINGS * 2]; // 已定义的字符串（按指针开放寻址，字符串须为常量或在进程内不变）
+    uint16_t ids[LOGBIN_STRINGS * 2];
+    unsigned string_count;
+    int64_t last_us;                // 上一条事件的时间（微秒）
+    time_t tz_checked;              // 最近检查时区偏移的秒
+    long utc_offset;                // 最近写出的时区偏移
+    int tz_valid;                   // 0表示还没有写出时区记录
+} logbin_writer_t;
+
+/* 读取端状态 */
+typedef struct {
+    char strings[LOGBIN_STRINGS][LOGBIN_STRING_MAX];
+    uint8_t defined[LOGBIN_STRINGS];
+    int synced;                     // 0表示需要查找文件头（开头或数据损坏之后）
+    int precision;                  // 文件头中的时间精度
+    long utc_offset;                // 最近的时区偏移
+    int64_t last_us;
+    uint64_t skipped;               // 因损坏跳过的字节数
+    uint64_t bad_records;           // 无法还原的事件数（帧无法解析或引用了未定义的字符串）
+} logbin_reader_t;
+
+/* logbin_decode的返回值 */
+typedef enum {
+    LOGBIN_MORE = -1,               // 数据不足一条记录，需要更多数据
+    LOGBIN_SKIP = 0,                // 消耗了文件头、非事件记录或损坏的数据
+    LOGBIN_EVENT = 1                // 解出一个事件
+} logbin_result_t;
+
+/**
+ * 写文件头并重置写出端状态（之后的字符串和时区重新定义）
+ * @param w 写出端状态
+ * @param precision 时间精度（timestamp_precision_t）
+ * @param out 输出，至少LOGBIN_HEADER_LEN字节
+ * @return 写入的字节数
+ */
+size_t logbin_header(logbin_writer_t *w, int precision, uint8_t *out);
+
+/**
+ * 编码一个事件（必要时在前面附带字符串定义和时区记录）
+ * @param w 写出端状态
+ * @param record 事件
+ * @param out 输出
+ * @param cap 输出容量（不小于LOGBIN_EVENT_MAX时一定能写下）
+ * @return 写入的字节数，0表示容量不够
+ */
+size_t logbin_encode(logbin_writer_t *w, const logger_record_t *record, uint8_t *out, size_t cap);
+
+/**
+ * 初始化读取端状态
+ * @param r 读取端状态
+ */
+void logbin_reader_init(logbin_reader_t *r);
+
+/**
+ * 从缓冲区开头解码一条记录
+ * @param r 读取端状态
+ * @param data 数据
+ * @param len 数据长度
+ * @param record 输出的事件（返回LOGBIN_EVENT时有效；字符串指向r中的字符串表，下次解码前有效）
+ * @param used 输出：消耗的字节数
+ * @return logbin_result_t
+ */
+int logbin_decode(logbin_reader_t *r, const uint8_t *data, size_t len, logger_record_t *record, size_t *used);
+
+#endif /* LOGBIN_H */
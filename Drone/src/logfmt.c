@@ -0,0 +1,602 @@
+/*
+ * logfmt.c - 日志事件格式化
+ */
+
+#include "logfmt.h"
+#include "timestamp.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char g_hex_digits[] = "0123456789abcdef";
+
+/* char[]字段转成可打印文本，不可打印字节写成\xNN */
+static void format_chars(const char *str, size_t len, char *out) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)str[i];
+        if (c >= 0x20 && c < 0x7F) {
+            *out++ = (char)c;
+        } else {
+            *out++ = '\\';
+            *out++ = 'x';
+            *out++ = g_hex_digits[c >> 4];
+            *out++ = g_hex_digits[c & 0x0F];
+        }
+    }
+    *out = '\0';
+}
+
+/* 日志中固定的键（logfmt_init时转义一次，写出时直接拷贝） */
+enum {
+    KEY_TIME = 0,
+    KEY_EVENT,
+    KEY_IP,
+    KEY_PORT,
+    KEY_LOCAL_PORT,
+    KEY_DESC,
+    KEY_PROTO,
+    KEY_SERVICE,
+    KEY_BYTES,
+    KEY_CONTENT,
+    KEY_MSG_INFO,
+    KEY_MSG_TYPE,
+    KEY_VEHICLE_TYPE,
+    KEY_AUTOPILOT,
+    KEY_SYSID,
+    KEY_COMPID,
+    KEY_LINK_ID,
+    KEY_SIGN_TIMESTAMP,
+    KEY_SIGN_TIME,
+    KEY_SIGN_STATUS,
+    KEY_SIGN_KEY,
+    KEY_MSGID,
+    KEY_COMMAND_ID,
+    KEY_COMMAND_NAME,
+    KEY_PARAMS,
+    KEY_ACTION,
+    KEY_CUSTOM_MODE,
+    KEY_FLIGHT_MODE,
+    KEY_TARGET_ALT,
+    KEY_REQUEST_MSGID,
+    KEY_MSG_NAME,
+    KEY_MSG_CATEGORY,
+    KEY_PARAM1,
+    KEY_PARAM2,
+    KEY_PARAM3,
+    KEY_PARAM4,
+    KEY_PARAM5,
+    KEY_PARAM6,
+    KEY_PARAM7,
+    KEY_LAT,
+    KEY_LON,
+    KEY_ALT,
+    KEY_WARNING,
+    KEY_DATA_LEN,
+    KEY_FIELDS,
+    KEY_COUNT
+};
+
+static jsonw_key_t g_keys[KEY_COUNT] = {
+    [KEY_TIME] = { "时间" },
+    [KEY_EVENT] = { "事件类型" },
+    [KEY_IP] = { "来源IP" },
+    [KEY_PORT] = { "来源端口" },
+    [KEY_LOCAL_PORT] = { "目标端口" },
+    [KEY_DESC] = { "描述" },
+    [KEY_PROTO] = { "协议" },
+    [KEY_SERVICE] = { "服务" },
+    [KEY_BYTES] = { "字节数" },
+    [KEY_CONTENT] = { "内容" },
+    [KEY_MSG_INFO] = { "消息信息" },
+    [KEY_MSG_TYPE] = { "消息类型" },
+    [KEY_VEHICLE_TYPE] = { "飞行器类型" },
+    [KEY_AUTOPILOT] = { "自驾仪类型" },
+    [KEY_SYSID] = { "系统ID" },
+    [KEY_COMPID] = { "组件ID" },
+    [KEY_LINK_ID] = { "链路ID" },
+    [KEY_SIGN_TIMESTAMP] = { "签名时间戳" },
+    [KEY_SIGN_TIME] = { "签名时间" },
+    [KEY_SIGN_STATUS] = { "校验结果" },
+    [KEY_SIGN_KEY] = { "匹配密钥" },
+    [KEY_MSGID] = { "消息ID" },
+    [KEY_COMMAND_ID] = { "命令ID" },
+    [KEY_COMMAND_NAME] = { "命令名称" },
+    [KEY_PARAMS] = { "参数" },
+    [KEY_ACTION] = { "动作" },
+    [KEY_CUSTOM_MODE] = { "自定义模式值" },
+    [KEY_FLIGHT_MODE] = { "飞行模式" },
+    [KEY_TARGET_ALT] = { "目标高度(米)" },
+    [KEY_REQUEST_MSGID] = { "请求消息ID" },
+    [KEY_MSG_NAME] = { "消息名称" },
+    [KEY_MSG_CATEGORY] = { "消息类别" },
+    [KEY_PARAM1] = { "参数1" },
+    [KEY_PARAM2] = { "参数2" },
+    [KEY_PARAM3] = { "参数3" },
+    [KEY_PARAM4] = { "参数4" },
+    [KEY_PARAM5] = { "参数5" },
+    [KEY_PARAM6] = { "参数6" },
+    [KEY_PARAM7] = { "参数7" },
+    [KEY_LAT] = { "纬度" },
+    [KEY_LON] = { "经度" },
+    [KEY_ALT] = { "高度" },
+    [KEY_WARNING] = { "警告" },
+    [KEY_DATA_LEN] = { "数据长度" },
+    [KEY_FIELDS] = { "字段" },
+};
+
+static void put_str(jsonw_t *w, int key, const char *value) {
+    jsonw_key(w, &g_keys[key]);
+    jsonw_string(w, value);
+}
+
+static void put_num(jsonw_t *w, int key, double value) {
+    jsonw_key(w, &g_keys[key]);
+    jsonw_number(w, value);
+}
+
+/* 开始一个嵌套对象，以jsonw_object_end结束 */
+static void begin_object(jsonw_t *w, int key) {
+    jsonw_key(w, &g_keys[key]);
+    jsonw_object_begin(w);
+}
+
+/* 事件的公共字段：时间、事件类型、来源IP和端口（对象保持打开） */
+static void put_header(jsonw_t *w, const struct timespec *when, const char *event_type,
+                       const client_info_t *client) {
+    jsonw_object_begin(w);
+    put_str(w, KEY_TIME, timestamp_format(when));
+    put_str(w, KEY_EVENT, event_type);
+    put_str(w, KEY_IP, client->ip_str);
+    put_num(w, KEY_PORT, client->port);
+}
+
+/*
+ * 按生成的字段描述符解码整个载荷，写出"字段"对象
+ * 标量输出数值，char[]输出文本，uint8_t/int8_t数组输出十六进制串，其他数组输出数值数组
+ */
+static void put_payload_fields(jsonw_t *w, const mavlink_frame_t *frame) {
+    const mavlink_field_info_t *fields = mavlink_msg_fields(frame->info);
+    if (!fields) {
+        return;
+    }
+    
+    char text[MAVLINK_MAX_PAYLOAD_LEN * 4 + 1];
+    begin_object(w, KEY_FIELDS);
+    
+    for (uint8_t i = 0; i < frame->info->field_count; i++) {
+        const mavlink_field_info_t *field = &fields[i];
+        
+        jsonw_key_str(w, field->label);
+        if (field->array_len == 0) {
+            jsonw_number(w, mavlink_field_number(frame, field, 0));
+        } else if (field->type == MAVLINK_FIELD_CHAR) {
+            size_t len;
+            const char *str = mavlink_field_chars(frame, field, &len);
+            format_chars(str, len, text);
+            jsonw_string(w, text);
+        } else if (field->size == 1) {
+            for (size_t j = 0; j < field->array_len; j++) {
+                uint8_t b = mavlink_frame_u8(frame, field->offset + j);
+                text[j * 2] = g_hex_digits[b >> 4];
+                text[j * 2 + 1] = g_hex_digits[b & 0x0F];
+            }
+            text[field->array_len * 2] = '\0';
+            jsonw_string(w, text);
+        } else {
+            jsonw_array_begin(w);
+            for (size_t j = 0; j < field->array_len; j++) {
+                jsonw_number(w, mavlink_field_number(frame, field, j));
+            }
+            jsonw_array_end(w);
+        }
+    }
+    jsonw_object_end(w);
+}
+
+static void write_connection(jsonw_t *w, const struct timespec *when, const client_info_t *client) {
+    put_header(w, when, "新建连接", client);
+    if (client->local_port) {
+        put_num(w, KEY_LOCAL_PORT, client->local_port);
+    }
+    put_str(w, KEY_DESC, "检测到新的客户端连接");
+    
+    jsonw_object_end(w);
+}
+
+static void write_probe(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                        const char *proto, const char *service, const uint8_t *data, size_t len) {
+    char preview[LOGGER_PROBE_PREVIEW * 4 + 1];
+    
+    put_header(w, when, "端口探测", client);
+    put_str(w, KEY_PROTO, proto);
+    put_num(w, KEY_LOCAL_PORT, client->local_port);
+    put_str(w, KEY_SERVICE, service);
+    put_num(w, KEY_BYTES, (double)len);
+    if (data && len > 0) {
+        format_chars((const char *)data, len < LOGGER_PROBE_PREVIEW ? len : LOGGER_PROBE_PREVIEW, preview);
+        put_str(w, KEY_CONTENT, preview);
+    }
+    
+    jsonw_object_end(w);
+}
+
+/* 心跳载荷中的飞行器类型 */
+static const char *vehicle_type_name(const mavlink_frame_t *frame) {
+    switch (mavlink_frame_u8(frame, MAVLINK_OFFSET_HEARTBEAT_TYPE)) {
+        case 0: return "通用型";
+        case 1: return "固定翼";
+        case 2: return "四旋翼";
+        case 3: return "共轴helicopter";
+        case 4: return "直升机";
+        case 5: return "天线追踪器";
+        case 6: return "地面站";
+        case 7: return "飞艇";
+    }
+    return "未知";
+}
+
+/* 心跳载荷中的自驾仪类型 */
+static const char *autopilot_name(const mavlink_frame_t *frame) {
+    switch (mavlink_frame_u8(frame, MAVLINK_OFFSET_HEARTBEAT_AUTOPILOT)) {
+        case 0: return "通用型";
+        case 3: return "ArduPilot";
+        case 4: return "OpenPilot";
+        case 12: return "PX4";
+    }
+    return "未知";
+}
+
+static void write_heartbeat(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                            const mavlink_frame_t *frame) {
+    put_header(w, when, "心跳消息", client);
+    
+    begin_object(w, KEY_MSG_INFO);
+    put_str(w, KEY_MSG_TYPE, "HEARTBEAT");
+    put_str(w, KEY_VEHICLE_TYPE, vehicle_type_name(frame));
+    put_str(w, KEY_AUTOPILOT, autopilot_name(frame));
+    jsonw_object_end(w);
+    
+    jsonw_object_end(w);
+}
+
+static void write_signed(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                         const mavlink_frame_t *frame, const mavlink_sign_result_t *result,
+                         const char *key_name) {
+    // 签名时间戳单位10微秒，起点2015-01-01 00:00:00 UTC
+    char sign_time_str[64];
+    time_t sign_time = (time_t)(1420070400 + result->timestamp / 100000);
+    struct tm tm_info;
+    gmtime_r(&sign_time, &tm_info);
+    strftime(sign_time_str, sizeof(sign_time_str), "%Y-%m-%d %H:%M:%S UTC", &tm_info);
+    
+    put_header(w, when, "签名流量", client);
+    
+    begin_object(w, KEY_MSG_INFO);
+    put_num(w, KEY_SYSID, frame->sysid);
+    put_num(w, KEY_COMPID, frame->compid);
+    put_num(w, KEY_LINK_ID, result->link_id);
+    put_num(w, KEY_SIGN_TIMESTAMP, (double)result->timestamp);
+    put_str(w, KEY_SIGN_TIME, sign_time_str);
+    put_str(w, KEY_SIGN_STATUS, mavlink_sign_status_name(result->status));
+    if (result->key_index >= 0) {
+        put_str(w, KEY_SIGN_KEY, key_name);
+    }
+    put_num(w, KEY_MSGID, frame->msgid);
+    jsonw_object_end(w);
+    
+    jsonw_object_end(w);
+}
+
+static void write_command(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                          const mavlink_frame_t *frame) {
+    put_header(w, when, "命令接收", client);
+    
+    begin_object(w, KEY_MSG_INFO);
+    
+    // 解析命令payload
+    if (frame->msgid == MAVLINK_MSG_ID_COMMAND_LONG) {
+        put_str(w, KEY_MSG_TYPE, "COMMAND_LONG");
+        
+        // 字段偏移由生成的描述符宏给出（线上顺序，与XML声明顺序不同）
+        uint16_t command = mavlink_frame_u16(frame, MAVLINK_OFFSET_COMMAND_LONG_COMMAND);
+        put_num(w, KEY_COMMAND_ID, command);
+        
+        // 解析命令类型
+        const char *cmd_name = "未知命令";
+        switch (command) {
+            case 16: cmd_name = "导航至航点"; break;
+            case 20: cmd_name = "返回起飞点(RTL)"; break;
+            case 21: cmd_name = "降落"; break;
+            case 22: cmd_name = "起飞"; break;
+            case 84: cmd_name = "执行任务"; break;
+            case 176: cmd_name = "设置飞行模式"; break;
+            case 179: cmd_name = "设置引导位置(旧版)"; break;
+            case 192: cmd_name = "设置引导位置"; break;
+            case 241: cmd_name = "传感器校准"; break;
+            case 400: cmd_name = "解锁/锁定"; break;
+            case 410: cmd_name = "获取Home位置"; break;
+            case 500: cmd_name = "请求自动驾驶仪能力"; break;
+            case 511: cmd_name = "请求消息"; break;
+            case 512: cmd_name = "请求自动驾驶仪能力"; break;
+            case 519: cmd_name = "请求飞行信息"; break;
+            case 520: cmd_name = "开始接收消息"; break;
+            case 521: cmd_name = "请求特定消息"; break;
+            case 2500: cmd_name = "请求相机信息"; break;
+            case 2510: cmd_name = "请求相机设置"; break;
+            case 2800: cmd_name = "全景拍照"; break;
+        }
+        put_str(w, KEY_COMMAND_NAME, cmd_name);
+        
+        // 提取参数 (param1-7, 每个4字节float)
+        begin_object(w, KEY_PARAMS);
+        float param1 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM1);
+        float param2 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM2);
+        float param3 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM3);
+        float param4 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM4);
+        float param5 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM5);
+        float param6 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM6);
+        float param7 = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_LONG_PARAM7);
+        
+        // 根据命令类型解析参数
+        if (command == 400) { // ARM/DISARM
+            put_str(w, KEY_ACTION, param1 == 1.0 ? "解锁" : "锁定");
+        } else if (command == 176) { // SET_MODE
+            int custom_mode = (int)param2;
+            put_num(w, KEY_CUSTOM_MODE, custom_mode);
+            
+            // 解析ArduPilot自定义飞行模式
+            const char *mode_name = "未知模式";
+            switch (custom_mode) {
+                case 0: mode_name = "稳定模式(Stabilize)"; break;
+                case 1: mode_name = "特技模式(Acro)"; break;
+                case 2: mode_name = "高度保持(AltHold)"; break;
+                case 3: mode_name = "自动模式(Auto)"; break;
+                case 4: mode_name = "引导模式(Guided)"; break;
+                case 5: mode_name = "留待模式(Loiter)"; break;
+                case 6: mode_name = "返航模式(RTL)"; break;
+                case 7: mode_name = "绕圈模式(Circle)"; break;
+                case 9: mode_name = "降落模式(Land)"; break;
+                case 11: mode_name = "漂移模式(Drift)"; break;
+                case 13: mode_name = "运动模式(Sport)"; break;
+                case 14: mode_name = "翻转模式(Flip)"; break;
+                case 15: mode_name = "自动调参(AutoTune)"; break;
+                case 16: mode_name = "位置保持(PosHold)"; break;
+                case 17: mode_name = "刹车模式(Brake)"; break;
+                case 18: mode_name = "抛投模式(Throw)"; break;
+                case 19: mode_name = "避障模式(AvoidADSB)"; break;
+                case 20: mode_name = "引导无GPS(GuidedNoGPS)"; break;
+                case 21: mode_name = "智能RTL(SmartRTL)"; break;
+                case 22: mode_name = "流体保持(FlowHold)"; break;
+                case 23: mode_name = "跟随模式(Follow)"; break;
+                case 24: mode_name = "Z字形自动(ZigZag)"; break;
+            }
+            put_str(w, KEY_FLIGHT_MODE, mode_name);
+        } else if (command == 22) { // TAKEOFF
+            if (param7 != 0.0f) {
+                put_num(w, KEY_TARGET_ALT, param7);
+            }
+        } else if (command == 21) { // LAND
+            put_str(w, KEY_ACTION, "执行降落");
+        } else if (command == 20) { // RTL
+            put_str(w, KEY_ACTION, "返回起飞点");
+        } else if (command == 511 || command == 521) { // REQUEST_MESSAGE
+            int msg_id = (int)param1;
+            put_num(w, KEY_REQUEST_MSGID, msg_id);
+            
+            // 解析常见消息ID - 完整映射表
+            const char *msg_name = NULL;
+            switch (msg_id) {
+                // 系统信息类
+                case 0: msg_name = "心跳消息"; break;
+                case 1: msg_name = "系统状态"; break;
+                case 2: msg_name = "系统时间"; break;
+                case 148: msg_name = "自动驾驶仪版本"; break;
+                case 245: msg_name = "扩展系统状态"; break;
+                case 259: msg_name = "自动驾驶仪版本(扩展)"; break;
+                
+                // GPS和位置类
+                case 24: msg_name = "GPS原始数据"; break;
+                case 25: msg_name = "GPS卫星状态"; break;
+                case 33: msg_name = "全局位置(经纬度)"; break;
+                case 32: msg_name = "本地位置(NED坐标)"; break;
+                case 242: msg_name = "返航位置"; break;
+                
+                // 姿态和运动类
+                case 30: msg_name = "姿态信息(欧拉角)"; break;
+                case 31: msg_name = "姿态四元数"; break;
+                case 74: msg_name = "VFR HUD数据"; break;
+                
+                // 电池和动力类
+                case 147: msg_name = "电池状态"; break;
+                case 125: msg_name = "动力状态"; break;
+                
+                // 传感器类
+                case 27: msg_name = "原始IMU数据"; break;
+                case 28: msg_name = "缩放IMU数据"; break;
+                case 29: msg_name = "原始压力数据"; break;
+                case 65: msg_name = "遥控器通道"; break;
+                case 134: msg_name = "地形数据"; break;
+                
+                // 任务和导航类
+                case 42: msg_name = "任务当前项"; break;
+                case 62: msg_name = "导航控制器输出"; break;
+                
+                // 参数类
+                case 22: msg_name = "参数值"; break;
+                case 23: msg_name = "参数设置"; break;
+                
+                // 相机和云台类
+                case 260: msg_name = "相机图像捕获"; break;
+                case 261: msg_name = "相机设置"; break;
+                case 262: msg_name = "存储信息"; break;
+                
+                // 其他
+                case 241: msg_name = "振动信息"; break;
+                case 253: msg_name = "状态文本"; break;
+                
+                default: msg_name = "其他消息"; break;
+            }
+            
+            put_str(w, KEY_MSG_NAME, msg_name);
+            
+            // 添加消息类别
+            const char *category = "其他";
+            if (msg_id == 0) category = "连接管理";
+            else if (msg_id >= 1 && msg_id <= 2) category = "系统状态";
+            else if (msg_id == 245) category = "系统状态";
+            else if (msg_id >= 24 && msg_id <= 33) category = "位置导航";
+            else if (msg_id == 242) category = "位置导航";
+            else if (msg_id >= 27 && msg_id <= 31) category = "姿态运动";
+            else if (msg_id == 147 || msg_id == 125) category = "动力系统";
+            else if (msg_id >= 260 && msg_id <= 262) category = "载荷设备";
+            else if (msg_id == 148 || msg_id == 259) category = "版本信息";
+            else if (msg_id == 134) category = "地形数据";
+            
+            put_str(w, KEY_MSG_CATEGORY, category);
+        } else {
+            // 只显示非零参数
+            if (param1 != 0.0f) put_num(w, KEY_PARAM1, param1);
+            if (param2 != 0.0f) put_num(w, KEY_PARAM2, param2);
+            if (param3 != 0.0f) put_num(w, KEY_PARAM3, param3);
+            if (param4 != 0.0f) put_num(w, KEY_PARAM4, param4);
+            if (param5 != 0.0f) put_num(w, KEY_PARAM5, param5);
+            if (param6 != 0.0f) put_num(w, KEY_PARAM6, param6);
+            if (param7 != 0.0f) put_num(w, KEY_PARAM7, param7);
+        }
+        jsonw_object_end(w);
+    
+    } else if (frame->msgid == MAVLINK_MSG_ID_COMMAND_INT) {
+        put_str(w, KEY_MSG_TYPE, "COMMAND_INT");
+        
+        // 提取命令ID
+        uint16_t command = mavlink_frame_u16(frame, MAVLINK_OFFSET_COMMAND_INT_COMMAND);
+        put_num(w, KEY_COMMAND_ID, command);
+        
+        const char *cmd_name = "未知命令";
+        switch (command) {
+            case 16: cmd_name = "导航至航点"; break;
+            case 80: cmd_name = "设置ROI位置"; break;
+            case 81: cmd_name = "ROI跟随"; break;
+            case 192: cmd_name = "设置引导位置"; break;
+            case 195: cmd_name = "设置引导位置(扩展)"; break;
+        }
+        put_str(w, KEY_COMMAND_NAME, cmd_name);
+        
+        // 提取坐标参数
+        int32_t x = mavlink_frame_i32(frame, MAVLINK_OFFSET_COMMAND_INT_X);
+        int32_t y = mavlink_frame_i32(frame, MAVLINK_OFFSET_COMMAND_INT_Y);
+        float z = mavlink_frame_float(frame, MAVLINK_OFFSET_COMMAND_INT_Z);
+        
+        begin_object(w, KEY_PARAMS);
+        put_num(w, KEY_LAT, x / 1e7);
+        put_num(w, KEY_LON, y / 1e7);
+        put_num(w, KEY_ALT, z);
+        jsonw_object_end(w);
+    }
+    
+    jsonw_object_end(w);
+    put_str(w, KEY_WARNING, "检测到控制命令尝试");
+    
+    jsonw_object_end(w);
+}
+
+static void write_request(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                          const mavlink_frame_t *frame) {
+    put_header(w, when, "数据请求", client);
+    
+    begin_object(w, KEY_MSG_INFO);
+    put_str(w, KEY_MSG_TYPE, "REQUEST_DATA");
+    put_num(w, KEY_MSGID, frame->msgid);
+    put_payload_fields(w, frame);
+    jsonw_object_end(w);
+    
+    jsonw_object_end(w);
+}
+
+static void write_unknown(jsonw_t *w, const struct timespec *when, const client_info_t *client,
+                          const mavlink_frame_t *frame) {
+    // 消息名称和事件类型来自元数据表（未知消息为占位项）
+    put_header(w, when, mavlink_category_name(frame->info->category), client);
+    
+    begin_object(w, KEY_MSG_INFO);
+    put_num(w, KEY_MSGID, frame->msgid);
+    put_str(w, KEY_MSG_NAME, frame->info->name_zh);
+    put_num(w, KEY_DATA_LEN, frame->len);
+    put_payload_fields(w, frame);
+    jsonw_object_end(w);
+    
+    jsonw_object_end(w);
+}
+
+int logfmt_init(void) {
+    for (int i = 0; i < KEY_COUNT; i++) {
+        if (jsonw_key_prepare(&g_keys[i]) < 0) {
+            fprintf(stderr, "日志键名过长: %s\n", g_keys[i].name);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int logfmt_json(jsonw_t *w, const logger_record_t *record) {
+    const client_info_t *client = &record->client;
+    const mavlink_frame_t *frame = &record->u.mav.frame;
+    
+    switch (record->type) {
+        case LOGGER_EV_CONNECTION:
+            write_connection(w, &record->time, client);
+            break;
+        case LOGGER_EV_PROBE:
+            write_probe(w, &record->time, client, record->u.probe.proto, record->u.probe.service,
+                        record->u.probe.preview, record->u.probe.len);
+            break;
+        case LOGGER_EV_HEARTBEAT:
+            write_heartbeat(w, &record->time, client, frame);
+            break;
+        case LOGGER_EV_SIGNED:
+            write_signed(w, &record->time, client, frame, &record->u.mav.sign, record->u.mav.sign_key);
+            break;
+        case LOGGER_EV_COMMAND:
+            write_command(w, &record->time, client, frame);
+            break;
+        case LOGGER_EV_REQUEST:
+            write_request(w, &record->time, client, frame);
+            break;
+        default:
+            write_unknown(w, &record->time, client, frame);
+            break;
+    }
+    return jsonw_ok(w) ? 0 : -1;
+}
+
+void logfmt_print(const logger_record_t *record) {
+    const client_info_t *client = &record->client;
+    const mavlink_frame_t *frame = &record->u.mav.frame;
+    
+    switch (record->type) {
+        case LOGGER_EV_CONNECTION:
+            printf("[连接] %s:%d\n", client->ip_str, client->port);
+            break;
+        case LOGGER_EV_PROBE:
+            printf("[探测] %s/%u (%s) %s:%d, %zu字节\n", record->u.probe.proto, client->local_port,
+                   record->u.probe.service, client->ip_str, client->port, record->u.probe.len);
+            break;
+        case LOGGER_EV_HEARTBEAT:
+            printf("[心跳] %s:%d | %s | %s\n", client->ip_str, client->port,
+                   vehicle_type_name(frame), autopilot_name(frame));
+            break;
+        case LOGGER_EV_SIGNED:
+            printf("[签名] %s:%d | 系统%u 链路%u | %s\n", client->ip_str, client->port,
+                   frame->sysid, record->u.mav.sign.link_id, mavlink_sign_status_name(record->u.mav.sign.status));
+            break;
+        case LOGGER_EV_COMMAND:
+            printf("[命令] %s:%d | 消息ID=%u\n", client->ip_str, client->port, (unsigned)frame->msgid);
+            break;
+        case LOGGER_EV_REQUEST:
+            printf("[请求] %s:%d | 消息ID=%u\n", client->ip_str, client->port, (unsigned)frame->msgid);
+            break;
+        default:
+            printf("[%s] %s:%d | %s (ID=%u)\n", mavlink_category_name(frame->info->category),
+                   client->ip_str, client->port, frame->info->name_zh, (unsigned)frame->msgid);
+            break;
+    }
+}
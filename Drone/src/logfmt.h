@@ -0,0 +1,71 @@
+/*
+ * logfmt.h - 日志事件格式化
+ * 事件记录只保存原始数据（客户端、帧、时间）；格式化成中文JSON行和控制台输出的代码集中在这里，
+ * 日志写出线程和离线转换工具drone_logcat共用，同一个事件在两处得到逐字节相同的JSON。
+ */
+
+#ifndef LOGFMT_H
+#define LOGFMT_H
+
+#include <stdint.h>
+#include <time.h>
+#include "logger.h"
+#include "jsonw.h"
+
+#define LOGGER_PROBE_PREVIEW 128     // 探测日志记录的载荷前缀字节数
+#define LOGGER_LINE_MAX 8192         // 一条日志的上限（最长的载荷全部解码约2KB）
+
+/* 事件类型 */
+typedef enum {
+    LOGGER_EV_CONNECTION = 0,
+    LOGGER_EV_PROBE,
+    LOGGER_EV_HEARTBEAT,
+    LOGGER_EV_SIGNED,
+    LOGGER_EV_COMMAND,
+    LOGGER_EV_REQUEST,
+    LOGGER_EV_UNKNOWN,
+    LOGGER_EV_COUNT
+} logger_event_t;
+
+/* 事件：只有原始数据，格式化在写出线程（或drone_logcat）中进行 */
+typedef struct {
+    uint8_t type;                   // logger_event_t
+    struct timespec time;           // 事件发生时间（timestamp_now）
+    client_info_t client;
+    union {
+        struct {
+            mavlink_frame_t frame;  // 帧视图，指针指向下面的bytes
+            mavlink_sign_result_t sign; // 签名校验结果（签名流量）
+            const char *sign_key;   // 匹配的密钥名（key_index >= 0时有效，密钥表加载后不再变化）
+            uint8_t bytes[MAVLINK_MAX_FRAME_LEN];
+        } mav;
+        struct {
+            const char *proto;      // 字符串常量
+            const char *service;
+            size_t len;             // 收到的字节数
+            uint8_t preview[LOGGER_PROBE_PREVIEW]; // 前缀（不超过len）
+        } probe;
+    } u;
+} logger_record_t;
+
+/**
+ * 初始化格式化用的键表（转义一次，写出时直接拷贝）
+ * @return 0成功，-1失败
+ */
+int logfmt_init(void);
+
+/**
+ * 把事件格式化为一个JSON对象（不含换行），时间按timestamp_format格式化
+ * @param w JSON写出器
+ * @param record 事件
+ * @return 0成功，-1超出写出器的容量
+ */
+int logfmt_json(jsonw_t *w, const logger_record_t *record);
+
+/**
+ * 在标准输出打印事件的一行摘要
+ * @param record 事件
+ */
+void logfmt_print(const logger_record_t *record);
+
+#endif /* LOGFMT_H */
@@ -1,456 +1,603 @@
 /*
  * logger.c - 中文日志记录实现
+ * 事件队列是有界的多生产者单消费者环（每个槽带序号，生产者用CAS占位，不加锁）：
+ * 各工作线程占一个槽、拷入事件后发布；写出线程按顺序取出、格式化进输出缓冲区（JSON行或二进制记录），
+ * 按写出策略调用write。
  */
 
 #include "logger.h"
 #include "config.h"
-#include "../lib/cJSON.h"
+#include "jsonw.h"
+#include "logfmt.h"
+#include "logbin.h"
+#include "timestamp.h"
+#include "logarchive.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
-static FILE *log_file = NULL;
+#define LOGGER_RING_MASK (LOGGER_RING_SIZE - 1)
 
-/* 获取当前时间字符串 */
-static void get_current_time(char *buffer, size_t size) {
-    time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
-    strftime(buffer, size, "%Y-%m-%d %H:%M:%S", tm_info);
+/* 队列槽：seq等于位置时可写，等于位置+1时可读（取出后加上LOGGER_RING_SIZE，留给下一圈） */
+typedef struct {
+    uint64_t seq;
+    logger_record_t record;
+} logger_slot_t;
+
+static int g_log_fd = -1;
+static char g_log_path[256];        // 正在写的文件
+static uint64_t g_file_size = 0;    // 正在写的文件大小
+static time_t g_day_end = 0;        // 正在写的文件所属日期的结束时间（本地时间次日0点）
+static uint64_t g_rotate_bytes = (uint64_t)LOGGER_ROTATE_MB * 1024 * 1024;
+static uint64_t g_rotate_at = 0;    // 文件达到此大小时按大小轮转（失败后推迟一个阈值再试）
+static unsigned g_segment_index = 0; // 当天最后使用的段序号
+static logarchive_policy_t g_archive = { LOGGER_COMPRESS_LEVEL, 0, 0 };
+static int g_format = LOGGER_FORMAT_JSON;
+static logbin_writer_t g_bin;       // 二进制格式的字符串表和时间基准（只由写出线程访问）
+static int g_bin_header = 0;        // 1表示下一条记录之前要先写文件头（新打开的文件或写失败之后）
+
+static logger_slot_t *g_ring = NULL;
+static uint64_t g_tail __attribute__((aligned(64))); // 下一个可占用的位置（生产者）
+static uint64_t g_head __attribute__((aligned(64))); // 下一个要取出的位置（写出线程）
+static uint64_t g_dropped;
+static int g_writer_idle = 0;       // 写出线程即将等待，生产者发布后需要唤醒
+static int g_wake_fd = -1;          // 唤醒写出线程的eventfd
+static int g_stopping = 0;
+static pthread_t g_writer;
+static int g_sync = LOGGER_SYNC_INTERVAL;
+static unsigned g_flush_ms = LOGGER_FLUSH_MS;
+static logger_stats_t g_stats;      // 写出线程更新的部分
+
+/* 输出缓冲区（只由写出线程访问） */
+static char g_out[LOGGER_WRITE_BUF];
+static size_t g_out_len = 0;
+
+/* logger_flush的等待：g_synced之前的事件都已写入文件 */
+static pthread_mutex_t g_flush_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_flush_cond = PTHREAD_COND_INITIALIZER;
+static uint64_t g_synced = 0;
+static uint64_t g_flush_target = 0;
+
+/* 日志文件扩展名 */
+static const char *log_suffix(void) {
+    return g_format == LOGGER_FORMAT_BINARY ? ".bin" : ".json";
 }
 
-/* 获取日志文件名 */
-static void get_log_filename(char *buffer, size_t size) {
-    time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
+/* 获取when所在日期的日志文件名 */
+static void get_log_filename(time_t when, char *buffer, size_t size) {
+    struct tm tm_info;
     char date_str[32];
-    strftime(date_str, sizeof(date_str), "%Y%m%d", tm_info);
-    snprintf(buffer, size, "%s/%s_%s.json", LOG_DIR, LOG_FILE_PREFIX, date_str);
+    localtime_r(&when, &tm_info);
+    strftime(date_str, sizeof(date_str), "%Y%m%d", &tm_info);
+    snprintf(buffer, size, "%s/%s_%s%s", LOG_DIR, LOG_FILE_PREFIX, date_str, log_suffix());
 }
 
-/* 写入JSON日志 */
-static void write_json_log(cJSON *json_obj) {
-    if (!log_file) {
-        return;
-    }
-    
-    char *json_str = cJSON_PrintUnformatted(json_obj);
-    if (json_str) {
-        fprintf(log_file, "%s\n", json_str);
-        fflush(log_file);
-        free(json_str);
-    }
+/* when所在日期的结束时间（本地时间次日0点） */
+static time_t get_day_end(time_t when) {
+    struct tm tm_info;
+    localtime_r(&when, &tm_info);
+    tm_info.tm_hour = 0;
+    tm_info.tm_min = 0;
+    tm_info.tm_sec = 0;
+    tm_info.tm_mday++;
+    tm_info.tm_isdst = -1;
+    return mktime(&tm_info);
 }
 
-int logger_init(void) {
-    // 创建日志目录
-    mkdir(LOG_DIR, 0755);
-    
-    // 打开日志文件
-    char log_filename[256];
-    get_log_filename(log_filename, sizeof(log_filename));
-    
-    log_file = fopen(log_filename, "a");
-    if (!log_file) {
-        perror("无法打开日志文件");
+/**
+ * 打开（追加）日志文件，成为正在写的文件
+ * @param path 路径
+ * @param when 文件所属日期内的时间
+ * @return 0成功，-1失败（原来的文件不变）
+ */
+static int open_log_file(const char *path, time_t when) {
+    struct stat st;
+    int fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
         return -1;
     }
     
-    printf("日志系统初始化成功，文件: %s\n", log_filename);
+    if (g_log_fd >= 0) {
+        close(g_log_fd);
+    }
+    g_log_fd = fd;
+    if (path != g_log_path) {
+        snprintf(g_log_path, sizeof(g_log_path), "%s", path);
+    }
+    g_file_size = fstat(fd, &st) == 0 ? (uint64_t)st.st_size : 0;
+    g_rotate_at = g_rotate_bytes;
+    g_day_end = get_day_end(when);
+    g_bin_header = 1;
     return 0;
 }
 
-void logger_connection(const client_info_t *client) {
-    char time_str[64];
-    get_current_time(time_str, sizeof(time_str));
-    
-    cJSON *json = cJSON_CreateObject();
-    cJSON_AddStringToObject(json, "时间", time_str);
-    cJSON_AddStringToObject(json, "事件类型", "新建连接");
-    cJSON_AddStringToObject(json, "来源IP", client->ip_str);
-    cJSON_AddNumberToObject(json, "来源端口", client->port);
-    cJSON_AddStringToObject(json, "描述", "检测到新的客户端连接");
+/* 日期变了：换到新日期的文件，旧文件交给归档线程（调用前缓冲区已写空） */
+static void rotate_by_date(time_t when) {
+    char old_path[sizeof(g_log_path)];
+    char path[sizeof(g_log_path)];
     
-    write_json_log(json);
-    cJSON_Delete(json);
-    
-    printf("[连接] %s:%d\n", client->ip_str, client->port);
+    memcpy(old_path, g_log_path, sizeof(old_path));
+    get_log_filename(when, path, sizeof(path));
+    logarchive_set_active(path);
+    if (open_log_file(path, when) < 0) {
+        // 继续写旧文件，一分钟后再试
+        perror("打开新日志文件失败");
+        logarchive_set_active(old_path);
+        g_day_end = when + 60;
+        return;
+    }
+    g_segment_index = 0;
+    g_stats.rotations++;
+    logarchive_submit(old_path);
 }
 
-void logger_heartbeat(const client_info_t *client, const mavlink_message_t *msg) {
-    char time_str[64];
-    get_current_time(time_str, sizeof(time_str));
+/* 文件超过大小阈值：改名为drone_honeypot_YYYYMMDD.N.json（.bin）交给归档线程，重新打开同名文件继续写 */
+static void rotate_by_size(void) {
+    char segment[sizeof(g_log_path) + 16];
+    char gz_path[sizeof(segment) + 8];
+    const char *suffix = log_suffix();
+    size_t base_len = strlen(g_log_path) - strlen(suffix);
+    struct stat st;
     
-    // 解析心跳载荷
-    uint8_t vehicle_type = msg->payload[4];
-    uint8_t autopilot = msg->payload[5];
+    // 跳过已存在的序号（包括上次运行留下的和已压缩的）
+    do {
+        g_segment_index++;
+        snprintf(segment, sizeof(segment), "%.*s.%u%s", (int)base_len, g_log_path, g_segment_index, suffix);
+        snprintf(gz_path, sizeof(gz_path), "%s.gz", segment);
+    } while (stat(segment, &st) == 0 || stat(gz_path, &st) == 0);
     
-    const char *vehicle_type_str = "未知";
-    switch (vehicle_type) {
-        case 0: vehicle_type_str = "通用型"; break;
-        case 1: vehicle_type_str = "固定翼"; break;
-        case 2: vehicle_type_str = "四旋翼"; break;
-        case 3: vehicle_type_str = "共轴helicopter"; break;
-        case 4: vehicle_type_str = "直升机"; break;
-        case 5: vehicle_type_str = "天线追踪器"; break;
-        case 6: vehicle_type_str = "地面站"; break;
-        case 7: vehicle_type_str = "飞艇"; break;
+    if (rename(g_log_path, segment) < 0) {
+        perror("日志轮转失败");
+        g_rotate_at = g_file_size + g_rotate_bytes;
+        return;
     }
+    if (open_log_file(g_log_path, g_day_end - 1) < 0) {
+        perror("日志轮转失败");
+        rename(segment, g_log_path);
+        g_rotate_at = g_file_size + g_rotate_bytes;
+        return;
+    }
+    g_stats.rotations++;
+    logarchive_submit(segment);
+}
+
+/* 把输出缓冲区写入文件 */
+static void out_write(void) {
+    size_t done = 0;
     
-    const char *autopilot_str = "未知";
-    switch (autopilot) {
-        case 0: autopilot_str = "通用型"; break;
-        case 3: autopilot_str = "ArduPilot"; break;
-        case 4: autopilot_str = "OpenPilot"; break;
-        case 12: autopilot_str = "PX4"; break;
+    while (done < g_out_len) {
+        ssize_t n = write(g_log_fd, g_out + done, g_out_len - done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            // 磁盘满等错误：丢弃这一批，下次继续尝试（二进制格式丢了字符串定义，从新的文件头开始）
+            if (g_stats.write_errors++ == 0) {
+                perror("写日志文件失败");
+            }
+            g_bin_header = 1;
+            break;
+        }
+        done += (size_t)n;
     }
+    __atomic_fetch_add(&g_stats.writes, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_stats.bytes, done, __ATOMIC_RELAXED);
+    if (g_sync == LOGGER_SYNC_FSYNC) {
+        fdatasync(g_log_fd);
+    }
+    g_out_len = 0;
     
-    cJSON *json = cJSON_CreateObject();
-    cJSON_AddStringToObject(json, "时间", time_str);
-    cJSON_AddStringToObject(json, "事件类型", "心跳消息");
-    cJSON_AddStringToObject(json, "来源IP", client->ip_str);
-    cJSON_AddNumberToObject(json, "来源端口", client->port);
+    g_file_size += done;
+    if (g_rotate_bytes > 0 && g_file_size >= g_rotate_at) {
+        rotate_by_size();
+    }
+}
+
+/* ---------- 写出线程 ---------- */
+
+/* 二进制格式：编码一条事件追加到输出缓冲区（需要时先写文件头） */
+static void write_binary(const logger_record_t *record) {
+    uint8_t *out = (uint8_t *)g_out + g_out_len;
+    size_t len = 0;
     
-    cJSON *msg_info = cJSON_CreateObject();
-    cJSON_AddStringToObject(msg_info, "消息类型", "HEARTBEAT");
-    cJSON_AddStringToObject(msg_info, "飞行器类型", vehicle_type_str);
-    cJSON_AddStringToObject(msg_info, "自驾仪类型", autopilot_str);
-    cJSON_AddItemToObject(json, "消息信息", msg_info);
+    if (g_bin_header) {
+        len = logbin_header(&g_bin, timestamp_precision(), out);
+        g_bin_header = 0;
+    }
+    size_t n = logbin_encode(&g_bin, record, out + len, LOGGER_LINE_MAX - len);
+    if (n == 0) {
+        g_stats.format_errors++;
+    }
+    g_out_len += len + n;
+}
+
+/* 格式化一条事件，直接写在输出缓冲区末尾（一行一个事件） */
+static void write_record(const logger_record_t *record) {
+    jsonw_t w;
     
-    write_json_log(json);
-    cJSON_Delete(json);
+    // 过了0点：先把缓冲区写进旧文件，再换到新日期的文件
+    if (record->time.tv_sec >= g_day_end) {
+        if (g_out_len > 0) {
+            out_write();
+        }
+        rotate_by_date(record->time.tv_sec);
+    }
+    if (sizeof(g_out) - g_out_len < LOGGER_LINE_MAX) {
+        out_write();
+    }
+    logfmt_print(record);
+    if (g_format == LOGGER_FORMAT_BINARY) {
+        write_binary(record);
+        return;
+    }
     
-    printf("[心跳] %s:%d | %s | %s\n", client->ip_str, client->port, 
-           vehicle_type_str, autopilot_str);
+    // 超长的事件不写半行，整条丢弃
+    jsonw_init(&w, g_out + g_out_len, LOGGER_LINE_MAX - 1);
+    if (logfmt_json(&w, record) < 0) {
+        g_stats.format_errors++;
+        return;
+    }
+    g_out[g_out_len + w.len] = '\n';
+    g_out_len += w.len + 1;
 }
 
-void logger_command(const client_info_t *client, const mavlink_message_t *msg) {
-    char time_str[64];
-    get_current_time(time_str, sizeof(time_str));
-    
-    cJSON *json = cJSON_CreateObject();
-    cJSON_AddStringToObject(json, "时间", time_str);
-    cJSON_AddStringToObject(json, "事件类型", "命令接收");
-    cJSON_AddStringToObject(json, "来源IP", client->ip_str);
-    cJSON_AddNumberToObject(json, "来源端口", client->port);
+/**
+ * 取出并格式化已发布的事件（最多一圈）
+ * @return 取出的事件数
+ */
+static size_t drain_ring(void) {
+    uint64_t tail = __atomic_load_n(&g_tail, __ATOMIC_RELAXED);
+    size_t count = 0;
     
-    cJSON *msg_info = cJSON_CreateObject();
+    if (tail - g_head > g_stats.peak_depth) {
+        g_stats.peak_depth = tail - g_head;
+    }
+    while (count < LOGGER_RING_SIZE) {
+        logger_slot_t *slot = &g_ring[g_head & LOGGER_RING_MASK];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != g_head + 1) {
+            break; // 空，或占了槽的生产者还没发布
+        }
+        write_record(&slot->record);
+        __atomic_store_n(&slot->seq, g_head + LOGGER_RING_SIZE, __ATOMIC_RELEASE);
+        __atomic_store_n(&g_head, g_head + 1, __ATOMIC_RELEASE);
+        count++;
+    }
+    __atomic_fetch_add(&g_stats.written, count, __ATOMIC_RELAXED);
+    return count;
+}
+
+/* 下一个槽是否已发布 */
+static int ring_ready(void) {
+    return __atomic_load_n(&g_ring[g_head & LOGGER_RING_MASK].seq, __ATOMIC_SEQ_CST) == g_head + 1;
+}
+
+/* 缓冲区已写空：通知logger_flush的等待者 */
+static void publish_synced(void) {
+    pthread_mutex_lock(&g_flush_lock);
+    if (g_synced != g_head) {
+        g_synced = g_head;
+        pthread_cond_broadcast(&g_flush_cond);
+    }
+    pthread_mutex_unlock(&g_flush_lock);
+}
+
+static uint64_t monotonic_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static void *writer_main(void *arg) {
+    uint64_t last_write = monotonic_ms();
+    (void)arg;
     
-    // 解析命令payload
-    if (msg->msgid == 76) { // COMMAND_LONG
-        cJSON_AddStringToObject(msg_info, "消息类型", "COMMAND_LONG");
-        
-        // COMMAND_LONG payload布局（MAVLink字段按大小排序）：
-        // 0-3: param1 (float)
-        // 4-7: param2 (float)
-        // 8-11: param3 (float)
-        // 12-15: param4 (float)
-        // 16-19: param5 (float)
-        // 20-23: param6 (float)
-        // 24-27: param7 (float)
-        // 28-29: command (uint16)
-        // 30: target_system (uint8)
-        // 31: target_component (uint8)
-        // 32: confirmation (uint8)
-        
-        // 提取命令ID (字节28-29, little-endian uint16)
-        uint16_t command = msg->payload[28] | (msg->payload[29] << 8);
-        cJSON_AddNumberToObject(msg_info, "命令ID", command);
+    for (;;) {
+        int stopping = __atomic_load_n(&g_stopping, __ATOMIC_ACQUIRE);
+        size_t drained = drain_ring();
+        uint64_t now = monotonic_ms();
         
-        // 解析命令类型
-        const char *cmd_name = "未知命令";
-        switch (command) {
-            case 16: cmd_name = "导航至航点"; break;
-            case 20: cmd_name = "返回起飞点(RTL)"; break;
-            case 21: cmd_name = "降落"; break;
-            case 22: cmd_name = "起飞"; break;
-            case 84: cmd_name = "执行任务"; break;
-            case 176: cmd_name = "设置飞行模式"; break;
-            case 179: cmd_name = "设置引导位置(旧版)"; break;
-            case 192: cmd_name = "设置引导位置"; break;
-            case 241: cmd_name = "传感器校准"; break;
-            case 400: cmd_name = "解锁/锁定"; break;
-            case 410: cmd_name = "获取Home位置"; break;
-            case 500: cmd_name = "请求自动驾驶仪能力"; break;
-            case 511: cmd_name = "请求消息"; break;
-            case 512: cmd_name = "请求自动驾驶仪能力"; break;
-            case 519: cmd_name = "请求飞行信息"; break;
-            case 520: cmd_name = "开始接收消息"; break;
-            case 521: cmd_name = "请求特定消息"; break;
-            case 2500: cmd_name = "请求相机信息"; break;
-            case 2510: cmd_name = "请求相机设置"; break;
-            case 2800: cmd_name = "全景拍照"; break;
+        // 按策略写出：间隔到了、有人等待logger_flush或正在退出时也写出
+        if (g_out_len > 0 &&
+            (g_sync != LOGGER_SYNC_INTERVAL || now - last_write >= g_flush_ms || stopping ||
+             __atomic_load_n(&g_flush_target, __ATOMIC_ACQUIRE) > g_synced)) {
+            out_write();
+            last_write = now;
+        }
+        if (g_out_len == 0) {
+            publish_synced();
+        }
+        if (drained > 0) {
+            continue;
+        }
+        if (stopping) {
+            break;
         }
-        cJSON_AddStringToObject(msg_info, "命令名称", cmd_name);
-        
-        // 提取参数 (param1-7, 每个4字节float)
-        cJSON *params = cJSON_CreateObject();
-        float param1, param2, param3, param4, param5, param6, param7;
-        memcpy(&param1, &msg->payload[0], 4);
-        memcpy(&param2, &msg->payload[4], 4);
-        memcpy(&param3, &msg->payload[8], 4);
-        memcpy(&param4, &msg->payload[12], 4);
-        memcpy(&param5, &msg->payload[16], 4);
-        memcpy(&param6, &msg->payload[20], 4);
-        memcpy(&param7, &msg->payload[24], 4);
         
-        // 根据命令类型解析参数
-        if (command == 400) { // ARM/DISARM
-            cJSON_AddStringToObject(params, "动作", param1 == 1.0 ? "解锁" : "锁定");
-        } else if (command == 176) { // SET_MODE
-            int custom_mode = (int)param2;
-            cJSON_AddNumberToObject(params, "自定义模式值", custom_mode);
-            
-            // 解析ArduPilot自定义飞行模式
-            const char *mode_name = "未知模式";
-            switch (custom_mode) {
-                case 0: mode_name = "稳定模式(Stabilize)"; break;
-                case 1: mode_name = "特技模式(Acro)"; break;
-                case 2: mode_name = "高度保持(AltHold)"; break;
-                case 3: mode_name = "自动模式(Auto)"; break;
-                case 4: mode_name = "引导模式(Guided)"; break;
-                case 5: mode_name = "留待模式(Loiter)"; break;
-                case 6: mode_name = "返航模式(RTL)"; break;
-                case 7: mode_name = "绕圈模式(Circle)"; break;
-                case 9: mode_name = "降落模式(Land)"; break;
-                case 11: mode_name = "漂移模式(Drift)"; break;
-                case 13: mode_name = "运动模式(Sport)"; break;
-                case 14: mode_name = "翻转模式(Flip)"; break;
-                case 15: mode_name = "自动调参(AutoTune)"; break;
-                case 16: mode_name = "位置保持(PosHold)"; break;
-                case 17: mode_name = "刹车模式(Brake)"; break;
-                case 18: mode_name = "抛投模式(Throw)"; break;
-                case 19: mode_name = "避障模式(AvoidADSB)"; break;
-                case 20: mode_name = "引导无GPS(GuidedNoGPS)"; break;
-                case 21: mode_name = "智能RTL(SmartRTL)"; break;
-                case 22: mode_name = "流体保持(FlowHold)"; break;
-                case 23: mode_name = "跟随模式(Follow)"; break;
-                case 24: mode_name = "Z字形自动(ZigZag)"; break;
+        // 等待：先声明空闲再检查一次队列，生产者发布后看到空闲标志就会唤醒（两边都是顺序一致的原子操作，不会漏掉）
+        __atomic_store_n(&g_writer_idle, 1, __ATOMIC_SEQ_CST);
+        if (!ring_ready() && !__atomic_load_n(&g_stopping, __ATOMIC_SEQ_CST)) {
+            struct pollfd pfd = { g_wake_fd, POLLIN, 0 };
+            int timeout = -1;
+            if (g_out_len > 0) {
+                uint64_t waited = monotonic_ms() - last_write;
+                timeout = waited >= g_flush_ms ? 0 : (int)(g_flush_ms - waited);
             }
-            cJSON_AddStringToObject(params, "飞行模式", mode_name);
-        } else if (command == 22) { // TAKEOFF
-            if (param7 != 0.0f) {
-                cJSON_AddNumberToObject(params, "目标高度(米)", param7);
+            if (poll(&pfd, 1, timeout) > 0) {
+                uint64_t value;
+                if (read(g_wake_fd, &value, sizeof(value)) < 0) {
+                    // 计数已被读走，无需处理
+                }
             }
-        } else if (command == 21) { // LAND
-            cJSON_AddStringToObject(params, "动作", "执行降落");
-        } else if (command == 20) { // RTL
-            cJSON_AddStringToObject(params, "动作", "返回起飞点");
-        } else if (command == 511 || command == 521) { // REQUEST_MESSAGE
-            int msg_id = (int)param1;
-            cJSON_AddNumberToObject(params, "请求消息ID", msg_id);
-            
-            // 解析常见消息ID - 完整映射表
-            const char *msg_name = NULL;
-            switch (msg_id) {
-                // 系统信息类
-                case 0: msg_name = "心跳消息"; break;
-                case 1: msg_name = "系统状态"; break;
-                case 2: msg_name = "系统时间"; break;
-                case 148: msg_name = "自动驾驶仪版本"; break;
-                case 245: msg_name = "扩展系统状态"; break;
-                case 259: msg_name = "自动驾驶仪版本(扩展)"; break;
-                
-                // GPS和位置类
-                case 24: msg_name = "GPS原始数据"; break;
-                case 25: msg_name = "GPS卫星状态"; break;
-                case 33: msg_name = "全局位置(经纬度)"; break;
-                case 32: msg_name = "本地位置(NED坐标)"; break;
-                case 242: msg_name = "返航位置"; break;
-                
-                // 姿态和运动类
-                case 30: msg_name = "姿态信息(欧拉角)"; break;
-                case 31: msg_name = "姿态四元数"; break;
-                case 74: msg_name = "VFR HUD数据"; break;
-                
-                // 电池和动力类
-                case 147: msg_name = "电池状态"; break;
-                case 125: msg_name = "动力状态"; break;
-                
-                // 传感器类
-                case 27: msg_name = "原始IMU数据"; break;
-                case 28: msg_name = "缩放IMU数据"; break;
-                case 29: msg_name = "原始压力数据"; break;
-                case 65: msg_name = "遥控器通道"; break;
-                case 134: msg_name = "地形数据"; break;
-                
-                // 任务和导航类
-                case 42: msg_name = "任务当前项"; break;
-                case 62: msg_name = "导航控制器输出"; break;
-                
-                // 参数类
-                case 22: msg_name = "参数值"; break;
-                case 23: msg_name = "参数设置"; break;
-                
-                // 相机和云台类
-                case 260: msg_name = "相机图像捕获"; break;
-                case 261: msg_name = "相机设置"; break;
-                case 262: msg_name = "存储信息"; break;
-                
-                // 其他
-                case 241: msg_name = "振动信息"; break;
-                case 253: msg_name = "状态文本"; break;
-                
-                default: msg_name = "其他消息"; break;
-            }
-            
-            cJSON_AddStringToObject(params, "消息名称", msg_name);
-            
-            // 添加消息类别
-            const char *category = "其他";
-            if (msg_id == 0) category = "连接管理";
-            else if (msg_id >= 1 && msg_id <= 2) category = "系统状态";
-            else if (msg_id == 245) category = "系统状态";
-            else if (msg_id >= 24 && msg_id <= 33) category = "位置导航";
-            else if (msg_id == 242) category = "位置导航";
-            else if (msg_id >= 27 && msg_id <= 31) category = "姿态运动";
-            else if (msg_id == 147 || msg_id == 125) category = "动力系统";
-            else if (msg_id >= 260 && msg_id <= 262) category = "载荷设备";
-            else if (msg_id == 148 || msg_id == 259) category = "版本信息";
-            else if (msg_id == 134) category = "地形数据";
-            
-            cJSON_AddStringToObject(params, "消息类别", category);
-        } else {
-            // 只显示非零参数
-            if (param1 != 0.0f) cJSON_AddNumberToObject(params, "参数1", param1);
-            if (param2 != 0.0f) cJSON_AddNumberToObject(params, "参数2", param2);
-            if (param3 != 0.0f) cJSON_AddNumberToObject(params, "参数3", param3);
-            if (param4 != 0.0f) cJSON_AddNumberToObject(params, "参数4", param4);
-            if (param5 != 0.0f) cJSON_AddNumberToObject(params, "参数5", param5);
-            if (param6 != 0.0f) cJSON_AddNumberToObject(params, "参数6", param6);
-            if (param7 != 0.0f) cJSON_AddNumberToObject(params, "参数7", param7);
-        }
-        cJSON_AddItemToObject(msg_info, "参数", params);
-        
-    } else if (msg->msgid == 75) { // COMMAND_INT
-        cJSON_AddStringToObject(msg_info, "消息类型", "COMMAND_INT");
-        
-        // COMMAND_INT payload布局：
-        // 0-3: param1 (float)
-        // 4-7: param2 (float)
-        // 8-11: param3 (float)
-        // 12-15: param4 (float)
-        // 16-19: x (int32) - 纬度
-        // 20-23: y (int32) - 经度
-        // 24-27: z (float) - 高度
-        // 28-29: command (uint16)
-        // 30: target_system (uint8)
-        // 31: target_component (uint8)
-        // 32: frame (uint8)
-        // 33: current (uint8)
-        // 34: autocontinue (uint8)
-        
-        // 提取命令ID
-        uint16_t command = msg->payload[28] | (msg->payload[29] << 8);
-        cJSON_AddNumberToObject(msg_info, "命令ID", command);
-        
-        const char *cmd_name = "未知命令";
-        switch (command) {
-            case 16: cmd_name = "导航至航点"; break;
-            case 80: cmd_name = "设置ROI位置"; break;
-            case 81: cmd_name = "ROI跟随"; break;
-            case 192: cmd_name = "设置引导位置"; break;
-            case 195: cmd_name = "设置引导位置(扩展)"; break;
         }
-        cJSON_AddStringToObject(msg_info, "命令名称", cmd_name);
-        
-        // 提取坐标参数
-        int32_t x, y;
-        float z;
-        memcpy(&x, &msg->payload[16], 4);
-        memcpy(&y, &msg->payload[20], 4);
-        memcpy(&z, &msg->payload[24], 4);
-        
-        cJSON *params = cJSON_CreateObject();
-        cJSON_AddNumberToObject(params, "纬度", x / 1e7);
-        cJSON_AddNumberToObject(params, "经度", y / 1e7);
-        cJSON_AddNumberToObject(params, "高度", z);
-        cJSON_AddItemToObject(msg_info, "参数", params);
+        __atomic_store_n(&g_writer_idle, 0, __ATOMIC_SEQ_CST);
     }
     
-    cJSON_AddItemToObject(json, "消息信息", msg_info);
-    cJSON_AddStringToObject(json, "警告", "检测到控制命令尝试");
-    
-    write_json_log(json);
-    cJSON_Delete(json);
+    // 控制台输出也在本线程，退出前一并刷出
+    fflush(stdout);
+    return NULL;
+}
+
+static void wake_writer(void) {
+    uint64_t one = 1;
+    if (write(g_wake_fd, &one, sizeof(one)) < 0) {
+        // eventfd计数溢出才会失败，此时写出线程必然已被唤醒
+    }
+}
+
+/* ---------- 生产者 ---------- */
+
+/**
+ * 占一个队列槽，填好后调用ring_publish
+ * @param type 事件类型
+ * @param client 客户端信息
+ * @param pos 输出：槽的位置
+ * @return 槽，队列满（或日志未初始化）时返回NULL
+ */
+static logger_slot_t *ring_reserve(uint8_t type, const client_info_t *client, uint64_t *pos) {
+    if (!g_ring) {
+        return NULL;
+    }
     
-    printf("[命令] %s:%d | 消息ID=%d\n", client->ip_str, client->port, msg->msgid);
+    uint64_t tail = __atomic_load_n(&g_tail, __ATOMIC_RELAXED);
+    for (;;) {
+        logger_slot_t *slot = &g_ring[tail & LOGGER_RING_MASK];
+        int64_t diff = (int64_t)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - tail);
+        if (diff == 0) {
+            // 槽空闲：抢占位置，失败时tail被更新为最新值后重试
+            if (__atomic_compare_exchange_n(&g_tail, &tail, tail + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                slot->record.type = type;
+                timestamp_now(&slot->record.time);
+                slot->record.client = *client;
+                *pos = tail;
+                return slot;
+            }
+        } else if (diff < 0) {
+            // 写出线程落后一整圈：丢弃
+            __atomic_fetch_add(&g_dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        } else {
+            tail = __atomic_load_n(&g_tail, __ATOMIC_RELAXED);
+        }
+    }
 }
 
-void logger_request(const client_info_t *client, const mavlink_message_t *msg) {
-    char time_str[64];
-    get_current_time(time_str, sizeof(time_str));
+/* 发布事件，写出线程在等待时唤醒它 */
+static void ring_publish(logger_slot_t *slot, uint64_t pos) {
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&g_writer_idle, __ATOMIC_SEQ_CST) &&
+        __atomic_exchange_n(&g_writer_idle, 0, __ATOMIC_SEQ_CST)) {
+        wake_writer();
+    }
+}
+
+/* 拷贝帧（连同签名块），视图指针改指向拷贝 */
+static void copy_frame(logger_slot_t *slot, const mavlink_frame_t *frame) {
+    mavlink_frame_t *copy = &slot->record.u.mav.frame;
+    uint8_t *bytes = slot->record.u.mav.bytes;
     
-    cJSON *json = cJSON_CreateObject();
-    cJSON_AddStringToObject(json, "时间", time_str);
-    cJSON_AddStringToObject(json, "事件类型", "数据请求");
-    cJSON_AddStringToObject(json, "来源IP", client->ip_str);
-    cJSON_AddNumberToObject(json, "来源端口", client->port);
+    memcpy(bytes, frame->data, frame->frame_len);
+    *copy = *frame;
+    copy->data = bytes;
+    copy->payload = bytes + (frame->payload - frame->data);
+    copy->signature = frame->signature ? bytes + (frame->signature - frame->data) : NULL;
+}
+
+static void log_frame(uint8_t type, const client_info_t *client, const mavlink_frame_t *frame) {
+    uint64_t pos;
+    logger_slot_t *slot = ring_reserve(type, client, &pos);
+    if (slot) {
+        copy_frame(slot, frame);
+        ring_publish(slot, pos);
+    }
+}
+
+void logger_set_policy(unsigned flush_ms, int sync) {
+    g_flush_ms = flush_ms ? flush_ms : LOGGER_FLUSH_MS;
+    g_sync = sync;
+}
+
+void logger_set_format(int format) {
+    g_format = format;
+}
+
+void logger_set_rotation(uint64_t rotate_bytes, const logarchive_policy_t *archive) {
+    g_rotate_bytes = rotate_bytes;
+    g_archive = *archive;
+}
+
+int logger_init(void) {
+    // 创建日志目录
+    mkdir(LOG_DIR, 0755);
     
-    cJSON *msg_info = cJSON_CreateObject();
-    cJSON_AddStringToObject(msg_info, "消息类型", "REQUEST_DATA");
-    cJSON_AddNumberToObject(msg_info, "消息ID", msg->msgid);
-    cJSON_AddItemToObject(json, "消息信息", msg_info);
+    // 打开当天的日志文件
+    time_t now = time(NULL);
+    char log_filename[256];
+    get_log_filename(now, log_filename, sizeof(log_filename));
+    g_segment_index = 0;
+    if (open_log_file(log_filename, now) < 0) {
+        perror("无法打开日志文件");
+        return -1;
+    }
     
-    write_json_log(json);
-    cJSON_Delete(json);
+    if (logfmt_init() < 0) {
+        close(g_log_fd);
+        g_log_fd = -1;
+        return -1;
+    }
     
-    printf("[请求] %s:%d | 消息ID=%d\n", client->ip_str, client->port, msg->msgid);
-}
-
-void logger_unknown(const client_info_t *client, const mavlink_message_t *msg) {
-    char time_str[64];
-    get_current_time(time_str, sizeof(time_str));
+    g_ring = malloc(sizeof(*g_ring) * LOGGER_RING_SIZE);
+    g_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (!g_ring || g_wake_fd < 0) {
+        perror("日志队列初始化失败");
+        free(g_ring);
+        g_ring = NULL; // 写出线程还没启动
+        logger_close();
+        return -1;
+    }
+    for (uint64_t i = 0; i < LOGGER_RING_SIZE; i++) {
+        g_ring[i].seq = i;
+    }
+    g_head = g_tail = g_dropped = 0;
+    g_synced = g_flush_target = 0;
+    g_stopping = 0;
+    g_writer_idle = 0;
+    g_out_len = 0;
+    memset(&g_stats, 0, sizeof(g_stats));
     
-    // 获取消息名称
-    const char *msg_name = "未知消息";
-    const char *event_type = "其他消息";
+    // 归档线程先启动（写出线程轮转时会提交段），启动失败只是不压缩和清理
+    if (logarchive_start(&g_archive, g_log_path) < 0) {
+        fprintf(stderr, "[日志] 归档线程未启动，日志段不会压缩和清理\n");
+    }
     
-    switch (msg->msgid) {
-        case 2: msg_name = "系统时间"; event_type = "系统信息"; break;
-        case 39: msg_name = "任务项"; event_type = "任务操作"; break;
-        case 43: msg_name = "任务请求"; event_type = "任务操作"; break;
-        case 44: msg_name = "任务设置当前"; event_type = "任务操作"; break;
-        case 47: msg_name = "任务计数"; event_type = "任务操作"; break;
-        case 51: msg_name = "任务开始"; event_type = "任务操作"; break;
-        case 66: msg_name = "数据流请求"; event_type = "数据请求"; break;
-        case 84: msg_name = "设置本地位置目标"; event_type = "位置控制"; break;
-        case 86: msg_name = "设置全局位置目标"; event_type = "位置控制"; break;
-        case 110: msg_name = "时间同步"; event_type = "系统信息"; break;
-        case 111: msg_name = "时间同步响应"; event_type = "系统信息"; break;
-        case 134: msg_name = "地形数据"; event_type = "地形信息"; break;
-        case 148: msg_name = "协议版本"; event_type = "系统信息"; break;
-        default:
-            msg_name = "未识别消息";
-            event_type = "未知消息";
-            break;
+    // 写出线程屏蔽所有信号，退出信号只由主线程的signalfd读取
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    int err = pthread_create(&g_writer, NULL, writer_main, NULL);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (err != 0) {
+        errno = err;
+        perror("创建日志写出线程失败");
+        free(g_ring);
+        g_ring = NULL;
+        logger_close();
+        return -1;
     }
     
-    cJSON *json = cJSON_CreateObject();
-    cJSON_AddStringToObject(json, "时间", time_str);
-    cJSON_AddStringToObject(json, "事件类型", event_type);
-    cJSON_AddStringToObject(json, "来源IP", client->ip_str);
-    cJSON_AddNumberToObject(json, "来源端口", client->port);
+    char rotate_desc[32] = "";
+    if (g_rotate_bytes > 0) {
+        snprintf(rotate_desc, sizeof(rotate_desc), "或每%lluMB", (unsigned long long)(g_rotate_bytes >> 20));
+    }
+    printf("日志轮转: 每天%s, 压缩级别%d, 保留%u天, 配额%lluMB（0表示不限）\n", rotate_desc, g_archive.level,
+           g_archive.retention_days, (unsigned long long)(g_archive.quota_bytes >> 20));
+    printf("日志系统初始化成功，文件: %s (%s格式, 写出间隔%ums, 策略%s)\n", log_filename,
+           g_format == LOGGER_FORMAT_BINARY ? "二进制" : "JSON", g_flush_ms,
+           g_sync == LOGGER_SYNC_FSYNC ? "fsync" : g_sync == LOGGER_SYNC_ALWAYS ? "always" : "interval");
+    return 0;
+}
+
+void logger_connection(const client_info_t *client) {
+    uint64_t pos;
+    logger_slot_t *slot = ring_reserve(LOGGER_EV_CONNECTION, client, &pos);
+    if (slot) {
+        ring_publish(slot, pos);
+    }
+}
+
+void logger_probe(const client_info_t *client, const char *proto, const char *service,
+                  const uint8_t *data, size_t len) {
+    uint64_t pos;
+    logger_slot_t *slot = ring_reserve(LOGGER_EV_PROBE, client, &pos);
+    if (slot) {
+        slot->record.u.probe.proto = proto;
+        slot->record.u.probe.service = service;
+        slot->record.u.probe.len = data ? len : 0;
+        if (data && len > 0) {
+            memcpy(slot->record.u.probe.preview, data, len < LOGGER_PROBE_PREVIEW ? len : LOGGER_PROBE_PREVIEW);
+        }
+        ring_publish(slot, pos);
+    }
+}
+
+void logger_heartbeat(const client_info_t *client, const mavlink_frame_t *frame) {
+    log_frame(LOGGER_EV_HEARTBEAT, client, frame);
+}
+
+void logger_signed(const client_info_t *client, const mavlink_frame_t *frame,
+                   const mavlink_sign_result_t *result) {
+    uint64_t pos;
+    logger_slot_t *slot = ring_reserve(LOGGER_EV_SIGNED, client, &pos);
+    if (slot) {
+        copy_frame(slot, frame);
+        slot->record.u.mav.sign = *result;
+        slot->record.u.mav.sign_key = mavlink_sign_key_name(result->key_index);
+        ring_publish(slot, pos);
+    }
+}
+
+void logger_command(const client_info_t *client, const mavlink_frame_t *frame) {
+    log_frame(LOGGER_EV_COMMAND, client, frame);
+}
+
+void logger_request(const client_info_t *client, const mavlink_frame_t *frame) {
+    log_frame(LOGGER_EV_REQUEST, client, frame);
+}
+
+void logger_unknown(const client_info_t *client, const mavlink_frame_t *frame) {
+    log_frame(LOGGER_EV_UNKNOWN, client, frame);
+}
+
+void logger_flush(void) {
+    if (!g_ring) {
+        return;
+    }
     
-    cJSON *msg_info = cJSON_CreateObject();
-    cJSON_AddNumberToObject(msg_info, "消息ID", msg->msgid);
-    cJSON_AddStringToObject(msg_info, "消息名称", msg_name);
-    cJSON_AddNumberToObject(msg_info, "数据长度", msg->len);
-    cJSON_AddItemToObject(json, "消息信息", msg_info);
+    uint64_t target = __atomic_load_n(&g_tail, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&g_flush_target, target, __ATOMIC_RELEASE);
+    wake_writer();
     
-    write_json_log(json);
-    cJSON_Delete(json);
+    pthread_mutex_lock(&g_flush_lock);
+    while (g_synced < target) {
+        pthread_cond_wait(&g_flush_cond, &g_flush_lock);
+    }
+    pthread_mutex_unlock(&g_flush_lock);
+}
+
+void logger_get_stats(logger_stats_t *stats) {
+    uint64_t head = __atomic_load_n(&g_head, __ATOMIC_ACQUIRE);
     
-    printf("[%s] %s:%d | %s (ID=%d)\n", 
-           event_type, client->ip_str, client->port, msg_name, msg->msgid);
+    *stats = g_stats;
+    stats->queued = __atomic_load_n(&g_tail, __ATOMIC_ACQUIRE);
+    stats->dropped = __atomic_load_n(&g_dropped, __ATOMIC_RELAXED);
+    stats->depth = stats->queued > head ? stats->queued - head : 0;
 }
 
 void logger_close(void) {
-    if (log_file) {
-        fclose(log_file);
-        log_file = NULL;
+    if (g_ring) {
+        __atomic_store_n(&g_stopping, 1, __ATOMIC_RELEASE);
+        wake_writer();
+        pthread_join(g_writer, NULL);
+        free(g_ring);
+        g_ring = NULL;
+    }
+    logarchive_stop();
+    if (g_wake_fd >= 0) {
+        close(g_wake_fd);
+        g_wake_fd = -1;
+    }
+    if (g_log_fd >= 0) {
+        close(g_log_fd);
+        g_log_fd = -1;
         printf("日志系统已关闭\n");
     }
 }
@@ -1,5 +1,9 @@
 /*
  * logger.h - 中文日志记录头文件
+ * 记录函数只把事件的原始数据（客户端、帧、时间）拷进无锁队列，不格式化也不写文件；
+ * 后台写出线程取出事件、格式化成JSON（或编码成紧凑的二进制记录，见logbin.h）并成批写出，
+ * 磁盘慢时转发线程不受影响（队列满时丢弃并计数）。
+ * 写出线程在日期变化或文件超过阈值时轮转，旧段交给归档线程压缩和清理（logarchive.h）。
  */
 
 #ifndef LOGGER_H
@@ -9,6 +13,41 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include "mavlink.h"
+#include "mavlink_sign.h"
+#include "logarchive.h"
+
+#define LOGGER_RING_SIZE 4096           // 事件队列槽数（2的幂）
+#define LOGGER_FLUSH_MS 200             // 默认写出间隔（毫秒）
+#define LOGGER_WRITE_BUF (64 * 1024)    // 写出线程的输出缓冲区
+#define LOGGER_ROTATE_MB 64             // 默认按大小轮转的阈值（MB）
+#define LOGGER_COMPRESS_LEVEL 6         // 默认gzip压缩级别
+
+/* 写出策略 */
+typedef enum {
+    LOGGER_SYNC_INTERVAL = 0,       // 每个写出间隔（或缓冲区满时）写一次，进程崩溃最多丢失一个间隔的日志
+    LOGGER_SYNC_ALWAYS,             // 每取完一轮事件就写出（空闲时相当于逐条写出）
+    LOGGER_SYNC_FSYNC               // 同上，每次写出后fdatasync（断电也不丢失已写出的日志）
+} logger_sync_t;
+
+/* 日志文件格式 */
+typedef enum {
+    LOGGER_FORMAT_JSON = 0,         // 中文JSON行（默认）
+    LOGGER_FORMAT_BINARY            // 紧凑二进制记录，用drone_logcat转换成相同的JSON行
+} logger_format_t;
+
+/* 日志统计（读取时写出线程可能正在计数，结果是近似快照） */
+typedef struct {
+    uint64_t queued;                // 进入队列的事件数
+    uint64_t dropped;               // 队列满时丢弃的事件数
+    uint64_t written;               // 写出线程处理的事件数
+    uint64_t writes;                // write调用次数
+    uint64_t bytes;                 // 写出的字节数
+    uint64_t write_errors;          // 写文件失败次数
+    uint64_t format_errors;         // 超过单行上限而丢弃的事件数
+    uint64_t rotations;             // 日志轮转次数（按日期和按大小）
+    uint64_t depth;                 // 当前队列深度
+    uint64_t peak_depth;            // 队列深度峰值
+} logger_stats_t;
 
 /* 客户端信息结构 */
 typedef struct {
@@ -16,10 +55,34 @@ typedef struct {
     socklen_t addr_len;
     char ip_str[INET_ADDRSTRLEN];
     uint16_t port;
+    uint16_t local_port;            // 对方访问的本地端口（代理主端口或诱饵端口）
 } client_info_t;
 
 /**
- * 初始化日志系统
+ * 设置写出间隔和策略（在logger_init之前调用，不调用时为LOGGER_FLUSH_MS和LOGGER_SYNC_INTERVAL）
+ * @param flush_ms 写出间隔（毫秒），0表示默认值
+ * @param sync logger_sync_t
+ */
+void logger_set_policy(unsigned flush_ms, int sync);
+
+/**
+ * 设置日志文件格式（在logger_init之前调用，不调用时为LOGGER_FORMAT_JSON）
+ * 二进制格式的文件扩展名为.bin，轮转、压缩和清理规则与JSON相同
+ * @param format logger_format_t
+ */
+void logger_set_format(int format);
+
+/**
+ * 设置轮转和归档策略（在logger_init之前调用，不调用时为LOGGER_ROTATE_MB、LOGGER_COMPRESS_LEVEL，不限保留天数和配额）
+ * 日志文件每天一个（drone_honeypot_YYYYMMDD.json），超过大小阈值时旧内容改名为drone_honeypot_YYYYMMDD.N.json；
+ * 轮转出的段由归档线程压缩，并按保留天数和配额删除最旧的段
+ * @param rotate_bytes 按大小轮转的阈值（字节），0表示只按日期轮转
+ * @param archive 归档策略
+ */
+void logger_set_rotation(uint64_t rotate_bytes, const logarchive_policy_t *archive);
+
+/**
+ * 初始化日志系统：打开日志文件，启动写出线程和归档线程
  * @return 0成功，-1失败
  */
 int logger_init(void);
@@ -33,33 +96,64 @@ void logger_connection(const client_info_t *client);
 /**
  * 记录心跳消息
  * @param client 客户端信息
- * @param msg MAVLink消息
+ * @param frame MAVLink帧视图
  */
-void logger_heartbeat(const client_info_t *client, const mavlink_message_t *msg);
+void logger_heartbeat(const client_info_t *client, const mavlink_frame_t *frame);
+
+/**
+ * 记录签名流量（每条签名链路首次出现或校验结果变化时调用）
+ * @param client 客户端信息
+ * @param frame 签名帧视图
+ * @param result 签名校验结果
+ */
+void logger_signed(const client_info_t *client, const mavlink_frame_t *frame,
+                   const mavlink_sign_result_t *result);
 
 /**
  * 记录命令消息
  * @param client 客户端信息
- * @param msg MAVLink消息
+ * @param frame MAVLink帧视图
  */
-void logger_command(const client_info_t *client, const mavlink_message_t *msg);
+void logger_command(const client_info_t *client, const mavlink_frame_t *frame);
 
 /**
  * 记录数据请求
  * @param client 客户端信息
- * @param msg MAVLink消息
+ * @param frame MAVLink帧视图
  */
-void logger_request(const client_info_t *client, const mavlink_message_t *msg);
+void logger_request(const client_info_t *client, const mavlink_frame_t *frame);
 
 /**
  * 记录未知消息
  * @param client 客户端信息
- * @param msg MAVLink消息
+ * @param frame MAVLink帧视图
+ */
+void logger_unknown(const client_info_t *client, const mavlink_frame_t *frame);
+
+/**
+ * 记录诱饵端口上的探测（非MAVLink服务的连接或数据报）
+ * @param client 客户端信息（local_port为被探测的端口）
+ * @param proto 传输协议（"UDP"/"TCP"，须为字符串常量，写出线程稍后才读取）
+ * @param service 服务类型名称（同上）
+ * @param data 收到的数据（只记录前缀），可为NULL
+ * @param len 收到的字节数
+ */
+void logger_probe(const client_info_t *client, const char *proto, const char *service,
+                  const uint8_t *data, size_t len);
+
+/**
+ * 等待此前进入队列的事件全部写入文件（不受写出间隔限制）
+ */
+void logger_flush(void);
+
+/**
+ * 获取日志统计
+ * @param stats 输出
  */
-void logger_unknown(const client_info_t *client, const mavlink_message_t *msg);
+void logger_get_stats(logger_stats_t *stats);
 
 /**
- * 关闭日志系统
+ * 关闭日志系统：写出队列中剩余的事件后停止写出线程
  */
 void logger_close(void);
 
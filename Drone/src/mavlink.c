@@ -1,15 +1,83 @@
 /*
  * mavlink.c - MAVLink协议处理实现（精简版）
- * 只保留解析功能，生成消息由SITL负责
+ * 以解析为主，生成消息由SITL负责；只有SITL未就绪时的占位心跳由代理编码
  */
 
 #include "mavlink.h"
+#include "mavlink_crc.h"
+#include "mavlink_msgs.h"
+#include "mavlink_scan.h"
 #include <string.h>
 
+void mavlink_init(void) {
+    mavlink_crc_init();
+    mavlink_msgs_init();
+    mavlink_scan_init();
+}
+
+/**
+ * 检查载荷长度是否符合消息定义
+ * v1不含扩展字段，长度介于基础长度和最大长度之间；v2会截掉末尾的零字节，只检查上限
+ */
+static int mavlink_payload_len_valid(const mavlink_msg_info_t *info, int is_v2, uint8_t len) {
+    if (!info->known) {
+        return 1;
+    }
+    return len <= info->max_len && (is_v2 || len >= info->min_len);
+}
+
+int mavlink_get_crc_extra(uint32_t msgid, uint8_t *crc_extra) {
+    const mavlink_msg_info_t *info = mavlink_msg_lookup(msgid);
+    *crc_extra = info->crc_extra;
+    return info->known;
+}
+
+size_t mavlink_frame_encode(uint8_t *buf, int is_v2, uint8_t seq, uint8_t sysid, uint8_t compid,
+                            uint32_t msgid, const uint8_t *payload, uint8_t len) {
+    const mavlink_msg_info_t *info = mavlink_msg_lookup(msgid);
+    size_t header_len;
+    
+    if (!info->known || (!is_v2 && msgid > 0xFF)) {
+        return 0;
+    }
+    
+    if (is_v2) {
+        while (len > 1 && payload[len - 1] == 0) {
+            len--;
+        }
+        buf[0] = MAVLINK_STX_V2;
+        buf[1] = len;
+        buf[2] = 0;
+        buf[3] = 0;
+        buf[4] = seq;
+        buf[5] = sysid;
+        buf[6] = compid;
+        buf[7] = (uint8_t)msgid;
+        buf[8] = (uint8_t)(msgid >> 8);
+        buf[9] = (uint8_t)(msgid >> 16);
+        header_len = MAVLINK_HEADER_LEN_V2;
+    } else {
+        buf[0] = MAVLINK_STX_V1;
+        buf[1] = len;
+        buf[2] = seq;
+        buf[3] = sysid;
+        buf[4] = compid;
+        buf[5] = (uint8_t)msgid;
+        header_len = MAVLINK_HEADER_LEN_V1;
+    }
+    memcpy(buf + header_len, payload, len);
+    
+    uint16_t crc = mavlink_crc_calculate(&buf[1], header_len - 1 + len, MAVLINK_CRC_INIT);
+    crc = mavlink_crc_accumulate(info->crc_extra, crc);
+    buf[header_len + len] = (uint8_t)crc;
+    buf[header_len + len + 1] = (uint8_t)(crc >> 8);
+    return header_len + len + MAVLINK_CHECKSUM_LEN;
+}
+
 /**
- * 解析MAVLink消息
+ * 解析一帧MAVLink数据（帧视图）
  */
-int mavlink_parse_message(const uint8_t *data, size_t len, mavlink_message_t *msg) {
+int mavlink_frame_parse(const uint8_t *data, size_t len, mavlink_frame_t *frame) {
     // 检查最小长度
     if (len < MAVLINK_HEADER_LEN_V1 + MAVLINK_CHECKSUM_LEN) {
         return 0;
@@ -32,42 +100,300 @@ int mavlink_parse_message(const uint8_t *data, size_t len, mavlink_message_t *ms
     // 获取payload长度
     uint8_t payload_len = data[1];
     
-    // 检查是否有足够的数据
-    size_t min_msg_len = header_len + payload_len + MAVLINK_CHECKSUM_LEN;
+    // 检查是否有足够的数据（签名帧在校验和之后还有13字节签名块）
+    int is_signed = is_v2 && (data[2] & MAVLINK_IFLAG_SIGNED);
+    size_t checksum_end = header_len + payload_len + MAVLINK_CHECKSUM_LEN;
+    size_t min_msg_len = checksum_end + (is_signed ? MAVLINK_SIGNATURE_LEN : 0);
     if (len < min_msg_len) {
         return 0;
     }
     
-    // 解析消息头
-    msg->magic = data[0];
-    msg->len = payload_len;
+    // 完整消息ID，一次查表得到长度范围和CRC_EXTRA
+    uint32_t msgid = is_v2 ? (data[7] | (data[8] << 8) | ((uint32_t)data[9] << 16)) : data[5];
+    const mavlink_msg_info_t *info = mavlink_msg_lookup(msgid);
+    
+    // 提取并校验校验和（覆盖STX之后的消息头和载荷，再累加CRC_EXTRA）
+    uint16_t checksum = data[header_len + payload_len] | (data[header_len + payload_len + 1] << 8);
+    int result = MAVLINK_FRAME_UNCHECKED;
+    
+    if (info->known) {
+        if (!mavlink_payload_len_valid(info, is_v2, payload_len)) {
+            return MAVLINK_FRAME_BAD_CRC;
+        }
+        uint16_t crc = mavlink_crc_calculate(&data[1], header_len - 1 + payload_len, MAVLINK_CRC_INIT);
+        crc = mavlink_crc_accumulate(info->crc_extra, crc);
+        if (crc != checksum) {
+            return MAVLINK_FRAME_BAD_CRC;
+        }
+        result = MAVLINK_FRAME_OK;
+    }
+    
+    // 解析消息头，载荷保持在原缓冲区
+    frame->data = data;
+    frame->payload = data + header_len;
+    frame->signature = is_signed ? data + checksum_end : NULL;
+    frame->info = info;
+    frame->msgid = msgid;
+    frame->frame_len = (uint16_t)min_msg_len;
+    frame->checksum = checksum;
+    frame->magic = data[0];
+    frame->len = payload_len;
+    frame->crc_checked = (result == MAVLINK_FRAME_OK);
     
     if (is_v2) {
         // MAVLink v2格式
         // [0]=STX, [1]=len, [2]=incompat_flags, [3]=compat_flags,
         // [4]=seq, [5]=sysid, [6]=compid, [7-9]=msgid (24-bit)
-        msg->seq = data[4];
-        msg->sysid = data[5];
-        msg->compid = data[6];
-        // v2的msgid是24位，但我们只存储低8位以兼容v1结构
-        msg->msgid = data[7];  // 只取低8位
+        frame->incompat_flags = data[2];
+        frame->seq = data[4];
+        frame->sysid = data[5];
+        frame->compid = data[6];
     } else {
         // MAVLink v1格式
         // [0]=STX, [1]=len, [2]=seq, [3]=sysid, [4]=compid, [5]=msgid
-        msg->seq = data[2];
-        msg->sysid = data[3];
-        msg->compid = data[4];
-        msg->msgid = data[5];
+        frame->incompat_flags = 0;
+        frame->seq = data[2];
+        frame->sysid = data[3];
+        frame->compid = data[4];
     }
     
-    // 复制payload
-    if (payload_len > 0) {
-        memcpy(msg->payload, &data[header_len], payload_len);
+    return result;
+}
+
+void mavlink_frame_copy(const mavlink_frame_t *frame, mavlink_message_t *msg) {
+    msg->magic = frame->magic;
+    msg->len = frame->len;
+    msg->seq = frame->seq;
+    msg->sysid = frame->sysid;
+    msg->compid = frame->compid;
+    msg->msgid = frame->msgid;
+    memcpy(msg->payload, frame->payload, frame->len);
+    
+    // 还原v2截掉的末尾零字节（未知消息不知道真实长度，只保留收到的部分）
+    if (frame->info->known && frame->len < frame->info->max_len) {
+        memset(msg->payload + frame->len, 0, frame->info->max_len - frame->len);
     }
+    msg->checksum = frame->checksum;
+    msg->crc_checked = frame->crc_checked;
+    msg->info = frame->info;
+}
+
+double mavlink_field_number(const mavlink_frame_t *frame, const mavlink_field_info_t *field, size_t index) {
+    size_t offset = field->offset + index * field->size;
     
-    // 提取校验和
-    msg->checksum = data[header_len + payload_len] | (data[header_len + payload_len + 1] << 8);
+    switch (field->type) {
+        case MAVLINK_FIELD_CHAR:
+        case MAVLINK_FIELD_UINT8:  return mavlink_frame_u8(frame, offset);
+        case MAVLINK_FIELD_INT8:   return mavlink_frame_i8(frame, offset);
+        case MAVLINK_FIELD_UINT16: return mavlink_frame_u16(frame, offset);
+        case MAVLINK_FIELD_INT16:  return mavlink_frame_i16(frame, offset);
+        case MAVLINK_FIELD_UINT32: return mavlink_frame_u32(frame, offset);
+        case MAVLINK_FIELD_INT32:  return mavlink_frame_i32(frame, offset);
+        case MAVLINK_FIELD_UINT64: return (double)mavlink_frame_u64(frame, offset);
+        case MAVLINK_FIELD_INT64:  return (double)mavlink_frame_i64(frame, offset);
+        case MAVLINK_FIELD_FLOAT:  return mavlink_frame_float(frame, offset);
+        case MAVLINK_FIELD_DOUBLE: return mavlink_frame_double(frame, offset);
+    }
+    return 0;
+}
+
+const char *mavlink_field_chars(const mavlink_frame_t *frame, const mavlink_field_info_t *field, size_t *len) {
+    const char *str = (const char *)frame->payload + field->offset;
+    size_t end = field->offset + field->array_len;
     
-    return 1;
+    // v2截掉的末尾零字节不在载荷中，字符串在载荷末尾结束
+    if (end > frame->len) {
+        end = frame->len;
+    }
+    *len = 0;
+    if (field->offset < end) {
+        const char *nul = memchr(str, 0, end - field->offset);
+        *len = nul ? (size_t)(nul - str) : end - field->offset;
+    }
+    return str;
 }
 
+/**
+ * 根据帧头计算整帧长度，含v2签名块（调用者保证v1至少有2字节、v2至少有3字节）
+ */
+static size_t mavlink_frame_length(const uint8_t *data) {
+    if (data[0] == MAVLINK_STX_V2) {
+        size_t signature_len = (data[2] & MAVLINK_IFLAG_SIGNED) ? MAVLINK_SIGNATURE_LEN : 0;
+        return MAVLINK_HEADER_LEN_V2 + data[1] + MAVLINK_CHECKSUM_LEN + signature_len;
+    }
+    return MAVLINK_HEADER_LEN_V1 + data[1] + MAVLINK_CHECKSUM_LEN;
+}
+
+static int mavlink_is_stx(uint8_t byte) {
+    return byte == MAVLINK_STX_V1 || byte == MAVLINK_STX_V2;
+}
+
+static size_t mavlink_header_length(const uint8_t *data) {
+    return (data[0] == MAVLINK_STX_V2) ? MAVLINK_HEADER_LEN_V2 : MAVLINK_HEADER_LEN_V1;
+}
+
+/**
+ * 预检帧头：在等待或校验整帧之前排除不可能的候选
+ * 检查v2不兼容标志，以及已知消息的长度字节是否在合法范围内。
+ * 数据不足以判断的部分视为通过。
+ * @return 1可能是帧头，0不可能
+ */
+static int mavlink_header_plausible(const uint8_t *data, size_t avail) {
+    if (data[0] == MAVLINK_STX_V2) {
+        if (avail >= 3 && (data[2] & ~MAVLINK_IFLAG_SIGNED)) {
+            return 0; // 未知的不兼容标志，按协议必须丢弃
+        }
+        if (avail < MAVLINK_HEADER_LEN_V2) {
+            return 1;
+        }
+        uint32_t msgid = data[7] | (data[8] << 8) | ((uint32_t)data[9] << 16);
+        return mavlink_payload_len_valid(mavlink_msg_lookup(msgid), 1, data[1]);
+    }
+    
+    if (avail < MAVLINK_HEADER_LEN_V1) {
+        return 1;
+    }
+    return mavlink_payload_len_valid(mavlink_msg_lookup(data[5]), 0, data[1]);
+}
+
+void mavlink_parser_init(mavlink_parser_t *parser) {
+    memset(parser, 0, sizeof(*parser));
+}
+
+/**
+ * 扫描一段数据（进入时parser->used必须为0）
+ * 末尾不完整的帧拷贝到parser->buf
+ */
+static size_t mavlink_parser_scan(mavlink_parser_t *parser, const uint8_t *data, size_t len,
+                                  mavlink_frame_handler_t handler, void *ctx) {
+    size_t pos = 0;
+    size_t frames = 0;
+    mavlink_frame_t frame;
+    
+    while (pos < len) {
+        // 向量化跳过非STX字节
+        size_t skip = mavlink_scan_stx(data + pos, len - pos);
+        pos += skip;
+        parser->bytes_skipped += skip;
+        if (pos >= len) {
+            break;
+        }
+        
+        size_t avail = len - pos;
+        if (!mavlink_header_plausible(data + pos, avail)) {
+            pos++;
+            parser->bytes_skipped++;
+            parser->rejected++;
+            continue;
+        }
+        
+        if (avail < mavlink_header_length(data + pos) || avail < mavlink_frame_length(data + pos)) {
+            // 帧不完整，留到下次
+            memcpy(parser->buf, data + pos, avail);
+            parser->used = avail;
+            break;
+        }
+        
+        size_t frame_len = mavlink_frame_length(data + pos);
+        int result = mavlink_frame_parse(data + pos, frame_len, &frame);
+        if (result == MAVLINK_FRAME_BAD_CRC) {
+            // 伪STX或损坏的帧，从下一个字节继续同步
+            pos++;
+            parser->bytes_skipped++;
+            parser->crc_errors++;
+            continue;
+        }
+        if (result == MAVLINK_FRAME_UNCHECKED) {
+            // 无法校验的未知消息只在边界清晰时接受：恰好结束数据或紧跟下一个STX
+            if (pos + frame_len < len && !mavlink_is_stx(data[pos + frame_len])) {
+                pos++;
+                parser->bytes_skipped++;
+                parser->rejected++;
+                continue;
+            }
+            parser->unchecked++;
+        }
+        
+        handler(&frame, ctx);
+        frames++;
+        pos += frame_len;
+    }
+    
+    return frames;
+}
+
+/**
+ * 丢弃暂存候选帧的STX，剩余字节重新扫描
+ */
+static size_t mavlink_parser_reject_pending(mavlink_parser_t *parser,
+                                            mavlink_frame_handler_t handler, void *ctx) {
+    uint8_t rest[MAVLINK_MAX_FRAME_LEN];
+    size_t rest_len = parser->used - 1;
+    
+    memcpy(rest, parser->buf + 1, rest_len);
+    parser->used = 0;
+    parser->bytes_skipped++;
+    return mavlink_parser_scan(parser, rest, rest_len, handler, ctx);
+}
+
+size_t mavlink_parser_feed(mavlink_parser_t *parser, const uint8_t *data, size_t len,
+                           mavlink_frame_handler_t handler, void *ctx) {
+    size_t frames = 0;
+    mavlink_frame_t frame;
+    
+    // 先补全上次遗留的不完整帧
+    while (parser->used > 0 && len > 0) {
+        // 先补齐消息头（长度字节和消息ID），预检通过后再等待整帧
+        size_t header_len = mavlink_header_length(parser->buf);
+        if (parser->used < header_len) {
+            size_t take = header_len - parser->used;
+            take = (take < len) ? take : len;
+            memcpy(parser->buf + parser->used, data, take);
+            parser->used += take;
+            data += take;
+            len -= take;
+            
+            if (!mavlink_header_plausible(parser->buf, parser->used)) {
+                parser->rejected++;
+                frames += mavlink_parser_reject_pending(parser, handler, ctx);
+                continue;
+            }
+            if (parser->used < header_len) {
+                break;
+            }
+        }
+        
+        size_t need = mavlink_frame_length(parser->buf) - parser->used;
+        size_t take = (need < len) ? need : len;
+        memcpy(parser->buf + parser->used, data, take);
+        parser->used += take;
+        data += take;
+        len -= take;
+        if (take < need) {
+            break;
+        }
+        
+        int result = mavlink_frame_parse(parser->buf, parser->used, &frame);
+        if (result == MAVLINK_FRAME_BAD_CRC) {
+            parser->crc_errors++;
+            frames += mavlink_parser_reject_pending(parser, handler, ctx);
+        } else if (result == MAVLINK_FRAME_UNCHECKED && len > 0 && !mavlink_is_stx(data[0])) {
+            parser->rejected++;
+            frames += mavlink_parser_reject_pending(parser, handler, ctx);
+        } else {
+            if (result == MAVLINK_FRAME_UNCHECKED) {
+                parser->unchecked++;
+            }
+            handler(&frame, ctx);
+            frames++;
+            parser->used = 0;
+        }
+    }
+    
+    if (len > 0) {
+        frames += mavlink_parser_scan(parser, data, len, handler, ctx);
+    }
+    
+    parser->frames += frames;
+    return frames;
+}
@@ -7,16 +7,10 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
-/* MAVLink消息ID */
-#define MAVLINK_MSG_ID_HEARTBEAT 0
-#define MAVLINK_MSG_ID_SYS_STATUS 1
-#define MAVLINK_MSG_ID_PARAM_REQUEST_LIST 21
-#define MAVLINK_MSG_ID_PARAM_REQUEST_READ 20
-#define MAVLINK_MSG_ID_PARAM_VALUE 22
-#define MAVLINK_MSG_ID_GPS_RAW_INT 24
-#define MAVLINK_MSG_ID_ATTITUDE 30
-#define MAVLINK_MSG_ID_GLOBAL_POSITION_INT 33
+/* 消息ID和字段偏移由scripts/gen_msgdefs.py根据XML方言生成 */
+#include "mavlink_msgdefs.h"
 
 /* MAVLink协议常量 */
 #define MAVLINK_STX_V1 0xFE         // MAVLink v1 起始标志
@@ -25,26 +19,303 @@
 #define MAVLINK_HEADER_LEN_V2 10    // v2消息头长度
 #define MAVLINK_CHECKSUM_LEN 2      // 校验和长度
 #define MAVLINK_MAX_PAYLOAD_LEN 255 // 最大载荷长度
+#define MAVLINK_IFLAG_SIGNED 0x01   // v2不兼容标志：帧带签名
+#define MAVLINK_SIGNATURE_LEN 13    // 签名块：链路ID(1) + 时间戳(6) + 签名(6)
+#define MAVLINK_MAX_FRAME_LEN (MAVLINK_HEADER_LEN_V2 + MAVLINK_MAX_PAYLOAD_LEN + MAVLINK_CHECKSUM_LEN + MAVLINK_SIGNATURE_LEN)
 
-/* MAVLink消息结构 */
+#define MAVLINK_MAX_MSGID 0xFFFFFF  // v2消息ID为24位
+
+/* 消息类别（决定日志中的事件类型） */
+typedef enum {
+    MAVLINK_CAT_UNKNOWN = 0,        // 未知消息
+    MAVLINK_CAT_CONNECTION,         // 连接管理
+    MAVLINK_CAT_SYSTEM,             // 系统信息
+    MAVLINK_CAT_TELEMETRY,          // 遥测数据
+    MAVLINK_CAT_PARAM,              // 参数操作
+    MAVLINK_CAT_MISSION,            // 任务操作
+    MAVLINK_CAT_COMMAND,            // 命令控制
+    MAVLINK_CAT_POSITION,           // 位置控制
+    MAVLINK_CAT_MANUAL,             // 手动控制
+    MAVLINK_CAT_REQUEST,            // 数据请求
+    MAVLINK_CAT_TERRAIN,            // 地形信息
+    MAVLINK_CAT_OTHER,              // 已定义但未标注类别的消息
+    MAVLINK_CAT_COUNT
+} mavlink_msg_category_t;
+
+/* 日志策略（决定代理如何记录该消息） */
+typedef enum {
+    MAVLINK_LOG_OTHER = 0,          // 按类别记录（logger_unknown）
+    MAVLINK_LOG_SKIP,               // 高频或初始化消息，不记录
+    MAVLINK_LOG_REQUEST,            // 数据请求（logger_request）
+    MAVLINK_LOG_COMMAND             // 控制命令（logger_command）
+} mavlink_log_policy_t;
+
+/* 载荷字段类型 */
+typedef enum {
+    MAVLINK_FIELD_CHAR = 0,
+    MAVLINK_FIELD_UINT8,
+    MAVLINK_FIELD_INT8,
+    MAVLINK_FIELD_UINT16,
+    MAVLINK_FIELD_INT16,
+    MAVLINK_FIELD_UINT32,
+    MAVLINK_FIELD_INT32,
+    MAVLINK_FIELD_UINT64,
+    MAVLINK_FIELD_INT64,
+    MAVLINK_FIELD_FLOAT,
+    MAVLINK_FIELD_DOUBLE
+} mavlink_field_type_t;
+
+/* 载荷字段描述符（生成表，按XML声明顺序排列） */
+typedef struct {
+    const char *name;               // 协议字段名
+    const char *label;              // 中文标签（未标注时同name）
+    uint8_t type;                   // mavlink_field_type_t
+    uint8_t offset;                 // 载荷内偏移（线上顺序）
+    uint8_t size;                   // 单个元素字节数
+    uint8_t array_len;              // 数组元素个数，标量为0
+    uint8_t extension;              // 1表示v2扩展字段
+} mavlink_field_info_t;
+
+/* 消息元数据，热字段在前，每项32字节 */
+typedef struct {
+    uint32_t msgid;                 // 消息ID
+    uint8_t min_len;                // 基础载荷长度（不含扩展字段）
+    uint8_t max_len;                // 含扩展字段的最大载荷长度
+    uint8_t crc_extra;              // CRC_EXTRA种子
+    uint8_t category;               // mavlink_msg_category_t
+    uint8_t log_policy;             // mavlink_log_policy_t
+    uint8_t known;                  // 0表示未知消息的占位项
+    uint8_t field_count;            // 字段描述符个数
+    const char *name;               // 协议名称
+    const char *name_zh;            // 中文名称
+} mavlink_msg_info_t;
+
+/* MAVLink消息结构（拥有载荷副本，用于需要保留的事件） */
 typedef struct {
     uint8_t magic;                  // STX
     uint8_t len;                    // 载荷长度
     uint8_t seq;                    // 序列号
     uint8_t sysid;                  // 系统ID
     uint8_t compid;                 // 组件ID
-    uint8_t msgid;                  // 消息ID
+    uint32_t msgid;                 // 消息ID（v2为完整24位）
     uint8_t payload[MAVLINK_MAX_PAYLOAD_LEN]; // 载荷
     uint16_t checksum;              // 校验和
+    uint8_t crc_checked;            // 1=校验和已验证，0=消息ID未知无法验证
+    const mavlink_msg_info_t *info; // 消息元数据（未知消息指向占位项）
 } mavlink_message_t;
 
+/*
+ * MAVLink帧视图：直接指向接收缓冲区，不拷贝载荷。
+ * 只在帧回调期间有效，需要保留时用mavlink_frame_copy()拷贝。
+ */
+typedef struct {
+    const uint8_t *data;            // 帧起始（STX）
+    const uint8_t *payload;         // 载荷起始
+    const uint8_t *signature;       // 签名块（校验和之后13字节），未签名为NULL
+    const mavlink_msg_info_t *info; // 消息元数据（未知消息指向占位项）
+    uint32_t msgid;                 // 消息ID（v2为完整24位）
+    uint16_t frame_len;             // 整帧长度（含签名块）
+    uint16_t checksum;              // 校验和
+    uint8_t magic;                  // STX
+    uint8_t len;                    // 载荷长度
+    uint8_t incompat_flags;         // v2不兼容标志（v1为0）
+    uint8_t seq;                    // 序列号
+    uint8_t sysid;                  // 系统ID
+    uint8_t compid;                 // 组件ID
+    uint8_t crc_checked;            // 1=校验和已验证，0=消息ID未知无法验证
+} mavlink_frame_t;
+
+/* 帧校验结果 */
+#define MAVLINK_FRAME_BAD_CRC 0     // 数据不足、长度超限或校验和错误
+#define MAVLINK_FRAME_OK 1          // 校验和正确
+#define MAVLINK_FRAME_UNCHECKED 2   // 消息ID未知，无CRC_EXTRA可用于校验
+
 /**
- * 解析MAVLink消息
- * @param data 接收到的数据
+ * 初始化MAVLink处理模块（校验和查找表）
+ */
+void mavlink_init(void);
+
+/**
+ * 查询消息元数据（两级索引，O(1)）
+ * @param msgid 消息ID（24位）
+ * @return 元数据，未知消息返回known为0的占位项，不会返回NULL
+ */
+const mavlink_msg_info_t *mavlink_msg_lookup(uint32_t msgid);
+
+/**
+ * 获取消息的字段描述符
+ * @param info mavlink_msg_lookup()返回的元数据
+ * @return 字段描述符数组（info->field_count项），未知消息返回NULL
+ */
+const mavlink_field_info_t *mavlink_msg_fields(const mavlink_msg_info_t *info);
+
+/**
+ * 获取消息类别名称
+ * @param category mavlink_msg_category_t
+ * @return 中文类别名称
+ */
+const char *mavlink_category_name(uint8_t category);
+
+/**
+ * 查询消息的CRC_EXTRA种子
+ * @param msgid 消息ID（24位）
+ * @param crc_extra 输出的CRC_EXTRA
+ * @return 1找到，0未知消息
+ */
+int mavlink_get_crc_extra(uint32_t msgid, uint8_t *crc_extra);
+
+/**
+ * 解析一帧MAVLink数据并校验CRC（含CRC_EXTRA），不拷贝载荷
+ * @param data 接收到的数据（帧起始）
  * @param len 数据长度
+ * @param frame 输出的帧视图，指向data
+ * @return MAVLINK_FRAME_OK/MAVLINK_FRAME_UNCHECKED成功，MAVLINK_FRAME_BAD_CRC(0)失败
+ */
+int mavlink_frame_parse(const uint8_t *data, size_t len, mavlink_frame_t *frame);
+
+/**
+ * 编码一帧MAVLink消息（不签名），用于SITL未就绪时的占位应答
+ * v2截掉载荷末尾的零字节（至少保留1字节）；v1只能表示8位消息ID
+ * @param buf 输出缓冲区（至少MAVLINK_MAX_FRAME_LEN字节）
+ * @param is_v2 1为v2，0为v1
+ * @param seq 序列号
+ * @param sysid 系统ID
+ * @param compid 组件ID
+ * @param msgid 消息ID
+ * @param payload 载荷
+ * @param len 载荷长度
+ * @return 帧长度，0表示消息未知（没有CRC_EXTRA）或v1无法表示该消息ID
+ */
+size_t mavlink_frame_encode(uint8_t *buf, int is_v2, uint8_t seq, uint8_t sysid, uint8_t compid,
+                            uint32_t msgid, const uint8_t *payload, uint8_t len);
+
+/**
+ * 把帧视图拷贝为独立的消息结构
+ * 已知消息的载荷补零到该消息的最大线上长度，v2截掉的字段可以直接从payload读取；
+ * 补零范围只到max_len，不清零整个255字节缓冲区。
+ * @param frame 帧视图
  * @param msg 输出的消息结构
- * @return 1成功，0失败
  */
-int mavlink_parse_message(const uint8_t *data, size_t len, mavlink_message_t *msg);
+void mavlink_frame_copy(const mavlink_frame_t *frame, mavlink_message_t *msg);
+
+/*
+ * 载荷字段访问（小端序）
+ * v2发送方会截掉载荷末尾的零字节，超出实际载荷的字节按0补齐（逐字节，字段可以只截掉一部分）。
+ * 只读取字段本身涉及的字节，不需要预先清零载荷缓冲区。
+ */
+static inline uint64_t mavlink_frame_load(const mavlink_frame_t *frame, size_t offset, size_t size) {
+    uint8_t bytes[8] = {0};
+    uint64_t value = 0;
+    
+    if (offset + size <= frame->len) {
+        memcpy(bytes, frame->payload + offset, size);
+    } else if (offset < frame->len) {
+        memcpy(bytes, frame->payload + offset, frame->len - offset);
+    }
+    for (size_t i = 0; i < size; i++) {
+        value |= (uint64_t)bytes[i] << (8 * i);
+    }
+    return value;
+}
+
+static inline uint8_t mavlink_frame_u8(const mavlink_frame_t *frame, size_t offset) {
+    return (offset < frame->len) ? frame->payload[offset] : 0;
+}
+
+static inline int8_t mavlink_frame_i8(const mavlink_frame_t *frame, size_t offset) {
+    return (int8_t)mavlink_frame_u8(frame, offset);
+}
+
+static inline uint16_t mavlink_frame_u16(const mavlink_frame_t *frame, size_t offset) {
+    return (uint16_t)mavlink_frame_load(frame, offset, 2);
+}
+
+static inline int16_t mavlink_frame_i16(const mavlink_frame_t *frame, size_t offset) {
+    return (int16_t)mavlink_frame_u16(frame, offset);
+}
+
+static inline uint32_t mavlink_frame_u32(const mavlink_frame_t *frame, size_t offset) {
+    return (uint32_t)mavlink_frame_load(frame, offset, 4);
+}
+
+static inline int32_t mavlink_frame_i32(const mavlink_frame_t *frame, size_t offset) {
+    return (int32_t)mavlink_frame_u32(frame, offset);
+}
+
+static inline float mavlink_frame_float(const mavlink_frame_t *frame, size_t offset) {
+    uint32_t bits = mavlink_frame_u32(frame, offset);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline uint64_t mavlink_frame_u64(const mavlink_frame_t *frame, size_t offset) {
+    return mavlink_frame_load(frame, offset, 8);
+}
+
+static inline int64_t mavlink_frame_i64(const mavlink_frame_t *frame, size_t offset) {
+    return (int64_t)mavlink_frame_u64(frame, offset);
+}
+
+static inline double mavlink_frame_double(const mavlink_frame_t *frame, size_t offset) {
+    uint64_t bits = mavlink_frame_u64(frame, offset);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * 按描述符读取数值字段（数组取第index个元素），统一转换为double
+ * @param frame 帧视图
+ * @param field 字段描述符（不能是char类型）
+ * @param index 数组下标，标量为0
+ * @return 字段值，超出实际载荷长度时为0
+ */
+double mavlink_field_number(const mavlink_frame_t *frame, const mavlink_field_info_t *field, size_t index);
+
+/**
+ * 按描述符读取char[]字段，截止到第一个0字节或载荷末尾
+ * @param frame 帧视图
+ * @param field 字段描述符（char类型）
+ * @param len 输出的字符串长度
+ * @return 指向载荷内字符串的指针（不以0结尾）
+ */
+const char *mavlink_field_chars(const mavlink_frame_t *frame, const mavlink_field_info_t *field, size_t *len);
+
+/* 帧回调：流式解析器每解析出一帧调用一次，帧视图只在回调期间有效 */
+typedef void (*mavlink_frame_handler_t)(const mavlink_frame_t *frame, void *ctx);
+
+/* 流式解析器状态 */
+typedef struct {
+    uint8_t buf[MAVLINK_MAX_FRAME_LEN]; // 跨调用暂存的不完整帧
+    size_t used;                    // buf中已有字节数
+    uint64_t frames;                // 已解析帧数
+    uint64_t bytes_skipped;         // 重新同步时丢弃的字节数
+    uint64_t rejected;              // 帧头预检未通过或边界不清的候选STX数
+    uint64_t crc_errors;            // 校验失败（校验和或长度错误）的候选帧数
+    uint64_t unchecked;             // 消息ID未知、未经校验的帧数
+} mavlink_parser_t;
+
+/**
+ * 初始化流式解析器
+ * @param parser 解析器状态
+ */
+void mavlink_parser_init(mavlink_parser_t *parser);
+
+/**
+ * 向解析器输入一段字节流
+ * 用向量化扫描跳过帧间垃圾，候选STX先预检帧头再校验整帧；
+ * 消息ID未知、无法校验的帧只在恰好结束数据或紧跟下一个STX时接受。
+ * 末尾不完整的帧保留到下次调用。
+ * 完整落在data内的帧以视图形式直接交给回调，不做额外拷贝。
+ * @param parser 解析器状态
+ * @param data 输入数据
+ * @param len 数据长度
+ * @param handler 帧回调
+ * @param ctx 传给回调的上下文
+ * @return 本次解析出的帧数
+ */
+size_t mavlink_parser_feed(mavlink_parser_t *parser, const uint8_t *data, size_t len,
+                           mavlink_frame_handler_t handler, void *ctx);
 
 #endif /* MAVLINK_H */
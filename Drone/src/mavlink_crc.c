@@ -0,0 +1,93 @@
+/*
+ * mavlink_crc.c - MAVLink校验和实现
+ * 多项式0x1021（反射形式0x8408），初始值0xFFFF，无最终异或
+ */
+
+#include "mavlink_crc.h"
+#include <string.h>
+
+/* g_crc_table[k][b]：字节b之后再经过k个零字节的校验和贡献 */
+static uint16_t g_crc_table[8][256];
+
+static uint16_t crc_calculate_scalar(const uint8_t *data, size_t len, uint16_t crc);
+static uint16_t crc_calculate_slice8(const uint8_t *data, size_t len, uint16_t crc);
+
+static uint16_t (*g_crc_calculate)(const uint8_t *, size_t, uint16_t) = crc_calculate_scalar;
+static mavlink_crc_impl_t g_crc_impl = MAVLINK_CRC_IMPL_SCALAR;
+
+void mavlink_crc_init(void) {
+    for (int i = 0; i < 256; i++) {
+        uint16_t crc = (uint16_t)i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (uint16_t)((crc >> 1) ^ 0x8408) : (uint16_t)(crc >> 1);
+        }
+        g_crc_table[0][i] = crc;
+    }
+    
+    for (int k = 1; k < 8; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint16_t prev = g_crc_table[k - 1][i];
+            g_crc_table[k][i] = (prev >> 8) ^ g_crc_table[0][prev & 0xFF];
+        }
+    }
+    
+    mavlink_crc_select(MAVLINK_CRC_IMPL_AUTO);
+}
+
+mavlink_crc_impl_t mavlink_crc_select(mavlink_crc_impl_t impl) {
+    if (impl == MAVLINK_CRC_IMPL_AUTO) {
+        // slicing-by-8按小端序装载64位字，大端主机退回单字节查表
+        const uint16_t probe = 1;
+        uint8_t first;
+        memcpy(&first, &probe, 1);
+        impl = first ? MAVLINK_CRC_IMPL_SLICE8 : MAVLINK_CRC_IMPL_SCALAR;
+    }
+    
+    if (impl == MAVLINK_CRC_IMPL_SLICE8) {
+        g_crc_calculate = crc_calculate_slice8;
+    } else {
+        impl = MAVLINK_CRC_IMPL_SCALAR;
+        g_crc_calculate = crc_calculate_scalar;
+    }
+    
+    g_crc_impl = impl;
+    return impl;
+}
+
+const char *mavlink_crc_impl_name(void) {
+    return (g_crc_impl == MAVLINK_CRC_IMPL_SLICE8) ? "slice8" : "scalar";
+}
+
+uint16_t mavlink_crc_accumulate(uint8_t byte, uint16_t crc) {
+    return (crc >> 8) ^ g_crc_table[0][(crc ^ byte) & 0xFF];
+}
+
+uint16_t mavlink_crc_calculate(const uint8_t *data, size_t len, uint16_t crc) {
+    return g_crc_calculate(data, len, crc);
+}
+
+static uint16_t crc_calculate_scalar(const uint8_t *data, size_t len, uint16_t crc) {
+    while (len--) {
+        crc = (crc >> 8) ^ g_crc_table[0][(crc ^ *data++) & 0xFF];
+    }
+    return crc;
+}
+
+static uint16_t crc_calculate_slice8(const uint8_t *data, size_t len, uint16_t crc) {
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        word ^= crc;
+        crc = g_crc_table[7][word & 0xFF] ^
+              g_crc_table[6][(word >> 8) & 0xFF] ^
+              g_crc_table[5][(word >> 16) & 0xFF] ^
+              g_crc_table[4][(word >> 24) & 0xFF] ^
+              g_crc_table[3][(word >> 32) & 0xFF] ^
+              g_crc_table[2][(word >> 40) & 0xFF] ^
+              g_crc_table[1][(word >> 48) & 0xFF] ^
+              g_crc_table[0][word >> 56];
+        data += 8;
+        len -= 8;
+    }
+    return crc_calculate_scalar(data, len, crc);
+}
@@ -0,0 +1,55 @@
+/*
+ * mavlink_crc.h - MAVLink校验和（CRC-16/MCRF4XX，即X.25）
+ */
+
+#ifndef MAVLINK_CRC_H
+#define MAVLINK_CRC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MAVLINK_CRC_INIT 0xFFFF     // 校验和初始值
+
+/* 校验和实现 */
+typedef enum {
+    MAVLINK_CRC_IMPL_AUTO = 0,      // 按运行环境自动选择
+    MAVLINK_CRC_IMPL_SCALAR,        // 单字节查表
+    MAVLINK_CRC_IMPL_SLICE8         // slicing-by-8，每次处理8字节
+} mavlink_crc_impl_t;
+
+/**
+ * 初始化查找表并选择实现（使用其它函数前调用一次）
+ */
+void mavlink_crc_init(void);
+
+/**
+ * 切换校验和实现
+ * @param impl 实现类型，AUTO表示按运行环境自动选择
+ * @return 实际使用的实现
+ */
+mavlink_crc_impl_t mavlink_crc_select(mavlink_crc_impl_t impl);
+
+/**
+ * 获取当前实现名称
+ * @return 实现名称
+ */
+const char *mavlink_crc_impl_name(void);
+
+/**
+ * 累加一个字节
+ * @param byte 数据字节
+ * @param crc 当前校验和
+ * @return 新的校验和
+ */
+uint16_t mavlink_crc_accumulate(uint8_t byte, uint16_t crc);
+
+/**
+ * 累加一段数据
+ * @param data 数据
+ * @param len 数据长度
+ * @param crc 当前校验和
+ * @return 新的校验和
+ */
+uint16_t mavlink_crc_calculate(const uint8_t *data, size_t len, uint16_t crc);
+
+#endif /* MAVLINK_CRC_H */
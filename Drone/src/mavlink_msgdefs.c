@@ -0,0 +1,3667 @@
+/*
+ * mavlink_msgdefs.c - 由 scripts/gen_msgdefs.py 根据 mavlink/ardupilotmega.xml, mavlink/common.xml, mavlink/csAirLink.xml, mavlink/cubepilot.xml, mavlink/icarous.xml, mavlink/loweheiser.xml, mavlink/minimal.xml, mavlink/standard.xml, mavlink/uAvionix.xml 生成
+ * 请勿手工修改，修改XML或 mavlink/labels_zh.txt 后执行 make msgdefs
+ */
+
+#include "mavlink_msgs.h"
+
+/* 字段描述符，按XML声明顺序：名称、中文标签、类型、偏移、元素字节数、数组长度、是否扩展字段 */
+static const mavlink_field_info_t g_fields_HEARTBEAT[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"autopilot", "自驾仪类型", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"base_mode", "基本模式", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"custom_mode", "自定义模式", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"system_status", "系统状态", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"mavlink_version", "MAVLink版本", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SYS_STATUS[] = {
+    {"onboard_control_sensors_present", "onboard_control_sensors_present", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"onboard_control_sensors_enabled", "onboard_control_sensors_enabled", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"onboard_control_sensors_health", "onboard_control_sensors_health", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"load", "load", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"voltage_battery", "voltage_battery", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"current_battery", "current_battery", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"battery_remaining", "battery_remaining", MAVLINK_FIELD_INT8, 30, 1, 0, 0},
+    {"drop_rate_comm", "drop_rate_comm", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"errors_comm", "errors_comm", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"errors_count1", "errors_count1", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"errors_count2", "errors_count2", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"errors_count3", "errors_count3", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"errors_count4", "errors_count4", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"onboard_control_sensors_present_extended", "onboard_control_sensors_present_extended", MAVLINK_FIELD_UINT32, 31, 4, 0, 1},
+    {"onboard_control_sensors_enabled_extended", "onboard_control_sensors_enabled_extended", MAVLINK_FIELD_UINT32, 35, 4, 0, 1},
+    {"onboard_control_sensors_health_extended", "onboard_control_sensors_health_extended", MAVLINK_FIELD_UINT32, 39, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SYSTEM_TIME[] = {
+    {"time_unix_usec", "UNIX时间(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PING[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CHANGE_OPERATOR_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"control_request", "控制请求", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"version", "版本", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"passkey", "口令", MAVLINK_FIELD_CHAR, 3, 1, 25, 0},
+};
+static const mavlink_field_info_t g_fields_CHANGE_OPERATOR_CONTROL_ACK[] = {
+    {"gcs_system_id", "gcs_system_id", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"control_request", "控制请求", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"ack", "应答", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AUTH_KEY[] = {
+    {"key", "密钥", MAVLINK_FIELD_CHAR, 0, 1, 32, 0},
+};
+static const mavlink_field_info_t g_fields_LINK_NODE_STATUS[] = {
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"tx_buf", "tx_buf", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"rx_buf", "rx_buf", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"tx_rate", "tx_rate", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"rx_rate", "rx_rate", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+    {"rx_parse_err", "rx_parse_err", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"tx_overflows", "tx_overflows", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"rx_overflows", "rx_overflows", MAVLINK_FIELD_UINT16, 32, 2, 0, 0},
+    {"messages_sent", "messages_sent", MAVLINK_FIELD_UINT32, 16, 4, 0, 0},
+    {"messages_received", "messages_received", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"messages_lost", "messages_lost", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SET_MODE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"base_mode", "基本模式", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"custom_mode", "飞行模式", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_REQUEST_READ[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 4, 1, 16, 0},
+    {"param_index", "参数索引", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_REQUEST_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_VALUE[] = {
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 8, 1, 16, 0},
+    {"param_value", "参数值", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param_type", "参数类型", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"param_count", "参数总数", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"param_index", "参数索引", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_SET[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 6, 1, 16, 0},
+    {"param_value", "参数值", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param_type", "参数类型", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GPS_RAW_INT[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"fix_type", "定位类型", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"eph", "eph", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"epv", "epv", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"vel", "vel", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"cog", "cog", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"satellites_visible", "可见卫星数", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"alt_ellipsoid", "alt_ellipsoid", MAVLINK_FIELD_INT32, 30, 4, 0, 1},
+    {"h_acc", "h_acc", MAVLINK_FIELD_UINT32, 34, 4, 0, 1},
+    {"v_acc", "v_acc", MAVLINK_FIELD_UINT32, 38, 4, 0, 1},
+    {"vel_acc", "vel_acc", MAVLINK_FIELD_UINT32, 42, 4, 0, 1},
+    {"hdg_acc", "hdg_acc", MAVLINK_FIELD_UINT32, 46, 4, 0, 1},
+    {"yaw", "偏航角", MAVLINK_FIELD_UINT16, 50, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GPS_STATUS[] = {
+    {"satellites_visible", "可见卫星数", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"satellite_prn", "satellite_prn", MAVLINK_FIELD_UINT8, 1, 1, 20, 0},
+    {"satellite_used", "satellite_used", MAVLINK_FIELD_UINT8, 21, 1, 20, 0},
+    {"satellite_elevation", "satellite_elevation", MAVLINK_FIELD_UINT8, 41, 1, 20, 0},
+    {"satellite_azimuth", "satellite_azimuth", MAVLINK_FIELD_UINT8, 61, 1, 20, 0},
+    {"satellite_snr", "satellite_snr", MAVLINK_FIELD_UINT8, 81, 1, 20, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_IMU[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 6, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 22, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_RAW_IMU[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_INT16, 22, 2, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_INT16, 24, 2, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 26, 1, 0, 1},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 27, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_RAW_PRESSURE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"press_abs", "press_abs", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"press_diff1", "press_diff1", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"press_diff2", "press_diff2", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_PRESSURE[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"press_abs", "press_abs", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"press_diff", "press_diff", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"temperature_press_diff", "temperature_press_diff", MAVLINK_FIELD_INT16, 14, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_ATTITUDE[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ATTITUDE_QUATERNION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"q1", "q1", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"q2", "q2", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"q3", "q3", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"q4", "q4", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"repr_offset_q", "repr_offset_q", MAVLINK_FIELD_FLOAT, 32, 4, 4, 1},
+};
+static const mavlink_field_info_t g_fields_LOCAL_POSITION_NED[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GLOBAL_POSITION_INT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"relative_alt", "相对高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_INT16, 22, 2, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_INT16, 24, 2, 0, 0},
+    {"hdg", "hdg", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RC_CHANNELS_SCALED[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"port", "port", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"chan1_scaled", "chan1_scaled", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+    {"chan2_scaled", "chan2_scaled", MAVLINK_FIELD_INT16, 6, 2, 0, 0},
+    {"chan3_scaled", "chan3_scaled", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"chan4_scaled", "chan4_scaled", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"chan5_scaled", "chan5_scaled", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"chan6_scaled", "chan6_scaled", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"chan7_scaled", "chan7_scaled", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"chan8_scaled", "chan8_scaled", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RC_CHANNELS_RAW[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"port", "port", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"chan1_raw", "chan1_raw", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"chan2_raw", "chan2_raw", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"chan3_raw", "chan3_raw", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"chan4_raw", "chan4_raw", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"chan5_raw", "chan5_raw", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"chan6_raw", "chan6_raw", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"chan7_raw", "chan7_raw", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"chan8_raw", "chan8_raw", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SERVO_OUTPUT_RAW[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"port", "port", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"servo1_raw", "servo1_raw", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"servo2_raw", "servo2_raw", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"servo3_raw", "servo3_raw", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"servo4_raw", "servo4_raw", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"servo5_raw", "servo5_raw", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"servo6_raw", "servo6_raw", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"servo7_raw", "servo7_raw", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"servo8_raw", "servo8_raw", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"servo9_raw", "servo9_raw", MAVLINK_FIELD_UINT16, 21, 2, 0, 1},
+    {"servo10_raw", "servo10_raw", MAVLINK_FIELD_UINT16, 23, 2, 0, 1},
+    {"servo11_raw", "servo11_raw", MAVLINK_FIELD_UINT16, 25, 2, 0, 1},
+    {"servo12_raw", "servo12_raw", MAVLINK_FIELD_UINT16, 27, 2, 0, 1},
+    {"servo13_raw", "servo13_raw", MAVLINK_FIELD_UINT16, 29, 2, 0, 1},
+    {"servo14_raw", "servo14_raw", MAVLINK_FIELD_UINT16, 31, 2, 0, 1},
+    {"servo15_raw", "servo15_raw", MAVLINK_FIELD_UINT16, 33, 2, 0, 1},
+    {"servo16_raw", "servo16_raw", MAVLINK_FIELD_UINT16, 35, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_REQUEST_PARTIAL_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"start_index", "起始序号", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"end_index", "结束序号", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 6, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_WRITE_PARTIAL_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"start_index", "起始序号", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"end_index", "结束序号", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 6, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_ITEM[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"autocontinue", "自动继续", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"param1", "参数1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param2", "参数2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"param3", "参数3", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"param4", "参数4", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 37, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_REQUEST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 4, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_SET_CURRENT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MISSION_CURRENT[] = {
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"total", "total", MAVLINK_FIELD_UINT16, 2, 2, 0, 1},
+    {"mission_state", "mission_state", MAVLINK_FIELD_UINT8, 4, 1, 0, 1},
+    {"mission_mode", "mission_mode", MAVLINK_FIELD_UINT8, 5, 1, 0, 1},
+    {"mission_id", "mission_id", MAVLINK_FIELD_UINT32, 6, 4, 0, 1},
+    {"fence_id", "fence_id", MAVLINK_FIELD_UINT32, 10, 4, 0, 1},
+    {"rally_points_id", "rally_points_id", MAVLINK_FIELD_UINT32, 14, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_REQUEST_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 2, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_COUNT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 4, 1, 0, 1},
+    {"opaque_id", "opaque_id", MAVLINK_FIELD_UINT32, 5, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_CLEAR_ALL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 2, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_ITEM_REACHED[] = {
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MISSION_ACK[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 3, 1, 0, 1},
+    {"opaque_id", "opaque_id", MAVLINK_FIELD_UINT32, 4, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SET_GPS_GLOBAL_ORIGIN[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 13, 8, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GPS_GLOBAL_ORIGIN[] = {
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 12, 8, 0, 1},
+};
+static const mavlink_field_info_t g_fields_PARAM_MAP_RC[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 20, 1, 16, 0},
+    {"param_index", "参数索引", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"parameter_rc_channel_index", "parameter_rc_channel_index", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"param_value0", "param_value0", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"scale", "scale", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"param_value_min", "param_value_min", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"param_value_max", "param_value_max", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MISSION_REQUEST_INT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 4, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SAFETY_SET_ALLOWED_AREA[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 25, 1, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"p1x", "p1x", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"p1y", "p1y", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"p1z", "p1z", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"p2x", "p2x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"p2y", "p2y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"p2z", "p2z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SAFETY_ALLOWED_AREA[] = {
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"p1x", "p1x", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"p1y", "p1y", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"p1z", "p1z", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"p2x", "p2x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"p2y", "p2y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"p2z", "p2z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ATTITUDE_QUATERNION_COV[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 8, 4, 4, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 36, 4, 9, 0},
+};
+static const mavlink_field_info_t g_fields_NAV_CONTROLLER_OUTPUT[] = {
+    {"nav_roll", "nav_roll", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"nav_pitch", "nav_pitch", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"nav_bearing", "nav_bearing", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"target_bearing", "target_bearing", MAVLINK_FIELD_INT16, 22, 2, 0, 0},
+    {"wp_dist", "wp_dist", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"alt_error", "alt_error", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"aspd_error", "aspd_error", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"xtrack_error", "xtrack_error", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GLOBAL_POSITION_INT_COV[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"estimator_type", "estimator_type", MAVLINK_FIELD_UINT8, 180, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"relative_alt", "相对高度(毫米)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 36, 4, 36, 0},
+};
+static const mavlink_field_info_t g_fields_LOCAL_POSITION_NED_COV[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"estimator_type", "estimator_type", MAVLINK_FIELD_UINT8, 224, 1, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"ax", "ax", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"ay", "ay", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"az", "az", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 44, 4, 45, 0},
+};
+static const mavlink_field_info_t g_fields_RC_CHANNELS[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"chancount", "chancount", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"chan1_raw", "chan1_raw", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"chan2_raw", "chan2_raw", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"chan3_raw", "chan3_raw", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"chan4_raw", "chan4_raw", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"chan5_raw", "chan5_raw", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"chan6_raw", "chan6_raw", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"chan7_raw", "chan7_raw", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"chan8_raw", "chan8_raw", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"chan9_raw", "chan9_raw", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"chan10_raw", "chan10_raw", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"chan11_raw", "chan11_raw", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"chan12_raw", "chan12_raw", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"chan13_raw", "chan13_raw", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"chan14_raw", "chan14_raw", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"chan15_raw", "chan15_raw", MAVLINK_FIELD_UINT16, 32, 2, 0, 0},
+    {"chan16_raw", "chan16_raw", MAVLINK_FIELD_UINT16, 34, 2, 0, 0},
+    {"chan17_raw", "chan17_raw", MAVLINK_FIELD_UINT16, 36, 2, 0, 0},
+    {"chan18_raw", "chan18_raw", MAVLINK_FIELD_UINT16, 38, 2, 0, 0},
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_REQUEST_DATA_STREAM[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"req_stream_id", "请求数据流ID", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"req_message_rate", "请求频率(Hz)", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"start_stop", "启停", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DATA_STREAM[] = {
+    {"stream_id", "stream_id", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"message_rate", "message_rate", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"on_off", "on_off", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MANUAL_CONTROL[] = {
+    {"target", "目标", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"x", "俯仰输入", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"y", "横滚输入", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+    {"z", "油门输入", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+    {"r", "偏航输入", MAVLINK_FIELD_INT16, 6, 2, 0, 0},
+    {"buttons", "按键", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"buttons2", "buttons2", MAVLINK_FIELD_UINT16, 11, 2, 0, 1},
+    {"enabled_extensions", "enabled_extensions", MAVLINK_FIELD_UINT8, 13, 1, 0, 1},
+    {"s", "s", MAVLINK_FIELD_INT16, 14, 2, 0, 1},
+    {"t", "t", MAVLINK_FIELD_INT16, 16, 2, 0, 1},
+    {"aux1", "aux1", MAVLINK_FIELD_INT16, 18, 2, 0, 1},
+    {"aux2", "aux2", MAVLINK_FIELD_INT16, 20, 2, 0, 1},
+    {"aux3", "aux3", MAVLINK_FIELD_INT16, 22, 2, 0, 1},
+    {"aux4", "aux4", MAVLINK_FIELD_INT16, 24, 2, 0, 1},
+    {"aux5", "aux5", MAVLINK_FIELD_INT16, 26, 2, 0, 1},
+    {"aux6", "aux6", MAVLINK_FIELD_INT16, 28, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_RC_CHANNELS_OVERRIDE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"chan1_raw", "chan1_raw", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"chan2_raw", "chan2_raw", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"chan3_raw", "chan3_raw", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"chan4_raw", "chan4_raw", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"chan5_raw", "chan5_raw", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"chan6_raw", "chan6_raw", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"chan7_raw", "chan7_raw", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"chan8_raw", "chan8_raw", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"chan9_raw", "chan9_raw", MAVLINK_FIELD_UINT16, 18, 2, 0, 1},
+    {"chan10_raw", "chan10_raw", MAVLINK_FIELD_UINT16, 20, 2, 0, 1},
+    {"chan11_raw", "chan11_raw", MAVLINK_FIELD_UINT16, 22, 2, 0, 1},
+    {"chan12_raw", "chan12_raw", MAVLINK_FIELD_UINT16, 24, 2, 0, 1},
+    {"chan13_raw", "chan13_raw", MAVLINK_FIELD_UINT16, 26, 2, 0, 1},
+    {"chan14_raw", "chan14_raw", MAVLINK_FIELD_UINT16, 28, 2, 0, 1},
+    {"chan15_raw", "chan15_raw", MAVLINK_FIELD_UINT16, 30, 2, 0, 1},
+    {"chan16_raw", "chan16_raw", MAVLINK_FIELD_UINT16, 32, 2, 0, 1},
+    {"chan17_raw", "chan17_raw", MAVLINK_FIELD_UINT16, 34, 2, 0, 1},
+    {"chan18_raw", "chan18_raw", MAVLINK_FIELD_UINT16, 36, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MISSION_ITEM_INT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"autocontinue", "自动继续", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"param1", "参数1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param2", "参数2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"param3", "参数3", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"param4", "参数4", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"x", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"y", "经度(1e-7度)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"z", "高度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"mission_type", "任务类型", MAVLINK_FIELD_UINT8, 37, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_VFR_HUD[] = {
+    {"airspeed", "空速", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"groundspeed", "地速", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"heading", "航向", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"throttle", "油门", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"climb", "爬升率", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_COMMAND_INT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"autocontinue", "自动继续", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"param1", "参数1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param2", "参数2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"param3", "参数3", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"param4", "参数4", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"x", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"y", "经度(1e-7度)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"z", "高度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_COMMAND_LONG[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"confirmation", "确认次数", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"param1", "参数1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"param2", "参数2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"param3", "参数3", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"param4", "参数4", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"param5", "参数5", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"param6", "参数6", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"param7", "参数7", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_COMMAND_ACK[] = {
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"progress", "progress", MAVLINK_FIELD_UINT8, 3, 1, 0, 1},
+    {"result_param2", "result_param2", MAVLINK_FIELD_INT32, 4, 4, 0, 1},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 8, 1, 0, 1},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 9, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_COMMAND_CANCEL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MANUAL_SETPOINT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"thrust", "thrust", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"mode_switch", "mode_switch", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"manual_override_switch", "manual_override_switch", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SET_ATTITUDE_TARGET[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 37, 1, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT8, 38, 1, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 4, 4, 4, 0},
+    {"body_roll_rate", "body_roll_rate", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"body_pitch_rate", "body_pitch_rate", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"body_yaw_rate", "body_yaw_rate", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"thrust", "thrust", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"thrust_body", "thrust_body", MAVLINK_FIELD_FLOAT, 39, 4, 3, 1},
+};
+static const mavlink_field_info_t g_fields_ATTITUDE_TARGET[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 4, 4, 4, 0},
+    {"body_roll_rate", "body_roll_rate", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"body_pitch_rate", "body_pitch_rate", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"body_yaw_rate", "body_yaw_rate", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"thrust", "thrust", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SET_POSITION_TARGET_LOCAL_NED[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 51, 1, 0, 0},
+    {"coordinate_frame", "坐标系", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"afx", "afx", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"afy", "afy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"afz", "afz", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_POSITION_TARGET_LOCAL_NED[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"coordinate_frame", "坐标系", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"afx", "afx", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"afy", "afy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"afz", "afz", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SET_POSITION_TARGET_GLOBAL_INT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 51, 1, 0, 0},
+    {"coordinate_frame", "坐标系", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"lat_int", "lat_int", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon_int", "lon_int", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"afx", "afx", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"afy", "afy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"afz", "afz", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_POSITION_TARGET_GLOBAL_INT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"coordinate_frame", "坐标系", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"type_mask", "类型掩码", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"lat_int", "lat_int", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon_int", "lon_int", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"afx", "afx", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"afy", "afy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"afz", "afz", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_STATE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 32, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 36, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 40, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_INT16, 44, 2, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_INT16, 46, 2, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_INT16, 48, 2, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 50, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 52, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 54, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_CONTROLS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"roll_ailerons", "roll_ailerons", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"pitch_elevator", "pitch_elevator", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yaw_rudder", "yaw_rudder", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"throttle", "油门", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"aux1", "aux1", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"aux2", "aux2", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"aux3", "aux3", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"aux4", "aux4", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"mode", "mode", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"nav_mode", "nav_mode", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_RC_INPUTS_RAW[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"chan1_raw", "chan1_raw", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"chan2_raw", "chan2_raw", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"chan3_raw", "chan3_raw", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"chan4_raw", "chan4_raw", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"chan5_raw", "chan5_raw", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"chan6_raw", "chan6_raw", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"chan7_raw", "chan7_raw", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"chan8_raw", "chan8_raw", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"chan9_raw", "chan9_raw", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"chan10_raw", "chan10_raw", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"chan11_raw", "chan11_raw", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"chan12_raw", "chan12_raw", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_ACTUATOR_CONTROLS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"controls", "controls", MAVLINK_FIELD_FLOAT, 16, 4, 16, 0},
+    {"mode", "mode", MAVLINK_FIELD_UINT8, 80, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OPTICAL_FLOW[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"sensor_id", "sensor_id", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"flow_x", "flow_x", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"flow_y", "flow_y", MAVLINK_FIELD_INT16, 22, 2, 0, 0},
+    {"flow_comp_m_x", "flow_comp_m_x", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"flow_comp_m_y", "flow_comp_m_y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"quality", "quality", MAVLINK_FIELD_UINT8, 25, 1, 0, 0},
+    {"ground_distance", "ground_distance", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"flow_rate_x", "flow_rate_x", MAVLINK_FIELD_FLOAT, 26, 4, 0, 1},
+    {"flow_rate_y", "flow_rate_y", MAVLINK_FIELD_FLOAT, 30, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GLOBAL_VISION_POSITION_ESTIMATE[] = {
+    {"usec", "usec", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 32, 4, 21, 1},
+    {"reset_counter", "reset_counter", MAVLINK_FIELD_UINT8, 116, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_VISION_POSITION_ESTIMATE[] = {
+    {"usec", "usec", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 32, 4, 21, 1},
+    {"reset_counter", "reset_counter", MAVLINK_FIELD_UINT8, 116, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_VISION_SPEED_ESTIMATE[] = {
+    {"usec", "usec", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 20, 4, 9, 1},
+    {"reset_counter", "reset_counter", MAVLINK_FIELD_UINT8, 56, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_VICON_POSITION_ESTIMATE[] = {
+    {"usec", "usec", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 32, 4, 21, 1},
+};
+static const mavlink_field_info_t g_fields_HIGHRES_IMU[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"abs_pressure", "abs_pressure", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"diff_pressure", "diff_pressure", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"pressure_alt", "pressure_alt", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"fields_updated", "fields_updated", MAVLINK_FIELD_UINT16, 60, 2, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 62, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_OPTICAL_FLOW_RAD[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"sensor_id", "sensor_id", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"integration_time_us", "integration_time_us", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"integrated_x", "integrated_x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"integrated_y", "integrated_y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"integrated_xgyro", "integrated_xgyro", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"integrated_ygyro", "integrated_ygyro", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"integrated_zgyro", "integrated_zgyro", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 40, 2, 0, 0},
+    {"quality", "quality", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"time_delta_distance_us", "time_delta_distance_us", MAVLINK_FIELD_UINT32, 32, 4, 0, 0},
+    {"distance", "distance", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_SENSOR[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"abs_pressure", "abs_pressure", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"diff_pressure", "diff_pressure", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"pressure_alt", "pressure_alt", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"fields_updated", "fields_updated", MAVLINK_FIELD_UINT32, 60, 4, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 64, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SIM_STATE[] = {
+    {"q1", "q1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"q2", "q2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"q3", "q3", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"q4", "q4", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 60, 4, 0, 0},
+    {"std_dev_horz", "std_dev_horz", MAVLINK_FIELD_FLOAT, 64, 4, 0, 0},
+    {"std_dev_vert", "std_dev_vert", MAVLINK_FIELD_FLOAT, 68, 4, 0, 0},
+    {"vn", "vn", MAVLINK_FIELD_FLOAT, 72, 4, 0, 0},
+    {"ve", "ve", MAVLINK_FIELD_FLOAT, 76, 4, 0, 0},
+    {"vd", "vd", MAVLINK_FIELD_FLOAT, 80, 4, 0, 0},
+    {"lat_int", "lat_int", MAVLINK_FIELD_INT32, 84, 4, 0, 1},
+    {"lon_int", "lon_int", MAVLINK_FIELD_INT32, 88, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_RADIO_STATUS[] = {
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"remrssi", "remrssi", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"txbuf", "txbuf", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"noise", "noise", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"remnoise", "remnoise", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"rxerrors", "rxerrors", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"fixed", "fixed", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_FILE_TRANSFER_PROTOCOL[] = {
+    {"target_network", "目标网络", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"payload", "载荷", MAVLINK_FIELD_UINT8, 3, 1, 251, 0},
+};
+static const mavlink_field_info_t g_fields_TIMESYNC[] = {
+    {"tc1", "tc1", MAVLINK_FIELD_INT64, 0, 8, 0, 0},
+    {"ts1", "ts1", MAVLINK_FIELD_INT64, 8, 8, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 16, 1, 0, 1},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 17, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_TRIGGER[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"seq", "序号", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_GPS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"fix_type", "定位类型", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"eph", "eph", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"epv", "epv", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"vel", "vel", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"vn", "vn", MAVLINK_FIELD_INT16, 26, 2, 0, 0},
+    {"ve", "ve", MAVLINK_FIELD_INT16, 28, 2, 0, 0},
+    {"vd", "vd", MAVLINK_FIELD_INT16, 30, 2, 0, 0},
+    {"cog", "cog", MAVLINK_FIELD_UINT16, 32, 2, 0, 0},
+    {"satellites_visible", "可见卫星数", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 36, 1, 0, 1},
+    {"yaw", "偏航角", MAVLINK_FIELD_UINT16, 37, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_HIL_OPTICAL_FLOW[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"sensor_id", "sensor_id", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"integration_time_us", "integration_time_us", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"integrated_x", "integrated_x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"integrated_y", "integrated_y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"integrated_xgyro", "integrated_xgyro", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"integrated_ygyro", "integrated_ygyro", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"integrated_zgyro", "integrated_zgyro", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 40, 2, 0, 0},
+    {"quality", "quality", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"time_delta_distance_us", "time_delta_distance_us", MAVLINK_FIELD_UINT32, 32, 4, 0, 0},
+    {"distance", "distance", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIL_STATE_QUATERNION[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"attitude_quaternion", "attitude_quaternion", MAVLINK_FIELD_FLOAT, 8, 4, 4, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 36, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 40, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 44, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_INT16, 48, 2, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_INT16, 50, 2, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_INT16, 52, 2, 0, 0},
+    {"ind_airspeed", "ind_airspeed", MAVLINK_FIELD_UINT16, 54, 2, 0, 0},
+    {"true_airspeed", "true_airspeed", MAVLINK_FIELD_UINT16, 56, 2, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 58, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 60, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 62, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_IMU2[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 6, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 22, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_LOG_REQUEST_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"start", "start", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"end", "end", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LOG_ENTRY[] = {
+    {"id", "id", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"num_logs", "num_logs", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"last_log_num", "last_log_num", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"time_utc", "time_utc", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"size", "size", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LOG_REQUEST_DATA[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"ofs", "ofs", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LOG_DATA[] = {
+    {"id", "id", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"ofs", "ofs", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 7, 1, 90, 0},
+};
+static const mavlink_field_info_t g_fields_LOG_ERASE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LOG_REQUEST_END[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GPS_INJECT_DATA[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 3, 1, 110, 0},
+};
+static const mavlink_field_info_t g_fields_GPS2_RAW[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"fix_type", "定位类型", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"eph", "eph", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"epv", "epv", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"vel", "vel", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"cog", "cog", MAVLINK_FIELD_UINT16, 30, 2, 0, 0},
+    {"satellites_visible", "可见卫星数", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"dgps_numch", "dgps_numch", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"dgps_age", "dgps_age", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_UINT16, 35, 2, 0, 1},
+    {"alt_ellipsoid", "alt_ellipsoid", MAVLINK_FIELD_INT32, 37, 4, 0, 1},
+    {"h_acc", "h_acc", MAVLINK_FIELD_UINT32, 41, 4, 0, 1},
+    {"v_acc", "v_acc", MAVLINK_FIELD_UINT32, 45, 4, 0, 1},
+    {"vel_acc", "vel_acc", MAVLINK_FIELD_UINT32, 49, 4, 0, 1},
+    {"hdg_acc", "hdg_acc", MAVLINK_FIELD_UINT32, 53, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_POWER_STATUS[] = {
+    {"Vcc", "Vcc", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"Vservo", "Vservo", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SERIAL_CONTROL[] = {
+    {"device", "设备", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"timeout", "timeout", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"baudrate", "波特率", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 9, 1, 70, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 79, 1, 0, 1},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 80, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GPS_RTK[] = {
+    {"time_last_baseline_ms", "time_last_baseline_ms", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"rtk_receiver_id", "rtk_receiver_id", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"wn", "wn", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"tow", "tow", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"rtk_health", "rtk_health", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"rtk_rate", "rtk_rate", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"nsats", "nsats", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"baseline_coords_type", "baseline_coords_type", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"baseline_a_mm", "baseline_a_mm", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"baseline_b_mm", "baseline_b_mm", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"baseline_c_mm", "baseline_c_mm", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"accuracy", "accuracy", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"iar_num_hypotheses", "iar_num_hypotheses", MAVLINK_FIELD_INT32, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GPS2_RTK[] = {
+    {"time_last_baseline_ms", "time_last_baseline_ms", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"rtk_receiver_id", "rtk_receiver_id", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"wn", "wn", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"tow", "tow", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"rtk_health", "rtk_health", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"rtk_rate", "rtk_rate", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"nsats", "nsats", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"baseline_coords_type", "baseline_coords_type", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"baseline_a_mm", "baseline_a_mm", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"baseline_b_mm", "baseline_b_mm", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"baseline_c_mm", "baseline_c_mm", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"accuracy", "accuracy", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"iar_num_hypotheses", "iar_num_hypotheses", MAVLINK_FIELD_INT32, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_IMU3[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_INT16, 6, 2, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"xmag", "xmag", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"ymag", "ymag", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"zmag", "zmag", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 22, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DATA_TRANSMISSION_HANDSHAKE[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"size", "size", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"width", "width", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"height", "height", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"packets", "packets", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"payload", "载荷", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"jpg_quality", "jpg_quality", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ENCAPSULATED_DATA[] = {
+    {"seqnr", "seqnr", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 253, 0},
+};
+static const mavlink_field_info_t g_fields_DISTANCE_SENSOR[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"min_distance", "min_distance", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"max_distance", "max_distance", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"current_distance", "current_distance", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"orientation", "orientation", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"horizontal_fov", "horizontal_fov", MAVLINK_FIELD_FLOAT, 14, 4, 0, 1},
+    {"vertical_fov", "vertical_fov", MAVLINK_FIELD_FLOAT, 18, 4, 0, 1},
+    {"quaternion", "quaternion", MAVLINK_FIELD_FLOAT, 22, 4, 4, 1},
+    {"signal_quality", "signal_quality", MAVLINK_FIELD_UINT8, 38, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_TERRAIN_REQUEST[] = {
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"grid_spacing", "grid_spacing", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"mask", "mask", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+};
+static const mavlink_field_info_t g_fields_TERRAIN_DATA[] = {
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"grid_spacing", "grid_spacing", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"gridbit", "gridbit", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_INT16, 10, 2, 16, 0},
+};
+static const mavlink_field_info_t g_fields_TERRAIN_CHECK[] = {
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_TERRAIN_REPORT[] = {
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"spacing", "spacing", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"terrain_height", "terrain_height", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"current_height", "current_height", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"pending", "pending", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"loaded", "loaded", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_PRESSURE2[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"press_abs", "press_abs", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"press_diff", "press_diff", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"temperature_press_diff", "temperature_press_diff", MAVLINK_FIELD_INT16, 14, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_ATT_POS_MOCAP[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 8, 4, 4, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"covariance", "covariance", MAVLINK_FIELD_FLOAT, 36, 4, 21, 1},
+};
+static const mavlink_field_info_t g_fields_SET_ACTUATOR_CONTROL_TARGET[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"group_mlx", "group_mlx", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"controls", "controls", MAVLINK_FIELD_FLOAT, 8, 4, 8, 0},
+};
+static const mavlink_field_info_t g_fields_ACTUATOR_CONTROL_TARGET[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"group_mlx", "group_mlx", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"controls", "controls", MAVLINK_FIELD_FLOAT, 8, 4, 8, 0},
+};
+static const mavlink_field_info_t g_fields_ALTITUDE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"altitude_monotonic", "altitude_monotonic", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"altitude_amsl", "altitude_amsl", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"altitude_local", "altitude_local", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"altitude_relative", "altitude_relative", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"altitude_terrain", "altitude_terrain", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"bottom_clearance", "bottom_clearance", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RESOURCE_REQUEST[] = {
+    {"request_id", "request_id", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"uri_type", "uri_type", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"uri", "uri", MAVLINK_FIELD_UINT8, 2, 1, 120, 0},
+    {"transfer_type", "transfer_type", MAVLINK_FIELD_UINT8, 122, 1, 0, 0},
+    {"storage", "storage", MAVLINK_FIELD_UINT8, 123, 1, 120, 0},
+};
+static const mavlink_field_info_t g_fields_SCALED_PRESSURE3[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"press_abs", "press_abs", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"press_diff", "press_diff", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"temperature_press_diff", "temperature_press_diff", MAVLINK_FIELD_INT16, 14, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_FOLLOW_TARGET[] = {
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"est_capabilities", "est_capabilities", MAVLINK_FIELD_UINT8, 92, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"vel", "vel", MAVLINK_FIELD_FLOAT, 28, 4, 3, 0},
+    {"acc", "acc", MAVLINK_FIELD_FLOAT, 40, 4, 3, 0},
+    {"attitude_q", "attitude_q", MAVLINK_FIELD_FLOAT, 52, 4, 4, 0},
+    {"rates", "rates", MAVLINK_FIELD_FLOAT, 68, 4, 3, 0},
+    {"position_cov", "position_cov", MAVLINK_FIELD_FLOAT, 80, 4, 3, 0},
+    {"custom_state", "custom_state", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CONTROL_SYSTEM_STATE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x_acc", "x_acc", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y_acc", "y_acc", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z_acc", "z_acc", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"x_vel", "x_vel", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"y_vel", "y_vel", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"z_vel", "z_vel", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"x_pos", "x_pos", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"y_pos", "y_pos", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"z_pos", "z_pos", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"airspeed", "空速", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"vel_variance", "vel_variance", MAVLINK_FIELD_FLOAT, 48, 4, 3, 0},
+    {"pos_variance", "pos_variance", MAVLINK_FIELD_FLOAT, 60, 4, 3, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 72, 4, 4, 0},
+    {"roll_rate", "roll_rate", MAVLINK_FIELD_FLOAT, 88, 4, 0, 0},
+    {"pitch_rate", "pitch_rate", MAVLINK_FIELD_FLOAT, 92, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 96, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_BATTERY_STATUS[] = {
+    {"id", "id", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"battery_function", "battery_function", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"voltages", "voltages", MAVLINK_FIELD_UINT16, 10, 2, 10, 0},
+    {"current_battery", "current_battery", MAVLINK_FIELD_INT16, 30, 2, 0, 0},
+    {"current_consumed", "current_consumed", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"energy_consumed", "energy_consumed", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"battery_remaining", "battery_remaining", MAVLINK_FIELD_INT8, 35, 1, 0, 0},
+    {"time_remaining", "time_remaining", MAVLINK_FIELD_INT32, 36, 4, 0, 1},
+    {"charge_state", "charge_state", MAVLINK_FIELD_UINT8, 40, 1, 0, 1},
+    {"voltages_ext", "voltages_ext", MAVLINK_FIELD_UINT16, 41, 2, 4, 1},
+    {"mode", "mode", MAVLINK_FIELD_UINT8, 49, 1, 0, 1},
+    {"fault_bitmask", "fault_bitmask", MAVLINK_FIELD_UINT32, 50, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_AUTOPILOT_VERSION[] = {
+    {"capabilities", "capabilities", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"flight_sw_version", "flight_sw_version", MAVLINK_FIELD_UINT32, 16, 4, 0, 0},
+    {"middleware_sw_version", "middleware_sw_version", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"os_sw_version", "os_sw_version", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+    {"board_version", "board_version", MAVLINK_FIELD_UINT32, 28, 4, 0, 0},
+    {"flight_custom_version", "flight_custom_version", MAVLINK_FIELD_UINT8, 36, 1, 8, 0},
+    {"middleware_custom_version", "middleware_custom_version", MAVLINK_FIELD_UINT8, 44, 1, 8, 0},
+    {"os_custom_version", "os_custom_version", MAVLINK_FIELD_UINT8, 52, 1, 8, 0},
+    {"vendor_id", "厂商ID", MAVLINK_FIELD_UINT16, 32, 2, 0, 0},
+    {"product_id", "产品ID", MAVLINK_FIELD_UINT16, 34, 2, 0, 0},
+    {"uid", "硬件UID", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+    {"uid2", "uid2", MAVLINK_FIELD_UINT8, 60, 1, 18, 1},
+};
+static const mavlink_field_info_t g_fields_LANDING_TARGET[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"target_num", "target_num", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"angle_x", "angle_x", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"angle_y", "angle_y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"distance", "distance", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"size_x", "size_x", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"size_y", "size_y", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 30, 4, 0, 1},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 34, 4, 0, 1},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 38, 4, 0, 1},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 42, 4, 4, 1},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 58, 1, 0, 1},
+    {"position_valid", "position_valid", MAVLINK_FIELD_UINT8, 59, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SENSOR_OFFSETS[] = {
+    {"mag_ofs_x", "mag_ofs_x", MAVLINK_FIELD_INT16, 36, 2, 0, 0},
+    {"mag_ofs_y", "mag_ofs_y", MAVLINK_FIELD_INT16, 38, 2, 0, 0},
+    {"mag_ofs_z", "mag_ofs_z", MAVLINK_FIELD_INT16, 40, 2, 0, 0},
+    {"mag_declination", "mag_declination", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"raw_press", "raw_press", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"raw_temp", "raw_temp", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"gyro_cal_x", "gyro_cal_x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"gyro_cal_y", "gyro_cal_y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"gyro_cal_z", "gyro_cal_z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"accel_cal_x", "accel_cal_x", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"accel_cal_y", "accel_cal_y", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"accel_cal_z", "accel_cal_z", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SET_MAG_OFFSETS[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"mag_ofs_x", "mag_ofs_x", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"mag_ofs_y", "mag_ofs_y", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+    {"mag_ofs_z", "mag_ofs_z", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MEMINFO[] = {
+    {"brkval", "brkval", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"freemem", "freemem", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"freemem32", "freemem32", MAVLINK_FIELD_UINT32, 4, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_AP_ADC[] = {
+    {"adc1", "adc1", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"adc2", "adc2", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"adc3", "adc3", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"adc4", "adc4", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+    {"adc5", "adc5", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"adc6", "adc6", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DIGICAM_CONFIGURE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"mode", "mode", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"shutter_speed", "shutter_speed", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"aperture", "aperture", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"iso", "iso", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"exposure_type", "exposure_type", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"command_id", "command_id", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"engine_cut_off", "engine_cut_off", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"extra_param", "extra_param", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+    {"extra_value", "extra_value", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DIGICAM_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"session", "session", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"zoom_pos", "zoom_pos", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"zoom_step", "zoom_step", MAVLINK_FIELD_INT8, 8, 1, 0, 0},
+    {"focus_lock", "focus_lock", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"shot", "shot", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"command_id", "command_id", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"extra_param", "extra_param", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"extra_value", "extra_value", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MOUNT_CONFIGURE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"mount_mode", "mount_mode", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"stab_roll", "stab_roll", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"stab_pitch", "stab_pitch", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"stab_yaw", "stab_yaw", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MOUNT_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"input_a", "input_a", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"input_b", "input_b", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"input_c", "input_c", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"save_position", "save_position", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MOUNT_STATUS[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"pointing_a", "pointing_a", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"pointing_b", "pointing_b", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"pointing_c", "pointing_c", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"mount_mode", "mount_mode", MAVLINK_FIELD_UINT8, 14, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_FENCE_POINT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"idx", "idx", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_FENCE_FETCH_POINT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"idx", "idx", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_FENCE_STATUS[] = {
+    {"breach_status", "breach_status", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"breach_count", "breach_count", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"breach_type", "breach_type", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"breach_time", "breach_time", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"breach_mitigation", "breach_mitigation", MAVLINK_FIELD_UINT8, 8, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_AHRS[] = {
+    {"omegaIx", "omegaIx", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"omegaIy", "omegaIy", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"omegaIz", "omegaIz", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"accel_weight", "accel_weight", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"renorm_val", "renorm_val", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"error_rp", "error_rp", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"error_yaw", "error_yaw", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SIMSTATE[] = {
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"xacc", "xacc", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yacc", "yacc", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"zacc", "zacc", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"xgyro", "xgyro", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"ygyro", "ygyro", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"zgyro", "zgyro", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 36, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 40, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HWSTATUS[] = {
+    {"Vcc", "Vcc", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"I2Cerr", "I2Cerr", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RADIO[] = {
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"remrssi", "remrssi", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"txbuf", "txbuf", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"noise", "noise", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"remnoise", "remnoise", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"rxerrors", "rxerrors", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"fixed", "fixed", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LIMITS_STATUS[] = {
+    {"limits_state", "limits_state", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"last_trigger", "last_trigger", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"last_action", "last_action", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"last_recovery", "last_recovery", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"last_clear", "last_clear", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+    {"breach_count", "breach_count", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"mods_enabled", "mods_enabled", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+    {"mods_required", "mods_required", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"mods_triggered", "mods_triggered", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_WIND[] = {
+    {"direction", "direction", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"speed", "speed", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"speed_z", "speed_z", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DATA16[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 16, 0},
+};
+static const mavlink_field_info_t g_fields_DATA32[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 32, 0},
+};
+static const mavlink_field_info_t g_fields_DATA64[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 64, 0},
+};
+static const mavlink_field_info_t g_fields_DATA96[] = {
+    {"type", "类型", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 96, 0},
+};
+static const mavlink_field_info_t g_fields_RANGEFINDER[] = {
+    {"distance", "distance", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AIRSPEED_AUTOCAL[] = {
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"diff_pressure", "diff_pressure", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"EAS2TAS", "EAS2TAS", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"ratio", "ratio", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"state_x", "state_x", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"state_y", "state_y", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"state_z", "state_z", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"Pax", "Pax", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"Pby", "Pby", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"Pcz", "Pcz", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RALLY_POINT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 15, 1, 0, 0},
+    {"idx", "idx", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT16, 8, 2, 0, 0},
+    {"break_alt", "break_alt", MAVLINK_FIELD_INT16, 10, 2, 0, 0},
+    {"land_dir", "land_dir", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RALLY_FETCH_POINT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"idx", "idx", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_COMPASSMOT_STATUS[] = {
+    {"throttle", "油门", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"current", "当前项", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"interference", "interference", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"CompensationX", "CompensationX", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"CompensationY", "CompensationY", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"CompensationZ", "CompensationZ", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AHRS2[] = {
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CAMERA_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"cam_idx", "cam_idx", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"img_idx", "img_idx", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"event_id", "event_id", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"p1", "p1", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"p2", "p2", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"p3", "p3", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"p4", "p4", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CAMERA_FEEDBACK[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"cam_idx", "cam_idx", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"img_idx", "img_idx", MAVLINK_FIELD_UINT16, 40, 2, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt_msl", "alt_msl", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"alt_rel", "alt_rel", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"foc_len", "foc_len", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 44, 1, 0, 0},
+    {"completed_captures", "completed_captures", MAVLINK_FIELD_UINT16, 45, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_BATTERY2[] = {
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"current_battery", "current_battery", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AHRS3[] = {
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"v1", "v1", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"v2", "v2", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"v3", "v3", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"v4", "v4", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AUTOPILOT_VERSION_REQUEST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_REMOTE_LOG_DATA_BLOCK[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"seqno", "seqno", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 6, 1, 200, 0},
+};
+static const mavlink_field_info_t g_fields_REMOTE_LOG_BLOCK_STATUS[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"seqno", "seqno", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_LED_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"instance", "instance", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"pattern", "pattern", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"custom_len", "custom_len", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"custom_bytes", "custom_bytes", MAVLINK_FIELD_UINT8, 5, 1, 24, 0},
+};
+static const mavlink_field_info_t g_fields_MAG_CAL_PROGRESS[] = {
+    {"compass_id", "compass_id", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"cal_mask", "cal_mask", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"cal_status", "cal_status", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+    {"attempt", "attempt", MAVLINK_FIELD_UINT8, 15, 1, 0, 0},
+    {"completion_pct", "completion_pct", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"completion_mask", "completion_mask", MAVLINK_FIELD_UINT8, 17, 1, 10, 0},
+    {"direction_x", "direction_x", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"direction_y", "direction_y", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"direction_z", "direction_z", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MAG_CAL_REPORT[] = {
+    {"compass_id", "compass_id", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"cal_mask", "cal_mask", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+    {"cal_status", "cal_status", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"autosaved", "autosaved", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"fitness", "fitness", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"ofs_x", "ofs_x", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"ofs_y", "ofs_y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"ofs_z", "ofs_z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"diag_x", "diag_x", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"diag_y", "diag_y", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"diag_z", "diag_z", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"offdiag_x", "offdiag_x", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"offdiag_y", "offdiag_y", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"offdiag_z", "offdiag_z", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"orientation_confidence", "orientation_confidence", MAVLINK_FIELD_FLOAT, 44, 4, 0, 1},
+    {"old_orientation", "old_orientation", MAVLINK_FIELD_UINT8, 48, 1, 0, 1},
+    {"new_orientation", "new_orientation", MAVLINK_FIELD_UINT8, 49, 1, 0, 1},
+    {"scale_factor", "scale_factor", MAVLINK_FIELD_FLOAT, 50, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_EKF_STATUS_REPORT[] = {
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"velocity_variance", "velocity_variance", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"pos_horiz_variance", "pos_horiz_variance", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"pos_vert_variance", "pos_vert_variance", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"compass_variance", "compass_variance", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"terrain_alt_variance", "terrain_alt_variance", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"airspeed_variance", "airspeed_variance", MAVLINK_FIELD_FLOAT, 22, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_PID_TUNING[] = {
+    {"axis", "axis", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"desired", "desired", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"achieved", "achieved", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"FF", "FF", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"P", "P", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"I", "I", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"D", "D", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"SRate", "SRate", MAVLINK_FIELD_FLOAT, 25, 4, 0, 1},
+    {"PDmod", "PDmod", MAVLINK_FIELD_FLOAT, 29, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DEEPSTALL[] = {
+    {"landing_lat", "landing_lat", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"landing_lon", "landing_lon", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"path_lat", "path_lat", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"path_lon", "path_lon", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"arc_entry_lat", "arc_entry_lat", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"arc_entry_lon", "arc_entry_lon", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"expected_travel_distance", "expected_travel_distance", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"cross_track_error", "cross_track_error", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"stage", "stage", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_REPORT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+    {"delta_time", "delta_time", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"delta_angle_x", "delta_angle_x", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"delta_angle_y", "delta_angle_y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"delta_angle_z", "delta_angle_z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"delta_velocity_x", "delta_velocity_x", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"delta_velocity_y", "delta_velocity_y", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"delta_velocity_z", "delta_velocity_z", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"joint_roll", "joint_roll", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"joint_el", "joint_el", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"joint_az", "joint_az", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 13, 1, 0, 0},
+    {"demanded_rate_x", "demanded_rate_x", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"demanded_rate_y", "demanded_rate_y", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"demanded_rate_z", "demanded_rate_z", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_TORQUE_CMD_REPORT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"rl_torque_cmd", "rl_torque_cmd", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"el_torque_cmd", "el_torque_cmd", MAVLINK_FIELD_INT16, 2, 2, 0, 0},
+    {"az_torque_cmd", "az_torque_cmd", MAVLINK_FIELD_INT16, 4, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GOPRO_HEARTBEAT[] = {
+    {"status", "status", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"capture_mode", "capture_mode", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GOPRO_GET_REQUEST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"cmd_id", "cmd_id", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GOPRO_GET_RESPONSE[] = {
+    {"cmd_id", "cmd_id", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"value", "value", MAVLINK_FIELD_UINT8, 2, 1, 4, 0},
+};
+static const mavlink_field_info_t g_fields_GOPRO_SET_REQUEST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"cmd_id", "cmd_id", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"value", "value", MAVLINK_FIELD_UINT8, 3, 1, 4, 0},
+};
+static const mavlink_field_info_t g_fields_GOPRO_SET_RESPONSE[] = {
+    {"cmd_id", "cmd_id", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_EFI_STATUS[] = {
+    {"health", "health", MAVLINK_FIELD_UINT8, 64, 1, 0, 0},
+    {"ecu_index", "ecu_index", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"fuel_consumed", "fuel_consumed", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"fuel_flow", "fuel_flow", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"engine_load", "engine_load", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"throttle_position", "throttle_position", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"spark_dwell_time", "spark_dwell_time", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"barometric_pressure", "barometric_pressure", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"intake_manifold_pressure", "intake_manifold_pressure", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"intake_manifold_temperature", "intake_manifold_temperature", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"cylinder_head_temperature", "cylinder_head_temperature", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"ignition_timing", "ignition_timing", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"injection_time", "injection_time", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"exhaust_gas_temperature", "exhaust_gas_temperature", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"throttle_out", "throttle_out", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"pt_compensation", "pt_compensation", MAVLINK_FIELD_FLOAT, 60, 4, 0, 0},
+    {"ignition_voltage", "ignition_voltage", MAVLINK_FIELD_FLOAT, 65, 4, 0, 1},
+    {"fuel_pressure", "fuel_pressure", MAVLINK_FIELD_FLOAT, 69, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_RPM[] = {
+    {"rpm1", "rpm1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"rpm2", "rpm2", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ESTIMATOR_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 40, 2, 0, 0},
+    {"vel_ratio", "vel_ratio", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"pos_horiz_ratio", "pos_horiz_ratio", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"pos_vert_ratio", "pos_vert_ratio", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"mag_ratio", "mag_ratio", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"hagl_ratio", "hagl_ratio", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"tas_ratio", "tas_ratio", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"pos_horiz_accuracy", "pos_horiz_accuracy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"pos_vert_accuracy", "pos_vert_accuracy", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_WIND_COV[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"wind_x", "wind_x", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"wind_y", "wind_y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"wind_z", "wind_z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"var_horiz", "var_horiz", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"var_vert", "var_vert", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"wind_alt", "wind_alt", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"horiz_accuracy", "horiz_accuracy", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"vert_accuracy", "vert_accuracy", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GPS_INPUT[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"gps_id", "gps_id", MAVLINK_FIELD_UINT8, 60, 1, 0, 0},
+    {"ignore_flags", "ignore_flags", MAVLINK_FIELD_UINT16, 56, 2, 0, 0},
+    {"time_week_ms", "time_week_ms", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"time_week", "time_week", MAVLINK_FIELD_UINT16, 58, 2, 0, 0},
+    {"fix_type", "定位类型", MAVLINK_FIELD_UINT8, 61, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"hdop", "hdop", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"vdop", "vdop", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"vn", "vn", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"ve", "ve", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"vd", "vd", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"speed_accuracy", "speed_accuracy", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"horiz_accuracy", "horiz_accuracy", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"vert_accuracy", "vert_accuracy", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"satellites_visible", "可见卫星数", MAVLINK_FIELD_UINT8, 62, 1, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_UINT16, 63, 2, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GPS_RTCM_DATA[] = {
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 2, 1, 180, 0},
+};
+static const mavlink_field_info_t g_fields_HIGH_LATENCY[] = {
+    {"base_mode", "基本模式", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"custom_mode", "自定义模式", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"landed_state", "landed_state", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_INT16, 12, 2, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"heading", "航向", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"throttle", "油门", MAVLINK_FIELD_INT8, 28, 1, 0, 0},
+    {"heading_sp", "heading_sp", MAVLINK_FIELD_INT16, 18, 2, 0, 0},
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"altitude_amsl", "altitude_amsl", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"altitude_sp", "altitude_sp", MAVLINK_FIELD_INT16, 22, 2, 0, 0},
+    {"airspeed", "空速", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"airspeed_sp", "airspeed_sp", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"groundspeed", "地速", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"climb_rate", "climb_rate", MAVLINK_FIELD_INT8, 32, 1, 0, 0},
+    {"gps_nsat", "gps_nsat", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"gps_fix_type", "gps_fix_type", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"battery_remaining", "battery_remaining", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT8, 36, 1, 0, 0},
+    {"temperature_air", "temperature_air", MAVLINK_FIELD_INT8, 37, 1, 0, 0},
+    {"failsafe", "failsafe", MAVLINK_FIELD_UINT8, 38, 1, 0, 0},
+    {"wp_num", "wp_num", MAVLINK_FIELD_UINT8, 39, 1, 0, 0},
+    {"wp_distance", "wp_distance", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HIGH_LATENCY2[] = {
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"autopilot", "自驾仪类型", MAVLINK_FIELD_UINT8, 25, 1, 0, 0},
+    {"custom_mode", "自定义模式", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT16, 14, 2, 0, 0},
+    {"target_altitude", "target_altitude", MAVLINK_FIELD_INT16, 16, 2, 0, 0},
+    {"heading", "航向", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"target_heading", "target_heading", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"target_distance", "target_distance", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"throttle", "油门", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"airspeed", "空速", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"airspeed_sp", "airspeed_sp", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"groundspeed", "地速", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"windspeed", "windspeed", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"wind_heading", "wind_heading", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"eph", "eph", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"epv", "epv", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"temperature_air", "temperature_air", MAVLINK_FIELD_INT8, 36, 1, 0, 0},
+    {"climb_rate", "climb_rate", MAVLINK_FIELD_INT8, 37, 1, 0, 0},
+    {"battery", "battery", MAVLINK_FIELD_INT8, 38, 1, 0, 0},
+    {"wp_num", "wp_num", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"failure_flags", "failure_flags", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"custom0", "custom0", MAVLINK_FIELD_INT8, 39, 1, 0, 0},
+    {"custom1", "custom1", MAVLINK_FIELD_INT8, 40, 1, 0, 0},
+    {"custom2", "custom2", MAVLINK_FIELD_INT8, 41, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_VIBRATION[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"vibration_x", "vibration_x", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"vibration_y", "vibration_y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"vibration_z", "vibration_z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"clipping_0", "clipping_0", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"clipping_1", "clipping_1", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+    {"clipping_2", "clipping_2", MAVLINK_FIELD_UINT32, 28, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HOME_POSITION[] = {
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 24, 4, 4, 0},
+    {"approach_x", "approach_x", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"approach_y", "approach_y", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"approach_z", "approach_z", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 52, 8, 0, 1},
+};
+static const mavlink_field_info_t g_fields_SET_HOME_POSITION[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 24, 4, 4, 0},
+    {"approach_x", "approach_x", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"approach_y", "approach_y", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"approach_z", "approach_z", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 53, 8, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MESSAGE_INTERVAL[] = {
+    {"message_id", "消息ID", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"interval_us", "间隔(微秒)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_EXTENDED_SYS_STATE[] = {
+    {"vtol_state", "vtol_state", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"landed_state", "landed_state", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ADSB_VEHICLE[] = {
+    {"ICAO_address", "ICAO_address", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"altitude_type", "altitude_type", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"altitude", "高度(毫米)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"heading", "航向", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"hor_velocity", "hor_velocity", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"ver_velocity", "ver_velocity", MAVLINK_FIELD_INT16, 20, 2, 0, 0},
+    {"callsign", "callsign", MAVLINK_FIELD_CHAR, 27, 1, 9, 0},
+    {"emitter_type", "emitter_type", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"tslc", "tslc", MAVLINK_FIELD_UINT8, 37, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"squawk", "squawk", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_COLLISION[] = {
+    {"src", "src", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"action", "action", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"threat_level", "threat_level", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"time_to_minimum_delta", "time_to_minimum_delta", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"altitude_minimum_delta", "altitude_minimum_delta", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"horizontal_minimum_delta", "horizontal_minimum_delta", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_V2_EXTENSION[] = {
+    {"target_network", "目标网络", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"message_type", "message_type", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"payload", "载荷", MAVLINK_FIELD_UINT8, 5, 1, 249, 0},
+};
+static const mavlink_field_info_t g_fields_MEMORY_VECT[] = {
+    {"address", "address", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"ver", "ver", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"value", "value", MAVLINK_FIELD_INT8, 4, 1, 32, 0},
+};
+static const mavlink_field_info_t g_fields_DEBUG_VECT[] = {
+    {"name", "name", MAVLINK_FIELD_CHAR, 20, 1, 10, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_NAMED_VALUE_FLOAT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 8, 1, 10, 0},
+    {"value", "value", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_NAMED_VALUE_INT[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 8, 1, 10, 0},
+    {"value", "value", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_STATUSTEXT[] = {
+    {"severity", "严重级别", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"text", "文本", MAVLINK_FIELD_CHAR, 1, 1, 50, 0},
+    {"id", "id", MAVLINK_FIELD_UINT16, 51, 2, 0, 1},
+    {"chunk_seq", "chunk_seq", MAVLINK_FIELD_UINT8, 53, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DEBUG[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"ind", "ind", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"value", "value", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SETUP_SIGNING[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"secret_key", "secret_key", MAVLINK_FIELD_UINT8, 10, 1, 32, 0},
+    {"initial_timestamp", "initial_timestamp", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+};
+static const mavlink_field_info_t g_fields_BUTTON_CHANGE[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"last_change_ms", "last_change_ms", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"state", "state", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PLAY_TUNE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"tune", "tune", MAVLINK_FIELD_CHAR, 2, 1, 30, 0},
+    {"tune2", "tune2", MAVLINK_FIELD_CHAR, 32, 1, 200, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"vendor_name", "vendor_name", MAVLINK_FIELD_UINT8, 30, 1, 32, 0},
+    {"model_name", "model_name", MAVLINK_FIELD_UINT8, 62, 1, 32, 0},
+    {"firmware_version", "firmware_version", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"focal_length", "focal_length", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"sensor_size_h", "sensor_size_h", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"sensor_size_v", "sensor_size_v", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"resolution_h", "resolution_h", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"resolution_v", "resolution_v", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"lens_id", "lens_id", MAVLINK_FIELD_UINT8, 94, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"cam_definition_version", "cam_definition_version", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"cam_definition_uri", "cam_definition_uri", MAVLINK_FIELD_CHAR, 95, 1, 140, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 235, 1, 0, 1},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 236, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_SETTINGS[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"mode_id", "mode_id", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"zoomLevel", "zoomLevel", MAVLINK_FIELD_FLOAT, 5, 4, 0, 1},
+    {"focusLevel", "focusLevel", MAVLINK_FIELD_FLOAT, 9, 4, 0, 1},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 13, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_STORAGE_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"storage_id", "storage_id", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"storage_count", "storage_count", MAVLINK_FIELD_UINT8, 25, 1, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"total_capacity", "total_capacity", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"used_capacity", "used_capacity", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"available_capacity", "available_capacity", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"read_speed", "read_speed", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"write_speed", "write_speed", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 27, 1, 0, 1},
+    {"name", "name", MAVLINK_FIELD_CHAR, 28, 1, 32, 1},
+    {"storage_usage", "storage_usage", MAVLINK_FIELD_UINT8, 60, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_CAPTURE_STATUS[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"image_status", "image_status", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"video_status", "video_status", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"image_interval", "image_interval", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"recording_time_ms", "recording_time_ms", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"available_capacity", "available_capacity", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"image_count", "image_count", MAVLINK_FIELD_INT32, 18, 4, 0, 1},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 22, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_IMAGE_CAPTURED[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"time_utc", "time_utc", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"camera_id", "camera_id", MAVLINK_FIELD_UINT8, 48, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"relative_alt", "相对高度(毫米)", MAVLINK_FIELD_INT32, 24, 4, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 28, 4, 4, 0},
+    {"image_index", "image_index", MAVLINK_FIELD_INT32, 44, 4, 0, 0},
+    {"capture_result", "capture_result", MAVLINK_FIELD_INT8, 49, 1, 0, 0},
+    {"file_url", "file_url", MAVLINK_FIELD_CHAR, 50, 1, 205, 0},
+};
+static const mavlink_field_info_t g_fields_FLIGHT_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+    {"arming_time_utc", "arming_time_utc", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"takeoff_time_utc", "takeoff_time_utc", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+    {"flight_uuid", "flight_uuid", MAVLINK_FIELD_UINT64, 16, 8, 0, 0},
+    {"landing_time", "landing_time", MAVLINK_FIELD_UINT32, 28, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_MOUNT_ORIENTATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yaw_absolute", "yaw_absolute", MAVLINK_FIELD_FLOAT, 16, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_LOGGING_DATA[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"length", "length", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"first_message_offset", "first_message_offset", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 6, 1, 249, 0},
+};
+static const mavlink_field_info_t g_fields_LOGGING_DATA_ACKED[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"length", "length", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"first_message_offset", "first_message_offset", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 6, 1, 249, 0},
+};
+static const mavlink_field_info_t g_fields_LOGGING_ACK[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_VIDEO_STREAM_INFORMATION[] = {
+    {"stream_id", "stream_id", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"framerate", "framerate", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"resolution_h", "resolution_h", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"resolution_v", "resolution_v", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"bitrate", "bitrate", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"rotation", "rotation", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"hfov", "hfov", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 21, 1, 32, 0},
+    {"uri", "uri", MAVLINK_FIELD_CHAR, 53, 1, 160, 0},
+    {"encoding", "encoding", MAVLINK_FIELD_UINT8, 213, 1, 0, 1},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 214, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_VIDEO_STREAM_STATUS[] = {
+    {"stream_id", "stream_id", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"framerate", "framerate", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"resolution_h", "resolution_h", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"resolution_v", "resolution_v", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"bitrate", "bitrate", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"rotation", "rotation", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"hfov", "hfov", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 19, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_FOV_STATUS[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"lat_camera", "lat_camera", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon_camera", "lon_camera", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"alt_camera", "alt_camera", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"lat_image", "lat_image", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"lon_image", "lon_image", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"alt_image", "alt_image", MAVLINK_FIELD_INT32, 24, 4, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 28, 4, 4, 0},
+    {"hfov", "hfov", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"vfov", "vfov", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 52, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_TRACKING_IMAGE_STATUS[] = {
+    {"tracking_status", "tracking_status", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"tracking_mode", "tracking_mode", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"target_data", "target_data", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"point_x", "point_x", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"point_y", "point_y", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"radius", "radius", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"rec_top_x", "rec_top_x", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"rec_top_y", "rec_top_y", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"rec_bottom_x", "rec_bottom_x", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"rec_bottom_y", "rec_bottom_y", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 31, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_CAMERA_TRACKING_GEO_STATUS[] = {
+    {"tracking_status", "tracking_status", MAVLINK_FIELD_UINT8, 48, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"h_acc", "h_acc", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"v_acc", "v_acc", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"vel_n", "vel_n", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"vel_e", "vel_e", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"vel_d", "vel_d", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"vel_acc", "vel_acc", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"dist", "dist", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"hdg", "hdg", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"hdg_acc", "hdg_acc", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"camera_device_id", "camera_device_id", MAVLINK_FIELD_UINT8, 49, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_MANAGER_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"cap_flags", "cap_flags", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"roll_min", "roll_min", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"roll_max", "roll_max", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"pitch_min", "pitch_min", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"pitch_max", "pitch_max", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"yaw_min", "yaw_min", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"yaw_max", "yaw_max", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_MANAGER_STATUS[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"primary_control_sysid", "primary_control_sysid", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"primary_control_compid", "primary_control_compid", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"secondary_control_sysid", "secondary_control_sysid", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"secondary_control_compid", "secondary_control_compid", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_MANAGER_SET_ATTITUDE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 4, 4, 4, 0},
+    {"angular_velocity_x", "angular_velocity_x", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"angular_velocity_y", "angular_velocity_y", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"angular_velocity_z", "angular_velocity_z", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_DEVICE_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"vendor_name", "vendor_name", MAVLINK_FIELD_CHAR, 48, 1, 32, 0},
+    {"model_name", "model_name", MAVLINK_FIELD_CHAR, 80, 1, 32, 0},
+    {"custom_name", "custom_name", MAVLINK_FIELD_CHAR, 112, 1, 32, 0},
+    {"firmware_version", "firmware_version", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+    {"hardware_version", "hardware_version", MAVLINK_FIELD_UINT32, 16, 4, 0, 0},
+    {"uid", "硬件UID", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"cap_flags", "cap_flags", MAVLINK_FIELD_UINT16, 44, 2, 0, 0},
+    {"custom_cap_flags", "custom_cap_flags", MAVLINK_FIELD_UINT16, 46, 2, 0, 0},
+    {"roll_min", "roll_min", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"roll_max", "roll_max", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"pitch_min", "pitch_min", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"pitch_max", "pitch_max", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"yaw_min", "yaw_min", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"yaw_max", "yaw_max", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 144, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_DEVICE_SET_ATTITUDE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 28, 2, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 0, 4, 4, 0},
+    {"angular_velocity_x", "angular_velocity_x", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"angular_velocity_y", "angular_velocity_y", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"angular_velocity_z", "angular_velocity_z", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_DEVICE_ATTITUDE_STATUS[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 38, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 39, 1, 0, 0},
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 36, 2, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 4, 4, 4, 0},
+    {"angular_velocity_x", "angular_velocity_x", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"angular_velocity_y", "angular_velocity_y", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"angular_velocity_z", "angular_velocity_z", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"failure_flags", "failure_flags", MAVLINK_FIELD_UINT32, 32, 4, 0, 0},
+    {"delta_yaw", "delta_yaw", MAVLINK_FIELD_FLOAT, 40, 4, 0, 1},
+    {"delta_yaw_velocity", "delta_yaw_velocity", MAVLINK_FIELD_FLOAT, 44, 4, 0, 1},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 48, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 51, 1, 0, 0},
+    {"time_boot_us", "time_boot_us", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 8, 4, 4, 0},
+    {"q_estimated_delay_us", "q_estimated_delay_us", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"v_estimated_delay_us", "v_estimated_delay_us", MAVLINK_FIELD_UINT32, 40, 4, 0, 0},
+    {"feed_forward_angular_velocity_z", "feed_forward_angular_velocity_z", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"estimator_status", "estimator_status", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"landed_state", "landed_state", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"angular_velocity_z", "angular_velocity_z", MAVLINK_FIELD_FLOAT, 53, 4, 0, 1},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_MANAGER_SET_PITCHYAW[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"pitch_rate", "pitch_rate", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_GIMBAL_MANAGER_SET_MANUAL_CONTROL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"gimbal_device_id", "gimbal_device_id", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"pitch_rate", "pitch_rate", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"yaw_rate", "yaw_rate", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_INFO[] = {
+    {"index", "index", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"counter", "counter", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"connection_type", "connection_type", MAVLINK_FIELD_UINT8, 44, 1, 0, 0},
+    {"info", "info", MAVLINK_FIELD_UINT8, 45, 1, 0, 0},
+    {"failure_flags", "failure_flags", MAVLINK_FIELD_UINT16, 26, 2, 4, 0},
+    {"error_count", "error_count", MAVLINK_FIELD_UINT32, 8, 4, 4, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 34, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_STATUS[] = {
+    {"index", "index", MAVLINK_FIELD_UINT8, 56, 1, 0, 0},
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_INT32, 8, 4, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_FLOAT, 24, 4, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_FLOAT, 40, 4, 4, 0},
+};
+static const mavlink_field_info_t g_fields_WIFI_CONFIG_AP[] = {
+    {"ssid", "ssid", MAVLINK_FIELD_CHAR, 0, 1, 32, 0},
+    {"password", "password", MAVLINK_FIELD_CHAR, 32, 1, 64, 0},
+    {"mode", "mode", MAVLINK_FIELD_INT8, 96, 1, 0, 1},
+    {"response", "response", MAVLINK_FIELD_INT8, 97, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_PROTOCOL_VERSION[] = {
+    {"version", "版本", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"min_version", "min_version", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"max_version", "max_version", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"spec_version_hash", "spec_version_hash", MAVLINK_FIELD_UINT8, 6, 1, 8, 0},
+    {"library_version_hash", "library_version_hash", MAVLINK_FIELD_UINT8, 14, 1, 8, 0},
+};
+static const mavlink_field_info_t g_fields_AIS_VESSEL[] = {
+    {"MMSI", "MMSI", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"COG", "COG", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"heading", "航向", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"velocity", "velocity", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"turn_rate", "turn_rate", MAVLINK_FIELD_INT8, 26, 1, 0, 0},
+    {"navigational_status", "navigational_status", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"dimension_bow", "dimension_bow", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"dimension_stern", "dimension_stern", MAVLINK_FIELD_UINT16, 20, 2, 0, 0},
+    {"dimension_port", "dimension_port", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"dimension_starboard", "dimension_starboard", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"callsign", "callsign", MAVLINK_FIELD_CHAR, 31, 1, 7, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 38, 1, 20, 0},
+    {"tslc", "tslc", MAVLINK_FIELD_UINT16, 22, 2, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVCAN_NODE_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"uptime_sec", "uptime_sec", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"health", "health", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+    {"mode", "mode", MAVLINK_FIELD_UINT8, 15, 1, 0, 0},
+    {"sub_mode", "sub_mode", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"vendor_specific_status_code", "vendor_specific_status_code", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVCAN_NODE_INFO[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"uptime_sec", "uptime_sec", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 16, 1, 80, 0},
+    {"hw_version_major", "hw_version_major", MAVLINK_FIELD_UINT8, 96, 1, 0, 0},
+    {"hw_version_minor", "hw_version_minor", MAVLINK_FIELD_UINT8, 97, 1, 0, 0},
+    {"hw_unique_id", "hw_unique_id", MAVLINK_FIELD_UINT8, 98, 1, 16, 0},
+    {"sw_version_major", "sw_version_major", MAVLINK_FIELD_UINT8, 114, 1, 0, 0},
+    {"sw_version_minor", "sw_version_minor", MAVLINK_FIELD_UINT8, 115, 1, 0, 0},
+    {"sw_vcs_commit", "sw_vcs_commit", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_EXT_REQUEST_READ[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 4, 1, 16, 0},
+    {"param_index", "参数索引", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_EXT_REQUEST_LIST[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_EXT_VALUE[] = {
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 4, 1, 16, 0},
+    {"param_value", "参数值", MAVLINK_FIELD_CHAR, 20, 1, 128, 0},
+    {"param_type", "参数类型", MAVLINK_FIELD_UINT8, 148, 1, 0, 0},
+    {"param_count", "参数总数", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"param_index", "参数索引", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_EXT_SET[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 2, 1, 16, 0},
+    {"param_value", "参数值", MAVLINK_FIELD_CHAR, 18, 1, 128, 0},
+    {"param_type", "参数类型", MAVLINK_FIELD_UINT8, 146, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_PARAM_EXT_ACK[] = {
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 0, 1, 16, 0},
+    {"param_value", "参数值", MAVLINK_FIELD_CHAR, 16, 1, 128, 0},
+    {"param_type", "参数类型", MAVLINK_FIELD_UINT8, 144, 1, 0, 0},
+    {"param_result", "param_result", MAVLINK_FIELD_UINT8, 145, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OBSTACLE_DISTANCE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"sensor_type", "sensor_type", MAVLINK_FIELD_UINT8, 156, 1, 0, 0},
+    {"distances", "distances", MAVLINK_FIELD_UINT16, 8, 2, 72, 0},
+    {"increment", "increment", MAVLINK_FIELD_UINT8, 157, 1, 0, 0},
+    {"min_distance", "min_distance", MAVLINK_FIELD_UINT16, 152, 2, 0, 0},
+    {"max_distance", "max_distance", MAVLINK_FIELD_UINT16, 154, 2, 0, 0},
+    {"increment_f", "increment_f", MAVLINK_FIELD_FLOAT, 158, 4, 0, 1},
+    {"angle_offset", "angle_offset", MAVLINK_FIELD_FLOAT, 162, 4, 0, 1},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 166, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_ODOMETRY[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"frame_id", "frame_id", MAVLINK_FIELD_UINT8, 228, 1, 0, 0},
+    {"child_frame_id", "child_frame_id", MAVLINK_FIELD_UINT8, 229, 1, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"q", "q", MAVLINK_FIELD_FLOAT, 20, 4, 4, 0},
+    {"vx", "X速度", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"rollspeed", "rollspeed", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"pitchspeed", "pitchspeed", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"yawspeed", "yawspeed", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"pose_covariance", "pose_covariance", MAVLINK_FIELD_FLOAT, 60, 4, 21, 0},
+    {"velocity_covariance", "velocity_covariance", MAVLINK_FIELD_FLOAT, 144, 4, 21, 0},
+    {"reset_counter", "reset_counter", MAVLINK_FIELD_UINT8, 230, 1, 0, 1},
+    {"estimator_type", "estimator_type", MAVLINK_FIELD_UINT8, 231, 1, 0, 1},
+    {"quality", "quality", MAVLINK_FIELD_INT8, 232, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_TRAJECTORY_REPRESENTATION_WAYPOINTS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"valid_points", "valid_points", MAVLINK_FIELD_UINT8, 238, 1, 0, 0},
+    {"pos_x", "pos_x", MAVLINK_FIELD_FLOAT, 8, 4, 5, 0},
+    {"pos_y", "pos_y", MAVLINK_FIELD_FLOAT, 28, 4, 5, 0},
+    {"pos_z", "pos_z", MAVLINK_FIELD_FLOAT, 48, 4, 5, 0},
+    {"vel_x", "vel_x", MAVLINK_FIELD_FLOAT, 68, 4, 5, 0},
+    {"vel_y", "vel_y", MAVLINK_FIELD_FLOAT, 88, 4, 5, 0},
+    {"vel_z", "vel_z", MAVLINK_FIELD_FLOAT, 108, 4, 5, 0},
+    {"acc_x", "acc_x", MAVLINK_FIELD_FLOAT, 128, 4, 5, 0},
+    {"acc_y", "acc_y", MAVLINK_FIELD_FLOAT, 148, 4, 5, 0},
+    {"acc_z", "acc_z", MAVLINK_FIELD_FLOAT, 168, 4, 5, 0},
+    {"pos_yaw", "pos_yaw", MAVLINK_FIELD_FLOAT, 188, 4, 5, 0},
+    {"vel_yaw", "vel_yaw", MAVLINK_FIELD_FLOAT, 208, 4, 5, 0},
+    {"command", "命令ID", MAVLINK_FIELD_UINT16, 228, 2, 5, 0},
+};
+static const mavlink_field_info_t g_fields_TRAJECTORY_REPRESENTATION_BEZIER[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"valid_points", "valid_points", MAVLINK_FIELD_UINT8, 108, 1, 0, 0},
+    {"pos_x", "pos_x", MAVLINK_FIELD_FLOAT, 8, 4, 5, 0},
+    {"pos_y", "pos_y", MAVLINK_FIELD_FLOAT, 28, 4, 5, 0},
+    {"pos_z", "pos_z", MAVLINK_FIELD_FLOAT, 48, 4, 5, 0},
+    {"delta", "delta", MAVLINK_FIELD_FLOAT, 68, 4, 5, 0},
+    {"pos_yaw", "pos_yaw", MAVLINK_FIELD_FLOAT, 88, 4, 5, 0},
+};
+static const mavlink_field_info_t g_fields_CELLULAR_STATUS[] = {
+    {"status", "status", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"failure_reason", "failure_reason", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"quality", "quality", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"mcc", "mcc", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"mnc", "mnc", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"lac", "lac", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ISBD_LINK_STATUS[] = {
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"last_heartbeat", "last_heartbeat", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+    {"failed_sessions", "failed_sessions", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"successful_sessions", "successful_sessions", MAVLINK_FIELD_UINT16, 18, 2, 0, 0},
+    {"signal_quality", "signal_quality", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"ring_pending", "ring_pending", MAVLINK_FIELD_UINT8, 21, 1, 0, 0},
+    {"tx_session_pending", "tx_session_pending", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"rx_session_pending", "rx_session_pending", MAVLINK_FIELD_UINT8, 23, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CELLULAR_CONFIG[] = {
+    {"enable_lte", "enable_lte", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"enable_pin", "enable_pin", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"pin", "pin", MAVLINK_FIELD_CHAR, 2, 1, 16, 0},
+    {"new_pin", "new_pin", MAVLINK_FIELD_CHAR, 18, 1, 16, 0},
+    {"apn", "apn", MAVLINK_FIELD_CHAR, 34, 1, 32, 0},
+    {"puk", "puk", MAVLINK_FIELD_CHAR, 66, 1, 16, 0},
+    {"roaming", "roaming", MAVLINK_FIELD_UINT8, 82, 1, 0, 0},
+    {"response", "response", MAVLINK_FIELD_UINT8, 83, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RAW_RPM[] = {
+    {"index", "index", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"frequency", "frequency", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UTM_GLOBAL_POSITION[] = {
+    {"time", "time", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"uas_id", "uas_id", MAVLINK_FIELD_UINT8, 50, 1, 18, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"lon", "经度(1e-7度)", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"relative_alt", "相对高度(毫米)", MAVLINK_FIELD_INT32, 20, 4, 0, 0},
+    {"vx", "X速度", MAVLINK_FIELD_INT16, 36, 2, 0, 0},
+    {"vy", "Y速度", MAVLINK_FIELD_INT16, 38, 2, 0, 0},
+    {"vz", "Z速度", MAVLINK_FIELD_INT16, 40, 2, 0, 0},
+    {"h_acc", "h_acc", MAVLINK_FIELD_UINT16, 42, 2, 0, 0},
+    {"v_acc", "v_acc", MAVLINK_FIELD_UINT16, 44, 2, 0, 0},
+    {"vel_acc", "vel_acc", MAVLINK_FIELD_UINT16, 46, 2, 0, 0},
+    {"next_lat", "next_lat", MAVLINK_FIELD_INT32, 24, 4, 0, 0},
+    {"next_lon", "next_lon", MAVLINK_FIELD_INT32, 28, 4, 0, 0},
+    {"next_alt", "next_alt", MAVLINK_FIELD_INT32, 32, 4, 0, 0},
+    {"update_rate", "update_rate", MAVLINK_FIELD_UINT16, 48, 2, 0, 0},
+    {"flight_state", "flight_state", MAVLINK_FIELD_UINT8, 68, 1, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 69, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DEBUG_FLOAT_ARRAY[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"name", "name", MAVLINK_FIELD_CHAR, 10, 1, 10, 0},
+    {"array_id", "array_id", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_FLOAT, 20, 4, 58, 1},
+};
+static const mavlink_field_info_t g_fields_ORBIT_EXECUTION_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"radius", "radius", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 24, 1, 0, 0},
+    {"x", "X", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SMART_BATTERY_INFO[] = {
+    {"id", "id", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"battery_function", "battery_function", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 20, 1, 0, 0},
+    {"capacity_full_specification", "capacity_full_specification", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"capacity_full", "capacity_full", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"cycle_count", "cycle_count", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"serial_number", "serial_number", MAVLINK_FIELD_CHAR, 21, 1, 16, 0},
+    {"device_name", "device_name", MAVLINK_FIELD_CHAR, 37, 1, 50, 0},
+    {"weight", "weight", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"discharge_minimum_voltage", "discharge_minimum_voltage", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"charging_minimum_voltage", "charging_minimum_voltage", MAVLINK_FIELD_UINT16, 14, 2, 0, 0},
+    {"resting_minimum_voltage", "resting_minimum_voltage", MAVLINK_FIELD_UINT16, 16, 2, 0, 0},
+    {"charging_maximum_voltage", "charging_maximum_voltage", MAVLINK_FIELD_UINT16, 87, 2, 0, 1},
+    {"cells_in_series", "cells_in_series", MAVLINK_FIELD_UINT8, 89, 1, 0, 1},
+    {"discharge_maximum_current", "discharge_maximum_current", MAVLINK_FIELD_UINT32, 90, 4, 0, 1},
+    {"discharge_maximum_burst_current", "discharge_maximum_burst_current", MAVLINK_FIELD_UINT32, 94, 4, 0, 1},
+    {"manufacture_date", "manufacture_date", MAVLINK_FIELD_CHAR, 98, 1, 11, 1},
+};
+static const mavlink_field_info_t g_fields_GENERATOR_STATUS[] = {
+    {"status", "status", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"generator_speed", "generator_speed", MAVLINK_FIELD_UINT16, 36, 2, 0, 0},
+    {"battery_current", "battery_current", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"load_current", "load_current", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"power_generated", "power_generated", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"bus_voltage", "bus_voltage", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"rectifier_temperature", "rectifier_temperature", MAVLINK_FIELD_INT16, 38, 2, 0, 0},
+    {"bat_current_setpoint", "bat_current_setpoint", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"generator_temperature", "generator_temperature", MAVLINK_FIELD_INT16, 40, 2, 0, 0},
+    {"runtime", "runtime", MAVLINK_FIELD_UINT32, 28, 4, 0, 0},
+    {"time_until_maintenance", "time_until_maintenance", MAVLINK_FIELD_INT32, 32, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ACTUATOR_OUTPUT_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"active", "active", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"actuator", "actuator", MAVLINK_FIELD_FLOAT, 12, 4, 32, 0},
+};
+static const mavlink_field_info_t g_fields_TIME_ESTIMATE_TO_TARGET[] = {
+    {"safe_return", "safe_return", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"land", "land", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"mission_next_item", "mission_next_item", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"mission_end", "mission_end", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"commanded_action", "commanded_action", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_TUNNEL[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"payload_type", "payload_type", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"payload_length", "payload_length", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"payload", "载荷", MAVLINK_FIELD_UINT8, 5, 1, 128, 0},
+};
+static const mavlink_field_info_t g_fields_CAN_FRAME[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"bus", "bus", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 8, 1, 8, 0},
+};
+static const mavlink_field_info_t g_fields_CANFD_FRAME[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"bus", "bus", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"len", "len", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 8, 1, 64, 0},
+};
+static const mavlink_field_info_t g_fields_CAN_FILTER_MODIFY[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 32, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"bus", "bus", MAVLINK_FIELD_UINT8, 34, 1, 0, 0},
+    {"operation", "operation", MAVLINK_FIELD_UINT8, 35, 1, 0, 0},
+    {"num_ids", "num_ids", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"ids", "ids", MAVLINK_FIELD_UINT16, 0, 2, 16, 0},
+};
+static const mavlink_field_info_t g_fields_ONBOARD_COMPUTER_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"uptime", "uptime", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"type", "类型", MAVLINK_FIELD_UINT8, 196, 1, 0, 0},
+    {"cpu_cores", "cpu_cores", MAVLINK_FIELD_UINT8, 197, 1, 8, 0},
+    {"cpu_combined", "cpu_combined", MAVLINK_FIELD_UINT8, 205, 1, 10, 0},
+    {"gpu_cores", "gpu_cores", MAVLINK_FIELD_UINT8, 215, 1, 4, 0},
+    {"gpu_combined", "gpu_combined", MAVLINK_FIELD_UINT8, 219, 1, 10, 0},
+    {"temperature_board", "temperature_board", MAVLINK_FIELD_INT8, 229, 1, 0, 0},
+    {"temperature_core", "temperature_core", MAVLINK_FIELD_INT8, 230, 1, 8, 0},
+    {"fan_speed", "fan_speed", MAVLINK_FIELD_INT16, 188, 2, 4, 0},
+    {"ram_usage", "ram_usage", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+    {"ram_total", "ram_total", MAVLINK_FIELD_UINT32, 16, 4, 0, 0},
+    {"storage_type", "storage_type", MAVLINK_FIELD_UINT32, 20, 4, 4, 0},
+    {"storage_usage", "storage_usage", MAVLINK_FIELD_UINT32, 36, 4, 4, 0},
+    {"storage_total", "storage_total", MAVLINK_FIELD_UINT32, 52, 4, 4, 0},
+    {"link_type", "link_type", MAVLINK_FIELD_UINT32, 68, 4, 6, 0},
+    {"link_tx_rate", "link_tx_rate", MAVLINK_FIELD_UINT32, 92, 4, 6, 0},
+    {"link_rx_rate", "link_rx_rate", MAVLINK_FIELD_UINT32, 116, 4, 6, 0},
+    {"link_tx_max", "link_tx_max", MAVLINK_FIELD_UINT32, 140, 4, 6, 0},
+    {"link_rx_max", "link_rx_max", MAVLINK_FIELD_UINT32, 164, 4, 6, 0},
+};
+static const mavlink_field_info_t g_fields_COMPONENT_INFORMATION[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"general_metadata_file_crc", "general_metadata_file_crc", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"general_metadata_uri", "general_metadata_uri", MAVLINK_FIELD_CHAR, 12, 1, 100, 0},
+    {"peripherals_metadata_file_crc", "peripherals_metadata_file_crc", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"peripherals_metadata_uri", "peripherals_metadata_uri", MAVLINK_FIELD_CHAR, 112, 1, 100, 0},
+};
+static const mavlink_field_info_t g_fields_COMPONENT_INFORMATION_BASIC[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"capabilities", "capabilities", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"time_manufacture_s", "time_manufacture_s", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+    {"vendor_name", "vendor_name", MAVLINK_FIELD_CHAR, 16, 1, 32, 0},
+    {"model_name", "model_name", MAVLINK_FIELD_CHAR, 48, 1, 32, 0},
+    {"software_version", "software_version", MAVLINK_FIELD_CHAR, 80, 1, 24, 0},
+    {"hardware_version", "hardware_version", MAVLINK_FIELD_CHAR, 104, 1, 24, 0},
+    {"serial_number", "serial_number", MAVLINK_FIELD_CHAR, 128, 1, 32, 0},
+};
+static const mavlink_field_info_t g_fields_COMPONENT_METADATA[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"file_crc", "file_crc", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"uri", "uri", MAVLINK_FIELD_CHAR, 8, 1, 100, 0},
+};
+static const mavlink_field_info_t g_fields_PLAY_TUNE_V2[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"format", "format", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"tune", "tune", MAVLINK_FIELD_CHAR, 6, 1, 248, 0},
+};
+static const mavlink_field_info_t g_fields_SUPPORTED_TUNES[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"format", "format", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_EVENT[] = {
+    {"destination_component", "destination_component", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"destination_system", "destination_system", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"event_time_boot_ms", "event_time_boot_ms", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"log_levels", "log_levels", MAVLINK_FIELD_UINT8, 12, 1, 0, 0},
+    {"arguments", "arguments", MAVLINK_FIELD_UINT8, 13, 1, 40, 0},
+};
+static const mavlink_field_info_t g_fields_CURRENT_EVENT_SEQUENCE[] = {
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"flags", "标志", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_REQUEST_EVENT[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"first_sequence", "first_sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"last_sequence", "last_sequence", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_RESPONSE_EVENT_ERROR[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"sequence_oldest_available", "sequence_oldest_available", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"reason", "reason", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AVAILABLE_MODES[] = {
+    {"number_modes", "number_modes", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"mode_index", "mode_index", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"standard_mode", "standard_mode", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"custom_mode", "自定义模式", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"properties", "properties", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"mode_name", "mode_name", MAVLINK_FIELD_CHAR, 11, 1, 35, 0},
+};
+static const mavlink_field_info_t g_fields_CURRENT_MODE[] = {
+    {"standard_mode", "standard_mode", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"custom_mode", "自定义模式", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"intended_custom_mode", "intended_custom_mode", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AVAILABLE_MODES_MONITOR[] = {
+    {"seq", "序号", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_WHEEL_DISTANCE[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 136, 1, 0, 0},
+    {"distance", "distance", MAVLINK_FIELD_DOUBLE, 8, 8, 16, 0},
+};
+static const mavlink_field_info_t g_fields_WINCH_STATUS[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"line_length", "line_length", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"speed", "speed", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"tension", "tension", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"current", "当前项", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 32, 2, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT32, 28, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_CFG[] = {
+    {"ICAO", "ICAO", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"callsign", "callsign", MAVLINK_FIELD_CHAR, 6, 1, 9, 0},
+    {"emitterType", "emitterType", MAVLINK_FIELD_UINT8, 15, 1, 0, 0},
+    {"aircraftSize", "aircraftSize", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"gpsOffsetLat", "gpsOffsetLat", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"gpsOffsetLon", "gpsOffsetLon", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"stallSpeed", "stallSpeed", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"rfSelect", "rfSelect", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_DYNAMIC[] = {
+    {"utcTime", "utcTime", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"gpsLat", "gpsLat", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"gpsLon", "gpsLon", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"gpsAlt", "gpsAlt", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"gpsFix", "gpsFix", MAVLINK_FIELD_UINT8, 38, 1, 0, 0},
+    {"numSats", "numSats", MAVLINK_FIELD_UINT8, 39, 1, 0, 0},
+    {"baroAltMSL", "baroAltMSL", MAVLINK_FIELD_INT32, 16, 4, 0, 0},
+    {"accuracyHor", "accuracyHor", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+    {"accuracyVert", "accuracyVert", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"accuracyVel", "accuracyVel", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"velVert", "velVert", MAVLINK_FIELD_INT16, 28, 2, 0, 0},
+    {"velNS", "velNS", MAVLINK_FIELD_INT16, 30, 2, 0, 0},
+    {"VelEW", "VelEW", MAVLINK_FIELD_INT16, 32, 2, 0, 0},
+    {"emergencyStatus", "emergencyStatus", MAVLINK_FIELD_UINT8, 40, 1, 0, 0},
+    {"state", "state", MAVLINK_FIELD_UINT16, 34, 2, 0, 0},
+    {"squawk", "squawk", MAVLINK_FIELD_UINT16, 36, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT[] = {
+    {"rfHealth", "rfHealth", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_CFG_REGISTRATION[] = {
+    {"registration", "registration", MAVLINK_FIELD_CHAR, 0, 1, 9, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_CFG_FLIGHTID[] = {
+    {"flight_id", "flight_id", MAVLINK_FIELD_CHAR, 0, 1, 9, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_GET[] = {
+    {"ReqMessageId", "ReqMessageId", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_CONTROL[] = {
+    {"state", "state", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"baroAltMSL", "baroAltMSL", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"squawk", "squawk", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"emergencyStatus", "emergencyStatus", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"flight_id", "flight_id", MAVLINK_FIELD_CHAR, 8, 1, 8, 0},
+    {"x_bit", "x_bit", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_UAVIONIX_ADSB_OUT_STATUS[] = {
+    {"state", "state", MAVLINK_FIELD_UINT8, 2, 1, 0, 0},
+    {"squawk", "squawk", MAVLINK_FIELD_UINT16, 0, 2, 0, 0},
+    {"NIC_NACp", "NIC_NACp", MAVLINK_FIELD_UINT8, 3, 1, 0, 0},
+    {"boardTemp", "boardTemp", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"fault", "fault", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"flight_id", "flight_id", MAVLINK_FIELD_CHAR, 6, 1, 8, 0},
+};
+static const mavlink_field_info_t g_fields_LOWEHEISER_GOV_EFI[] = {
+    {"volt_batt", "volt_batt", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"curr_batt", "curr_batt", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"curr_gen", "curr_gen", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"curr_rot", "curr_rot", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"fuel_level", "fuel_level", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"throttle", "油门", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"runtime", "runtime", MAVLINK_FIELD_UINT32, 24, 4, 0, 0},
+    {"until_maintenance", "until_maintenance", MAVLINK_FIELD_INT32, 28, 4, 0, 0},
+    {"rectifier_temp", "rectifier_temp", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"generator_temp", "generator_temp", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"efi_batt", "efi_batt", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"efi_rpm", "efi_rpm", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+    {"efi_pw", "efi_pw", MAVLINK_FIELD_FLOAT, 48, 4, 0, 0},
+    {"efi_fuel_flow", "efi_fuel_flow", MAVLINK_FIELD_FLOAT, 52, 4, 0, 0},
+    {"efi_fuel_consumed", "efi_fuel_consumed", MAVLINK_FIELD_FLOAT, 56, 4, 0, 0},
+    {"efi_baro", "efi_baro", MAVLINK_FIELD_FLOAT, 60, 4, 0, 0},
+    {"efi_mat", "efi_mat", MAVLINK_FIELD_FLOAT, 64, 4, 0, 0},
+    {"efi_clt", "efi_clt", MAVLINK_FIELD_FLOAT, 68, 4, 0, 0},
+    {"efi_tps", "efi_tps", MAVLINK_FIELD_FLOAT, 72, 4, 0, 0},
+    {"efi_exhaust_gas_temperature", "efi_exhaust_gas_temperature", MAVLINK_FIELD_FLOAT, 76, 4, 0, 0},
+    {"efi_index", "efi_index", MAVLINK_FIELD_UINT8, 84, 1, 0, 0},
+    {"generator_status", "generator_status", MAVLINK_FIELD_UINT16, 80, 2, 0, 0},
+    {"efi_status", "efi_status", MAVLINK_FIELD_UINT16, 82, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_DEVICE_OP_READ[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"bustype", "bustype", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"bus", "bus", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"address", "address", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"busname", "busname", MAVLINK_FIELD_CHAR, 9, 1, 40, 0},
+    {"regstart", "regstart", MAVLINK_FIELD_UINT8, 49, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"bank", "bank", MAVLINK_FIELD_UINT8, 51, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DEVICE_OP_READ_REPLY[] = {
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"regstart", "regstart", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 7, 1, 128, 0},
+    {"bank", "bank", MAVLINK_FIELD_UINT8, 135, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DEVICE_OP_WRITE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"bustype", "bustype", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"bus", "bus", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+    {"address", "address", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"busname", "busname", MAVLINK_FIELD_CHAR, 9, 1, 40, 0},
+    {"regstart", "regstart", MAVLINK_FIELD_UINT8, 49, 1, 0, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 51, 1, 128, 0},
+    {"bank", "bank", MAVLINK_FIELD_UINT8, 179, 1, 0, 1},
+};
+static const mavlink_field_info_t g_fields_DEVICE_OP_WRITE_REPLY[] = {
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_SECURE_COMMAND[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"sequence", "sequence", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"operation", "operation", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"data_length", "data_length", MAVLINK_FIELD_UINT8, 10, 1, 0, 0},
+    {"sig_length", "sig_length", MAVLINK_FIELD_UINT8, 11, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 12, 1, 220, 0},
+};
+static const mavlink_field_info_t g_fields_SECURE_COMMAND_REPLY[] = {
+    {"sequence", "sequence", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"operation", "operation", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"data_length", "data_length", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"data", "数据", MAVLINK_FIELD_UINT8, 10, 1, 220, 0},
+};
+static const mavlink_field_info_t g_fields_ADAP_TUNING[] = {
+    {"axis", "axis", MAVLINK_FIELD_UINT8, 48, 1, 0, 0},
+    {"desired", "desired", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"achieved", "achieved", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"error", "error", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"theta", "theta", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"omega", "omega", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"sigma", "sigma", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"theta_dot", "theta_dot", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"omega_dot", "omega_dot", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"sigma_dot", "sigma_dot", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"f", "f", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+    {"f_dot", "f_dot", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+    {"u", "u", MAVLINK_FIELD_FLOAT, 44, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_VISION_POSITION_DELTA[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"time_delta_usec", "time_delta_usec", MAVLINK_FIELD_UINT64, 8, 8, 0, 0},
+    {"angle_delta", "angle_delta", MAVLINK_FIELD_FLOAT, 16, 4, 3, 0},
+    {"position_delta", "position_delta", MAVLINK_FIELD_FLOAT, 28, 4, 3, 0},
+    {"confidence", "confidence", MAVLINK_FIELD_FLOAT, 40, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AOA_SSA[] = {
+    {"time_usec", "时间戳(微秒)", MAVLINK_FIELD_UINT64, 0, 8, 0, 0},
+    {"AOA", "AOA", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"SSA", "SSA", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_1_TO_4[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_5_TO_8[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_9_TO_12[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_OSD_PARAM_CONFIG[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"osd_screen", "osd_screen", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+    {"osd_index", "osd_index", MAVLINK_FIELD_UINT8, 19, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 20, 1, 16, 0},
+    {"config_type", "config_type", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"min_value", "min_value", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"max_value", "max_value", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"increment", "increment", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OSD_PARAM_CONFIG_REPLY[] = {
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OSD_PARAM_SHOW_CONFIG[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"osd_screen", "osd_screen", MAVLINK_FIELD_UINT8, 6, 1, 0, 0},
+    {"osd_index", "osd_index", MAVLINK_FIELD_UINT8, 7, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OSD_PARAM_SHOW_CONFIG_REPLY[] = {
+    {"request_id", "request_id", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"result", "结果", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"param_id", "参数名", MAVLINK_FIELD_CHAR, 17, 1, 16, 0},
+    {"config_type", "config_type", MAVLINK_FIELD_UINT8, 33, 1, 0, 0},
+    {"min_value", "min_value", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"max_value", "max_value", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"increment", "increment", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OBSTACLE_DISTANCE_3D[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"sensor_type", "sensor_type", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"frame", "坐标系", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"obstacle_id", "obstacle_id", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"x", "X", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"y", "Y", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"z", "Z", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"min_distance", "min_distance", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"max_distance", "max_distance", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_WATER_DEPTH[] = {
+    {"time_boot_ms", "启动时间(毫秒)", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"id", "id", MAVLINK_FIELD_UINT8, 36, 1, 0, 0},
+    {"healthy", "healthy", MAVLINK_FIELD_UINT8, 37, 1, 0, 0},
+    {"lat", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"lng", "lng", MAVLINK_FIELD_INT32, 8, 4, 0, 0},
+    {"alt", "高度(毫米)", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"roll", "横滚角", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"pitch", "俯仰角", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"yaw", "偏航角", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"distance", "distance", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_MCU_STATUS[] = {
+    {"id", "id", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"MCU_temperature", "MCU_temperature", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"MCU_voltage", "MCU_voltage", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+    {"MCU_voltage_min", "MCU_voltage_min", MAVLINK_FIELD_UINT16, 4, 2, 0, 0},
+    {"MCU_voltage_max", "MCU_voltage_max", MAVLINK_FIELD_UINT16, 6, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_13_TO_16[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_17_TO_20[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_21_TO_24[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_25_TO_28[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_ESC_TELEMETRY_29_TO_32[] = {
+    {"temperature", "温度", MAVLINK_FIELD_UINT8, 40, 1, 4, 0},
+    {"voltage", "voltage", MAVLINK_FIELD_UINT16, 0, 2, 4, 0},
+    {"current", "当前项", MAVLINK_FIELD_UINT16, 8, 2, 4, 0},
+    {"totalcurrent", "totalcurrent", MAVLINK_FIELD_UINT16, 16, 2, 4, 0},
+    {"rpm", "rpm", MAVLINK_FIELD_UINT16, 24, 2, 4, 0},
+    {"count", "数量", MAVLINK_FIELD_UINT16, 32, 2, 4, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_BASIC_ID[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 2, 1, 20, 0},
+    {"id_type", "id_type", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"ua_type", "ua_type", MAVLINK_FIELD_UINT8, 23, 1, 0, 0},
+    {"uas_id", "uas_id", MAVLINK_FIELD_UINT8, 24, 1, 20, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_LOCATION[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 30, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 31, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 32, 1, 20, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"direction", "direction", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"speed_horizontal", "speed_horizontal", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"speed_vertical", "speed_vertical", MAVLINK_FIELD_INT16, 28, 2, 0, 0},
+    {"latitude", "纬度(1e-7度)", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"longitude", "经度(1e-7度)", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"altitude_barometric", "altitude_barometric", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"altitude_geodetic", "altitude_geodetic", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"height_reference", "height_reference", MAVLINK_FIELD_UINT8, 53, 1, 0, 0},
+    {"height", "height", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"horizontal_accuracy", "horizontal_accuracy", MAVLINK_FIELD_UINT8, 54, 1, 0, 0},
+    {"vertical_accuracy", "vertical_accuracy", MAVLINK_FIELD_UINT8, 55, 1, 0, 0},
+    {"barometer_accuracy", "barometer_accuracy", MAVLINK_FIELD_UINT8, 56, 1, 0, 0},
+    {"speed_accuracy", "speed_accuracy", MAVLINK_FIELD_UINT8, 57, 1, 0, 0},
+    {"timestamp", "timestamp", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"timestamp_accuracy", "timestamp_accuracy", MAVLINK_FIELD_UINT8, 58, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_AUTHENTICATION[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 6, 1, 20, 0},
+    {"authentication_type", "authentication_type", MAVLINK_FIELD_UINT8, 26, 1, 0, 0},
+    {"data_page", "data_page", MAVLINK_FIELD_UINT8, 27, 1, 0, 0},
+    {"last_page_index", "last_page_index", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"length", "length", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"authentication_data", "authentication_data", MAVLINK_FIELD_UINT8, 30, 1, 23, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_SELF_ID[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 2, 1, 20, 0},
+    {"description_type", "description_type", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"description", "description", MAVLINK_FIELD_CHAR, 23, 1, 23, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_SYSTEM[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 28, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 29, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 30, 1, 20, 0},
+    {"operator_location_type", "operator_location_type", MAVLINK_FIELD_UINT8, 50, 1, 0, 0},
+    {"classification_type", "classification_type", MAVLINK_FIELD_UINT8, 51, 1, 0, 0},
+    {"operator_latitude", "operator_latitude", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"operator_longitude", "operator_longitude", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"area_count", "area_count", MAVLINK_FIELD_UINT16, 24, 2, 0, 0},
+    {"area_radius", "area_radius", MAVLINK_FIELD_UINT16, 26, 2, 0, 0},
+    {"area_ceiling", "area_ceiling", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"area_floor", "area_floor", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"category_eu", "category_eu", MAVLINK_FIELD_UINT8, 52, 1, 0, 0},
+    {"class_eu", "class_eu", MAVLINK_FIELD_UINT8, 53, 1, 0, 0},
+    {"operator_altitude_geo", "operator_altitude_geo", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT32, 20, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_OPERATOR_ID[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 2, 1, 20, 0},
+    {"operator_id_type", "operator_id_type", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"operator_id", "operator_id", MAVLINK_FIELD_CHAR, 23, 1, 20, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_MESSAGE_PACK[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 1, 1, 0, 0},
+    {"id_or_mac", "id_or_mac", MAVLINK_FIELD_UINT8, 2, 1, 20, 0},
+    {"single_message_size", "single_message_size", MAVLINK_FIELD_UINT8, 22, 1, 0, 0},
+    {"msg_pack_size", "msg_pack_size", MAVLINK_FIELD_UINT8, 23, 1, 0, 0},
+    {"messages", "messages", MAVLINK_FIELD_UINT8, 24, 1, 225, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_ARM_STATUS[] = {
+    {"status", "status", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+    {"error", "error", MAVLINK_FIELD_CHAR, 1, 1, 50, 0},
+};
+static const mavlink_field_info_t g_fields_OPEN_DRONE_ID_SYSTEM_UPDATE[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 17, 1, 0, 0},
+    {"operator_latitude", "operator_latitude", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"operator_longitude", "operator_longitude", MAVLINK_FIELD_INT32, 4, 4, 0, 0},
+    {"operator_altitude_geo", "operator_altitude_geo", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"timestamp", "timestamp", MAVLINK_FIELD_UINT32, 12, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_HYGROMETER_SENSOR[] = {
+    {"id", "id", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"temperature", "温度", MAVLINK_FIELD_INT16, 0, 2, 0, 0},
+    {"humidity", "humidity", MAVLINK_FIELD_UINT16, 2, 2, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ICAROUS_HEARTBEAT[] = {
+    {"status", "status", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_ICAROUS_KINEMATIC_BANDS[] = {
+    {"numBands", "numBands", MAVLINK_FIELD_INT8, 40, 1, 0, 0},
+    {"type1", "type1", MAVLINK_FIELD_UINT8, 41, 1, 0, 0},
+    {"min1", "min1", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"max1", "max1", MAVLINK_FIELD_FLOAT, 4, 4, 0, 0},
+    {"type2", "type2", MAVLINK_FIELD_UINT8, 42, 1, 0, 0},
+    {"min2", "min2", MAVLINK_FIELD_FLOAT, 8, 4, 0, 0},
+    {"max2", "max2", MAVLINK_FIELD_FLOAT, 12, 4, 0, 0},
+    {"type3", "type3", MAVLINK_FIELD_UINT8, 43, 1, 0, 0},
+    {"min3", "min3", MAVLINK_FIELD_FLOAT, 16, 4, 0, 0},
+    {"max3", "max3", MAVLINK_FIELD_FLOAT, 20, 4, 0, 0},
+    {"type4", "type4", MAVLINK_FIELD_UINT8, 44, 1, 0, 0},
+    {"min4", "min4", MAVLINK_FIELD_FLOAT, 24, 4, 0, 0},
+    {"max4", "max4", MAVLINK_FIELD_FLOAT, 28, 4, 0, 0},
+    {"type5", "type5", MAVLINK_FIELD_UINT8, 45, 1, 0, 0},
+    {"min5", "min5", MAVLINK_FIELD_FLOAT, 32, 4, 0, 0},
+    {"max5", "max5", MAVLINK_FIELD_FLOAT, 36, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CUBEPILOT_RAW_RC[] = {
+    {"rc_raw", "rc_raw", MAVLINK_FIELD_UINT8, 0, 1, 32, 0},
+};
+static const mavlink_field_info_t g_fields_HERELINK_VIDEO_STREAM_INFORMATION[] = {
+    {"camera_id", "camera_id", MAVLINK_FIELD_UINT8, 14, 1, 0, 0},
+    {"status", "status", MAVLINK_FIELD_UINT8, 15, 1, 0, 0},
+    {"framerate", "framerate", MAVLINK_FIELD_FLOAT, 0, 4, 0, 0},
+    {"resolution_h", "resolution_h", MAVLINK_FIELD_UINT16, 8, 2, 0, 0},
+    {"resolution_v", "resolution_v", MAVLINK_FIELD_UINT16, 10, 2, 0, 0},
+    {"bitrate", "bitrate", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"rotation", "rotation", MAVLINK_FIELD_UINT16, 12, 2, 0, 0},
+    {"uri", "uri", MAVLINK_FIELD_CHAR, 16, 1, 230, 0},
+};
+static const mavlink_field_info_t g_fields_HERELINK_TELEM[] = {
+    {"rssi", "信号强度", MAVLINK_FIELD_UINT8, 16, 1, 0, 0},
+    {"snr", "snr", MAVLINK_FIELD_INT32, 0, 4, 0, 0},
+    {"rf_freq", "rf_freq", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+    {"link_bw", "link_bw", MAVLINK_FIELD_UINT32, 8, 4, 0, 0},
+    {"angle", "angle", MAVLINK_FIELD_INT32, 12, 4, 0, 0},
+    {"cpu_temp", "cpu_temp", MAVLINK_FIELD_INT8, 17, 1, 0, 0},
+    {"board_temp", "board_temp", MAVLINK_FIELD_UINT8, 18, 1, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CUBEPILOT_FIRMWARE_UPDATE_START[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 8, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 9, 1, 0, 0},
+    {"size", "size", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+    {"crc", "crc", MAVLINK_FIELD_UINT32, 4, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_CUBEPILOT_FIRMWARE_UPDATE_RESP[] = {
+    {"target_system", "目标系统", MAVLINK_FIELD_UINT8, 4, 1, 0, 0},
+    {"target_component", "目标组件", MAVLINK_FIELD_UINT8, 5, 1, 0, 0},
+    {"offset", "offset", MAVLINK_FIELD_UINT32, 0, 4, 0, 0},
+};
+static const mavlink_field_info_t g_fields_AIRLINK_AUTH[] = {
+    {"login", "login", MAVLINK_FIELD_CHAR, 0, 1, 50, 0},
+    {"password", "password", MAVLINK_FIELD_CHAR, 50, 1, 50, 0},
+};
+static const mavlink_field_info_t g_fields_AIRLINK_AUTH_RESPONSE[] = {
+    {"resp_type", "resp_type", MAVLINK_FIELD_UINT8, 0, 1, 0, 0},
+};
+
+/* 元数据表，0号为未知消息占位项 */
+const mavlink_msg_info_t g_mavlink_msg_info[MAVLINK_MSGDEF_COUNT] __attribute__((aligned(64))) = {
+    {0, 0, MAVLINK_MAX_PAYLOAD_LEN, 0, MAVLINK_CAT_UNKNOWN, MAVLINK_LOG_OTHER, 0, 0, "UNKNOWN", "未识别消息"},
+    {0, 9, 9, 50, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_SKIP, 1, 6, "HEARTBEAT", "心跳消息"},
+    {1, 31, 43, 124, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "SYS_STATUS", "系统状态"},
+    {2, 12, 12, 137, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_SKIP, 1, 2, "SYSTEM_TIME", "系统时间"},
+    {4, 14, 14, 237, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 4, "PING", "连通性测试"},
+    {5, 28, 28, 217, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 4, "CHANGE_OPERATOR_CONTROL", "请求控制权"},
+    {6, 3, 3, 104, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 3, "CHANGE_OPERATOR_CONTROL_ACK", "控制权应答"},
+    {7, 32, 32, 119, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 1, "AUTH_KEY", "认证密钥"},
+    {8, 36, 36, 117, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 11, "LINK_NODE_STATUS", "链路节点状态"},
+    {11, 6, 6, 89, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 3, "SET_MODE", "设置模式"},
+    {20, 20, 20, 214, MAVLINK_CAT_PARAM, MAVLINK_LOG_REQUEST, 1, 4, "PARAM_REQUEST_READ", "读取参数"},
+    {21, 2, 2, 159, MAVLINK_CAT_PARAM, MAVLINK_LOG_REQUEST, 1, 2, "PARAM_REQUEST_LIST", "请求参数列表"},
+    {22, 25, 25, 220, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 5, "PARAM_VALUE", "参数值"},
+    {23, 23, 23, 168, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 5, "PARAM_SET", "参数设置"},
+    {24, 30, 52, 24, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "GPS_RAW_INT", "GPS原始数据"},
+    {25, 101, 101, 23, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "GPS_STATUS", "GPS卫星状态"},
+    {26, 22, 24, 170, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "SCALED_IMU", "缩放IMU数据"},
+    {27, 26, 29, 144, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "RAW_IMU", "原始IMU数据"},
+    {28, 16, 16, 67, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "RAW_PRESSURE", "原始压力数据"},
+    {29, 14, 16, 115, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "SCALED_PRESSURE", "缩放压力数据"},
+    {30, 28, 28, 39, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "ATTITUDE", "姿态信息"},
+    {31, 32, 48, 246, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "ATTITUDE_QUATERNION", "姿态四元数"},
+    {32, 28, 28, 185, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "LOCAL_POSITION_NED", "本地位置"},
+    {33, 28, 28, 104, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "GLOBAL_POSITION_INT", "全局位置"},
+    {34, 22, 22, 237, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "RC_CHANNELS_SCALED", "遥控通道(缩放)"},
+    {35, 22, 22, 244, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "RC_CHANNELS_RAW", "遥控通道(原始)"},
+    {36, 21, 37, 222, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 18, "SERVO_OUTPUT_RAW", "舵机输出"},
+    {37, 6, 7, 212, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 5, "MISSION_REQUEST_PARTIAL_LIST", "请求部分任务列表"},
+    {38, 6, 7, 9, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 5, "MISSION_WRITE_PARTIAL_LIST", "写入部分任务列表"},
+    {39, 37, 38, 254, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 15, "MISSION_ITEM", "任务项"},
+    {40, 4, 5, 230, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 4, "MISSION_REQUEST", "任务请求"},
+    {41, 4, 4, 28, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 3, "MISSION_SET_CURRENT", "设置当前任务"},
+    {42, 2, 18, 28, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 7, "MISSION_CURRENT", "当前任务"},
+    {43, 2, 3, 132, MAVLINK_CAT_MISSION, MAVLINK_LOG_SKIP, 1, 3, "MISSION_REQUEST_LIST", "请求任务列表"},
+    {44, 4, 9, 221, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 5, "MISSION_COUNT", "任务计数"},
+    {45, 2, 3, 232, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 3, "MISSION_CLEAR_ALL", "清除全部任务"},
+    {46, 2, 2, 11, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 1, "MISSION_ITEM_REACHED", "到达任务项"},
+    {47, 3, 8, 153, MAVLINK_CAT_MISSION, MAVLINK_LOG_SKIP, 1, 5, "MISSION_ACK", "任务应答"},
+    {48, 13, 21, 41, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 5, "SET_GPS_GLOBAL_ORIGIN", "设置GPS原点"},
+    {49, 12, 20, 39, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 4, "GPS_GLOBAL_ORIGIN", "GPS原点"},
+    {50, 37, 37, 78, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 9, "PARAM_MAP_RC", "参数映射遥控通道"},
+    {51, 4, 5, 196, MAVLINK_CAT_MISSION, MAVLINK_LOG_SKIP, 1, 4, "MISSION_REQUEST_INT", "任务请求(整型)"},
+    {54, 27, 27, 15, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 9, "SAFETY_SET_ALLOWED_AREA", "设置安全区域"},
+    {55, 25, 25, 3, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 7, "SAFETY_ALLOWED_AREA", "安全区域"},
+    {61, 72, 72, 167, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "ATTITUDE_QUATERNION_COV", "姿态四元数(协方差)"},
+    {62, 26, 26, 183, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 8, "NAV_CONTROLLER_OUTPUT", "导航控制器输出"},
+    {63, 181, 181, 119, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 10, "GLOBAL_POSITION_INT_COV", "全局位置(协方差)"},
+    {64, 225, 225, 191, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "LOCAL_POSITION_NED_COV", "本地位置(协方差)"},
+    {65, 42, 42, 118, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 21, "RC_CHANNELS", "遥控器通道"},
+    {66, 6, 6, 148, MAVLINK_CAT_REQUEST, MAVLINK_LOG_SKIP, 1, 5, "REQUEST_DATA_STREAM", "数据流请求"},
+    {67, 4, 4, 21, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "DATA_STREAM", "数据流"},
+    {69, 11, 30, 243, MAVLINK_CAT_MANUAL, MAVLINK_LOG_OTHER, 1, 16, "MANUAL_CONTROL", "手动控制"},
+    {70, 18, 38, 124, MAVLINK_CAT_MANUAL, MAVLINK_LOG_OTHER, 1, 20, "RC_CHANNELS_OVERRIDE", "遥控通道覆盖"},
+    {73, 37, 38, 38, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 15, "MISSION_ITEM_INT", "任务项(整型)"},
+    {74, 20, 20, 20, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "VFR_HUD", "VFR_HUD数据"},
+    {75, 35, 35, 158, MAVLINK_CAT_COMMAND, MAVLINK_LOG_COMMAND, 1, 13, "COMMAND_INT", "整型命令"},
+    {76, 33, 33, 152, MAVLINK_CAT_COMMAND, MAVLINK_LOG_COMMAND, 1, 11, "COMMAND_LONG", "长命令"},
+    {77, 3, 10, 143, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 6, "COMMAND_ACK", "命令应答"},
+    {80, 4, 4, 14, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 3, "COMMAND_CANCEL", "取消命令"},
+    {81, 22, 22, 106, MAVLINK_CAT_MANUAL, MAVLINK_LOG_OTHER, 1, 7, "MANUAL_SETPOINT", "手动设定值"},
+    {82, 39, 51, 49, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 10, "SET_ATTITUDE_TARGET", "设置姿态目标"},
+    {83, 37, 37, 22, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "ATTITUDE_TARGET", "姿态目标"},
+    {84, 53, 53, 143, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 16, "SET_POSITION_TARGET_LOCAL_NED", "设置本地位置目标"},
+    {85, 51, 51, 140, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 14, "POSITION_TARGET_LOCAL_NED", "本地位置目标"},
+    {86, 53, 53, 5, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 16, "SET_POSITION_TARGET_GLOBAL_INT", "设置全局位置目标"},
+    {87, 51, 51, 150, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 14, "POSITION_TARGET_GLOBAL_INT", "全局位置目标"},
+    {89, 28, 28, 231, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET", "LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET"},
+    {90, 56, 56, 183, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "HIL_STATE", "HIL状态"},
+    {91, 42, 42, 63, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "HIL_CONTROLS", "HIL控制输出"},
+    {92, 33, 33, 54, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 14, "HIL_RC_INPUTS_RAW", "HIL遥控输入"},
+    {93, 81, 81, 47, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 4, "HIL_ACTUATOR_CONTROLS", "HIL执行器输出"},
+    {100, 26, 34, 175, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 10, "OPTICAL_FLOW", "光流"},
+    {101, 32, 117, 102, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 9, "GLOBAL_VISION_POSITION_ESTIMATE", "视觉全局位置估计"},
+    {102, 32, 117, 158, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 9, "VISION_POSITION_ESTIMATE", "视觉位置估计"},
+    {103, 20, 57, 208, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 6, "VISION_SPEED_ESTIMATE", "视觉速度估计"},
+    {104, 32, 116, 56, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 8, "VICON_POSITION_ESTIMATE", "动捕位置估计"},
+    {105, 62, 63, 93, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "HIGHRES_IMU", "高精度IMU数据"},
+    {106, 44, 44, 138, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "OPTICAL_FLOW_RAD", "光流(角速度)"},
+    {107, 64, 65, 108, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "HIL_SENSOR", "HIL传感器输入"},
+    {108, 84, 92, 32, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 23, "SIM_STATE", "仿真器状态"},
+    {109, 9, 9, 185, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "RADIO_STATUS", "数传电台状态"},
+    {110, 254, 254, 84, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_SKIP, 1, 4, "FILE_TRANSFER_PROTOCOL", "文件传输协议"},
+    {111, 16, 18, 34, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_SKIP, 1, 4, "TIMESYNC", "时间同步"},
+    {112, 12, 12, 174, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "CAMERA_TRIGGER", "相机触发"},
+    {113, 36, 39, 124, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 15, "HIL_GPS", "HIL_GPS输入"},
+    {114, 44, 44, 237, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "HIL_OPTICAL_FLOW", "HIL光流输入"},
+    {115, 64, 64, 4, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "HIL_STATE_QUATERNION", "HIL状态(四元数)"},
+    {116, 22, 24, 76, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "SCALED_IMU2", "缩放IMU数据2"},
+    {117, 6, 6, 128, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_REQUEST, 1, 4, "LOG_REQUEST_LIST", "请求日志列表"},
+    {118, 14, 14, 56, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "LOG_ENTRY", "日志条目"},
+    {119, 12, 12, 116, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_REQUEST, 1, 5, "LOG_REQUEST_DATA", "请求日志数据"},
+    {120, 97, 97, 134, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "LOG_DATA", "日志数据"},
+    {121, 2, 2, 237, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 2, "LOG_ERASE", "擦除日志"},
+    {122, 2, 2, 203, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "LOG_REQUEST_END", "结束日志传输"},
+    {123, 113, 113, 250, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 4, "GPS_INJECT_DATA", "注入GPS数据"},
+    {124, 35, 57, 87, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 18, "GPS2_RAW", "GPS2原始数据"},
+    {125, 6, 6, 203, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "POWER_STATUS", "动力状态"},
+    {126, 79, 81, 220, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 8, "SERIAL_CONTROL", "串口控制"},
+    {127, 35, 35, 25, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 13, "GPS_RTK", "RTK基线"},
+    {128, 35, 35, 226, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 13, "GPS2_RTK", "RTK基线2"},
+    {129, 22, 24, 46, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "SCALED_IMU3", "缩放IMU数据3"},
+    {130, 13, 13, 29, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 7, "DATA_TRANSMISSION_HANDSHAKE", "数据传输握手"},
+    {131, 255, 255, 223, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "ENCAPSULATED_DATA", "封装数据"},
+    {132, 14, 39, 85, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "DISTANCE_SENSOR", "距离传感器"},
+    {133, 18, 18, 6, MAVLINK_CAT_TERRAIN, MAVLINK_LOG_OTHER, 1, 4, "TERRAIN_REQUEST", "地形请求"},
+    {134, 43, 43, 229, MAVLINK_CAT_TERRAIN, MAVLINK_LOG_SKIP, 1, 5, "TERRAIN_DATA", "地形数据"},
+    {135, 8, 8, 203, MAVLINK_CAT_TERRAIN, MAVLINK_LOG_OTHER, 1, 2, "TERRAIN_CHECK", "地形检查"},
+    {136, 22, 22, 1, MAVLINK_CAT_TERRAIN, MAVLINK_LOG_OTHER, 1, 7, "TERRAIN_REPORT", "地形报告"},
+    {137, 14, 16, 195, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "SCALED_PRESSURE2", "缩放压力数据2"},
+    {138, 36, 120, 109, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 6, "ATT_POS_MOCAP", "动捕姿态位置"},
+    {139, 43, 43, 168, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 5, "SET_ACTUATOR_CONTROL_TARGET", "设置执行器控制"},
+    {140, 41, 41, 181, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "ACTUATOR_CONTROL_TARGET", "执行器控制目标"},
+    {141, 32, 32, 47, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "ALTITUDE", "高度信息"},
+    {142, 243, 243, 72, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "RESOURCE_REQUEST", "资源请求"},
+    {143, 14, 16, 131, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "SCALED_PRESSURE3", "缩放压力数据3"},
+    {144, 93, 93, 127, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 11, "FOLLOW_TARGET", "跟随目标"},
+    {146, 100, 100, 103, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 17, "CONTROL_SYSTEM_STATE", "控制系统状态"},
+    {147, 36, 54, 154, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 14, "BATTERY_STATUS", "电池状态"},
+    {148, 60, 78, 178, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 12, "AUTOPILOT_VERSION", "自动驾驶仪版本"},
+    {149, 30, 60, 200, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 14, "LANDING_TARGET", "着陆目标"},
+    {150, 42, 42, 134, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "SENSOR_OFFSETS", "传感器偏移"},
+    {151, 8, 8, 219, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 5, "SET_MAG_OFFSETS", "设置罗盘偏移"},
+    {152, 4, 8, 208, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 3, "MEMINFO", "内存信息"},
+    {153, 12, 12, 188, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "AP_ADC", "ADC原始值"},
+    {154, 15, 15, 84, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 11, "DIGICAM_CONFIGURE", "相机配置"},
+    {155, 13, 13, 22, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 10, "DIGICAM_CONTROL", "相机控制"},
+    {156, 6, 6, 19, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 6, "MOUNT_CONFIGURE", "云台配置"},
+    {157, 15, 15, 21, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 6, "MOUNT_CONTROL", "云台控制"},
+    {158, 14, 15, 134, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "MOUNT_STATUS", "云台状态"},
+    {160, 12, 12, 78, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 6, "FENCE_POINT", "围栏点"},
+    {161, 3, 3, 68, MAVLINK_CAT_MISSION, MAVLINK_LOG_REQUEST, 1, 3, "FENCE_FETCH_POINT", "读取围栏点"},
+    {162, 8, 9, 189, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "FENCE_STATUS", "围栏状态"},
+    {163, 28, 28, 127, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "AHRS", "AHRS状态"},
+    {164, 44, 44, 154, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "SIMSTATE", "仿真器状态(SITL)"},
+    {165, 3, 3, 21, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "HWSTATUS", "硬件状态"},
+    {166, 9, 9, 21, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "RADIO", "数传电台"},
+    {167, 22, 22, 144, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "LIMITS_STATUS", "限制状态"},
+    {168, 12, 12, 1, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "WIND", "风速估计"},
+    {169, 18, 18, 234, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "DATA16", "DATA16"},
+    {170, 34, 34, 73, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "DATA32", "DATA32"},
+    {171, 66, 66, 181, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "DATA64", "DATA64"},
+    {172, 98, 98, 22, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "DATA96", "DATA96"},
+    {173, 8, 8, 83, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "RANGEFINDER", "测距仪"},
+    {174, 48, 48, 167, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "AIRSPEED_AUTOCAL", "空速自动校准"},
+    {175, 19, 19, 138, MAVLINK_CAT_MISSION, MAVLINK_LOG_OTHER, 1, 10, "RALLY_POINT", "集结点"},
+    {176, 3, 3, 234, MAVLINK_CAT_MISSION, MAVLINK_LOG_REQUEST, 1, 3, "RALLY_FETCH_POINT", "读取集结点"},
+    {177, 20, 20, 240, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "COMPASSMOT_STATUS", "罗盘电机干扰校准"},
+    {178, 24, 24, 47, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "AHRS2", "AHRS2状态"},
+    {179, 29, 29, 189, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "CAMERA_STATUS", "相机状态"},
+    {180, 45, 47, 52, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 14, "CAMERA_FEEDBACK", "相机反馈"},
+    {181, 4, 4, 174, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "BATTERY2", "电池2"},
+    {182, 40, 40, 229, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 10, "AHRS3", "AHRS3状态"},
+    {183, 2, 2, 85, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "AUTOPILOT_VERSION_REQUEST", "请求自动驾驶仪版本"},
+    {184, 206, 206, 159, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "REMOTE_LOG_DATA_BLOCK", "远程日志数据块"},
+    {185, 7, 7, 186, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "REMOTE_LOG_BLOCK_STATUS", "远程日志块状态"},
+    {186, 29, 29, 72, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 6, "LED_CONTROL", "LED控制"},
+    {191, 27, 27, 92, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 9, "MAG_CAL_PROGRESS", "罗盘校准进度"},
+    {192, 44, 54, 36, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 18, "MAG_CAL_REPORT", "罗盘校准报告"},
+    {193, 22, 26, 71, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "EKF_STATUS_REPORT", "EKF状态报告"},
+    {194, 25, 33, 98, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "PID_TUNING", "PID调参"},
+    {195, 37, 37, 120, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 10, "DEEPSTALL", "深失速降落"},
+    {200, 42, 42, 134, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "GIMBAL_REPORT", "云台报告"},
+    {201, 14, 14, 205, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 5, "GIMBAL_CONTROL", "云台速率控制"},
+    {214, 8, 8, 69, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 5, "GIMBAL_TORQUE_CMD_REPORT", "GIMBAL_TORQUE_CMD_REPORT"},
+    {215, 3, 3, 101, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "GOPRO_HEARTBEAT", "GOPRO_HEARTBEAT"},
+    {216, 3, 3, 50, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "GOPRO_GET_REQUEST", "GOPRO_GET_REQUEST"},
+    {217, 6, 6, 202, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "GOPRO_GET_RESPONSE", "GOPRO_GET_RESPONSE"},
+    {218, 7, 7, 17, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 4, "GOPRO_SET_REQUEST", "GOPRO_SET_REQUEST"},
+    {219, 2, 2, 162, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 2, "GOPRO_SET_RESPONSE", "GOPRO_SET_RESPONSE"},
+    {225, 65, 73, 208, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 19, "EFI_STATUS", "电喷状态"},
+    {226, 8, 8, 207, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "RPM", "转速"},
+    {230, 42, 42, 163, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 10, "ESTIMATOR_STATUS", "估计器状态"},
+    {231, 40, 40, 105, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "WIND_COV", "风速估计(协方差)"},
+    {232, 63, 65, 151, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 19, "GPS_INPUT", "外部GPS输入"},
+    {233, 182, 182, 35, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 3, "GPS_RTCM_DATA", "RTCM差分数据"},
+    {234, 40, 40, 150, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 24, "HIGH_LATENCY", "高延迟遥测"},
+    {235, 42, 42, 179, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 27, "HIGH_LATENCY2", "高延迟遥测2"},
+    {241, 32, 32, 90, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "VIBRATION", "振动信息"},
+    {242, 52, 60, 104, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 11, "HOME_POSITION", "返航位置"},
+    {243, 53, 61, 85, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 12, "SET_HOME_POSITION", "设置返航位置"},
+    {244, 6, 6, 95, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "MESSAGE_INTERVAL", "消息间隔"},
+    {245, 2, 2, 130, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "EXTENDED_SYS_STATE", "扩展系统状态"},
+    {246, 38, 38, 184, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 13, "ADSB_VEHICLE", "ADS-B目标"},
+    {247, 19, 19, 81, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 7, "COLLISION", "碰撞威胁"},
+    {248, 254, 254, 8, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "V2_EXTENSION", "V2扩展载荷"},
+    {249, 36, 36, 204, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "MEMORY_VECT", "内存数据"},
+    {250, 30, 30, 49, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "DEBUG_VECT", "调试向量"},
+    {251, 18, 18, 170, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "NAMED_VALUE_FLOAT", "命名浮点值"},
+    {252, 18, 18, 44, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "NAMED_VALUE_INT", "命名整数值"},
+    {253, 51, 54, 83, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "STATUSTEXT", "状态文本"},
+    {254, 9, 9, 46, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "DEBUG", "调试值"},
+    {256, 42, 42, 71, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 4, "SETUP_SIGNING", "设置签名密钥"},
+    {257, 9, 9, 131, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 3, "BUTTON_CHANGE", "按键变化"},
+    {258, 32, 232, 187, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 4, "PLAY_TUNE", "播放提示音"},
+    {259, 235, 237, 92, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 15, "CAMERA_INFORMATION", "相机信息"},
+    {260, 5, 14, 146, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "CAMERA_SETTINGS", "相机设置"},
+    {261, 27, 61, 179, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 12, "STORAGE_INFORMATION", "存储信息"},
+    {262, 18, 23, 12, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 8, "CAMERA_CAPTURE_STATUS", "相机拍摄状态"},
+    {263, 255, 255, 133, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "CAMERA_IMAGE_CAPTURED", "相机拍照"},
+    {264, 28, 32, 49, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "FLIGHT_INFORMATION", "飞行信息"},
+    {265, 16, 20, 26, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "MOUNT_ORIENTATION", "云台朝向"},
+    {266, 255, 255, 193, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "LOGGING_DATA", "日志流数据"},
+    {267, 255, 255, 35, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "LOGGING_DATA_ACKED", "日志流数据(需应答)"},
+    {268, 4, 4, 14, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 3, "LOGGING_ACK", "日志流应答"},
+    {269, 213, 215, 109, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 14, "VIDEO_STREAM_INFORMATION", "视频流信息"},
+    {270, 19, 20, 59, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 9, "VIDEO_STREAM_STATUS", "视频流状态"},
+    {271, 52, 53, 22, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 11, "CAMERA_FOV_STATUS", "CAMERA_FOV_STATUS"},
+    {275, 31, 32, 126, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 11, "CAMERA_TRACKING_IMAGE_STATUS", "CAMERA_TRACKING_IMAGE_STATUS"},
+    {276, 49, 50, 18, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 14, "CAMERA_TRACKING_GEO_STATUS", "CAMERA_TRACKING_GEO_STATUS"},
+    {280, 33, 33, 70, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 9, "GIMBAL_MANAGER_INFORMATION", "GIMBAL_MANAGER_INFORMATION"},
+    {281, 13, 13, 48, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "GIMBAL_MANAGER_STATUS", "GIMBAL_MANAGER_STATUS"},
+    {282, 35, 35, 123, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 8, "GIMBAL_MANAGER_SET_ATTITUDE", "设置云台姿态"},
+    {283, 144, 145, 74, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 16, "GIMBAL_DEVICE_INFORMATION", "GIMBAL_DEVICE_INFORMATION"},
+    {284, 32, 32, 99, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 7, "GIMBAL_DEVICE_SET_ATTITUDE", "设置云台设备姿态"},
+    {285, 40, 49, 137, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 12, "GIMBAL_DEVICE_ATTITUDE_STATUS", "云台姿态"},
+    {286, 53, 57, 210, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 13, "AUTOPILOT_STATE_FOR_GIMBAL_DEVICE", "AUTOPILOT_STATE_FOR_GIMBAL_DEVICE"},
+    {287, 23, 23, 1, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 8, "GIMBAL_MANAGER_SET_PITCHYAW", "设置云台俯仰偏航"},
+    {288, 23, 23, 20, MAVLINK_CAT_MANUAL, MAVLINK_LOG_OTHER, 1, 8, "GIMBAL_MANAGER_SET_MANUAL_CONTROL", "云台手动控制"},
+    {290, 46, 46, 251, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "ESC_INFO", "电调信息"},
+    {291, 57, 57, 10, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 5, "ESC_STATUS", "电调状态"},
+    {299, 96, 98, 19, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 4, "WIFI_CONFIG_AP", "WiFi配置"},
+    {300, 22, 22, 217, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "PROTOCOL_VERSION", "协议版本"},
+    {301, 58, 58, 243, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 17, "AIS_VESSEL", "AIS_VESSEL"},
+    {310, 17, 17, 28, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "UAVCAN_NODE_STATUS", "UAVCAN节点状态"},
+    {311, 116, 116, 95, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 9, "UAVCAN_NODE_INFO", "UAVCAN节点信息"},
+    {320, 20, 20, 243, MAVLINK_CAT_PARAM, MAVLINK_LOG_REQUEST, 1, 4, "PARAM_EXT_REQUEST_READ", "读取扩展参数"},
+    {321, 2, 2, 88, MAVLINK_CAT_PARAM, MAVLINK_LOG_REQUEST, 1, 2, "PARAM_EXT_REQUEST_LIST", "请求扩展参数列表"},
+    {322, 149, 149, 243, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 5, "PARAM_EXT_VALUE", "扩展参数值"},
+    {323, 147, 147, 78, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 5, "PARAM_EXT_SET", "扩展参数设置"},
+    {324, 146, 146, 132, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 4, "PARAM_EXT_ACK", "扩展参数应答"},
+    {330, 158, 167, 23, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "OBSTACLE_DISTANCE", "障碍物距离"},
+    {331, 230, 233, 91, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 18, "ODOMETRY", "里程计"},
+    {332, 239, 239, 236, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 14, "TRAJECTORY_REPRESENTATION_WAYPOINTS", "TRAJECTORY_REPRESENTATION_WAYPOINTS"},
+    {333, 109, 109, 231, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "TRAJECTORY_REPRESENTATION_BEZIER", "TRAJECTORY_REPRESENTATION_BEZIER"},
+    {334, 10, 10, 72, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "CELLULAR_STATUS", "CELLULAR_STATUS"},
+    {335, 24, 24, 225, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 8, "ISBD_LINK_STATUS", "ISBD_LINK_STATUS"},
+    {336, 84, 84, 245, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 8, "CELLULAR_CONFIG", "CELLULAR_CONFIG"},
+    {339, 5, 5, 199, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 2, "RAW_RPM", "转速"},
+    {340, 70, 70, 99, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 18, "UTM_GLOBAL_POSITION", "UTM_GLOBAL_POSITION"},
+    {350, 20, 252, 232, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 4, "DEBUG_FLOAT_ARRAY", "DEBUG_FLOAT_ARRAY"},
+    {360, 25, 25, 11, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ORBIT_EXECUTION_STATUS", "ORBIT_EXECUTION_STATUS"},
+    {370, 87, 109, 75, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 17, "SMART_BATTERY_INFO", "SMART_BATTERY_INFO"},
+    {373, 42, 42, 117, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 11, "GENERATOR_STATUS", "GENERATOR_STATUS"},
+    {375, 140, 140, 251, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "ACTUATOR_OUTPUT_STATUS", "ACTUATOR_OUTPUT_STATUS"},
+    {380, 20, 20, 232, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 5, "TIME_ESTIMATE_TO_TARGET", "TIME_ESTIMATE_TO_TARGET"},
+    {385, 133, 133, 147, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "TUNNEL", "隧道数据"},
+    {386, 16, 16, 132, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "CAN_FRAME", "CAN帧"},
+    {387, 72, 72, 4, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "CANFD_FRAME", "CANFD帧"},
+    {388, 37, 37, 8, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "CAN_FILTER_MODIFY", "修改CAN过滤器"},
+    {390, 238, 238, 156, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 20, "ONBOARD_COMPUTER_STATUS", "机载计算机状态"},
+    {395, 212, 212, 0, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "COMPONENT_INFORMATION", "组件信息"},
+    {396, 160, 160, 50, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 8, "COMPONENT_INFORMATION_BASIC", "组件基本信息"},
+    {397, 108, 108, 182, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 3, "COMPONENT_METADATA", "组件元数据"},
+    {400, 254, 254, 110, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 4, "PLAY_TUNE_V2", "播放提示音V2"},
+    {401, 6, 6, 183, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 3, "SUPPORTED_TUNES", "支持的提示音格式"},
+    {410, 53, 53, 160, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 7, "EVENT", "事件"},
+    {411, 3, 3, 106, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "CURRENT_EVENT_SEQUENCE", "当前事件序号"},
+    {412, 6, 6, 33, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_REQUEST, 1, 4, "REQUEST_EVENT", "请求事件"},
+    {413, 7, 7, 77, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "RESPONSE_EVENT_ERROR", "事件请求错误"},
+    {435, 46, 46, 134, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "AVAILABLE_MODES", "可用模式"},
+    {436, 9, 9, 193, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "CURRENT_MODE", "当前模式"},
+    {437, 1, 1, 30, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 1, "AVAILABLE_MODES_MONITOR", "可用模式变化"},
+    {9000, 137, 137, 113, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "WHEEL_DISTANCE", "WHEEL_DISTANCE"},
+    {9005, 34, 34, 117, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 8, "WINCH_STATUS", "WINCH_STATUS"},
+    {10001, 20, 20, 209, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 8, "UAVIONIX_ADSB_OUT_CFG", "ADS-B发射配置"},
+    {10002, 41, 41, 186, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 16, "UAVIONIX_ADSB_OUT_DYNAMIC", "ADS-B发射动态数据"},
+    {10003, 1, 1, 4, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT", "UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT"},
+    {10004, 9, 9, 133, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "UAVIONIX_ADSB_OUT_CFG_REGISTRATION", "UAVIONIX_ADSB_OUT_CFG_REGISTRATION"},
+    {10005, 9, 9, 103, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "UAVIONIX_ADSB_OUT_CFG_FLIGHTID", "UAVIONIX_ADSB_OUT_CFG_FLIGHTID"},
+    {10006, 4, 4, 193, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "UAVIONIX_ADSB_GET", "UAVIONIX_ADSB_GET"},
+    {10007, 17, 17, 71, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 6, "UAVIONIX_ADSB_OUT_CONTROL", "ADS-B发射控制"},
+    {10008, 14, 14, 240, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "UAVIONIX_ADSB_OUT_STATUS", "UAVIONIX_ADSB_OUT_STATUS"},
+    {10151, 85, 85, 195, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 23, "LOWEHEISER_GOV_EFI", "LOWEHEISER_GOV_EFI"},
+    {11000, 51, 52, 134, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 10, "DEVICE_OP_READ", "读取设备寄存器"},
+    {11001, 135, 136, 15, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "DEVICE_OP_READ_REPLY", "设备寄存器读取应答"},
+    {11002, 179, 180, 234, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 11, "DEVICE_OP_WRITE", "写入设备寄存器"},
+    {11003, 5, 5, 64, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "DEVICE_OP_WRITE_REPLY", "设备寄存器写入应答"},
+    {11004, 232, 232, 11, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 7, "SECURE_COMMAND", "安全命令"},
+    {11005, 230, 230, 93, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "SECURE_COMMAND_REPLY", "安全命令应答"},
+    {11010, 49, 49, 46, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 13, "ADAP_TUNING", "自适应调参"},
+    {11011, 44, 44, 106, MAVLINK_CAT_POSITION, MAVLINK_LOG_OTHER, 1, 5, "VISION_POSITION_DELTA", "视觉位置增量"},
+    {11020, 16, 16, 205, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 3, "AOA_SSA", "攻角侧滑角"},
+    {11030, 44, 44, 144, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_1_TO_4", "电调遥测1-4"},
+    {11031, 44, 44, 133, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_5_TO_8", "电调遥测5-8"},
+    {11032, 44, 44, 85, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_9_TO_12", "电调遥测9-12"},
+    {11033, 37, 37, 195, MAVLINK_CAT_PARAM, MAVLINK_LOG_OTHER, 1, 10, "OSD_PARAM_CONFIG", "OSD参数配置"},
+    {11034, 5, 5, 79, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 2, "OSD_PARAM_CONFIG_REPLY", "OSD_PARAM_CONFIG_REPLY"},
+    {11035, 8, 8, 128, MAVLINK_CAT_PARAM, MAVLINK_LOG_REQUEST, 1, 5, "OSD_PARAM_SHOW_CONFIG", "读取OSD参数配置"},
+    {11036, 34, 34, 177, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "OSD_PARAM_SHOW_CONFIG_REPLY", "OSD_PARAM_SHOW_CONFIG_REPLY"},
+    {11037, 28, 28, 130, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 9, "OBSTACLE_DISTANCE_3D", "三维障碍物距离"},
+    {11038, 38, 38, 47, MAVLINK_CAT_TELEMETRY, MAVLINK_LOG_OTHER, 1, 11, "WATER_DEPTH", "水深"},
+    {11039, 9, 9, 142, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "MCU_STATUS", "MCU状态"},
+    {11040, 44, 44, 132, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_13_TO_16", "ESC_TELEMETRY_13_TO_16"},
+    {11041, 44, 44, 208, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_17_TO_20", "ESC_TELEMETRY_17_TO_20"},
+    {11042, 44, 44, 201, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_21_TO_24", "ESC_TELEMETRY_21_TO_24"},
+    {11043, 44, 44, 193, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_25_TO_28", "ESC_TELEMETRY_25_TO_28"},
+    {11044, 44, 44, 189, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "ESC_TELEMETRY_29_TO_32", "ESC_TELEMETRY_29_TO_32"},
+    {12900, 44, 44, 114, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "OPEN_DRONE_ID_BASIC_ID", "远程识别基本ID"},
+    {12901, 59, 59, 254, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 19, "OPEN_DRONE_ID_LOCATION", "远程识别位置"},
+    {12902, 53, 53, 140, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 9, "OPEN_DRONE_ID_AUTHENTICATION", "OPEN_DRONE_ID_AUTHENTICATION"},
+    {12903, 46, 46, 249, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 5, "OPEN_DRONE_ID_SELF_ID", "OPEN_DRONE_ID_SELF_ID"},
+    {12904, 54, 54, 77, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 15, "OPEN_DRONE_ID_SYSTEM", "远程识别系统"},
+    {12905, 43, 43, 49, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 5, "OPEN_DRONE_ID_OPERATOR_ID", "远程识别操作员ID"},
+    {12915, 249, 249, 94, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 6, "OPEN_DRONE_ID_MESSAGE_PACK", "OPEN_DRONE_ID_MESSAGE_PACK"},
+    {12918, 51, 51, 139, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 2, "OPEN_DRONE_ID_ARM_STATUS", "远程识别解锁状态"},
+    {12919, 18, 18, 7, MAVLINK_CAT_SYSTEM, MAVLINK_LOG_OTHER, 1, 6, "OPEN_DRONE_ID_SYSTEM_UPDATE", "远程识别系统更新"},
+    {12920, 5, 5, 20, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "HYGROMETER_SENSOR", "HYGROMETER_SENSOR"},
+    {42000, 1, 1, 227, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "ICAROUS_HEARTBEAT", "ICAROUS_HEARTBEAT"},
+    {42001, 46, 46, 239, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 16, "ICAROUS_KINEMATIC_BANDS", "ICAROUS_KINEMATIC_BANDS"},
+    {50001, 32, 32, 246, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "CUBEPILOT_RAW_RC", "CUBEPILOT_RAW_RC"},
+    {50002, 246, 246, 181, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 8, "HERELINK_VIDEO_STREAM_INFORMATION", "HERELINK_VIDEO_STREAM_INFORMATION"},
+    {50003, 19, 19, 62, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 7, "HERELINK_TELEM", "HERELINK_TELEM"},
+    {50004, 10, 10, 240, MAVLINK_CAT_COMMAND, MAVLINK_LOG_OTHER, 1, 4, "CUBEPILOT_FIRMWARE_UPDATE_START", "固件更新开始"},
+    {50005, 6, 6, 152, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 3, "CUBEPILOT_FIRMWARE_UPDATE_RESP", "CUBEPILOT_FIRMWARE_UPDATE_RESP"},
+    {52000, 100, 100, 13, MAVLINK_CAT_CONNECTION, MAVLINK_LOG_OTHER, 1, 2, "AIRLINK_AUTH", "AirLink登录认证"},
+    {52001, 1, 1, 239, MAVLINK_CAT_OTHER, MAVLINK_LOG_OTHER, 1, 1, "AIRLINK_AUTH_RESPONSE", "AIRLINK_AUTH_RESPONSE"},
+};
+
+/* 字段描述符数组，与元数据表下标一一对应 */
+const mavlink_field_info_t *const g_mavlink_msg_fields[MAVLINK_MSGDEF_COUNT] = {
+    NULL,
+    g_fields_HEARTBEAT,
+    g_fields_SYS_STATUS,
+    g_fields_SYSTEM_TIME,
+    g_fields_PING,
+    g_fields_CHANGE_OPERATOR_CONTROL,
+    g_fields_CHANGE_OPERATOR_CONTROL_ACK,
+    g_fields_AUTH_KEY,
+    g_fields_LINK_NODE_STATUS,
+    g_fields_SET_MODE,
+    g_fields_PARAM_REQUEST_READ,
+    g_fields_PARAM_REQUEST_LIST,
+    g_fields_PARAM_VALUE,
+    g_fields_PARAM_SET,
+    g_fields_GPS_RAW_INT,
+    g_fields_GPS_STATUS,
+    g_fields_SCALED_IMU,
+    g_fields_RAW_IMU,
+    g_fields_RAW_PRESSURE,
+    g_fields_SCALED_PRESSURE,
+    g_fields_ATTITUDE,
+    g_fields_ATTITUDE_QUATERNION,
+    g_fields_LOCAL_POSITION_NED,
+    g_fields_GLOBAL_POSITION_INT,
+    g_fields_RC_CHANNELS_SCALED,
+    g_fields_RC_CHANNELS_RAW,
+    g_fields_SERVO_OUTPUT_RAW,
+    g_fields_MISSION_REQUEST_PARTIAL_LIST,
+    g_fields_MISSION_WRITE_PARTIAL_LIST,
+    g_fields_MISSION_ITEM,
+    g_fields_MISSION_REQUEST,
+    g_fields_MISSION_SET_CURRENT,
+    g_fields_MISSION_CURRENT,
+    g_fields_MISSION_REQUEST_LIST,
+    g_fields_MISSION_COUNT,
+    g_fields_MISSION_CLEAR_ALL,
+    g_fields_MISSION_ITEM_REACHED,
+    g_fields_MISSION_ACK,
+    g_fields_SET_GPS_GLOBAL_ORIGIN,
+    g_fields_GPS_GLOBAL_ORIGIN,
+    g_fields_PARAM_MAP_RC,
+    g_fields_MISSION_REQUEST_INT,
+    g_fields_SAFETY_SET_ALLOWED_AREA,
+    g_fields_SAFETY_ALLOWED_AREA,
+    g_fields_ATTITUDE_QUATERNION_COV,
+    g_fields_NAV_CONTROLLER_OUTPUT,
+    g_fields_GLOBAL_POSITION_INT_COV,
+    g_fields_LOCAL_POSITION_NED_COV,
+    g_fields_RC_CHANNELS,
+    g_fields_REQUEST_DATA_STREAM,
+    g_fields_DATA_STREAM,
+    g_fields_MANUAL_CONTROL,
+    g_fields_RC_CHANNELS_OVERRIDE,
+    g_fields_MISSION_ITEM_INT,
+    g_fields_VFR_HUD,
+    g_fields_COMMAND_INT,
+    g_fields_COMMAND_LONG,
+    g_fields_COMMAND_ACK,
+    g_fields_COMMAND_CANCEL,
+    g_fields_MANUAL_SETPOINT,
+    g_fields_SET_ATTITUDE_TARGET,
+    g_fields_ATTITUDE_TARGET,
+    g_fields_SET_POSITION_TARGET_LOCAL_NED,
+    g_fields_POSITION_TARGET_LOCAL_NED,
+    g_fields_SET_POSITION_TARGET_GLOBAL_INT,
+    g_fields_POSITION_TARGET_GLOBAL_INT,
+    g_fields_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET,
+    g_fields_HIL_STATE,
+    g_fields_HIL_CONTROLS,
+    g_fields_HIL_RC_INPUTS_RAW,
+    g_fields_HIL_ACTUATOR_CONTROLS,
+    g_fields_OPTICAL_FLOW,
+    g_fields_GLOBAL_VISION_POSITION_ESTIMATE,
+    g_fields_VISION_POSITION_ESTIMATE,
+    g_fields_VISION_SPEED_ESTIMATE,
+    g_fields_VICON_POSITION_ESTIMATE,
+    g_fields_HIGHRES_IMU,
+    g_fields_OPTICAL_FLOW_RAD,
+    g_fields_HIL_SENSOR,
+    g_fields_SIM_STATE,
+    g_fields_RADIO_STATUS,
+    g_fields_FILE_TRANSFER_PROTOCOL,
+    g_fields_TIMESYNC,
+    g_fields_CAMERA_TRIGGER,
+    g_fields_HIL_GPS,
+    g_fields_HIL_OPTICAL_FLOW,
+    g_fields_HIL_STATE_QUATERNION,
+    g_fields_SCALED_IMU2,
+    g_fields_LOG_REQUEST_LIST,
+    g_fields_LOG_ENTRY,
+    g_fields_LOG_REQUEST_DATA,
+    g_fields_LOG_DATA,
+    g_fields_LOG_ERASE,
+    g_fields_LOG_REQUEST_END,
+    g_fields_GPS_INJECT_DATA,
+    g_fields_GPS2_RAW,
+    g_fields_POWER_STATUS,
+    g_fields_SERIAL_CONTROL,
+    g_fields_GPS_RTK,
+    g_fields_GPS2_RTK,
+    g_fields_SCALED_IMU3,
+    g_fields_DATA_TRANSMISSION_HANDSHAKE,
+    g_fields_ENCAPSULATED_DATA,
+    g_fields_DISTANCE_SENSOR,
+    g_fields_TERRAIN_REQUEST,
+    g_fields_TERRAIN_DATA,
+    g_fields_TERRAIN_CHECK,
+    g_fields_TERRAIN_REPORT,
+    g_fields_SCALED_PRESSURE2,
+    g_fields_ATT_POS_MOCAP,
+    g_fields_SET_ACTUATOR_CONTROL_TARGET,
+    g_fields_ACTUATOR_CONTROL_TARGET,
+    g_fields_ALTITUDE,
+    g_fields_RESOURCE_REQUEST,
+    g_fields_SCALED_PRESSURE3,
+    g_fields_FOLLOW_TARGET,
+    g_fields_CONTROL_SYSTEM_STATE,
+    g_fields_BATTERY_STATUS,
+    g_fields_AUTOPILOT_VERSION,
+    g_fields_LANDING_TARGET,
+    g_fields_SENSOR_OFFSETS,
+    g_fields_SET_MAG_OFFSETS,
+    g_fields_MEMINFO,
+    g_fields_AP_ADC,
+    g_fields_DIGICAM_CONFIGURE,
+    g_fields_DIGICAM_CONTROL,
+    g_fields_MOUNT_CONFIGURE,
+    g_fields_MOUNT_CONTROL,
+    g_fields_MOUNT_STATUS,
+    g_fields_FENCE_POINT,
+    g_fields_FENCE_FETCH_POINT,
+    g_fields_FENCE_STATUS,
+    g_fields_AHRS,
+    g_fields_SIMSTATE,
+    g_fields_HWSTATUS,
+    g_fields_RADIO,
+    g_fields_LIMITS_STATUS,
+    g_fields_WIND,
+    g_fields_DATA16,
+    g_fields_DATA32,
+    g_fields_DATA64,
+    g_fields_DATA96,
+    g_fields_RANGEFINDER,
+    g_fields_AIRSPEED_AUTOCAL,
+    g_fields_RALLY_POINT,
+    g_fields_RALLY_FETCH_POINT,
+    g_fields_COMPASSMOT_STATUS,
+    g_fields_AHRS2,
+    g_fields_CAMERA_STATUS,
+    g_fields_CAMERA_FEEDBACK,
+    g_fields_BATTERY2,
+    g_fields_AHRS3,
+    g_fields_AUTOPILOT_VERSION_REQUEST,
+    g_fields_REMOTE_LOG_DATA_BLOCK,
+    g_fields_REMOTE_LOG_BLOCK_STATUS,
+    g_fields_LED_CONTROL,
+    g_fields_MAG_CAL_PROGRESS,
+    g_fields_MAG_CAL_REPORT,
+    g_fields_EKF_STATUS_REPORT,
+    g_fields_PID_TUNING,
+    g_fields_DEEPSTALL,
+    g_fields_GIMBAL_REPORT,
+    g_fields_GIMBAL_CONTROL,
+    g_fields_GIMBAL_TORQUE_CMD_REPORT,
+    g_fields_GOPRO_HEARTBEAT,
+    g_fields_GOPRO_GET_REQUEST,
+    g_fields_GOPRO_GET_RESPONSE,
+    g_fields_GOPRO_SET_REQUEST,
+    g_fields_GOPRO_SET_RESPONSE,
+    g_fields_EFI_STATUS,
+    g_fields_RPM,
+    g_fields_ESTIMATOR_STATUS,
+    g_fields_WIND_COV,
+    g_fields_GPS_INPUT,
+    g_fields_GPS_RTCM_DATA,
+    g_fields_HIGH_LATENCY,
+    g_fields_HIGH_LATENCY2,
+    g_fields_VIBRATION,
+    g_fields_HOME_POSITION,
+    g_fields_SET_HOME_POSITION,
+    g_fields_MESSAGE_INTERVAL,
+    g_fields_EXTENDED_SYS_STATE,
+    g_fields_ADSB_VEHICLE,
+    g_fields_COLLISION,
+    g_fields_V2_EXTENSION,
+    g_fields_MEMORY_VECT,
+    g_fields_DEBUG_VECT,
+    g_fields_NAMED_VALUE_FLOAT,
+    g_fields_NAMED_VALUE_INT,
+    g_fields_STATUSTEXT,
+    g_fields_DEBUG,
+    g_fields_SETUP_SIGNING,
+    g_fields_BUTTON_CHANGE,
+    g_fields_PLAY_TUNE,
+    g_fields_CAMERA_INFORMATION,
+    g_fields_CAMERA_SETTINGS,
+    g_fields_STORAGE_INFORMATION,
+    g_fields_CAMERA_CAPTURE_STATUS,
+    g_fields_CAMERA_IMAGE_CAPTURED,
+    g_fields_FLIGHT_INFORMATION,
+    g_fields_MOUNT_ORIENTATION,
+    g_fields_LOGGING_DATA,
+    g_fields_LOGGING_DATA_ACKED,
+    g_fields_LOGGING_ACK,
+    g_fields_VIDEO_STREAM_INFORMATION,
+    g_fields_VIDEO_STREAM_STATUS,
+    g_fields_CAMERA_FOV_STATUS,
+    g_fields_CAMERA_TRACKING_IMAGE_STATUS,
+    g_fields_CAMERA_TRACKING_GEO_STATUS,
+    g_fields_GIMBAL_MANAGER_INFORMATION,
+    g_fields_GIMBAL_MANAGER_STATUS,
+    g_fields_GIMBAL_MANAGER_SET_ATTITUDE,
+    g_fields_GIMBAL_DEVICE_INFORMATION,
+    g_fields_GIMBAL_DEVICE_SET_ATTITUDE,
+    g_fields_GIMBAL_DEVICE_ATTITUDE_STATUS,
+    g_fields_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE,
+    g_fields_GIMBAL_MANAGER_SET_PITCHYAW,
+    g_fields_GIMBAL_MANAGER_SET_MANUAL_CONTROL,
+    g_fields_ESC_INFO,
+    g_fields_ESC_STATUS,
+    g_fields_WIFI_CONFIG_AP,
+    g_fields_PROTOCOL_VERSION,
+    g_fields_AIS_VESSEL,
+    g_fields_UAVCAN_NODE_STATUS,
+    g_fields_UAVCAN_NODE_INFO,
+    g_fields_PARAM_EXT_REQUEST_READ,
+    g_fields_PARAM_EXT_REQUEST_LIST,
+    g_fields_PARAM_EXT_VALUE,
+    g_fields_PARAM_EXT_SET,
+    g_fields_PARAM_EXT_ACK,
+    g_fields_OBSTACLE_DISTANCE,
+    g_fields_ODOMETRY,
+    g_fields_TRAJECTORY_REPRESENTATION_WAYPOINTS,
+    g_fields_TRAJECTORY_REPRESENTATION_BEZIER,
+    g_fields_CELLULAR_STATUS,
+    g_fields_ISBD_LINK_STATUS,
+    g_fields_CELLULAR_CONFIG,
+    g_fields_RAW_RPM,
+    g_fields_UTM_GLOBAL_POSITION,
+    g_fields_DEBUG_FLOAT_ARRAY,
+    g_fields_ORBIT_EXECUTION_STATUS,
+    g_fields_SMART_BATTERY_INFO,
+    g_fields_GENERATOR_STATUS,
+    g_fields_ACTUATOR_OUTPUT_STATUS,
+    g_fields_TIME_ESTIMATE_TO_TARGET,
+    g_fields_TUNNEL,
+    g_fields_CAN_FRAME,
+    g_fields_CANFD_FRAME,
+    g_fields_CAN_FILTER_MODIFY,
+    g_fields_ONBOARD_COMPUTER_STATUS,
+    g_fields_COMPONENT_INFORMATION,
+    g_fields_COMPONENT_INFORMATION_BASIC,
+    g_fields_COMPONENT_METADATA,
+    g_fields_PLAY_TUNE_V2,
+    g_fields_SUPPORTED_TUNES,
+    g_fields_EVENT,
+    g_fields_CURRENT_EVENT_SEQUENCE,
+    g_fields_REQUEST_EVENT,
+    g_fields_RESPONSE_EVENT_ERROR,
+    g_fields_AVAILABLE_MODES,
+    g_fields_CURRENT_MODE,
+    g_fields_AVAILABLE_MODES_MONITOR,
+    g_fields_WHEEL_DISTANCE,
+    g_fields_WINCH_STATUS,
+    g_fields_UAVIONIX_ADSB_OUT_CFG,
+    g_fields_UAVIONIX_ADSB_OUT_DYNAMIC,
+    g_fields_UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT,
+    g_fields_UAVIONIX_ADSB_OUT_CFG_REGISTRATION,
+    g_fields_UAVIONIX_ADSB_OUT_CFG_FLIGHTID,
+    g_fields_UAVIONIX_ADSB_GET,
+    g_fields_UAVIONIX_ADSB_OUT_CONTROL,
+    g_fields_UAVIONIX_ADSB_OUT_STATUS,
+    g_fields_LOWEHEISER_GOV_EFI,
+    g_fields_DEVICE_OP_READ,
+    g_fields_DEVICE_OP_READ_REPLY,
+    g_fields_DEVICE_OP_WRITE,
+    g_fields_DEVICE_OP_WRITE_REPLY,
+    g_fields_SECURE_COMMAND,
+    g_fields_SECURE_COMMAND_REPLY,
+    g_fields_ADAP_TUNING,
+    g_fields_VISION_POSITION_DELTA,
+    g_fields_AOA_SSA,
+    g_fields_ESC_TELEMETRY_1_TO_4,
+    g_fields_ESC_TELEMETRY_5_TO_8,
+    g_fields_ESC_TELEMETRY_9_TO_12,
+    g_fields_OSD_PARAM_CONFIG,
+    g_fields_OSD_PARAM_CONFIG_REPLY,
+    g_fields_OSD_PARAM_SHOW_CONFIG,
+    g_fields_OSD_PARAM_SHOW_CONFIG_REPLY,
+    g_fields_OBSTACLE_DISTANCE_3D,
+    g_fields_WATER_DEPTH,
+    g_fields_MCU_STATUS,
+    g_fields_ESC_TELEMETRY_13_TO_16,
+    g_fields_ESC_TELEMETRY_17_TO_20,
+    g_fields_ESC_TELEMETRY_21_TO_24,
+    g_fields_ESC_TELEMETRY_25_TO_28,
+    g_fields_ESC_TELEMETRY_29_TO_32,
+    g_fields_OPEN_DRONE_ID_BASIC_ID,
+    g_fields_OPEN_DRONE_ID_LOCATION,
+    g_fields_OPEN_DRONE_ID_AUTHENTICATION,
+    g_fields_OPEN_DRONE_ID_SELF_ID,
+    g_fields_OPEN_DRONE_ID_SYSTEM,
+    g_fields_OPEN_DRONE_ID_OPERATOR_ID,
+    g_fields_OPEN_DRONE_ID_MESSAGE_PACK,
+    g_fields_OPEN_DRONE_ID_ARM_STATUS,
+    g_fields_OPEN_DRONE_ID_SYSTEM_UPDATE,
+    g_fields_HYGROMETER_SENSOR,
+    g_fields_ICAROUS_HEARTBEAT,
+    g_fields_ICAROUS_KINEMATIC_BANDS,
+    g_fields_CUBEPILOT_RAW_RC,
+    g_fields_HERELINK_VIDEO_STREAM_INFORMATION,
+    g_fields_HERELINK_TELEM,
+    g_fields_CUBEPILOT_FIRMWARE_UPDATE_START,
+    g_fields_CUBEPILOT_FIRMWARE_UPDATE_RESP,
+    g_fields_AIRLINK_AUTH,
+    g_fields_AIRLINK_AUTH_RESPONSE,
+};
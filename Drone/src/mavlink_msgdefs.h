@@ -0,0 +1,2720 @@
+/*
+ * mavlink_msgdefs.h - 由 scripts/gen_msgdefs.py 根据 mavlink/ardupilotmega.xml, mavlink/common.xml, mavlink/csAirLink.xml, mavlink/cubepilot.xml, mavlink/icarous.xml, mavlink/loweheiser.xml, mavlink/minimal.xml, mavlink/standard.xml, mavlink/uAvionix.xml 生成
+ * 请勿手工修改，修改XML或 mavlink/labels_zh.txt 后执行 make msgdefs
+ */
+
+#ifndef MAVLINK_MSGDEFS_H
+#define MAVLINK_MSGDEFS_H
+
+#define MAVLINK_MSGDEF_COUNT 316       // 元数据表项数（含0号占位项）
+#define MAVLINK_MSGDEF_PAGES 11        // 两级索引需要的页数（含0号空页）
+
+/* 消息ID */
+#define MAVLINK_MSG_ID_HEARTBEAT 0
+#define MAVLINK_MSG_ID_SYS_STATUS 1
+#define MAVLINK_MSG_ID_SYSTEM_TIME 2
+#define MAVLINK_MSG_ID_PING 4
+#define MAVLINK_MSG_ID_CHANGE_OPERATOR_CONTROL 5
+#define MAVLINK_MSG_ID_CHANGE_OPERATOR_CONTROL_ACK 6
+#define MAVLINK_MSG_ID_AUTH_KEY 7
+#define MAVLINK_MSG_ID_LINK_NODE_STATUS 8
+#define MAVLINK_MSG_ID_SET_MODE 11
+#define MAVLINK_MSG_ID_PARAM_REQUEST_READ 20
+#define MAVLINK_MSG_ID_PARAM_REQUEST_LIST 21
+#define MAVLINK_MSG_ID_PARAM_VALUE 22
+#define MAVLINK_MSG_ID_PARAM_SET 23
+#define MAVLINK_MSG_ID_GPS_RAW_INT 24
+#define MAVLINK_MSG_ID_GPS_STATUS 25
+#define MAVLINK_MSG_ID_SCALED_IMU 26
+#define MAVLINK_MSG_ID_RAW_IMU 27
+#define MAVLINK_MSG_ID_RAW_PRESSURE 28
+#define MAVLINK_MSG_ID_SCALED_PRESSURE 29
+#define MAVLINK_MSG_ID_ATTITUDE 30
+#define MAVLINK_MSG_ID_ATTITUDE_QUATERNION 31
+#define MAVLINK_MSG_ID_LOCAL_POSITION_NED 32
+#define MAVLINK_MSG_ID_GLOBAL_POSITION_INT 33
+#define MAVLINK_MSG_ID_RC_CHANNELS_SCALED 34
+#define MAVLINK_MSG_ID_RC_CHANNELS_RAW 35
+#define MAVLINK_MSG_ID_SERVO_OUTPUT_RAW 36
+#define MAVLINK_MSG_ID_MISSION_REQUEST_PARTIAL_LIST 37
+#define MAVLINK_MSG_ID_MISSION_WRITE_PARTIAL_LIST 38
+#define MAVLINK_MSG_ID_MISSION_ITEM 39
+#define MAVLINK_MSG_ID_MISSION_REQUEST 40
+#define MAVLINK_MSG_ID_MISSION_SET_CURRENT 41
+#define MAVLINK_MSG_ID_MISSION_CURRENT 42
+#define MAVLINK_MSG_ID_MISSION_REQUEST_LIST 43
+#define MAVLINK_MSG_ID_MISSION_COUNT 44
+#define MAVLINK_MSG_ID_MISSION_CLEAR_ALL 45
+#define MAVLINK_MSG_ID_MISSION_ITEM_REACHED 46
+#define MAVLINK_MSG_ID_MISSION_ACK 47
+#define MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN 48
+#define MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN 49
+#define MAVLINK_MSG_ID_PARAM_MAP_RC 50
+#define MAVLINK_MSG_ID_MISSION_REQUEST_INT 51
+#define MAVLINK_MSG_ID_SAFETY_SET_ALLOWED_AREA 54
+#define MAVLINK_MSG_ID_SAFETY_ALLOWED_AREA 55
+#define MAVLINK_MSG_ID_ATTITUDE_QUATERNION_COV 61
+#define MAVLINK_MSG_ID_NAV_CONTROLLER_OUTPUT 62
+#define MAVLINK_MSG_ID_GLOBAL_POSITION_INT_COV 63
+#define MAVLINK_MSG_ID_LOCAL_POSITION_NED_COV 64
+#define MAVLINK_MSG_ID_RC_CHANNELS 65
+#define MAVLINK_MSG_ID_REQUEST_DATA_STREAM 66
+#define MAVLINK_MSG_ID_DATA_STREAM 67
+#define MAVLINK_MSG_ID_MANUAL_CONTROL 69
+#define MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE 70
+#define MAVLINK_MSG_ID_MISSION_ITEM_INT 73
+#define MAVLINK_MSG_ID_VFR_HUD 74
+#define MAVLINK_MSG_ID_COMMAND_INT 75
+#define MAVLINK_MSG_ID_COMMAND_LONG 76
+#define MAVLINK_MSG_ID_COMMAND_ACK 77
+#define MAVLINK_MSG_ID_COMMAND_CANCEL 80
+#define MAVLINK_MSG_ID_MANUAL_SETPOINT 81
+#define MAVLINK_MSG_ID_SET_ATTITUDE_TARGET 82
+#define MAVLINK_MSG_ID_ATTITUDE_TARGET 83
+#define MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED 84
+#define MAVLINK_MSG_ID_POSITION_TARGET_LOCAL_NED 85
+#define MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT 86
+#define MAVLINK_MSG_ID_POSITION_TARGET_GLOBAL_INT 87
+#define MAVLINK_MSG_ID_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET 89
+#define MAVLINK_MSG_ID_HIL_STATE 90
+#define MAVLINK_MSG_ID_HIL_CONTROLS 91
+#define MAVLINK_MSG_ID_HIL_RC_INPUTS_RAW 92
+#define MAVLINK_MSG_ID_HIL_ACTUATOR_CONTROLS 93
+#define MAVLINK_MSG_ID_OPTICAL_FLOW 100
+#define MAVLINK_MSG_ID_GLOBAL_VISION_POSITION_ESTIMATE 101
+#define MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE 102
+#define MAVLINK_MSG_ID_VISION_SPEED_ESTIMATE 103
+#define MAVLINK_MSG_ID_VICON_POSITION_ESTIMATE 104
+#define MAVLINK_MSG_ID_HIGHRES_IMU 105
+#define MAVLINK_MSG_ID_OPTICAL_FLOW_RAD 106
+#define MAVLINK_MSG_ID_HIL_SENSOR 107
+#define MAVLINK_MSG_ID_SIM_STATE 108
+#define MAVLINK_MSG_ID_RADIO_STATUS 109
+#define MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL 110
+#define MAVLINK_MSG_ID_TIMESYNC 111
+#define MAVLINK_MSG_ID_CAMERA_TRIGGER 112
+#define MAVLINK_MSG_ID_HIL_GPS 113
+#define MAVLINK_MSG_ID_HIL_OPTICAL_FLOW 114
+#define MAVLINK_MSG_ID_HIL_STATE_QUATERNION 115
+#define MAVLINK_MSG_ID_SCALED_IMU2 116
+#define MAVLINK_MSG_ID_LOG_REQUEST_LIST 117
+#define MAVLINK_MSG_ID_LOG_ENTRY 118
+#define MAVLINK_MSG_ID_LOG_REQUEST_DATA 119
+#define MAVLINK_MSG_ID_LOG_DATA 120
+#define MAVLINK_MSG_ID_LOG_ERASE 121
+#define MAVLINK_MSG_ID_LOG_REQUEST_END 122
+#define MAVLINK_MSG_ID_GPS_INJECT_DATA 123
+#define MAVLINK_MSG_ID_GPS2_RAW 124
+#define MAVLINK_MSG_ID_POWER_STATUS 125
+#define MAVLINK_MSG_ID_SERIAL_CONTROL 126
+#define MAVLINK_MSG_ID_GPS_RTK 127
+#define MAVLINK_MSG_ID_GPS2_RTK 128
+#define MAVLINK_MSG_ID_SCALED_IMU3 129
+#define MAVLINK_MSG_ID_DATA_TRANSMISSION_HANDSHAKE 130
+#define MAVLINK_MSG_ID_ENCAPSULATED_DATA 131
+#define MAVLINK_MSG_ID_DISTANCE_SENSOR 132
+#define MAVLINK_MSG_ID_TERRAIN_REQUEST 133
+#define MAVLINK_MSG_ID_TERRAIN_DATA 134
+#define MAVLINK_MSG_ID_TERRAIN_CHECK 135
+#define MAVLINK_MSG_ID_TERRAIN_REPORT 136
+#define MAVLINK_MSG_ID_SCALED_PRESSURE2 137
+#define MAVLINK_MSG_ID_ATT_POS_MOCAP 138
+#define MAVLINK_MSG_ID_SET_ACTUATOR_CONTROL_TARGET 139
+#define MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET 140
+#define MAVLINK_MSG_ID_ALTITUDE 141
+#define MAVLINK_MSG_ID_RESOURCE_REQUEST 142
+#define MAVLINK_MSG_ID_SCALED_PRESSURE3 143
+#define MAVLINK_MSG_ID_FOLLOW_TARGET 144
+#define MAVLINK_MSG_ID_CONTROL_SYSTEM_STATE 146
+#define MAVLINK_MSG_ID_BATTERY_STATUS 147
+#define MAVLINK_MSG_ID_AUTOPILOT_VERSION 148
+#define MAVLINK_MSG_ID_LANDING_TARGET 149
+#define MAVLINK_MSG_ID_SENSOR_OFFSETS 150
+#define MAVLINK_MSG_ID_SET_MAG_OFFSETS 151
+#define MAVLINK_MSG_ID_MEMINFO 152
+#define MAVLINK_MSG_ID_AP_ADC 153
+#define MAVLINK_MSG_ID_DIGICAM_CONFIGURE 154
+#define MAVLINK_MSG_ID_DIGICAM_CONTROL 155
+#define MAVLINK_MSG_ID_MOUNT_CONFIGURE 156
+#define MAVLINK_MSG_ID_MOUNT_CONTROL 157
+#define MAVLINK_MSG_ID_MOUNT_STATUS 158
+#define MAVLINK_MSG_ID_FENCE_POINT 160
+#define MAVLINK_MSG_ID_FENCE_FETCH_POINT 161
+#define MAVLINK_MSG_ID_FENCE_STATUS 162
+#define MAVLINK_MSG_ID_AHRS 163
+#define MAVLINK_MSG_ID_SIMSTATE 164
+#define MAVLINK_MSG_ID_HWSTATUS 165
+#define MAVLINK_MSG_ID_RADIO 166
+#define MAVLINK_MSG_ID_LIMITS_STATUS 167
+#define MAVLINK_MSG_ID_WIND 168
+#define MAVLINK_MSG_ID_DATA16 169
+#define MAVLINK_MSG_ID_DATA32 170
+#define MAVLINK_MSG_ID_DATA64 171
+#define MAVLINK_MSG_ID_DATA96 172
+#define MAVLINK_MSG_ID_RANGEFINDER 173
+#define MAVLINK_MSG_ID_AIRSPEED_AUTOCAL 174
+#define MAVLINK_MSG_ID_RALLY_POINT 175
+#define MAVLINK_MSG_ID_RALLY_FETCH_POINT 176
+#define MAVLINK_MSG_ID_COMPASSMOT_STATUS 177
+#define MAVLINK_MSG_ID_AHRS2 178
+#define MAVLINK_MSG_ID_CAMERA_STATUS 179
+#define MAVLINK_MSG_ID_CAMERA_FEEDBACK 180
+#define MAVLINK_MSG_ID_BATTERY2 181
+#define MAVLINK_MSG_ID_AHRS3 182
+#define MAVLINK_MSG_ID_AUTOPILOT_VERSION_REQUEST 183
+#define MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK 184
+#define MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS 185
+#define MAVLINK_MSG_ID_LED_CONTROL 186
+#define MAVLINK_MSG_ID_MAG_CAL_PROGRESS 191
+#define MAVLINK_MSG_ID_MAG_CAL_REPORT 192
+#define MAVLINK_MSG_ID_EKF_STATUS_REPORT 193
+#define MAVLINK_MSG_ID_PID_TUNING 194
+#define MAVLINK_MSG_ID_DEEPSTALL 195
+#define MAVLINK_MSG_ID_GIMBAL_REPORT 200
+#define MAVLINK_MSG_ID_GIMBAL_CONTROL 201
+#define MAVLINK_MSG_ID_GIMBAL_TORQUE_CMD_REPORT 214
+#define MAVLINK_MSG_ID_GOPRO_HEARTBEAT 215
+#define MAVLINK_MSG_ID_GOPRO_GET_REQUEST 216
+#define MAVLINK_MSG_ID_GOPRO_GET_RESPONSE 217
+#define MAVLINK_MSG_ID_GOPRO_SET_REQUEST 218
+#define MAVLINK_MSG_ID_GOPRO_SET_RESPONSE 219
+#define MAVLINK_MSG_ID_EFI_STATUS 225
+#define MAVLINK_MSG_ID_RPM 226
+#define MAVLINK_MSG_ID_ESTIMATOR_STATUS 230
+#define MAVLINK_MSG_ID_WIND_COV 231
+#define MAVLINK_MSG_ID_GPS_INPUT 232
+#define MAVLINK_MSG_ID_GPS_RTCM_DATA 233
+#define MAVLINK_MSG_ID_HIGH_LATENCY 234
+#define MAVLINK_MSG_ID_HIGH_LATENCY2 235
+#define MAVLINK_MSG_ID_VIBRATION 241
+#define MAVLINK_MSG_ID_HOME_POSITION 242
+#define MAVLINK_MSG_ID_SET_HOME_POSITION 243
+#define MAVLINK_MSG_ID_MESSAGE_INTERVAL 244
+#define MAVLINK_MSG_ID_EXTENDED_SYS_STATE 245
+#define MAVLINK_MSG_ID_ADSB_VEHICLE 246
+#define MAVLINK_MSG_ID_COLLISION 247
+#define MAVLINK_MSG_ID_V2_EXTENSION 248
+#define MAVLINK_MSG_ID_MEMORY_VECT 249
+#define MAVLINK_MSG_ID_DEBUG_VECT 250
+#define MAVLINK_MSG_ID_NAMED_VALUE_FLOAT 251
+#define MAVLINK_MSG_ID_NAMED_VALUE_INT 252
+#define MAVLINK_MSG_ID_STATUSTEXT 253
+#define MAVLINK_MSG_ID_DEBUG 254
+#define MAVLINK_MSG_ID_SETUP_SIGNING 256
+#define MAVLINK_MSG_ID_BUTTON_CHANGE 257
+#define MAVLINK_MSG_ID_PLAY_TUNE 258
+#define MAVLINK_MSG_ID_CAMERA_INFORMATION 259
+#define MAVLINK_MSG_ID_CAMERA_SETTINGS 260
+#define MAVLINK_MSG_ID_STORAGE_INFORMATION 261
+#define MAVLINK_MSG_ID_CAMERA_CAPTURE_STATUS 262
+#define MAVLINK_MSG_ID_CAMERA_IMAGE_CAPTURED 263
+#define MAVLINK_MSG_ID_FLIGHT_INFORMATION 264
+#define MAVLINK_MSG_ID_MOUNT_ORIENTATION 265
+#define MAVLINK_MSG_ID_LOGGING_DATA 266
+#define MAVLINK_MSG_ID_LOGGING_DATA_ACKED 267
+#define MAVLINK_MSG_ID_LOGGING_ACK 268
+#define MAVLINK_MSG_ID_VIDEO_STREAM_INFORMATION 269
+#define MAVLINK_MSG_ID_VIDEO_STREAM_STATUS 270
+#define MAVLINK_MSG_ID_CAMERA_FOV_STATUS 271
+#define MAVLINK_MSG_ID_CAMERA_TRACKING_IMAGE_STATUS 275
+#define MAVLINK_MSG_ID_CAMERA_TRACKING_GEO_STATUS 276
+#define MAVLINK_MSG_ID_GIMBAL_MANAGER_INFORMATION 280
+#define MAVLINK_MSG_ID_GIMBAL_MANAGER_STATUS 281
+#define MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE 282
+#define MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION 283
+#define MAVLINK_MSG_ID_GIMBAL_DEVICE_SET_ATTITUDE 284
+#define MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS 285
+#define MAVLINK_MSG_ID_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE 286
+#define MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_PITCHYAW 287
+#define MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL 288
+#define MAVLINK_MSG_ID_ESC_INFO 290
+#define MAVLINK_MSG_ID_ESC_STATUS 291
+#define MAVLINK_MSG_ID_WIFI_CONFIG_AP 299
+#define MAVLINK_MSG_ID_PROTOCOL_VERSION 300
+#define MAVLINK_MSG_ID_AIS_VESSEL 301
+#define MAVLINK_MSG_ID_UAVCAN_NODE_STATUS 310
+#define MAVLINK_MSG_ID_UAVCAN_NODE_INFO 311
+#define MAVLINK_MSG_ID_PARAM_EXT_REQUEST_READ 320
+#define MAVLINK_MSG_ID_PARAM_EXT_REQUEST_LIST 321
+#define MAVLINK_MSG_ID_PARAM_EXT_VALUE 322
+#define MAVLINK_MSG_ID_PARAM_EXT_SET 323
+#define MAVLINK_MSG_ID_PARAM_EXT_ACK 324
+#define MAVLINK_MSG_ID_OBSTACLE_DISTANCE 330
+#define MAVLINK_MSG_ID_ODOMETRY 331
+#define MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_WAYPOINTS 332
+#define MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_BEZIER 333
+#define MAVLINK_MSG_ID_CELLULAR_STATUS 334
+#define MAVLINK_MSG_ID_ISBD_LINK_STATUS 335
+#define MAVLINK_MSG_ID_CELLULAR_CONFIG 336
+#define MAVLINK_MSG_ID_RAW_RPM 339
+#define MAVLINK_MSG_ID_UTM_GLOBAL_POSITION 340
+#define MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY 350
+#define MAVLINK_MSG_ID_ORBIT_EXECUTION_STATUS 360
+#define MAVLINK_MSG_ID_SMART_BATTERY_INFO 370
+#define MAVLINK_MSG_ID_GENERATOR_STATUS 373
+#define MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS 375
+#define MAVLINK_MSG_ID_TIME_ESTIMATE_TO_TARGET 380
+#define MAVLINK_MSG_ID_TUNNEL 385
+#define MAVLINK_MSG_ID_CAN_FRAME 386
+#define MAVLINK_MSG_ID_CANFD_FRAME 387
+#define MAVLINK_MSG_ID_CAN_FILTER_MODIFY 388
+#define MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS 390
+#define MAVLINK_MSG_ID_COMPONENT_INFORMATION 395
+#define MAVLINK_MSG_ID_COMPONENT_INFORMATION_BASIC 396
+#define MAVLINK_MSG_ID_COMPONENT_METADATA 397
+#define MAVLINK_MSG_ID_PLAY_TUNE_V2 400
+#define MAVLINK_MSG_ID_SUPPORTED_TUNES 401
+#define MAVLINK_MSG_ID_EVENT 410
+#define MAVLINK_MSG_ID_CURRENT_EVENT_SEQUENCE 411
+#define MAVLINK_MSG_ID_REQUEST_EVENT 412
+#define MAVLINK_MSG_ID_RESPONSE_EVENT_ERROR 413
+#define MAVLINK_MSG_ID_AVAILABLE_MODES 435
+#define MAVLINK_MSG_ID_CURRENT_MODE 436
+#define MAVLINK_MSG_ID_AVAILABLE_MODES_MONITOR 437
+#define MAVLINK_MSG_ID_WHEEL_DISTANCE 9000
+#define MAVLINK_MSG_ID_WINCH_STATUS 9005
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_CFG 10001
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_DYNAMIC 10002
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT 10003
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_CFG_REGISTRATION 10004
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_CFG_FLIGHTID 10005
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_GET 10006
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_CONTROL 10007
+#define MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_STATUS 10008
+#define MAVLINK_MSG_ID_LOWEHEISER_GOV_EFI 10151
+#define MAVLINK_MSG_ID_DEVICE_OP_READ 11000
+#define MAVLINK_MSG_ID_DEVICE_OP_READ_REPLY 11001
+#define MAVLINK_MSG_ID_DEVICE_OP_WRITE 11002
+#define MAVLINK_MSG_ID_DEVICE_OP_WRITE_REPLY 11003
+#define MAVLINK_MSG_ID_SECURE_COMMAND 11004
+#define MAVLINK_MSG_ID_SECURE_COMMAND_REPLY 11005
+#define MAVLINK_MSG_ID_ADAP_TUNING 11010
+#define MAVLINK_MSG_ID_VISION_POSITION_DELTA 11011
+#define MAVLINK_MSG_ID_AOA_SSA 11020
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_1_TO_4 11030
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_5_TO_8 11031
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_9_TO_12 11032
+#define MAVLINK_MSG_ID_OSD_PARAM_CONFIG 11033
+#define MAVLINK_MSG_ID_OSD_PARAM_CONFIG_REPLY 11034
+#define MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG 11035
+#define MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG_REPLY 11036
+#define MAVLINK_MSG_ID_OBSTACLE_DISTANCE_3D 11037
+#define MAVLINK_MSG_ID_WATER_DEPTH 11038
+#define MAVLINK_MSG_ID_MCU_STATUS 11039
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_13_TO_16 11040
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_17_TO_20 11041
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_21_TO_24 11042
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_25_TO_28 11043
+#define MAVLINK_MSG_ID_ESC_TELEMETRY_29_TO_32 11044
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_BASIC_ID 12900
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_LOCATION 12901
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_AUTHENTICATION 12902
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_SELF_ID 12903
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM 12904
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_OPERATOR_ID 12905
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_MESSAGE_PACK 12915
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_ARM_STATUS 12918
+#define MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM_UPDATE 12919
+#define MAVLINK_MSG_ID_HYGROMETER_SENSOR 12920
+#define MAVLINK_MSG_ID_ICAROUS_HEARTBEAT 42000
+#define MAVLINK_MSG_ID_ICAROUS_KINEMATIC_BANDS 42001
+#define MAVLINK_MSG_ID_CUBEPILOT_RAW_RC 50001
+#define MAVLINK_MSG_ID_HERELINK_VIDEO_STREAM_INFORMATION 50002
+#define MAVLINK_MSG_ID_HERELINK_TELEM 50003
+#define MAVLINK_MSG_ID_CUBEPILOT_FIRMWARE_UPDATE_START 50004
+#define MAVLINK_MSG_ID_CUBEPILOT_FIRMWARE_UPDATE_RESP 50005
+#define MAVLINK_MSG_ID_AIRLINK_AUTH 52000
+#define MAVLINK_MSG_ID_AIRLINK_AUTH_RESPONSE 52001
+
+/* 字段在载荷中的偏移（线上顺序） */
+#define MAVLINK_OFFSET_HEARTBEAT_TYPE 4
+#define MAVLINK_OFFSET_HEARTBEAT_AUTOPILOT 5
+#define MAVLINK_OFFSET_HEARTBEAT_BASE_MODE 6
+#define MAVLINK_OFFSET_HEARTBEAT_CUSTOM_MODE 0
+#define MAVLINK_OFFSET_HEARTBEAT_SYSTEM_STATUS 7
+#define MAVLINK_OFFSET_HEARTBEAT_MAVLINK_VERSION 8
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_PRESENT 0
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_ENABLED 4
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_HEALTH 8
+#define MAVLINK_OFFSET_SYS_STATUS_LOAD 12
+#define MAVLINK_OFFSET_SYS_STATUS_VOLTAGE_BATTERY 14
+#define MAVLINK_OFFSET_SYS_STATUS_CURRENT_BATTERY 16
+#define MAVLINK_OFFSET_SYS_STATUS_BATTERY_REMAINING 30
+#define MAVLINK_OFFSET_SYS_STATUS_DROP_RATE_COMM 18
+#define MAVLINK_OFFSET_SYS_STATUS_ERRORS_COMM 20
+#define MAVLINK_OFFSET_SYS_STATUS_ERRORS_COUNT1 22
+#define MAVLINK_OFFSET_SYS_STATUS_ERRORS_COUNT2 24
+#define MAVLINK_OFFSET_SYS_STATUS_ERRORS_COUNT3 26
+#define MAVLINK_OFFSET_SYS_STATUS_ERRORS_COUNT4 28
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_PRESENT_EXTENDED 31
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_ENABLED_EXTENDED 35
+#define MAVLINK_OFFSET_SYS_STATUS_ONBOARD_CONTROL_SENSORS_HEALTH_EXTENDED 39
+#define MAVLINK_OFFSET_SYSTEM_TIME_TIME_UNIX_USEC 0
+#define MAVLINK_OFFSET_SYSTEM_TIME_TIME_BOOT_MS 8
+#define MAVLINK_OFFSET_PING_TIME_USEC 0
+#define MAVLINK_OFFSET_PING_SEQ 8
+#define MAVLINK_OFFSET_PING_TARGET_SYSTEM 12
+#define MAVLINK_OFFSET_PING_TARGET_COMPONENT 13
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_CONTROL_REQUEST 1
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_VERSION 2
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_PASSKEY 3
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_ACK_GCS_SYSTEM_ID 0
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_ACK_CONTROL_REQUEST 1
+#define MAVLINK_OFFSET_CHANGE_OPERATOR_CONTROL_ACK_ACK 2
+#define MAVLINK_OFFSET_AUTH_KEY_KEY 0
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_TIMESTAMP 0
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_TX_BUF 34
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_RX_BUF 35
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_TX_RATE 8
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_RX_RATE 12
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_RX_PARSE_ERR 28
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_TX_OVERFLOWS 30
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_RX_OVERFLOWS 32
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_MESSAGES_SENT 16
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_MESSAGES_RECEIVED 20
+#define MAVLINK_OFFSET_LINK_NODE_STATUS_MESSAGES_LOST 24
+#define MAVLINK_OFFSET_SET_MODE_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_SET_MODE_BASE_MODE 5
+#define MAVLINK_OFFSET_SET_MODE_CUSTOM_MODE 0
+#define MAVLINK_OFFSET_PARAM_REQUEST_READ_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_PARAM_REQUEST_READ_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_PARAM_REQUEST_READ_PARAM_ID 4
+#define MAVLINK_OFFSET_PARAM_REQUEST_READ_PARAM_INDEX 0
+#define MAVLINK_OFFSET_PARAM_REQUEST_LIST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_PARAM_REQUEST_LIST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_PARAM_VALUE_PARAM_ID 8
+#define MAVLINK_OFFSET_PARAM_VALUE_PARAM_VALUE 0
+#define MAVLINK_OFFSET_PARAM_VALUE_PARAM_TYPE 24
+#define MAVLINK_OFFSET_PARAM_VALUE_PARAM_COUNT 4
+#define MAVLINK_OFFSET_PARAM_VALUE_PARAM_INDEX 6
+#define MAVLINK_OFFSET_PARAM_SET_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_PARAM_SET_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_PARAM_SET_PARAM_ID 6
+#define MAVLINK_OFFSET_PARAM_SET_PARAM_VALUE 0
+#define MAVLINK_OFFSET_PARAM_SET_PARAM_TYPE 22
+#define MAVLINK_OFFSET_GPS_RAW_INT_TIME_USEC 0
+#define MAVLINK_OFFSET_GPS_RAW_INT_FIX_TYPE 28
+#define MAVLINK_OFFSET_GPS_RAW_INT_LAT 8
+#define MAVLINK_OFFSET_GPS_RAW_INT_LON 12
+#define MAVLINK_OFFSET_GPS_RAW_INT_ALT 16
+#define MAVLINK_OFFSET_GPS_RAW_INT_EPH 20
+#define MAVLINK_OFFSET_GPS_RAW_INT_EPV 22
+#define MAVLINK_OFFSET_GPS_RAW_INT_VEL 24
+#define MAVLINK_OFFSET_GPS_RAW_INT_COG 26
+#define MAVLINK_OFFSET_GPS_RAW_INT_SATELLITES_VISIBLE 29
+#define MAVLINK_OFFSET_GPS_RAW_INT_ALT_ELLIPSOID 30
+#define MAVLINK_OFFSET_GPS_RAW_INT_H_ACC 34
+#define MAVLINK_OFFSET_GPS_RAW_INT_V_ACC 38
+#define MAVLINK_OFFSET_GPS_RAW_INT_VEL_ACC 42
+#define MAVLINK_OFFSET_GPS_RAW_INT_HDG_ACC 46
+#define MAVLINK_OFFSET_GPS_RAW_INT_YAW 50
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITES_VISIBLE 0
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITE_PRN 1
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITE_USED 21
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITE_ELEVATION 41
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITE_AZIMUTH 61
+#define MAVLINK_OFFSET_GPS_STATUS_SATELLITE_SNR 81
+#define MAVLINK_OFFSET_SCALED_IMU_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_IMU_XACC 4
+#define MAVLINK_OFFSET_SCALED_IMU_YACC 6
+#define MAVLINK_OFFSET_SCALED_IMU_ZACC 8
+#define MAVLINK_OFFSET_SCALED_IMU_XGYRO 10
+#define MAVLINK_OFFSET_SCALED_IMU_YGYRO 12
+#define MAVLINK_OFFSET_SCALED_IMU_ZGYRO 14
+#define MAVLINK_OFFSET_SCALED_IMU_XMAG 16
+#define MAVLINK_OFFSET_SCALED_IMU_YMAG 18
+#define MAVLINK_OFFSET_SCALED_IMU_ZMAG 20
+#define MAVLINK_OFFSET_SCALED_IMU_TEMPERATURE 22
+#define MAVLINK_OFFSET_RAW_IMU_TIME_USEC 0
+#define MAVLINK_OFFSET_RAW_IMU_XACC 8
+#define MAVLINK_OFFSET_RAW_IMU_YACC 10
+#define MAVLINK_OFFSET_RAW_IMU_ZACC 12
+#define MAVLINK_OFFSET_RAW_IMU_XGYRO 14
+#define MAVLINK_OFFSET_RAW_IMU_YGYRO 16
+#define MAVLINK_OFFSET_RAW_IMU_ZGYRO 18
+#define MAVLINK_OFFSET_RAW_IMU_XMAG 20
+#define MAVLINK_OFFSET_RAW_IMU_YMAG 22
+#define MAVLINK_OFFSET_RAW_IMU_ZMAG 24
+#define MAVLINK_OFFSET_RAW_IMU_ID 26
+#define MAVLINK_OFFSET_RAW_IMU_TEMPERATURE 27
+#define MAVLINK_OFFSET_RAW_PRESSURE_TIME_USEC 0
+#define MAVLINK_OFFSET_RAW_PRESSURE_PRESS_ABS 8
+#define MAVLINK_OFFSET_RAW_PRESSURE_PRESS_DIFF1 10
+#define MAVLINK_OFFSET_RAW_PRESSURE_PRESS_DIFF2 12
+#define MAVLINK_OFFSET_RAW_PRESSURE_TEMPERATURE 14
+#define MAVLINK_OFFSET_SCALED_PRESSURE_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_PRESSURE_PRESS_ABS 4
+#define MAVLINK_OFFSET_SCALED_PRESSURE_PRESS_DIFF 8
+#define MAVLINK_OFFSET_SCALED_PRESSURE_TEMPERATURE 12
+#define MAVLINK_OFFSET_SCALED_PRESSURE_TEMPERATURE_PRESS_DIFF 14
+#define MAVLINK_OFFSET_ATTITUDE_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_ATTITUDE_ROLL 4
+#define MAVLINK_OFFSET_ATTITUDE_PITCH 8
+#define MAVLINK_OFFSET_ATTITUDE_YAW 12
+#define MAVLINK_OFFSET_ATTITUDE_ROLLSPEED 16
+#define MAVLINK_OFFSET_ATTITUDE_PITCHSPEED 20
+#define MAVLINK_OFFSET_ATTITUDE_YAWSPEED 24
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_Q1 4
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_Q2 8
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_Q3 12
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_Q4 16
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_ROLLSPEED 20
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_PITCHSPEED 24
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_YAWSPEED 28
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_REPR_OFFSET_Q 32
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_X 4
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_Y 8
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_Z 12
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_VX 16
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_VY 20
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_VZ 24
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_LAT 4
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_LON 8
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_ALT 12
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_RELATIVE_ALT 16
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_VX 20
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_VY 22
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_VZ 24
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_HDG 26
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_PORT 20
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN1_SCALED 4
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN2_SCALED 6
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN3_SCALED 8
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN4_SCALED 10
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN5_SCALED 12
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN6_SCALED 14
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN7_SCALED 16
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_CHAN8_SCALED 18
+#define MAVLINK_OFFSET_RC_CHANNELS_SCALED_RSSI 21
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_PORT 20
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN1_RAW 4
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN2_RAW 6
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN3_RAW 8
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN4_RAW 10
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN5_RAW 12
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN6_RAW 14
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN7_RAW 16
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_CHAN8_RAW 18
+#define MAVLINK_OFFSET_RC_CHANNELS_RAW_RSSI 21
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_TIME_USEC 0
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_PORT 20
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO1_RAW 4
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO2_RAW 6
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO3_RAW 8
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO4_RAW 10
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO5_RAW 12
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO6_RAW 14
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO7_RAW 16
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO8_RAW 18
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO9_RAW 21
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO10_RAW 23
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO11_RAW 25
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO12_RAW 27
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO13_RAW 29
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO14_RAW 31
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO15_RAW 33
+#define MAVLINK_OFFSET_SERVO_OUTPUT_RAW_SERVO16_RAW 35
+#define MAVLINK_OFFSET_MISSION_REQUEST_PARTIAL_LIST_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_MISSION_REQUEST_PARTIAL_LIST_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_MISSION_REQUEST_PARTIAL_LIST_START_INDEX 0
+#define MAVLINK_OFFSET_MISSION_REQUEST_PARTIAL_LIST_END_INDEX 2
+#define MAVLINK_OFFSET_MISSION_REQUEST_PARTIAL_LIST_MISSION_TYPE 6
+#define MAVLINK_OFFSET_MISSION_WRITE_PARTIAL_LIST_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_MISSION_WRITE_PARTIAL_LIST_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_MISSION_WRITE_PARTIAL_LIST_START_INDEX 0
+#define MAVLINK_OFFSET_MISSION_WRITE_PARTIAL_LIST_END_INDEX 2
+#define MAVLINK_OFFSET_MISSION_WRITE_PARTIAL_LIST_MISSION_TYPE 6
+#define MAVLINK_OFFSET_MISSION_ITEM_TARGET_SYSTEM 32
+#define MAVLINK_OFFSET_MISSION_ITEM_TARGET_COMPONENT 33
+#define MAVLINK_OFFSET_MISSION_ITEM_SEQ 28
+#define MAVLINK_OFFSET_MISSION_ITEM_FRAME 34
+#define MAVLINK_OFFSET_MISSION_ITEM_COMMAND 30
+#define MAVLINK_OFFSET_MISSION_ITEM_CURRENT 35
+#define MAVLINK_OFFSET_MISSION_ITEM_AUTOCONTINUE 36
+#define MAVLINK_OFFSET_MISSION_ITEM_PARAM1 0
+#define MAVLINK_OFFSET_MISSION_ITEM_PARAM2 4
+#define MAVLINK_OFFSET_MISSION_ITEM_PARAM3 8
+#define MAVLINK_OFFSET_MISSION_ITEM_PARAM4 12
+#define MAVLINK_OFFSET_MISSION_ITEM_X 16
+#define MAVLINK_OFFSET_MISSION_ITEM_Y 20
+#define MAVLINK_OFFSET_MISSION_ITEM_Z 24
+#define MAVLINK_OFFSET_MISSION_ITEM_MISSION_TYPE 37
+#define MAVLINK_OFFSET_MISSION_REQUEST_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_MISSION_REQUEST_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_MISSION_REQUEST_SEQ 0
+#define MAVLINK_OFFSET_MISSION_REQUEST_MISSION_TYPE 4
+#define MAVLINK_OFFSET_MISSION_SET_CURRENT_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_MISSION_SET_CURRENT_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_MISSION_SET_CURRENT_SEQ 0
+#define MAVLINK_OFFSET_MISSION_CURRENT_SEQ 0
+#define MAVLINK_OFFSET_MISSION_CURRENT_TOTAL 2
+#define MAVLINK_OFFSET_MISSION_CURRENT_MISSION_STATE 4
+#define MAVLINK_OFFSET_MISSION_CURRENT_MISSION_MODE 5
+#define MAVLINK_OFFSET_MISSION_CURRENT_MISSION_ID 6
+#define MAVLINK_OFFSET_MISSION_CURRENT_FENCE_ID 10
+#define MAVLINK_OFFSET_MISSION_CURRENT_RALLY_POINTS_ID 14
+#define MAVLINK_OFFSET_MISSION_REQUEST_LIST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_MISSION_REQUEST_LIST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_MISSION_REQUEST_LIST_MISSION_TYPE 2
+#define MAVLINK_OFFSET_MISSION_COUNT_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_MISSION_COUNT_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_MISSION_COUNT_COUNT 0
+#define MAVLINK_OFFSET_MISSION_COUNT_MISSION_TYPE 4
+#define MAVLINK_OFFSET_MISSION_COUNT_OPAQUE_ID 5
+#define MAVLINK_OFFSET_MISSION_CLEAR_ALL_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_MISSION_CLEAR_ALL_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_MISSION_CLEAR_ALL_MISSION_TYPE 2
+#define MAVLINK_OFFSET_MISSION_ITEM_REACHED_SEQ 0
+#define MAVLINK_OFFSET_MISSION_ACK_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_MISSION_ACK_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_MISSION_ACK_TYPE 2
+#define MAVLINK_OFFSET_MISSION_ACK_MISSION_TYPE 3
+#define MAVLINK_OFFSET_MISSION_ACK_OPAQUE_ID 4
+#define MAVLINK_OFFSET_SET_GPS_GLOBAL_ORIGIN_TARGET_SYSTEM 12
+#define MAVLINK_OFFSET_SET_GPS_GLOBAL_ORIGIN_LATITUDE 0
+#define MAVLINK_OFFSET_SET_GPS_GLOBAL_ORIGIN_LONGITUDE 4
+#define MAVLINK_OFFSET_SET_GPS_GLOBAL_ORIGIN_ALTITUDE 8
+#define MAVLINK_OFFSET_SET_GPS_GLOBAL_ORIGIN_TIME_USEC 13
+#define MAVLINK_OFFSET_GPS_GLOBAL_ORIGIN_LATITUDE 0
+#define MAVLINK_OFFSET_GPS_GLOBAL_ORIGIN_LONGITUDE 4
+#define MAVLINK_OFFSET_GPS_GLOBAL_ORIGIN_ALTITUDE 8
+#define MAVLINK_OFFSET_GPS_GLOBAL_ORIGIN_TIME_USEC 12
+#define MAVLINK_OFFSET_PARAM_MAP_RC_TARGET_SYSTEM 18
+#define MAVLINK_OFFSET_PARAM_MAP_RC_TARGET_COMPONENT 19
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAM_ID 20
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAM_INDEX 16
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAMETER_RC_CHANNEL_INDEX 36
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAM_VALUE0 0
+#define MAVLINK_OFFSET_PARAM_MAP_RC_SCALE 4
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAM_VALUE_MIN 8
+#define MAVLINK_OFFSET_PARAM_MAP_RC_PARAM_VALUE_MAX 12
+#define MAVLINK_OFFSET_MISSION_REQUEST_INT_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_MISSION_REQUEST_INT_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_MISSION_REQUEST_INT_SEQ 0
+#define MAVLINK_OFFSET_MISSION_REQUEST_INT_MISSION_TYPE 4
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_TARGET_SYSTEM 24
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_TARGET_COMPONENT 25
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_FRAME 26
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P1X 0
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P1Y 4
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P1Z 8
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P2X 12
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P2Y 16
+#define MAVLINK_OFFSET_SAFETY_SET_ALLOWED_AREA_P2Z 20
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_FRAME 24
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P1X 0
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P1Y 4
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P1Z 8
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P2X 12
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P2Y 16
+#define MAVLINK_OFFSET_SAFETY_ALLOWED_AREA_P2Z 20
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_TIME_USEC 0
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_Q 8
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_ROLLSPEED 24
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_PITCHSPEED 28
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_YAWSPEED 32
+#define MAVLINK_OFFSET_ATTITUDE_QUATERNION_COV_COVARIANCE 36
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_NAV_ROLL 0
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_NAV_PITCH 4
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_NAV_BEARING 20
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_TARGET_BEARING 22
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_WP_DIST 24
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_ALT_ERROR 8
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_ASPD_ERROR 12
+#define MAVLINK_OFFSET_NAV_CONTROLLER_OUTPUT_XTRACK_ERROR 16
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_TIME_USEC 0
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_ESTIMATOR_TYPE 180
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_LAT 8
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_LON 12
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_ALT 16
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_RELATIVE_ALT 20
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_VX 24
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_VY 28
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_VZ 32
+#define MAVLINK_OFFSET_GLOBAL_POSITION_INT_COV_COVARIANCE 36
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_TIME_USEC 0
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_ESTIMATOR_TYPE 224
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_X 8
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_Y 12
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_Z 16
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_VX 20
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_VY 24
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_VZ 28
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_AX 32
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_AY 36
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_AZ 40
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_COV_COVARIANCE 44
+#define MAVLINK_OFFSET_RC_CHANNELS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_RC_CHANNELS_CHANCOUNT 40
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN1_RAW 4
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN2_RAW 6
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN3_RAW 8
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN4_RAW 10
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN5_RAW 12
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN6_RAW 14
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN7_RAW 16
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN8_RAW 18
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN9_RAW 20
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN10_RAW 22
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN11_RAW 24
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN12_RAW 26
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN13_RAW 28
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN14_RAW 30
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN15_RAW 32
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN16_RAW 34
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN17_RAW 36
+#define MAVLINK_OFFSET_RC_CHANNELS_CHAN18_RAW 38
+#define MAVLINK_OFFSET_RC_CHANNELS_RSSI 41
+#define MAVLINK_OFFSET_REQUEST_DATA_STREAM_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_REQUEST_DATA_STREAM_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_REQUEST_DATA_STREAM_REQ_STREAM_ID 4
+#define MAVLINK_OFFSET_REQUEST_DATA_STREAM_REQ_MESSAGE_RATE 0
+#define MAVLINK_OFFSET_REQUEST_DATA_STREAM_START_STOP 5
+#define MAVLINK_OFFSET_DATA_STREAM_STREAM_ID 2
+#define MAVLINK_OFFSET_DATA_STREAM_MESSAGE_RATE 0
+#define MAVLINK_OFFSET_DATA_STREAM_ON_OFF 3
+#define MAVLINK_OFFSET_MANUAL_CONTROL_TARGET 10
+#define MAVLINK_OFFSET_MANUAL_CONTROL_X 0
+#define MAVLINK_OFFSET_MANUAL_CONTROL_Y 2
+#define MAVLINK_OFFSET_MANUAL_CONTROL_Z 4
+#define MAVLINK_OFFSET_MANUAL_CONTROL_R 6
+#define MAVLINK_OFFSET_MANUAL_CONTROL_BUTTONS 8
+#define MAVLINK_OFFSET_MANUAL_CONTROL_BUTTONS2 11
+#define MAVLINK_OFFSET_MANUAL_CONTROL_ENABLED_EXTENSIONS 13
+#define MAVLINK_OFFSET_MANUAL_CONTROL_S 14
+#define MAVLINK_OFFSET_MANUAL_CONTROL_T 16
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX1 18
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX2 20
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX3 22
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX4 24
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX5 26
+#define MAVLINK_OFFSET_MANUAL_CONTROL_AUX6 28
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_TARGET_SYSTEM 16
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_TARGET_COMPONENT 17
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN1_RAW 0
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN2_RAW 2
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN3_RAW 4
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN4_RAW 6
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN5_RAW 8
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN6_RAW 10
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN7_RAW 12
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN8_RAW 14
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN9_RAW 18
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN10_RAW 20
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN11_RAW 22
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN12_RAW 24
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN13_RAW 26
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN14_RAW 28
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN15_RAW 30
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN16_RAW 32
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN17_RAW 34
+#define MAVLINK_OFFSET_RC_CHANNELS_OVERRIDE_CHAN18_RAW 36
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_TARGET_SYSTEM 32
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_TARGET_COMPONENT 33
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_SEQ 28
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_FRAME 34
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_COMMAND 30
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_CURRENT 35
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_AUTOCONTINUE 36
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_PARAM1 0
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_PARAM2 4
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_PARAM3 8
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_PARAM4 12
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_X 16
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_Y 20
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_Z 24
+#define MAVLINK_OFFSET_MISSION_ITEM_INT_MISSION_TYPE 37
+#define MAVLINK_OFFSET_VFR_HUD_AIRSPEED 0
+#define MAVLINK_OFFSET_VFR_HUD_GROUNDSPEED 4
+#define MAVLINK_OFFSET_VFR_HUD_HEADING 16
+#define MAVLINK_OFFSET_VFR_HUD_THROTTLE 18
+#define MAVLINK_OFFSET_VFR_HUD_ALT 8
+#define MAVLINK_OFFSET_VFR_HUD_CLIMB 12
+#define MAVLINK_OFFSET_COMMAND_INT_TARGET_SYSTEM 30
+#define MAVLINK_OFFSET_COMMAND_INT_TARGET_COMPONENT 31
+#define MAVLINK_OFFSET_COMMAND_INT_FRAME 32
+#define MAVLINK_OFFSET_COMMAND_INT_COMMAND 28
+#define MAVLINK_OFFSET_COMMAND_INT_CURRENT 33
+#define MAVLINK_OFFSET_COMMAND_INT_AUTOCONTINUE 34
+#define MAVLINK_OFFSET_COMMAND_INT_PARAM1 0
+#define MAVLINK_OFFSET_COMMAND_INT_PARAM2 4
+#define MAVLINK_OFFSET_COMMAND_INT_PARAM3 8
+#define MAVLINK_OFFSET_COMMAND_INT_PARAM4 12
+#define MAVLINK_OFFSET_COMMAND_INT_X 16
+#define MAVLINK_OFFSET_COMMAND_INT_Y 20
+#define MAVLINK_OFFSET_COMMAND_INT_Z 24
+#define MAVLINK_OFFSET_COMMAND_LONG_TARGET_SYSTEM 30
+#define MAVLINK_OFFSET_COMMAND_LONG_TARGET_COMPONENT 31
+#define MAVLINK_OFFSET_COMMAND_LONG_COMMAND 28
+#define MAVLINK_OFFSET_COMMAND_LONG_CONFIRMATION 32
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM1 0
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM2 4
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM3 8
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM4 12
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM5 16
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM6 20
+#define MAVLINK_OFFSET_COMMAND_LONG_PARAM7 24
+#define MAVLINK_OFFSET_COMMAND_ACK_COMMAND 0
+#define MAVLINK_OFFSET_COMMAND_ACK_RESULT 2
+#define MAVLINK_OFFSET_COMMAND_ACK_PROGRESS 3
+#define MAVLINK_OFFSET_COMMAND_ACK_RESULT_PARAM2 4
+#define MAVLINK_OFFSET_COMMAND_ACK_TARGET_SYSTEM 8
+#define MAVLINK_OFFSET_COMMAND_ACK_TARGET_COMPONENT 9
+#define MAVLINK_OFFSET_COMMAND_CANCEL_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_COMMAND_CANCEL_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_COMMAND_CANCEL_COMMAND 0
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_ROLL 4
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_PITCH 8
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_YAW 12
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_THRUST 16
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_MODE_SWITCH 20
+#define MAVLINK_OFFSET_MANUAL_SETPOINT_MANUAL_OVERRIDE_SWITCH 21
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_TARGET_SYSTEM 36
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_TARGET_COMPONENT 37
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_TYPE_MASK 38
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_Q 4
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_BODY_ROLL_RATE 20
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_BODY_PITCH_RATE 24
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_BODY_YAW_RATE 28
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_THRUST 32
+#define MAVLINK_OFFSET_SET_ATTITUDE_TARGET_THRUST_BODY 39
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_TYPE_MASK 36
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_Q 4
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_BODY_ROLL_RATE 20
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_BODY_PITCH_RATE 24
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_BODY_YAW_RATE 28
+#define MAVLINK_OFFSET_ATTITUDE_TARGET_THRUST 32
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_TARGET_SYSTEM 50
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_TARGET_COMPONENT 51
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_COORDINATE_FRAME 52
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_TYPE_MASK 48
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_X 4
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_Y 8
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_Z 12
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_VX 16
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_VY 20
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_VZ 24
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_AFX 28
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_AFY 32
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_AFZ 36
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_YAW 40
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_LOCAL_NED_YAW_RATE 44
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_COORDINATE_FRAME 50
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_TYPE_MASK 48
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_X 4
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_Y 8
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_Z 12
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_VX 16
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_VY 20
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_VZ 24
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_AFX 28
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_AFY 32
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_AFZ 36
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_YAW 40
+#define MAVLINK_OFFSET_POSITION_TARGET_LOCAL_NED_YAW_RATE 44
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_TARGET_SYSTEM 50
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_TARGET_COMPONENT 51
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_COORDINATE_FRAME 52
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_TYPE_MASK 48
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_LAT_INT 4
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_LON_INT 8
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_ALT 12
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_VX 16
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_VY 20
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_VZ 24
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_AFX 28
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_AFY 32
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_AFZ 36
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_YAW 40
+#define MAVLINK_OFFSET_SET_POSITION_TARGET_GLOBAL_INT_YAW_RATE 44
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_COORDINATE_FRAME 50
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_TYPE_MASK 48
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_LAT_INT 4
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_LON_INT 8
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_ALT 12
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_VX 16
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_VY 20
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_VZ 24
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_AFX 28
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_AFY 32
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_AFZ 36
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_YAW 40
+#define MAVLINK_OFFSET_POSITION_TARGET_GLOBAL_INT_YAW_RATE 44
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_X 4
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_Y 8
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_Z 12
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_ROLL 16
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_PITCH 20
+#define MAVLINK_OFFSET_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET_YAW 24
+#define MAVLINK_OFFSET_HIL_STATE_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_STATE_ROLL 8
+#define MAVLINK_OFFSET_HIL_STATE_PITCH 12
+#define MAVLINK_OFFSET_HIL_STATE_YAW 16
+#define MAVLINK_OFFSET_HIL_STATE_ROLLSPEED 20
+#define MAVLINK_OFFSET_HIL_STATE_PITCHSPEED 24
+#define MAVLINK_OFFSET_HIL_STATE_YAWSPEED 28
+#define MAVLINK_OFFSET_HIL_STATE_LAT 32
+#define MAVLINK_OFFSET_HIL_STATE_LON 36
+#define MAVLINK_OFFSET_HIL_STATE_ALT 40
+#define MAVLINK_OFFSET_HIL_STATE_VX 44
+#define MAVLINK_OFFSET_HIL_STATE_VY 46
+#define MAVLINK_OFFSET_HIL_STATE_VZ 48
+#define MAVLINK_OFFSET_HIL_STATE_XACC 50
+#define MAVLINK_OFFSET_HIL_STATE_YACC 52
+#define MAVLINK_OFFSET_HIL_STATE_ZACC 54
+#define MAVLINK_OFFSET_HIL_CONTROLS_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_CONTROLS_ROLL_AILERONS 8
+#define MAVLINK_OFFSET_HIL_CONTROLS_PITCH_ELEVATOR 12
+#define MAVLINK_OFFSET_HIL_CONTROLS_YAW_RUDDER 16
+#define MAVLINK_OFFSET_HIL_CONTROLS_THROTTLE 20
+#define MAVLINK_OFFSET_HIL_CONTROLS_AUX1 24
+#define MAVLINK_OFFSET_HIL_CONTROLS_AUX2 28
+#define MAVLINK_OFFSET_HIL_CONTROLS_AUX3 32
+#define MAVLINK_OFFSET_HIL_CONTROLS_AUX4 36
+#define MAVLINK_OFFSET_HIL_CONTROLS_MODE 40
+#define MAVLINK_OFFSET_HIL_CONTROLS_NAV_MODE 41
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN1_RAW 8
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN2_RAW 10
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN3_RAW 12
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN4_RAW 14
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN5_RAW 16
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN6_RAW 18
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN7_RAW 20
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN8_RAW 22
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN9_RAW 24
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN10_RAW 26
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN11_RAW 28
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_CHAN12_RAW 30
+#define MAVLINK_OFFSET_HIL_RC_INPUTS_RAW_RSSI 32
+#define MAVLINK_OFFSET_HIL_ACTUATOR_CONTROLS_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_ACTUATOR_CONTROLS_CONTROLS 16
+#define MAVLINK_OFFSET_HIL_ACTUATOR_CONTROLS_MODE 80
+#define MAVLINK_OFFSET_HIL_ACTUATOR_CONTROLS_FLAGS 8
+#define MAVLINK_OFFSET_OPTICAL_FLOW_TIME_USEC 0
+#define MAVLINK_OFFSET_OPTICAL_FLOW_SENSOR_ID 24
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_X 20
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_Y 22
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_COMP_M_X 8
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_COMP_M_Y 12
+#define MAVLINK_OFFSET_OPTICAL_FLOW_QUALITY 25
+#define MAVLINK_OFFSET_OPTICAL_FLOW_GROUND_DISTANCE 16
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_RATE_X 26
+#define MAVLINK_OFFSET_OPTICAL_FLOW_FLOW_RATE_Y 30
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_USEC 0
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_X 8
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_Y 12
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_Z 16
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_ROLL 20
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_PITCH 24
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_YAW 28
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_COVARIANCE 32
+#define MAVLINK_OFFSET_GLOBAL_VISION_POSITION_ESTIMATE_RESET_COUNTER 116
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_USEC 0
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_X 8
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_Y 12
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_Z 16
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_ROLL 20
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_PITCH 24
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_YAW 28
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_COVARIANCE 32
+#define MAVLINK_OFFSET_VISION_POSITION_ESTIMATE_RESET_COUNTER 116
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_USEC 0
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_X 8
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_Y 12
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_Z 16
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_COVARIANCE 20
+#define MAVLINK_OFFSET_VISION_SPEED_ESTIMATE_RESET_COUNTER 56
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_USEC 0
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_X 8
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_Y 12
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_Z 16
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_ROLL 20
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_PITCH 24
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_YAW 28
+#define MAVLINK_OFFSET_VICON_POSITION_ESTIMATE_COVARIANCE 32
+#define MAVLINK_OFFSET_HIGHRES_IMU_TIME_USEC 0
+#define MAVLINK_OFFSET_HIGHRES_IMU_XACC 8
+#define MAVLINK_OFFSET_HIGHRES_IMU_YACC 12
+#define MAVLINK_OFFSET_HIGHRES_IMU_ZACC 16
+#define MAVLINK_OFFSET_HIGHRES_IMU_XGYRO 20
+#define MAVLINK_OFFSET_HIGHRES_IMU_YGYRO 24
+#define MAVLINK_OFFSET_HIGHRES_IMU_ZGYRO 28
+#define MAVLINK_OFFSET_HIGHRES_IMU_XMAG 32
+#define MAVLINK_OFFSET_HIGHRES_IMU_YMAG 36
+#define MAVLINK_OFFSET_HIGHRES_IMU_ZMAG 40
+#define MAVLINK_OFFSET_HIGHRES_IMU_ABS_PRESSURE 44
+#define MAVLINK_OFFSET_HIGHRES_IMU_DIFF_PRESSURE 48
+#define MAVLINK_OFFSET_HIGHRES_IMU_PRESSURE_ALT 52
+#define MAVLINK_OFFSET_HIGHRES_IMU_TEMPERATURE 56
+#define MAVLINK_OFFSET_HIGHRES_IMU_FIELDS_UPDATED 60
+#define MAVLINK_OFFSET_HIGHRES_IMU_ID 62
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_TIME_USEC 0
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_SENSOR_ID 42
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATION_TIME_US 8
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATED_X 12
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATED_Y 16
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATED_XGYRO 20
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATED_YGYRO 24
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_INTEGRATED_ZGYRO 28
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_TEMPERATURE 40
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_QUALITY 43
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_TIME_DELTA_DISTANCE_US 32
+#define MAVLINK_OFFSET_OPTICAL_FLOW_RAD_DISTANCE 36
+#define MAVLINK_OFFSET_HIL_SENSOR_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_SENSOR_XACC 8
+#define MAVLINK_OFFSET_HIL_SENSOR_YACC 12
+#define MAVLINK_OFFSET_HIL_SENSOR_ZACC 16
+#define MAVLINK_OFFSET_HIL_SENSOR_XGYRO 20
+#define MAVLINK_OFFSET_HIL_SENSOR_YGYRO 24
+#define MAVLINK_OFFSET_HIL_SENSOR_ZGYRO 28
+#define MAVLINK_OFFSET_HIL_SENSOR_XMAG 32
+#define MAVLINK_OFFSET_HIL_SENSOR_YMAG 36
+#define MAVLINK_OFFSET_HIL_SENSOR_ZMAG 40
+#define MAVLINK_OFFSET_HIL_SENSOR_ABS_PRESSURE 44
+#define MAVLINK_OFFSET_HIL_SENSOR_DIFF_PRESSURE 48
+#define MAVLINK_OFFSET_HIL_SENSOR_PRESSURE_ALT 52
+#define MAVLINK_OFFSET_HIL_SENSOR_TEMPERATURE 56
+#define MAVLINK_OFFSET_HIL_SENSOR_FIELDS_UPDATED 60
+#define MAVLINK_OFFSET_HIL_SENSOR_ID 64
+#define MAVLINK_OFFSET_SIM_STATE_Q1 0
+#define MAVLINK_OFFSET_SIM_STATE_Q2 4
+#define MAVLINK_OFFSET_SIM_STATE_Q3 8
+#define MAVLINK_OFFSET_SIM_STATE_Q4 12
+#define MAVLINK_OFFSET_SIM_STATE_ROLL 16
+#define MAVLINK_OFFSET_SIM_STATE_PITCH 20
+#define MAVLINK_OFFSET_SIM_STATE_YAW 24
+#define MAVLINK_OFFSET_SIM_STATE_XACC 28
+#define MAVLINK_OFFSET_SIM_STATE_YACC 32
+#define MAVLINK_OFFSET_SIM_STATE_ZACC 36
+#define MAVLINK_OFFSET_SIM_STATE_XGYRO 40
+#define MAVLINK_OFFSET_SIM_STATE_YGYRO 44
+#define MAVLINK_OFFSET_SIM_STATE_ZGYRO 48
+#define MAVLINK_OFFSET_SIM_STATE_LAT 52
+#define MAVLINK_OFFSET_SIM_STATE_LON 56
+#define MAVLINK_OFFSET_SIM_STATE_ALT 60
+#define MAVLINK_OFFSET_SIM_STATE_STD_DEV_HORZ 64
+#define MAVLINK_OFFSET_SIM_STATE_STD_DEV_VERT 68
+#define MAVLINK_OFFSET_SIM_STATE_VN 72
+#define MAVLINK_OFFSET_SIM_STATE_VE 76
+#define MAVLINK_OFFSET_SIM_STATE_VD 80
+#define MAVLINK_OFFSET_SIM_STATE_LAT_INT 84
+#define MAVLINK_OFFSET_SIM_STATE_LON_INT 88
+#define MAVLINK_OFFSET_RADIO_STATUS_RSSI 4
+#define MAVLINK_OFFSET_RADIO_STATUS_REMRSSI 5
+#define MAVLINK_OFFSET_RADIO_STATUS_TXBUF 6
+#define MAVLINK_OFFSET_RADIO_STATUS_NOISE 7
+#define MAVLINK_OFFSET_RADIO_STATUS_REMNOISE 8
+#define MAVLINK_OFFSET_RADIO_STATUS_RXERRORS 0
+#define MAVLINK_OFFSET_RADIO_STATUS_FIXED 2
+#define MAVLINK_OFFSET_FILE_TRANSFER_PROTOCOL_TARGET_NETWORK 0
+#define MAVLINK_OFFSET_FILE_TRANSFER_PROTOCOL_TARGET_SYSTEM 1
+#define MAVLINK_OFFSET_FILE_TRANSFER_PROTOCOL_TARGET_COMPONENT 2
+#define MAVLINK_OFFSET_FILE_TRANSFER_PROTOCOL_PAYLOAD 3
+#define MAVLINK_OFFSET_TIMESYNC_TC1 0
+#define MAVLINK_OFFSET_TIMESYNC_TS1 8
+#define MAVLINK_OFFSET_TIMESYNC_TARGET_SYSTEM 16
+#define MAVLINK_OFFSET_TIMESYNC_TARGET_COMPONENT 17
+#define MAVLINK_OFFSET_CAMERA_TRIGGER_TIME_USEC 0
+#define MAVLINK_OFFSET_CAMERA_TRIGGER_SEQ 8
+#define MAVLINK_OFFSET_HIL_GPS_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_GPS_FIX_TYPE 34
+#define MAVLINK_OFFSET_HIL_GPS_LAT 8
+#define MAVLINK_OFFSET_HIL_GPS_LON 12
+#define MAVLINK_OFFSET_HIL_GPS_ALT 16
+#define MAVLINK_OFFSET_HIL_GPS_EPH 20
+#define MAVLINK_OFFSET_HIL_GPS_EPV 22
+#define MAVLINK_OFFSET_HIL_GPS_VEL 24
+#define MAVLINK_OFFSET_HIL_GPS_VN 26
+#define MAVLINK_OFFSET_HIL_GPS_VE 28
+#define MAVLINK_OFFSET_HIL_GPS_VD 30
+#define MAVLINK_OFFSET_HIL_GPS_COG 32
+#define MAVLINK_OFFSET_HIL_GPS_SATELLITES_VISIBLE 35
+#define MAVLINK_OFFSET_HIL_GPS_ID 36
+#define MAVLINK_OFFSET_HIL_GPS_YAW 37
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_SENSOR_ID 42
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATION_TIME_US 8
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATED_X 12
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATED_Y 16
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATED_XGYRO 20
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATED_YGYRO 24
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_INTEGRATED_ZGYRO 28
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_TEMPERATURE 40
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_QUALITY 43
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_TIME_DELTA_DISTANCE_US 32
+#define MAVLINK_OFFSET_HIL_OPTICAL_FLOW_DISTANCE 36
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_TIME_USEC 0
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_ATTITUDE_QUATERNION 8
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_ROLLSPEED 24
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_PITCHSPEED 28
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_YAWSPEED 32
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_LAT 36
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_LON 40
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_ALT 44
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_VX 48
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_VY 50
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_VZ 52
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_IND_AIRSPEED 54
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_TRUE_AIRSPEED 56
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_XACC 58
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_YACC 60
+#define MAVLINK_OFFSET_HIL_STATE_QUATERNION_ZACC 62
+#define MAVLINK_OFFSET_SCALED_IMU2_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_IMU2_XACC 4
+#define MAVLINK_OFFSET_SCALED_IMU2_YACC 6
+#define MAVLINK_OFFSET_SCALED_IMU2_ZACC 8
+#define MAVLINK_OFFSET_SCALED_IMU2_XGYRO 10
+#define MAVLINK_OFFSET_SCALED_IMU2_YGYRO 12
+#define MAVLINK_OFFSET_SCALED_IMU2_ZGYRO 14
+#define MAVLINK_OFFSET_SCALED_IMU2_XMAG 16
+#define MAVLINK_OFFSET_SCALED_IMU2_YMAG 18
+#define MAVLINK_OFFSET_SCALED_IMU2_ZMAG 20
+#define MAVLINK_OFFSET_SCALED_IMU2_TEMPERATURE 22
+#define MAVLINK_OFFSET_LOG_REQUEST_LIST_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_LOG_REQUEST_LIST_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_LOG_REQUEST_LIST_START 0
+#define MAVLINK_OFFSET_LOG_REQUEST_LIST_END 2
+#define MAVLINK_OFFSET_LOG_ENTRY_ID 8
+#define MAVLINK_OFFSET_LOG_ENTRY_NUM_LOGS 10
+#define MAVLINK_OFFSET_LOG_ENTRY_LAST_LOG_NUM 12
+#define MAVLINK_OFFSET_LOG_ENTRY_TIME_UTC 0
+#define MAVLINK_OFFSET_LOG_ENTRY_SIZE 4
+#define MAVLINK_OFFSET_LOG_REQUEST_DATA_TARGET_SYSTEM 10
+#define MAVLINK_OFFSET_LOG_REQUEST_DATA_TARGET_COMPONENT 11
+#define MAVLINK_OFFSET_LOG_REQUEST_DATA_ID 8
+#define MAVLINK_OFFSET_LOG_REQUEST_DATA_OFS 0
+#define MAVLINK_OFFSET_LOG_REQUEST_DATA_COUNT 4
+#define MAVLINK_OFFSET_LOG_DATA_ID 4
+#define MAVLINK_OFFSET_LOG_DATA_OFS 0
+#define MAVLINK_OFFSET_LOG_DATA_COUNT 6
+#define MAVLINK_OFFSET_LOG_DATA_DATA 7
+#define MAVLINK_OFFSET_LOG_ERASE_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_LOG_ERASE_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_LOG_REQUEST_END_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_LOG_REQUEST_END_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_GPS_INJECT_DATA_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_GPS_INJECT_DATA_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_GPS_INJECT_DATA_LEN 2
+#define MAVLINK_OFFSET_GPS_INJECT_DATA_DATA 3
+#define MAVLINK_OFFSET_GPS2_RAW_TIME_USEC 0
+#define MAVLINK_OFFSET_GPS2_RAW_FIX_TYPE 32
+#define MAVLINK_OFFSET_GPS2_RAW_LAT 8
+#define MAVLINK_OFFSET_GPS2_RAW_LON 12
+#define MAVLINK_OFFSET_GPS2_RAW_ALT 16
+#define MAVLINK_OFFSET_GPS2_RAW_EPH 24
+#define MAVLINK_OFFSET_GPS2_RAW_EPV 26
+#define MAVLINK_OFFSET_GPS2_RAW_VEL 28
+#define MAVLINK_OFFSET_GPS2_RAW_COG 30
+#define MAVLINK_OFFSET_GPS2_RAW_SATELLITES_VISIBLE 33
+#define MAVLINK_OFFSET_GPS2_RAW_DGPS_NUMCH 34
+#define MAVLINK_OFFSET_GPS2_RAW_DGPS_AGE 20
+#define MAVLINK_OFFSET_GPS2_RAW_YAW 35
+#define MAVLINK_OFFSET_GPS2_RAW_ALT_ELLIPSOID 37
+#define MAVLINK_OFFSET_GPS2_RAW_H_ACC 41
+#define MAVLINK_OFFSET_GPS2_RAW_V_ACC 45
+#define MAVLINK_OFFSET_GPS2_RAW_VEL_ACC 49
+#define MAVLINK_OFFSET_GPS2_RAW_HDG_ACC 53
+#define MAVLINK_OFFSET_POWER_STATUS_VCC 0
+#define MAVLINK_OFFSET_POWER_STATUS_VSERVO 2
+#define MAVLINK_OFFSET_POWER_STATUS_FLAGS 4
+#define MAVLINK_OFFSET_SERIAL_CONTROL_DEVICE 6
+#define MAVLINK_OFFSET_SERIAL_CONTROL_FLAGS 7
+#define MAVLINK_OFFSET_SERIAL_CONTROL_TIMEOUT 4
+#define MAVLINK_OFFSET_SERIAL_CONTROL_BAUDRATE 0
+#define MAVLINK_OFFSET_SERIAL_CONTROL_COUNT 8
+#define MAVLINK_OFFSET_SERIAL_CONTROL_DATA 9
+#define MAVLINK_OFFSET_SERIAL_CONTROL_TARGET_SYSTEM 79
+#define MAVLINK_OFFSET_SERIAL_CONTROL_TARGET_COMPONENT 80
+#define MAVLINK_OFFSET_GPS_RTK_TIME_LAST_BASELINE_MS 0
+#define MAVLINK_OFFSET_GPS_RTK_RTK_RECEIVER_ID 30
+#define MAVLINK_OFFSET_GPS_RTK_WN 28
+#define MAVLINK_OFFSET_GPS_RTK_TOW 4
+#define MAVLINK_OFFSET_GPS_RTK_RTK_HEALTH 31
+#define MAVLINK_OFFSET_GPS_RTK_RTK_RATE 32
+#define MAVLINK_OFFSET_GPS_RTK_NSATS 33
+#define MAVLINK_OFFSET_GPS_RTK_BASELINE_COORDS_TYPE 34
+#define MAVLINK_OFFSET_GPS_RTK_BASELINE_A_MM 8
+#define MAVLINK_OFFSET_GPS_RTK_BASELINE_B_MM 12
+#define MAVLINK_OFFSET_GPS_RTK_BASELINE_C_MM 16
+#define MAVLINK_OFFSET_GPS_RTK_ACCURACY 20
+#define MAVLINK_OFFSET_GPS_RTK_IAR_NUM_HYPOTHESES 24
+#define MAVLINK_OFFSET_GPS2_RTK_TIME_LAST_BASELINE_MS 0
+#define MAVLINK_OFFSET_GPS2_RTK_RTK_RECEIVER_ID 30
+#define MAVLINK_OFFSET_GPS2_RTK_WN 28
+#define MAVLINK_OFFSET_GPS2_RTK_TOW 4
+#define MAVLINK_OFFSET_GPS2_RTK_RTK_HEALTH 31
+#define MAVLINK_OFFSET_GPS2_RTK_RTK_RATE 32
+#define MAVLINK_OFFSET_GPS2_RTK_NSATS 33
+#define MAVLINK_OFFSET_GPS2_RTK_BASELINE_COORDS_TYPE 34
+#define MAVLINK_OFFSET_GPS2_RTK_BASELINE_A_MM 8
+#define MAVLINK_OFFSET_GPS2_RTK_BASELINE_B_MM 12
+#define MAVLINK_OFFSET_GPS2_RTK_BASELINE_C_MM 16
+#define MAVLINK_OFFSET_GPS2_RTK_ACCURACY 20
+#define MAVLINK_OFFSET_GPS2_RTK_IAR_NUM_HYPOTHESES 24
+#define MAVLINK_OFFSET_SCALED_IMU3_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_IMU3_XACC 4
+#define MAVLINK_OFFSET_SCALED_IMU3_YACC 6
+#define MAVLINK_OFFSET_SCALED_IMU3_ZACC 8
+#define MAVLINK_OFFSET_SCALED_IMU3_XGYRO 10
+#define MAVLINK_OFFSET_SCALED_IMU3_YGYRO 12
+#define MAVLINK_OFFSET_SCALED_IMU3_ZGYRO 14
+#define MAVLINK_OFFSET_SCALED_IMU3_XMAG 16
+#define MAVLINK_OFFSET_SCALED_IMU3_YMAG 18
+#define MAVLINK_OFFSET_SCALED_IMU3_ZMAG 20
+#define MAVLINK_OFFSET_SCALED_IMU3_TEMPERATURE 22
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_TYPE 10
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_SIZE 0
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_WIDTH 4
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_HEIGHT 6
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_PACKETS 8
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_PAYLOAD 11
+#define MAVLINK_OFFSET_DATA_TRANSMISSION_HANDSHAKE_JPG_QUALITY 12
+#define MAVLINK_OFFSET_ENCAPSULATED_DATA_SEQNR 0
+#define MAVLINK_OFFSET_ENCAPSULATED_DATA_DATA 2
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_MIN_DISTANCE 4
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_MAX_DISTANCE 6
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_CURRENT_DISTANCE 8
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_TYPE 10
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_ID 11
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_ORIENTATION 12
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_COVARIANCE 13
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_HORIZONTAL_FOV 14
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_VERTICAL_FOV 18
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_QUATERNION 22
+#define MAVLINK_OFFSET_DISTANCE_SENSOR_SIGNAL_QUALITY 38
+#define MAVLINK_OFFSET_TERRAIN_REQUEST_LAT 8
+#define MAVLINK_OFFSET_TERRAIN_REQUEST_LON 12
+#define MAVLINK_OFFSET_TERRAIN_REQUEST_GRID_SPACING 16
+#define MAVLINK_OFFSET_TERRAIN_REQUEST_MASK 0
+#define MAVLINK_OFFSET_TERRAIN_DATA_LAT 0
+#define MAVLINK_OFFSET_TERRAIN_DATA_LON 4
+#define MAVLINK_OFFSET_TERRAIN_DATA_GRID_SPACING 8
+#define MAVLINK_OFFSET_TERRAIN_DATA_GRIDBIT 42
+#define MAVLINK_OFFSET_TERRAIN_DATA_DATA 10
+#define MAVLINK_OFFSET_TERRAIN_CHECK_LAT 0
+#define MAVLINK_OFFSET_TERRAIN_CHECK_LON 4
+#define MAVLINK_OFFSET_TERRAIN_REPORT_LAT 0
+#define MAVLINK_OFFSET_TERRAIN_REPORT_LON 4
+#define MAVLINK_OFFSET_TERRAIN_REPORT_SPACING 16
+#define MAVLINK_OFFSET_TERRAIN_REPORT_TERRAIN_HEIGHT 8
+#define MAVLINK_OFFSET_TERRAIN_REPORT_CURRENT_HEIGHT 12
+#define MAVLINK_OFFSET_TERRAIN_REPORT_PENDING 18
+#define MAVLINK_OFFSET_TERRAIN_REPORT_LOADED 20
+#define MAVLINK_OFFSET_SCALED_PRESSURE2_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_PRESSURE2_PRESS_ABS 4
+#define MAVLINK_OFFSET_SCALED_PRESSURE2_PRESS_DIFF 8
+#define MAVLINK_OFFSET_SCALED_PRESSURE2_TEMPERATURE 12
+#define MAVLINK_OFFSET_SCALED_PRESSURE2_TEMPERATURE_PRESS_DIFF 14
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_TIME_USEC 0
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_Q 8
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_X 24
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_Y 28
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_Z 32
+#define MAVLINK_OFFSET_ATT_POS_MOCAP_COVARIANCE 36
+#define MAVLINK_OFFSET_SET_ACTUATOR_CONTROL_TARGET_TIME_USEC 0
+#define MAVLINK_OFFSET_SET_ACTUATOR_CONTROL_TARGET_GROUP_MLX 40
+#define MAVLINK_OFFSET_SET_ACTUATOR_CONTROL_TARGET_TARGET_SYSTEM 41
+#define MAVLINK_OFFSET_SET_ACTUATOR_CONTROL_TARGET_TARGET_COMPONENT 42
+#define MAVLINK_OFFSET_SET_ACTUATOR_CONTROL_TARGET_CONTROLS 8
+#define MAVLINK_OFFSET_ACTUATOR_CONTROL_TARGET_TIME_USEC 0
+#define MAVLINK_OFFSET_ACTUATOR_CONTROL_TARGET_GROUP_MLX 40
+#define MAVLINK_OFFSET_ACTUATOR_CONTROL_TARGET_CONTROLS 8
+#define MAVLINK_OFFSET_ALTITUDE_TIME_USEC 0
+#define MAVLINK_OFFSET_ALTITUDE_ALTITUDE_MONOTONIC 8
+#define MAVLINK_OFFSET_ALTITUDE_ALTITUDE_AMSL 12
+#define MAVLINK_OFFSET_ALTITUDE_ALTITUDE_LOCAL 16
+#define MAVLINK_OFFSET_ALTITUDE_ALTITUDE_RELATIVE 20
+#define MAVLINK_OFFSET_ALTITUDE_ALTITUDE_TERRAIN 24
+#define MAVLINK_OFFSET_ALTITUDE_BOTTOM_CLEARANCE 28
+#define MAVLINK_OFFSET_RESOURCE_REQUEST_REQUEST_ID 0
+#define MAVLINK_OFFSET_RESOURCE_REQUEST_URI_TYPE 1
+#define MAVLINK_OFFSET_RESOURCE_REQUEST_URI 2
+#define MAVLINK_OFFSET_RESOURCE_REQUEST_TRANSFER_TYPE 122
+#define MAVLINK_OFFSET_RESOURCE_REQUEST_STORAGE 123
+#define MAVLINK_OFFSET_SCALED_PRESSURE3_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_SCALED_PRESSURE3_PRESS_ABS 4
+#define MAVLINK_OFFSET_SCALED_PRESSURE3_PRESS_DIFF 8
+#define MAVLINK_OFFSET_SCALED_PRESSURE3_TEMPERATURE 12
+#define MAVLINK_OFFSET_SCALED_PRESSURE3_TEMPERATURE_PRESS_DIFF 14
+#define MAVLINK_OFFSET_FOLLOW_TARGET_TIMESTAMP 0
+#define MAVLINK_OFFSET_FOLLOW_TARGET_EST_CAPABILITIES 92
+#define MAVLINK_OFFSET_FOLLOW_TARGET_LAT 16
+#define MAVLINK_OFFSET_FOLLOW_TARGET_LON 20
+#define MAVLINK_OFFSET_FOLLOW_TARGET_ALT 24
+#define MAVLINK_OFFSET_FOLLOW_TARGET_VEL 28
+#define MAVLINK_OFFSET_FOLLOW_TARGET_ACC 40
+#define MAVLINK_OFFSET_FOLLOW_TARGET_ATTITUDE_Q 52
+#define MAVLINK_OFFSET_FOLLOW_TARGET_RATES 68
+#define MAVLINK_OFFSET_FOLLOW_TARGET_POSITION_COV 80
+#define MAVLINK_OFFSET_FOLLOW_TARGET_CUSTOM_STATE 8
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_TIME_USEC 0
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_X_ACC 8
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Y_ACC 12
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Z_ACC 16
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_X_VEL 20
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Y_VEL 24
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Z_VEL 28
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_X_POS 32
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Y_POS 36
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Z_POS 40
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_AIRSPEED 44
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_VEL_VARIANCE 48
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_POS_VARIANCE 60
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_Q 72
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_ROLL_RATE 88
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_PITCH_RATE 92
+#define MAVLINK_OFFSET_CONTROL_SYSTEM_STATE_YAW_RATE 96
+#define MAVLINK_OFFSET_BATTERY_STATUS_ID 32
+#define MAVLINK_OFFSET_BATTERY_STATUS_BATTERY_FUNCTION 33
+#define MAVLINK_OFFSET_BATTERY_STATUS_TYPE 34
+#define MAVLINK_OFFSET_BATTERY_STATUS_TEMPERATURE 8
+#define MAVLINK_OFFSET_BATTERY_STATUS_VOLTAGES 10
+#define MAVLINK_OFFSET_BATTERY_STATUS_CURRENT_BATTERY 30
+#define MAVLINK_OFFSET_BATTERY_STATUS_CURRENT_CONSUMED 0
+#define MAVLINK_OFFSET_BATTERY_STATUS_ENERGY_CONSUMED 4
+#define MAVLINK_OFFSET_BATTERY_STATUS_BATTERY_REMAINING 35
+#define MAVLINK_OFFSET_BATTERY_STATUS_TIME_REMAINING 36
+#define MAVLINK_OFFSET_BATTERY_STATUS_CHARGE_STATE 40
+#define MAVLINK_OFFSET_BATTERY_STATUS_VOLTAGES_EXT 41
+#define MAVLINK_OFFSET_BATTERY_STATUS_MODE 49
+#define MAVLINK_OFFSET_BATTERY_STATUS_FAULT_BITMASK 50
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_CAPABILITIES 0
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_FLIGHT_SW_VERSION 16
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_MIDDLEWARE_SW_VERSION 20
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_OS_SW_VERSION 24
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_BOARD_VERSION 28
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_FLIGHT_CUSTOM_VERSION 36
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_MIDDLEWARE_CUSTOM_VERSION 44
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_OS_CUSTOM_VERSION 52
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_VENDOR_ID 32
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_PRODUCT_ID 34
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_UID 8
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_UID2 60
+#define MAVLINK_OFFSET_LANDING_TARGET_TIME_USEC 0
+#define MAVLINK_OFFSET_LANDING_TARGET_TARGET_NUM 28
+#define MAVLINK_OFFSET_LANDING_TARGET_FRAME 29
+#define MAVLINK_OFFSET_LANDING_TARGET_ANGLE_X 8
+#define MAVLINK_OFFSET_LANDING_TARGET_ANGLE_Y 12
+#define MAVLINK_OFFSET_LANDING_TARGET_DISTANCE 16
+#define MAVLINK_OFFSET_LANDING_TARGET_SIZE_X 20
+#define MAVLINK_OFFSET_LANDING_TARGET_SIZE_Y 24
+#define MAVLINK_OFFSET_LANDING_TARGET_X 30
+#define MAVLINK_OFFSET_LANDING_TARGET_Y 34
+#define MAVLINK_OFFSET_LANDING_TARGET_Z 38
+#define MAVLINK_OFFSET_LANDING_TARGET_Q 42
+#define MAVLINK_OFFSET_LANDING_TARGET_TYPE 58
+#define MAVLINK_OFFSET_LANDING_TARGET_POSITION_VALID 59
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_MAG_OFS_X 36
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_MAG_OFS_Y 38
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_MAG_OFS_Z 40
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_MAG_DECLINATION 0
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_RAW_PRESS 4
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_RAW_TEMP 8
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_GYRO_CAL_X 12
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_GYRO_CAL_Y 16
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_GYRO_CAL_Z 20
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_ACCEL_CAL_X 24
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_ACCEL_CAL_Y 28
+#define MAVLINK_OFFSET_SENSOR_OFFSETS_ACCEL_CAL_Z 32
+#define MAVLINK_OFFSET_SET_MAG_OFFSETS_TARGET_SYSTEM 6
+#define MAVLINK_OFFSET_SET_MAG_OFFSETS_TARGET_COMPONENT 7
+#define MAVLINK_OFFSET_SET_MAG_OFFSETS_MAG_OFS_X 0
+#define MAVLINK_OFFSET_SET_MAG_OFFSETS_MAG_OFS_Y 2
+#define MAVLINK_OFFSET_SET_MAG_OFFSETS_MAG_OFS_Z 4
+#define MAVLINK_OFFSET_MEMINFO_BRKVAL 0
+#define MAVLINK_OFFSET_MEMINFO_FREEMEM 2
+#define MAVLINK_OFFSET_MEMINFO_FREEMEM32 4
+#define MAVLINK_OFFSET_AP_ADC_ADC1 0
+#define MAVLINK_OFFSET_AP_ADC_ADC2 2
+#define MAVLINK_OFFSET_AP_ADC_ADC3 4
+#define MAVLINK_OFFSET_AP_ADC_ADC4 6
+#define MAVLINK_OFFSET_AP_ADC_ADC5 8
+#define MAVLINK_OFFSET_AP_ADC_ADC6 10
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_TARGET_SYSTEM 6
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_TARGET_COMPONENT 7
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_MODE 8
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_SHUTTER_SPEED 4
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_APERTURE 9
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_ISO 10
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_EXPOSURE_TYPE 11
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_COMMAND_ID 12
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_ENGINE_CUT_OFF 13
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_EXTRA_PARAM 14
+#define MAVLINK_OFFSET_DIGICAM_CONFIGURE_EXTRA_VALUE 0
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_SESSION 6
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_ZOOM_POS 7
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_ZOOM_STEP 8
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_FOCUS_LOCK 9
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_SHOT 10
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_COMMAND_ID 11
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_EXTRA_PARAM 12
+#define MAVLINK_OFFSET_DIGICAM_CONTROL_EXTRA_VALUE 0
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_MOUNT_MODE 2
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_STAB_ROLL 3
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_STAB_PITCH 4
+#define MAVLINK_OFFSET_MOUNT_CONFIGURE_STAB_YAW 5
+#define MAVLINK_OFFSET_MOUNT_CONTROL_TARGET_SYSTEM 12
+#define MAVLINK_OFFSET_MOUNT_CONTROL_TARGET_COMPONENT 13
+#define MAVLINK_OFFSET_MOUNT_CONTROL_INPUT_A 0
+#define MAVLINK_OFFSET_MOUNT_CONTROL_INPUT_B 4
+#define MAVLINK_OFFSET_MOUNT_CONTROL_INPUT_C 8
+#define MAVLINK_OFFSET_MOUNT_CONTROL_SAVE_POSITION 14
+#define MAVLINK_OFFSET_MOUNT_STATUS_TARGET_SYSTEM 12
+#define MAVLINK_OFFSET_MOUNT_STATUS_TARGET_COMPONENT 13
+#define MAVLINK_OFFSET_MOUNT_STATUS_POINTING_A 0
+#define MAVLINK_OFFSET_MOUNT_STATUS_POINTING_B 4
+#define MAVLINK_OFFSET_MOUNT_STATUS_POINTING_C 8
+#define MAVLINK_OFFSET_MOUNT_STATUS_MOUNT_MODE 14
+#define MAVLINK_OFFSET_FENCE_POINT_TARGET_SYSTEM 8
+#define MAVLINK_OFFSET_FENCE_POINT_TARGET_COMPONENT 9
+#define MAVLINK_OFFSET_FENCE_POINT_IDX 10
+#define MAVLINK_OFFSET_FENCE_POINT_COUNT 11
+#define MAVLINK_OFFSET_FENCE_POINT_LAT 0
+#define MAVLINK_OFFSET_FENCE_POINT_LNG 4
+#define MAVLINK_OFFSET_FENCE_FETCH_POINT_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_FENCE_FETCH_POINT_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_FENCE_FETCH_POINT_IDX 2
+#define MAVLINK_OFFSET_FENCE_STATUS_BREACH_STATUS 6
+#define MAVLINK_OFFSET_FENCE_STATUS_BREACH_COUNT 4
+#define MAVLINK_OFFSET_FENCE_STATUS_BREACH_TYPE 7
+#define MAVLINK_OFFSET_FENCE_STATUS_BREACH_TIME 0
+#define MAVLINK_OFFSET_FENCE_STATUS_BREACH_MITIGATION 8
+#define MAVLINK_OFFSET_AHRS_OMEGAIX 0
+#define MAVLINK_OFFSET_AHRS_OMEGAIY 4
+#define MAVLINK_OFFSET_AHRS_OMEGAIZ 8
+#define MAVLINK_OFFSET_AHRS_ACCEL_WEIGHT 12
+#define MAVLINK_OFFSET_AHRS_RENORM_VAL 16
+#define MAVLINK_OFFSET_AHRS_ERROR_RP 20
+#define MAVLINK_OFFSET_AHRS_ERROR_YAW 24
+#define MAVLINK_OFFSET_SIMSTATE_ROLL 0
+#define MAVLINK_OFFSET_SIMSTATE_PITCH 4
+#define MAVLINK_OFFSET_SIMSTATE_YAW 8
+#define MAVLINK_OFFSET_SIMSTATE_XACC 12
+#define MAVLINK_OFFSET_SIMSTATE_YACC 16
+#define MAVLINK_OFFSET_SIMSTATE_ZACC 20
+#define MAVLINK_OFFSET_SIMSTATE_XGYRO 24
+#define MAVLINK_OFFSET_SIMSTATE_YGYRO 28
+#define MAVLINK_OFFSET_SIMSTATE_ZGYRO 32
+#define MAVLINK_OFFSET_SIMSTATE_LAT 36
+#define MAVLINK_OFFSET_SIMSTATE_LNG 40
+#define MAVLINK_OFFSET_HWSTATUS_VCC 0
+#define MAVLINK_OFFSET_HWSTATUS_I2CERR 2
+#define MAVLINK_OFFSET_RADIO_RSSI 4
+#define MAVLINK_OFFSET_RADIO_REMRSSI 5
+#define MAVLINK_OFFSET_RADIO_TXBUF 6
+#define MAVLINK_OFFSET_RADIO_NOISE 7
+#define MAVLINK_OFFSET_RADIO_REMNOISE 8
+#define MAVLINK_OFFSET_RADIO_RXERRORS 0
+#define MAVLINK_OFFSET_RADIO_FIXED 2
+#define MAVLINK_OFFSET_LIMITS_STATUS_LIMITS_STATE 18
+#define MAVLINK_OFFSET_LIMITS_STATUS_LAST_TRIGGER 0
+#define MAVLINK_OFFSET_LIMITS_STATUS_LAST_ACTION 4
+#define MAVLINK_OFFSET_LIMITS_STATUS_LAST_RECOVERY 8
+#define MAVLINK_OFFSET_LIMITS_STATUS_LAST_CLEAR 12
+#define MAVLINK_OFFSET_LIMITS_STATUS_BREACH_COUNT 16
+#define MAVLINK_OFFSET_LIMITS_STATUS_MODS_ENABLED 19
+#define MAVLINK_OFFSET_LIMITS_STATUS_MODS_REQUIRED 20
+#define MAVLINK_OFFSET_LIMITS_STATUS_MODS_TRIGGERED 21
+#define MAVLINK_OFFSET_WIND_DIRECTION 0
+#define MAVLINK_OFFSET_WIND_SPEED 4
+#define MAVLINK_OFFSET_WIND_SPEED_Z 8
+#define MAVLINK_OFFSET_DATA16_TYPE 0
+#define MAVLINK_OFFSET_DATA16_LEN 1
+#define MAVLINK_OFFSET_DATA16_DATA 2
+#define MAVLINK_OFFSET_DATA32_TYPE 0
+#define MAVLINK_OFFSET_DATA32_LEN 1
+#define MAVLINK_OFFSET_DATA32_DATA 2
+#define MAVLINK_OFFSET_DATA64_TYPE 0
+#define MAVLINK_OFFSET_DATA64_LEN 1
+#define MAVLINK_OFFSET_DATA64_DATA 2
+#define MAVLINK_OFFSET_DATA96_TYPE 0
+#define MAVLINK_OFFSET_DATA96_LEN 1
+#define MAVLINK_OFFSET_DATA96_DATA 2
+#define MAVLINK_OFFSET_RANGEFINDER_DISTANCE 0
+#define MAVLINK_OFFSET_RANGEFINDER_VOLTAGE 4
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_VX 0
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_VY 4
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_VZ 8
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_DIFF_PRESSURE 12
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_EAS2TAS 16
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_RATIO 20
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_STATE_X 24
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_STATE_Y 28
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_STATE_Z 32
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_PAX 36
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_PBY 40
+#define MAVLINK_OFFSET_AIRSPEED_AUTOCAL_PCZ 44
+#define MAVLINK_OFFSET_RALLY_POINT_TARGET_SYSTEM 14
+#define MAVLINK_OFFSET_RALLY_POINT_TARGET_COMPONENT 15
+#define MAVLINK_OFFSET_RALLY_POINT_IDX 16
+#define MAVLINK_OFFSET_RALLY_POINT_COUNT 17
+#define MAVLINK_OFFSET_RALLY_POINT_LAT 0
+#define MAVLINK_OFFSET_RALLY_POINT_LNG 4
+#define MAVLINK_OFFSET_RALLY_POINT_ALT 8
+#define MAVLINK_OFFSET_RALLY_POINT_BREAK_ALT 10
+#define MAVLINK_OFFSET_RALLY_POINT_LAND_DIR 12
+#define MAVLINK_OFFSET_RALLY_POINT_FLAGS 18
+#define MAVLINK_OFFSET_RALLY_FETCH_POINT_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_RALLY_FETCH_POINT_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_RALLY_FETCH_POINT_IDX 2
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_THROTTLE 16
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_CURRENT 0
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_INTERFERENCE 18
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_COMPENSATIONX 4
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_COMPENSATIONY 8
+#define MAVLINK_OFFSET_COMPASSMOT_STATUS_COMPENSATIONZ 12
+#define MAVLINK_OFFSET_AHRS2_ROLL 0
+#define MAVLINK_OFFSET_AHRS2_PITCH 4
+#define MAVLINK_OFFSET_AHRS2_YAW 8
+#define MAVLINK_OFFSET_AHRS2_ALTITUDE 12
+#define MAVLINK_OFFSET_AHRS2_LAT 16
+#define MAVLINK_OFFSET_AHRS2_LNG 20
+#define MAVLINK_OFFSET_CAMERA_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_CAMERA_STATUS_TARGET_SYSTEM 26
+#define MAVLINK_OFFSET_CAMERA_STATUS_CAM_IDX 27
+#define MAVLINK_OFFSET_CAMERA_STATUS_IMG_IDX 24
+#define MAVLINK_OFFSET_CAMERA_STATUS_EVENT_ID 28
+#define MAVLINK_OFFSET_CAMERA_STATUS_P1 8
+#define MAVLINK_OFFSET_CAMERA_STATUS_P2 12
+#define MAVLINK_OFFSET_CAMERA_STATUS_P3 16
+#define MAVLINK_OFFSET_CAMERA_STATUS_P4 20
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_TIME_USEC 0
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_TARGET_SYSTEM 42
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_CAM_IDX 43
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_IMG_IDX 40
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_LAT 8
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_LNG 12
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_ALT_MSL 16
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_ALT_REL 20
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_ROLL 24
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_PITCH 28
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_YAW 32
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_FOC_LEN 36
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_FLAGS 44
+#define MAVLINK_OFFSET_CAMERA_FEEDBACK_COMPLETED_CAPTURES 45
+#define MAVLINK_OFFSET_BATTERY2_VOLTAGE 0
+#define MAVLINK_OFFSET_BATTERY2_CURRENT_BATTERY 2
+#define MAVLINK_OFFSET_AHRS3_ROLL 0
+#define MAVLINK_OFFSET_AHRS3_PITCH 4
+#define MAVLINK_OFFSET_AHRS3_YAW 8
+#define MAVLINK_OFFSET_AHRS3_ALTITUDE 12
+#define MAVLINK_OFFSET_AHRS3_LAT 16
+#define MAVLINK_OFFSET_AHRS3_LNG 20
+#define MAVLINK_OFFSET_AHRS3_V1 24
+#define MAVLINK_OFFSET_AHRS3_V2 28
+#define MAVLINK_OFFSET_AHRS3_V3 32
+#define MAVLINK_OFFSET_AHRS3_V4 36
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_REQUEST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_AUTOPILOT_VERSION_REQUEST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_REMOTE_LOG_DATA_BLOCK_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_REMOTE_LOG_DATA_BLOCK_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_REMOTE_LOG_DATA_BLOCK_SEQNO 0
+#define MAVLINK_OFFSET_REMOTE_LOG_DATA_BLOCK_DATA 6
+#define MAVLINK_OFFSET_REMOTE_LOG_BLOCK_STATUS_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_REMOTE_LOG_BLOCK_STATUS_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_REMOTE_LOG_BLOCK_STATUS_SEQNO 0
+#define MAVLINK_OFFSET_REMOTE_LOG_BLOCK_STATUS_STATUS 6
+#define MAVLINK_OFFSET_LED_CONTROL_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_LED_CONTROL_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_LED_CONTROL_INSTANCE 2
+#define MAVLINK_OFFSET_LED_CONTROL_PATTERN 3
+#define MAVLINK_OFFSET_LED_CONTROL_CUSTOM_LEN 4
+#define MAVLINK_OFFSET_LED_CONTROL_CUSTOM_BYTES 5
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_COMPASS_ID 12
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_CAL_MASK 13
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_CAL_STATUS 14
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_ATTEMPT 15
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_COMPLETION_PCT 16
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_COMPLETION_MASK 17
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_DIRECTION_X 0
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_DIRECTION_Y 4
+#define MAVLINK_OFFSET_MAG_CAL_PROGRESS_DIRECTION_Z 8
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_COMPASS_ID 40
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_CAL_MASK 41
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_CAL_STATUS 42
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_AUTOSAVED 43
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_FITNESS 0
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFS_X 4
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFS_Y 8
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFS_Z 12
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_DIAG_X 16
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_DIAG_Y 20
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_DIAG_Z 24
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFFDIAG_X 28
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFFDIAG_Y 32
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OFFDIAG_Z 36
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_ORIENTATION_CONFIDENCE 44
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_OLD_ORIENTATION 48
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_NEW_ORIENTATION 49
+#define MAVLINK_OFFSET_MAG_CAL_REPORT_SCALE_FACTOR 50
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_FLAGS 20
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_VELOCITY_VARIANCE 0
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_POS_HORIZ_VARIANCE 4
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_POS_VERT_VARIANCE 8
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_COMPASS_VARIANCE 12
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_TERRAIN_ALT_VARIANCE 16
+#define MAVLINK_OFFSET_EKF_STATUS_REPORT_AIRSPEED_VARIANCE 22
+#define MAVLINK_OFFSET_PID_TUNING_AXIS 24
+#define MAVLINK_OFFSET_PID_TUNING_DESIRED 0
+#define MAVLINK_OFFSET_PID_TUNING_ACHIEVED 4
+#define MAVLINK_OFFSET_PID_TUNING_FF 8
+#define MAVLINK_OFFSET_PID_TUNING_P 12
+#define MAVLINK_OFFSET_PID_TUNING_I 16
+#define MAVLINK_OFFSET_PID_TUNING_D 20
+#define MAVLINK_OFFSET_PID_TUNING_SRATE 25
+#define MAVLINK_OFFSET_PID_TUNING_PDMOD 29
+#define MAVLINK_OFFSET_DEEPSTALL_LANDING_LAT 0
+#define MAVLINK_OFFSET_DEEPSTALL_LANDING_LON 4
+#define MAVLINK_OFFSET_DEEPSTALL_PATH_LAT 8
+#define MAVLINK_OFFSET_DEEPSTALL_PATH_LON 12
+#define MAVLINK_OFFSET_DEEPSTALL_ARC_ENTRY_LAT 16
+#define MAVLINK_OFFSET_DEEPSTALL_ARC_ENTRY_LON 20
+#define MAVLINK_OFFSET_DEEPSTALL_ALTITUDE 24
+#define MAVLINK_OFFSET_DEEPSTALL_EXPECTED_TRAVEL_DISTANCE 28
+#define MAVLINK_OFFSET_DEEPSTALL_CROSS_TRACK_ERROR 32
+#define MAVLINK_OFFSET_DEEPSTALL_STAGE 36
+#define MAVLINK_OFFSET_GIMBAL_REPORT_TARGET_SYSTEM 40
+#define MAVLINK_OFFSET_GIMBAL_REPORT_TARGET_COMPONENT 41
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_TIME 0
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_ANGLE_X 4
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_ANGLE_Y 8
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_ANGLE_Z 12
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_VELOCITY_X 16
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_VELOCITY_Y 20
+#define MAVLINK_OFFSET_GIMBAL_REPORT_DELTA_VELOCITY_Z 24
+#define MAVLINK_OFFSET_GIMBAL_REPORT_JOINT_ROLL 28
+#define MAVLINK_OFFSET_GIMBAL_REPORT_JOINT_EL 32
+#define MAVLINK_OFFSET_GIMBAL_REPORT_JOINT_AZ 36
+#define MAVLINK_OFFSET_GIMBAL_CONTROL_TARGET_SYSTEM 12
+#define MAVLINK_OFFSET_GIMBAL_CONTROL_TARGET_COMPONENT 13
+#define MAVLINK_OFFSET_GIMBAL_CONTROL_DEMANDED_RATE_X 0
+#define MAVLINK_OFFSET_GIMBAL_CONTROL_DEMANDED_RATE_Y 4
+#define MAVLINK_OFFSET_GIMBAL_CONTROL_DEMANDED_RATE_Z 8
+#define MAVLINK_OFFSET_GIMBAL_TORQUE_CMD_REPORT_TARGET_SYSTEM 6
+#define MAVLINK_OFFSET_GIMBAL_TORQUE_CMD_REPORT_TARGET_COMPONENT 7
+#define MAVLINK_OFFSET_GIMBAL_TORQUE_CMD_REPORT_RL_TORQUE_CMD 0
+#define MAVLINK_OFFSET_GIMBAL_TORQUE_CMD_REPORT_EL_TORQUE_CMD 2
+#define MAVLINK_OFFSET_GIMBAL_TORQUE_CMD_REPORT_AZ_TORQUE_CMD 4
+#define MAVLINK_OFFSET_GOPRO_HEARTBEAT_STATUS 0
+#define MAVLINK_OFFSET_GOPRO_HEARTBEAT_CAPTURE_MODE 1
+#define MAVLINK_OFFSET_GOPRO_HEARTBEAT_FLAGS 2
+#define MAVLINK_OFFSET_GOPRO_GET_REQUEST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_GOPRO_GET_REQUEST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_GOPRO_GET_REQUEST_CMD_ID 2
+#define MAVLINK_OFFSET_GOPRO_GET_RESPONSE_CMD_ID 0
+#define MAVLINK_OFFSET_GOPRO_GET_RESPONSE_STATUS 1
+#define MAVLINK_OFFSET_GOPRO_GET_RESPONSE_VALUE 2
+#define MAVLINK_OFFSET_GOPRO_SET_REQUEST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_GOPRO_SET_REQUEST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_GOPRO_SET_REQUEST_CMD_ID 2
+#define MAVLINK_OFFSET_GOPRO_SET_REQUEST_VALUE 3
+#define MAVLINK_OFFSET_GOPRO_SET_RESPONSE_CMD_ID 0
+#define MAVLINK_OFFSET_GOPRO_SET_RESPONSE_STATUS 1
+#define MAVLINK_OFFSET_EFI_STATUS_HEALTH 64
+#define MAVLINK_OFFSET_EFI_STATUS_ECU_INDEX 0
+#define MAVLINK_OFFSET_EFI_STATUS_RPM 4
+#define MAVLINK_OFFSET_EFI_STATUS_FUEL_CONSUMED 8
+#define MAVLINK_OFFSET_EFI_STATUS_FUEL_FLOW 12
+#define MAVLINK_OFFSET_EFI_STATUS_ENGINE_LOAD 16
+#define MAVLINK_OFFSET_EFI_STATUS_THROTTLE_POSITION 20
+#define MAVLINK_OFFSET_EFI_STATUS_SPARK_DWELL_TIME 24
+#define MAVLINK_OFFSET_EFI_STATUS_BAROMETRIC_PRESSURE 28
+#define MAVLINK_OFFSET_EFI_STATUS_INTAKE_MANIFOLD_PRESSURE 32
+#define MAVLINK_OFFSET_EFI_STATUS_INTAKE_MANIFOLD_TEMPERATURE 36
+#define MAVLINK_OFFSET_EFI_STATUS_CYLINDER_HEAD_TEMPERATURE 40
+#define MAVLINK_OFFSET_EFI_STATUS_IGNITION_TIMING 44
+#define MAVLINK_OFFSET_EFI_STATUS_INJECTION_TIME 48
+#define MAVLINK_OFFSET_EFI_STATUS_EXHAUST_GAS_TEMPERATURE 52
+#define MAVLINK_OFFSET_EFI_STATUS_THROTTLE_OUT 56
+#define MAVLINK_OFFSET_EFI_STATUS_PT_COMPENSATION 60
+#define MAVLINK_OFFSET_EFI_STATUS_IGNITION_VOLTAGE 65
+#define MAVLINK_OFFSET_EFI_STATUS_FUEL_PRESSURE 69
+#define MAVLINK_OFFSET_RPM_RPM1 0
+#define MAVLINK_OFFSET_RPM_RPM2 4
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_FLAGS 40
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_VEL_RATIO 8
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_POS_HORIZ_RATIO 12
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_POS_VERT_RATIO 16
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_MAG_RATIO 20
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_HAGL_RATIO 24
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_TAS_RATIO 28
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_POS_HORIZ_ACCURACY 32
+#define MAVLINK_OFFSET_ESTIMATOR_STATUS_POS_VERT_ACCURACY 36
+#define MAVLINK_OFFSET_WIND_COV_TIME_USEC 0
+#define MAVLINK_OFFSET_WIND_COV_WIND_X 8
+#define MAVLINK_OFFSET_WIND_COV_WIND_Y 12
+#define MAVLINK_OFFSET_WIND_COV_WIND_Z 16
+#define MAVLINK_OFFSET_WIND_COV_VAR_HORIZ 20
+#define MAVLINK_OFFSET_WIND_COV_VAR_VERT 24
+#define MAVLINK_OFFSET_WIND_COV_WIND_ALT 28
+#define MAVLINK_OFFSET_WIND_COV_HORIZ_ACCURACY 32
+#define MAVLINK_OFFSET_WIND_COV_VERT_ACCURACY 36
+#define MAVLINK_OFFSET_GPS_INPUT_TIME_USEC 0
+#define MAVLINK_OFFSET_GPS_INPUT_GPS_ID 60
+#define MAVLINK_OFFSET_GPS_INPUT_IGNORE_FLAGS 56
+#define MAVLINK_OFFSET_GPS_INPUT_TIME_WEEK_MS 8
+#define MAVLINK_OFFSET_GPS_INPUT_TIME_WEEK 58
+#define MAVLINK_OFFSET_GPS_INPUT_FIX_TYPE 61
+#define MAVLINK_OFFSET_GPS_INPUT_LAT 12
+#define MAVLINK_OFFSET_GPS_INPUT_LON 16
+#define MAVLINK_OFFSET_GPS_INPUT_ALT 20
+#define MAVLINK_OFFSET_GPS_INPUT_HDOP 24
+#define MAVLINK_OFFSET_GPS_INPUT_VDOP 28
+#define MAVLINK_OFFSET_GPS_INPUT_VN 32
+#define MAVLINK_OFFSET_GPS_INPUT_VE 36
+#define MAVLINK_OFFSET_GPS_INPUT_VD 40
+#define MAVLINK_OFFSET_GPS_INPUT_SPEED_ACCURACY 44
+#define MAVLINK_OFFSET_GPS_INPUT_HORIZ_ACCURACY 48
+#define MAVLINK_OFFSET_GPS_INPUT_VERT_ACCURACY 52
+#define MAVLINK_OFFSET_GPS_INPUT_SATELLITES_VISIBLE 62
+#define MAVLINK_OFFSET_GPS_INPUT_YAW 63
+#define MAVLINK_OFFSET_GPS_RTCM_DATA_FLAGS 0
+#define MAVLINK_OFFSET_GPS_RTCM_DATA_LEN 1
+#define MAVLINK_OFFSET_GPS_RTCM_DATA_DATA 2
+#define MAVLINK_OFFSET_HIGH_LATENCY_BASE_MODE 26
+#define MAVLINK_OFFSET_HIGH_LATENCY_CUSTOM_MODE 0
+#define MAVLINK_OFFSET_HIGH_LATENCY_LANDED_STATE 27
+#define MAVLINK_OFFSET_HIGH_LATENCY_ROLL 12
+#define MAVLINK_OFFSET_HIGH_LATENCY_PITCH 14
+#define MAVLINK_OFFSET_HIGH_LATENCY_HEADING 16
+#define MAVLINK_OFFSET_HIGH_LATENCY_THROTTLE 28
+#define MAVLINK_OFFSET_HIGH_LATENCY_HEADING_SP 18
+#define MAVLINK_OFFSET_HIGH_LATENCY_LATITUDE 4
+#define MAVLINK_OFFSET_HIGH_LATENCY_LONGITUDE 8
+#define MAVLINK_OFFSET_HIGH_LATENCY_ALTITUDE_AMSL 20
+#define MAVLINK_OFFSET_HIGH_LATENCY_ALTITUDE_SP 22
+#define MAVLINK_OFFSET_HIGH_LATENCY_AIRSPEED 29
+#define MAVLINK_OFFSET_HIGH_LATENCY_AIRSPEED_SP 30
+#define MAVLINK_OFFSET_HIGH_LATENCY_GROUNDSPEED 31
+#define MAVLINK_OFFSET_HIGH_LATENCY_CLIMB_RATE 32
+#define MAVLINK_OFFSET_HIGH_LATENCY_GPS_NSAT 33
+#define MAVLINK_OFFSET_HIGH_LATENCY_GPS_FIX_TYPE 34
+#define MAVLINK_OFFSET_HIGH_LATENCY_BATTERY_REMAINING 35
+#define MAVLINK_OFFSET_HIGH_LATENCY_TEMPERATURE 36
+#define MAVLINK_OFFSET_HIGH_LATENCY_TEMPERATURE_AIR 37
+#define MAVLINK_OFFSET_HIGH_LATENCY_FAILSAFE 38
+#define MAVLINK_OFFSET_HIGH_LATENCY_WP_NUM 39
+#define MAVLINK_OFFSET_HIGH_LATENCY_WP_DISTANCE 24
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TIMESTAMP 0
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TYPE 24
+#define MAVLINK_OFFSET_HIGH_LATENCY2_AUTOPILOT 25
+#define MAVLINK_OFFSET_HIGH_LATENCY2_CUSTOM_MODE 12
+#define MAVLINK_OFFSET_HIGH_LATENCY2_LATITUDE 4
+#define MAVLINK_OFFSET_HIGH_LATENCY2_LONGITUDE 8
+#define MAVLINK_OFFSET_HIGH_LATENCY2_ALTITUDE 14
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TARGET_ALTITUDE 16
+#define MAVLINK_OFFSET_HIGH_LATENCY2_HEADING 26
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TARGET_HEADING 27
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TARGET_DISTANCE 18
+#define MAVLINK_OFFSET_HIGH_LATENCY2_THROTTLE 28
+#define MAVLINK_OFFSET_HIGH_LATENCY2_AIRSPEED 29
+#define MAVLINK_OFFSET_HIGH_LATENCY2_AIRSPEED_SP 30
+#define MAVLINK_OFFSET_HIGH_LATENCY2_GROUNDSPEED 31
+#define MAVLINK_OFFSET_HIGH_LATENCY2_WINDSPEED 32
+#define MAVLINK_OFFSET_HIGH_LATENCY2_WIND_HEADING 33
+#define MAVLINK_OFFSET_HIGH_LATENCY2_EPH 34
+#define MAVLINK_OFFSET_HIGH_LATENCY2_EPV 35
+#define MAVLINK_OFFSET_HIGH_LATENCY2_TEMPERATURE_AIR 36
+#define MAVLINK_OFFSET_HIGH_LATENCY2_CLIMB_RATE 37
+#define MAVLINK_OFFSET_HIGH_LATENCY2_BATTERY 38
+#define MAVLINK_OFFSET_HIGH_LATENCY2_WP_NUM 20
+#define MAVLINK_OFFSET_HIGH_LATENCY2_FAILURE_FLAGS 22
+#define MAVLINK_OFFSET_HIGH_LATENCY2_CUSTOM0 39
+#define MAVLINK_OFFSET_HIGH_LATENCY2_CUSTOM1 40
+#define MAVLINK_OFFSET_HIGH_LATENCY2_CUSTOM2 41
+#define MAVLINK_OFFSET_VIBRATION_TIME_USEC 0
+#define MAVLINK_OFFSET_VIBRATION_VIBRATION_X 8
+#define MAVLINK_OFFSET_VIBRATION_VIBRATION_Y 12
+#define MAVLINK_OFFSET_VIBRATION_VIBRATION_Z 16
+#define MAVLINK_OFFSET_VIBRATION_CLIPPING_0 20
+#define MAVLINK_OFFSET_VIBRATION_CLIPPING_1 24
+#define MAVLINK_OFFSET_VIBRATION_CLIPPING_2 28
+#define MAVLINK_OFFSET_HOME_POSITION_LATITUDE 0
+#define MAVLINK_OFFSET_HOME_POSITION_LONGITUDE 4
+#define MAVLINK_OFFSET_HOME_POSITION_ALTITUDE 8
+#define MAVLINK_OFFSET_HOME_POSITION_X 12
+#define MAVLINK_OFFSET_HOME_POSITION_Y 16
+#define MAVLINK_OFFSET_HOME_POSITION_Z 20
+#define MAVLINK_OFFSET_HOME_POSITION_Q 24
+#define MAVLINK_OFFSET_HOME_POSITION_APPROACH_X 40
+#define MAVLINK_OFFSET_HOME_POSITION_APPROACH_Y 44
+#define MAVLINK_OFFSET_HOME_POSITION_APPROACH_Z 48
+#define MAVLINK_OFFSET_HOME_POSITION_TIME_USEC 52
+#define MAVLINK_OFFSET_SET_HOME_POSITION_TARGET_SYSTEM 52
+#define MAVLINK_OFFSET_SET_HOME_POSITION_LATITUDE 0
+#define MAVLINK_OFFSET_SET_HOME_POSITION_LONGITUDE 4
+#define MAVLINK_OFFSET_SET_HOME_POSITION_ALTITUDE 8
+#define MAVLINK_OFFSET_SET_HOME_POSITION_X 12
+#define MAVLINK_OFFSET_SET_HOME_POSITION_Y 16
+#define MAVLINK_OFFSET_SET_HOME_POSITION_Z 20
+#define MAVLINK_OFFSET_SET_HOME_POSITION_Q 24
+#define MAVLINK_OFFSET_SET_HOME_POSITION_APPROACH_X 40
+#define MAVLINK_OFFSET_SET_HOME_POSITION_APPROACH_Y 44
+#define MAVLINK_OFFSET_SET_HOME_POSITION_APPROACH_Z 48
+#define MAVLINK_OFFSET_SET_HOME_POSITION_TIME_USEC 53
+#define MAVLINK_OFFSET_MESSAGE_INTERVAL_MESSAGE_ID 4
+#define MAVLINK_OFFSET_MESSAGE_INTERVAL_INTERVAL_US 0
+#define MAVLINK_OFFSET_EXTENDED_SYS_STATE_VTOL_STATE 0
+#define MAVLINK_OFFSET_EXTENDED_SYS_STATE_LANDED_STATE 1
+#define MAVLINK_OFFSET_ADSB_VEHICLE_ICAO_ADDRESS 0
+#define MAVLINK_OFFSET_ADSB_VEHICLE_LAT 4
+#define MAVLINK_OFFSET_ADSB_VEHICLE_LON 8
+#define MAVLINK_OFFSET_ADSB_VEHICLE_ALTITUDE_TYPE 26
+#define MAVLINK_OFFSET_ADSB_VEHICLE_ALTITUDE 12
+#define MAVLINK_OFFSET_ADSB_VEHICLE_HEADING 16
+#define MAVLINK_OFFSET_ADSB_VEHICLE_HOR_VELOCITY 18
+#define MAVLINK_OFFSET_ADSB_VEHICLE_VER_VELOCITY 20
+#define MAVLINK_OFFSET_ADSB_VEHICLE_CALLSIGN 27
+#define MAVLINK_OFFSET_ADSB_VEHICLE_EMITTER_TYPE 36
+#define MAVLINK_OFFSET_ADSB_VEHICLE_TSLC 37
+#define MAVLINK_OFFSET_ADSB_VEHICLE_FLAGS 22
+#define MAVLINK_OFFSET_ADSB_VEHICLE_SQUAWK 24
+#define MAVLINK_OFFSET_COLLISION_SRC 16
+#define MAVLINK_OFFSET_COLLISION_ID 0
+#define MAVLINK_OFFSET_COLLISION_ACTION 17
+#define MAVLINK_OFFSET_COLLISION_THREAT_LEVEL 18
+#define MAVLINK_OFFSET_COLLISION_TIME_TO_MINIMUM_DELTA 4
+#define MAVLINK_OFFSET_COLLISION_ALTITUDE_MINIMUM_DELTA 8
+#define MAVLINK_OFFSET_COLLISION_HORIZONTAL_MINIMUM_DELTA 12
+#define MAVLINK_OFFSET_V2_EXTENSION_TARGET_NETWORK 2
+#define MAVLINK_OFFSET_V2_EXTENSION_TARGET_SYSTEM 3
+#define MAVLINK_OFFSET_V2_EXTENSION_TARGET_COMPONENT 4
+#define MAVLINK_OFFSET_V2_EXTENSION_MESSAGE_TYPE 0
+#define MAVLINK_OFFSET_V2_EXTENSION_PAYLOAD 5
+#define MAVLINK_OFFSET_MEMORY_VECT_ADDRESS 0
+#define MAVLINK_OFFSET_MEMORY_VECT_VER 2
+#define MAVLINK_OFFSET_MEMORY_VECT_TYPE 3
+#define MAVLINK_OFFSET_MEMORY_VECT_VALUE 4
+#define MAVLINK_OFFSET_DEBUG_VECT_NAME 20
+#define MAVLINK_OFFSET_DEBUG_VECT_TIME_USEC 0
+#define MAVLINK_OFFSET_DEBUG_VECT_X 8
+#define MAVLINK_OFFSET_DEBUG_VECT_Y 12
+#define MAVLINK_OFFSET_DEBUG_VECT_Z 16
+#define MAVLINK_OFFSET_NAMED_VALUE_FLOAT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_NAMED_VALUE_FLOAT_NAME 8
+#define MAVLINK_OFFSET_NAMED_VALUE_FLOAT_VALUE 4
+#define MAVLINK_OFFSET_NAMED_VALUE_INT_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_NAMED_VALUE_INT_NAME 8
+#define MAVLINK_OFFSET_NAMED_VALUE_INT_VALUE 4
+#define MAVLINK_OFFSET_STATUSTEXT_SEVERITY 0
+#define MAVLINK_OFFSET_STATUSTEXT_TEXT 1
+#define MAVLINK_OFFSET_STATUSTEXT_ID 51
+#define MAVLINK_OFFSET_STATUSTEXT_CHUNK_SEQ 53
+#define MAVLINK_OFFSET_DEBUG_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_DEBUG_IND 8
+#define MAVLINK_OFFSET_DEBUG_VALUE 4
+#define MAVLINK_OFFSET_SETUP_SIGNING_TARGET_SYSTEM 8
+#define MAVLINK_OFFSET_SETUP_SIGNING_TARGET_COMPONENT 9
+#define MAVLINK_OFFSET_SETUP_SIGNING_SECRET_KEY 10
+#define MAVLINK_OFFSET_SETUP_SIGNING_INITIAL_TIMESTAMP 0
+#define MAVLINK_OFFSET_BUTTON_CHANGE_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_BUTTON_CHANGE_LAST_CHANGE_MS 4
+#define MAVLINK_OFFSET_BUTTON_CHANGE_STATE 8
+#define MAVLINK_OFFSET_PLAY_TUNE_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_PLAY_TUNE_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_PLAY_TUNE_TUNE 2
+#define MAVLINK_OFFSET_PLAY_TUNE_TUNE2 32
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_VENDOR_NAME 30
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_MODEL_NAME 62
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_FIRMWARE_VERSION 4
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_FOCAL_LENGTH 8
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_SENSOR_SIZE_H 12
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_SENSOR_SIZE_V 16
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_RESOLUTION_H 24
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_RESOLUTION_V 26
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_LENS_ID 94
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_FLAGS 20
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_CAM_DEFINITION_VERSION 28
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_CAM_DEFINITION_URI 95
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_GIMBAL_DEVICE_ID 235
+#define MAVLINK_OFFSET_CAMERA_INFORMATION_CAMERA_DEVICE_ID 236
+#define MAVLINK_OFFSET_CAMERA_SETTINGS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_CAMERA_SETTINGS_MODE_ID 4
+#define MAVLINK_OFFSET_CAMERA_SETTINGS_ZOOMLEVEL 5
+#define MAVLINK_OFFSET_CAMERA_SETTINGS_FOCUSLEVEL 9
+#define MAVLINK_OFFSET_CAMERA_SETTINGS_CAMERA_DEVICE_ID 13
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_STORAGE_ID 24
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_STORAGE_COUNT 25
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_STATUS 26
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_TOTAL_CAPACITY 4
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_USED_CAPACITY 8
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_AVAILABLE_CAPACITY 12
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_READ_SPEED 16
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_WRITE_SPEED 20
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_TYPE 27
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_NAME 28
+#define MAVLINK_OFFSET_STORAGE_INFORMATION_STORAGE_USAGE 60
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_IMAGE_STATUS 16
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_VIDEO_STATUS 17
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_IMAGE_INTERVAL 4
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_RECORDING_TIME_MS 8
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_AVAILABLE_CAPACITY 12
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_IMAGE_COUNT 18
+#define MAVLINK_OFFSET_CAMERA_CAPTURE_STATUS_CAMERA_DEVICE_ID 22
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_TIME_BOOT_MS 8
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_TIME_UTC 0
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_CAMERA_ID 48
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_LAT 12
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_LON 16
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_ALT 20
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_RELATIVE_ALT 24
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_Q 28
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_IMAGE_INDEX 44
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_CAPTURE_RESULT 49
+#define MAVLINK_OFFSET_CAMERA_IMAGE_CAPTURED_FILE_URL 50
+#define MAVLINK_OFFSET_FLIGHT_INFORMATION_TIME_BOOT_MS 24
+#define MAVLINK_OFFSET_FLIGHT_INFORMATION_ARMING_TIME_UTC 0
+#define MAVLINK_OFFSET_FLIGHT_INFORMATION_TAKEOFF_TIME_UTC 8
+#define MAVLINK_OFFSET_FLIGHT_INFORMATION_FLIGHT_UUID 16
+#define MAVLINK_OFFSET_FLIGHT_INFORMATION_LANDING_TIME 28
+#define MAVLINK_OFFSET_MOUNT_ORIENTATION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_MOUNT_ORIENTATION_ROLL 4
+#define MAVLINK_OFFSET_MOUNT_ORIENTATION_PITCH 8
+#define MAVLINK_OFFSET_MOUNT_ORIENTATION_YAW 12
+#define MAVLINK_OFFSET_MOUNT_ORIENTATION_YAW_ABSOLUTE 16
+#define MAVLINK_OFFSET_LOGGING_DATA_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_LOGGING_DATA_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_LOGGING_DATA_SEQUENCE 0
+#define MAVLINK_OFFSET_LOGGING_DATA_LENGTH 4
+#define MAVLINK_OFFSET_LOGGING_DATA_FIRST_MESSAGE_OFFSET 5
+#define MAVLINK_OFFSET_LOGGING_DATA_DATA 6
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_SEQUENCE 0
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_LENGTH 4
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_FIRST_MESSAGE_OFFSET 5
+#define MAVLINK_OFFSET_LOGGING_DATA_ACKED_DATA 6
+#define MAVLINK_OFFSET_LOGGING_ACK_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_LOGGING_ACK_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_LOGGING_ACK_SEQUENCE 0
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_STREAM_ID 18
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_COUNT 19
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_TYPE 20
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_FLAGS 8
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_FRAMERATE 0
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_RESOLUTION_H 10
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_RESOLUTION_V 12
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_BITRATE 4
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_ROTATION 14
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_HFOV 16
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_NAME 21
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_URI 53
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_ENCODING 213
+#define MAVLINK_OFFSET_VIDEO_STREAM_INFORMATION_CAMERA_DEVICE_ID 214
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_STREAM_ID 18
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_FLAGS 8
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_FRAMERATE 0
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_RESOLUTION_H 10
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_RESOLUTION_V 12
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_BITRATE 4
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_ROTATION 14
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_HFOV 16
+#define MAVLINK_OFFSET_VIDEO_STREAM_STATUS_CAMERA_DEVICE_ID 19
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_LAT_CAMERA 4
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_LON_CAMERA 8
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_ALT_CAMERA 12
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_LAT_IMAGE 16
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_LON_IMAGE 20
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_ALT_IMAGE 24
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_Q 28
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_HFOV 44
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_VFOV 48
+#define MAVLINK_OFFSET_CAMERA_FOV_STATUS_CAMERA_DEVICE_ID 52
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_TRACKING_STATUS 28
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_TRACKING_MODE 29
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_TARGET_DATA 30
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_POINT_X 0
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_POINT_Y 4
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_RADIUS 8
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_REC_TOP_X 12
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_REC_TOP_Y 16
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_REC_BOTTOM_X 20
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_REC_BOTTOM_Y 24
+#define MAVLINK_OFFSET_CAMERA_TRACKING_IMAGE_STATUS_CAMERA_DEVICE_ID 31
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_TRACKING_STATUS 48
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_LAT 0
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_LON 4
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_ALT 8
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_H_ACC 12
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_V_ACC 16
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_VEL_N 20
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_VEL_E 24
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_VEL_D 28
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_VEL_ACC 32
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_DIST 36
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_HDG 40
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_HDG_ACC 44
+#define MAVLINK_OFFSET_CAMERA_TRACKING_GEO_STATUS_CAMERA_DEVICE_ID 49
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_CAP_FLAGS 4
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_GIMBAL_DEVICE_ID 32
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_ROLL_MIN 8
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_ROLL_MAX 12
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_PITCH_MIN 16
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_PITCH_MAX 20
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_YAW_MIN 24
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_INFORMATION_YAW_MAX 28
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_FLAGS 4
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_GIMBAL_DEVICE_ID 8
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_PRIMARY_CONTROL_SYSID 9
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_PRIMARY_CONTROL_COMPID 10
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_SECONDARY_CONTROL_SYSID 11
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_STATUS_SECONDARY_CONTROL_COMPID 12
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_TARGET_SYSTEM 32
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_TARGET_COMPONENT 33
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_FLAGS 0
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_GIMBAL_DEVICE_ID 34
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_Q 4
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_ANGULAR_VELOCITY_X 20
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_ANGULAR_VELOCITY_Y 24
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_ATTITUDE_ANGULAR_VELOCITY_Z 28
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_TIME_BOOT_MS 8
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_VENDOR_NAME 48
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_MODEL_NAME 80
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_CUSTOM_NAME 112
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_FIRMWARE_VERSION 12
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_HARDWARE_VERSION 16
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_UID 0
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_CAP_FLAGS 44
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_CUSTOM_CAP_FLAGS 46
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_ROLL_MIN 20
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_ROLL_MAX 24
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_PITCH_MIN 28
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_PITCH_MAX 32
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_YAW_MIN 36
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_YAW_MAX 40
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_INFORMATION_GIMBAL_DEVICE_ID 144
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_TARGET_SYSTEM 30
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_TARGET_COMPONENT 31
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_FLAGS 28
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_Q 0
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_ANGULAR_VELOCITY_X 16
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_ANGULAR_VELOCITY_Y 20
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_SET_ATTITUDE_ANGULAR_VELOCITY_Z 24
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_TARGET_SYSTEM 38
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_TARGET_COMPONENT 39
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_FLAGS 36
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_Q 4
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_ANGULAR_VELOCITY_X 20
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_ANGULAR_VELOCITY_Y 24
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_ANGULAR_VELOCITY_Z 28
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_FAILURE_FLAGS 32
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_DELTA_YAW 40
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_DELTA_YAW_VELOCITY 44
+#define MAVLINK_OFFSET_GIMBAL_DEVICE_ATTITUDE_STATUS_GIMBAL_DEVICE_ID 48
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_TARGET_SYSTEM 50
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_TARGET_COMPONENT 51
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_TIME_BOOT_US 0
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_Q 8
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_Q_ESTIMATED_DELAY_US 24
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_VX 28
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_VY 32
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_VZ 36
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_V_ESTIMATED_DELAY_US 40
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_FEED_FORWARD_ANGULAR_VELOCITY_Z 44
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_ESTIMATOR_STATUS 48
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_LANDED_STATE 52
+#define MAVLINK_OFFSET_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE_ANGULAR_VELOCITY_Z 53
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_TARGET_SYSTEM 20
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_TARGET_COMPONENT 21
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_FLAGS 0
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_GIMBAL_DEVICE_ID 22
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_PITCH 4
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_YAW 8
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_PITCH_RATE 12
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_PITCHYAW_YAW_RATE 16
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_TARGET_SYSTEM 20
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_TARGET_COMPONENT 21
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_FLAGS 0
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_GIMBAL_DEVICE_ID 22
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_PITCH 4
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_YAW 8
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_PITCH_RATE 12
+#define MAVLINK_OFFSET_GIMBAL_MANAGER_SET_MANUAL_CONTROL_YAW_RATE 16
+#define MAVLINK_OFFSET_ESC_INFO_INDEX 42
+#define MAVLINK_OFFSET_ESC_INFO_TIME_USEC 0
+#define MAVLINK_OFFSET_ESC_INFO_COUNTER 24
+#define MAVLINK_OFFSET_ESC_INFO_COUNT 43
+#define MAVLINK_OFFSET_ESC_INFO_CONNECTION_TYPE 44
+#define MAVLINK_OFFSET_ESC_INFO_INFO 45
+#define MAVLINK_OFFSET_ESC_INFO_FAILURE_FLAGS 26
+#define MAVLINK_OFFSET_ESC_INFO_ERROR_COUNT 8
+#define MAVLINK_OFFSET_ESC_INFO_TEMPERATURE 34
+#define MAVLINK_OFFSET_ESC_STATUS_INDEX 56
+#define MAVLINK_OFFSET_ESC_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_ESC_STATUS_RPM 8
+#define MAVLINK_OFFSET_ESC_STATUS_VOLTAGE 24
+#define MAVLINK_OFFSET_ESC_STATUS_CURRENT 40
+#define MAVLINK_OFFSET_WIFI_CONFIG_AP_SSID 0
+#define MAVLINK_OFFSET_WIFI_CONFIG_AP_PASSWORD 32
+#define MAVLINK_OFFSET_WIFI_CONFIG_AP_MODE 96
+#define MAVLINK_OFFSET_WIFI_CONFIG_AP_RESPONSE 97
+#define MAVLINK_OFFSET_PROTOCOL_VERSION_VERSION 0
+#define MAVLINK_OFFSET_PROTOCOL_VERSION_MIN_VERSION 2
+#define MAVLINK_OFFSET_PROTOCOL_VERSION_MAX_VERSION 4
+#define MAVLINK_OFFSET_PROTOCOL_VERSION_SPEC_VERSION_HASH 6
+#define MAVLINK_OFFSET_PROTOCOL_VERSION_LIBRARY_VERSION_HASH 14
+#define MAVLINK_OFFSET_AIS_VESSEL_MMSI 0
+#define MAVLINK_OFFSET_AIS_VESSEL_LAT 4
+#define MAVLINK_OFFSET_AIS_VESSEL_LON 8
+#define MAVLINK_OFFSET_AIS_VESSEL_COG 12
+#define MAVLINK_OFFSET_AIS_VESSEL_HEADING 14
+#define MAVLINK_OFFSET_AIS_VESSEL_VELOCITY 16
+#define MAVLINK_OFFSET_AIS_VESSEL_TURN_RATE 26
+#define MAVLINK_OFFSET_AIS_VESSEL_NAVIGATIONAL_STATUS 27
+#define MAVLINK_OFFSET_AIS_VESSEL_TYPE 28
+#define MAVLINK_OFFSET_AIS_VESSEL_DIMENSION_BOW 18
+#define MAVLINK_OFFSET_AIS_VESSEL_DIMENSION_STERN 20
+#define MAVLINK_OFFSET_AIS_VESSEL_DIMENSION_PORT 29
+#define MAVLINK_OFFSET_AIS_VESSEL_DIMENSION_STARBOARD 30
+#define MAVLINK_OFFSET_AIS_VESSEL_CALLSIGN 31
+#define MAVLINK_OFFSET_AIS_VESSEL_NAME 38
+#define MAVLINK_OFFSET_AIS_VESSEL_TSLC 22
+#define MAVLINK_OFFSET_AIS_VESSEL_FLAGS 24
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_UPTIME_SEC 8
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_HEALTH 14
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_MODE 15
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_SUB_MODE 16
+#define MAVLINK_OFFSET_UAVCAN_NODE_STATUS_VENDOR_SPECIFIC_STATUS_CODE 12
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_TIME_USEC 0
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_UPTIME_SEC 8
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_NAME 16
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_HW_VERSION_MAJOR 96
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_HW_VERSION_MINOR 97
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_HW_UNIQUE_ID 98
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_SW_VERSION_MAJOR 114
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_SW_VERSION_MINOR 115
+#define MAVLINK_OFFSET_UAVCAN_NODE_INFO_SW_VCS_COMMIT 12
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_READ_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_READ_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_READ_PARAM_ID 4
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_READ_PARAM_INDEX 0
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_LIST_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_PARAM_EXT_REQUEST_LIST_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_PARAM_EXT_VALUE_PARAM_ID 4
+#define MAVLINK_OFFSET_PARAM_EXT_VALUE_PARAM_VALUE 20
+#define MAVLINK_OFFSET_PARAM_EXT_VALUE_PARAM_TYPE 148
+#define MAVLINK_OFFSET_PARAM_EXT_VALUE_PARAM_COUNT 0
+#define MAVLINK_OFFSET_PARAM_EXT_VALUE_PARAM_INDEX 2
+#define MAVLINK_OFFSET_PARAM_EXT_SET_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_PARAM_EXT_SET_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_PARAM_EXT_SET_PARAM_ID 2
+#define MAVLINK_OFFSET_PARAM_EXT_SET_PARAM_VALUE 18
+#define MAVLINK_OFFSET_PARAM_EXT_SET_PARAM_TYPE 146
+#define MAVLINK_OFFSET_PARAM_EXT_ACK_PARAM_ID 0
+#define MAVLINK_OFFSET_PARAM_EXT_ACK_PARAM_VALUE 16
+#define MAVLINK_OFFSET_PARAM_EXT_ACK_PARAM_TYPE 144
+#define MAVLINK_OFFSET_PARAM_EXT_ACK_PARAM_RESULT 145
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_TIME_USEC 0
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_SENSOR_TYPE 156
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_DISTANCES 8
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_INCREMENT 157
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_MIN_DISTANCE 152
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_MAX_DISTANCE 154
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_INCREMENT_F 158
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_ANGLE_OFFSET 162
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_FRAME 166
+#define MAVLINK_OFFSET_ODOMETRY_TIME_USEC 0
+#define MAVLINK_OFFSET_ODOMETRY_FRAME_ID 228
+#define MAVLINK_OFFSET_ODOMETRY_CHILD_FRAME_ID 229
+#define MAVLINK_OFFSET_ODOMETRY_X 8
+#define MAVLINK_OFFSET_ODOMETRY_Y 12
+#define MAVLINK_OFFSET_ODOMETRY_Z 16
+#define MAVLINK_OFFSET_ODOMETRY_Q 20
+#define MAVLINK_OFFSET_ODOMETRY_VX 36
+#define MAVLINK_OFFSET_ODOMETRY_VY 40
+#define MAVLINK_OFFSET_ODOMETRY_VZ 44
+#define MAVLINK_OFFSET_ODOMETRY_ROLLSPEED 48
+#define MAVLINK_OFFSET_ODOMETRY_PITCHSPEED 52
+#define MAVLINK_OFFSET_ODOMETRY_YAWSPEED 56
+#define MAVLINK_OFFSET_ODOMETRY_POSE_COVARIANCE 60
+#define MAVLINK_OFFSET_ODOMETRY_VELOCITY_COVARIANCE 144
+#define MAVLINK_OFFSET_ODOMETRY_RESET_COUNTER 230
+#define MAVLINK_OFFSET_ODOMETRY_ESTIMATOR_TYPE 231
+#define MAVLINK_OFFSET_ODOMETRY_QUALITY 232
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_TIME_USEC 0
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_VALID_POINTS 238
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_POS_X 8
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_POS_Y 28
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_POS_Z 48
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_VEL_X 68
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_VEL_Y 88
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_VEL_Z 108
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_ACC_X 128
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_ACC_Y 148
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_ACC_Z 168
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_POS_YAW 188
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_VEL_YAW 208
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_WAYPOINTS_COMMAND 228
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_TIME_USEC 0
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_VALID_POINTS 108
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_POS_X 8
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_POS_Y 28
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_POS_Z 48
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_DELTA 68
+#define MAVLINK_OFFSET_TRAJECTORY_REPRESENTATION_BEZIER_POS_YAW 88
+#define MAVLINK_OFFSET_CELLULAR_STATUS_STATUS 6
+#define MAVLINK_OFFSET_CELLULAR_STATUS_FAILURE_REASON 7
+#define MAVLINK_OFFSET_CELLULAR_STATUS_TYPE 8
+#define MAVLINK_OFFSET_CELLULAR_STATUS_QUALITY 9
+#define MAVLINK_OFFSET_CELLULAR_STATUS_MCC 0
+#define MAVLINK_OFFSET_CELLULAR_STATUS_MNC 2
+#define MAVLINK_OFFSET_CELLULAR_STATUS_LAC 4
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_TIMESTAMP 0
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_LAST_HEARTBEAT 8
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_FAILED_SESSIONS 16
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_SUCCESSFUL_SESSIONS 18
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_SIGNAL_QUALITY 20
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_RING_PENDING 21
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_TX_SESSION_PENDING 22
+#define MAVLINK_OFFSET_ISBD_LINK_STATUS_RX_SESSION_PENDING 23
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_ENABLE_LTE 0
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_ENABLE_PIN 1
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_PIN 2
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_NEW_PIN 18
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_APN 34
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_PUK 66
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_ROAMING 82
+#define MAVLINK_OFFSET_CELLULAR_CONFIG_RESPONSE 83
+#define MAVLINK_OFFSET_RAW_RPM_INDEX 4
+#define MAVLINK_OFFSET_RAW_RPM_FREQUENCY 0
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_TIME 0
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_UAS_ID 50
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_LAT 8
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_LON 12
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_ALT 16
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_RELATIVE_ALT 20
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_VX 36
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_VY 38
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_VZ 40
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_H_ACC 42
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_V_ACC 44
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_VEL_ACC 46
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_NEXT_LAT 24
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_NEXT_LON 28
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_NEXT_ALT 32
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_UPDATE_RATE 48
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_FLIGHT_STATE 68
+#define MAVLINK_OFFSET_UTM_GLOBAL_POSITION_FLAGS 69
+#define MAVLINK_OFFSET_DEBUG_FLOAT_ARRAY_TIME_USEC 0
+#define MAVLINK_OFFSET_DEBUG_FLOAT_ARRAY_NAME 10
+#define MAVLINK_OFFSET_DEBUG_FLOAT_ARRAY_ARRAY_ID 8
+#define MAVLINK_OFFSET_DEBUG_FLOAT_ARRAY_DATA 20
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_RADIUS 8
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_FRAME 24
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_X 12
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_Y 16
+#define MAVLINK_OFFSET_ORBIT_EXECUTION_STATUS_Z 20
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_ID 18
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_BATTERY_FUNCTION 19
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_TYPE 20
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CAPACITY_FULL_SPECIFICATION 0
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CAPACITY_FULL 4
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CYCLE_COUNT 8
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_SERIAL_NUMBER 21
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_DEVICE_NAME 37
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_WEIGHT 10
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_DISCHARGE_MINIMUM_VOLTAGE 12
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CHARGING_MINIMUM_VOLTAGE 14
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_RESTING_MINIMUM_VOLTAGE 16
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CHARGING_MAXIMUM_VOLTAGE 87
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_CELLS_IN_SERIES 89
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_DISCHARGE_MAXIMUM_CURRENT 90
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_DISCHARGE_MAXIMUM_BURST_CURRENT 94
+#define MAVLINK_OFFSET_SMART_BATTERY_INFO_MANUFACTURE_DATE 98
+#define MAVLINK_OFFSET_GENERATOR_STATUS_STATUS 0
+#define MAVLINK_OFFSET_GENERATOR_STATUS_GENERATOR_SPEED 36
+#define MAVLINK_OFFSET_GENERATOR_STATUS_BATTERY_CURRENT 8
+#define MAVLINK_OFFSET_GENERATOR_STATUS_LOAD_CURRENT 12
+#define MAVLINK_OFFSET_GENERATOR_STATUS_POWER_GENERATED 16
+#define MAVLINK_OFFSET_GENERATOR_STATUS_BUS_VOLTAGE 20
+#define MAVLINK_OFFSET_GENERATOR_STATUS_RECTIFIER_TEMPERATURE 38
+#define MAVLINK_OFFSET_GENERATOR_STATUS_BAT_CURRENT_SETPOINT 24
+#define MAVLINK_OFFSET_GENERATOR_STATUS_GENERATOR_TEMPERATURE 40
+#define MAVLINK_OFFSET_GENERATOR_STATUS_RUNTIME 28
+#define MAVLINK_OFFSET_GENERATOR_STATUS_TIME_UNTIL_MAINTENANCE 32
+#define MAVLINK_OFFSET_ACTUATOR_OUTPUT_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_ACTUATOR_OUTPUT_STATUS_ACTIVE 8
+#define MAVLINK_OFFSET_ACTUATOR_OUTPUT_STATUS_ACTUATOR 12
+#define MAVLINK_OFFSET_TIME_ESTIMATE_TO_TARGET_SAFE_RETURN 0
+#define MAVLINK_OFFSET_TIME_ESTIMATE_TO_TARGET_LAND 4
+#define MAVLINK_OFFSET_TIME_ESTIMATE_TO_TARGET_MISSION_NEXT_ITEM 8
+#define MAVLINK_OFFSET_TIME_ESTIMATE_TO_TARGET_MISSION_END 12
+#define MAVLINK_OFFSET_TIME_ESTIMATE_TO_TARGET_COMMANDED_ACTION 16
+#define MAVLINK_OFFSET_TUNNEL_TARGET_SYSTEM 2
+#define MAVLINK_OFFSET_TUNNEL_TARGET_COMPONENT 3
+#define MAVLINK_OFFSET_TUNNEL_PAYLOAD_TYPE 0
+#define MAVLINK_OFFSET_TUNNEL_PAYLOAD_LENGTH 4
+#define MAVLINK_OFFSET_TUNNEL_PAYLOAD 5
+#define MAVLINK_OFFSET_CAN_FRAME_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_CAN_FRAME_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_CAN_FRAME_BUS 6
+#define MAVLINK_OFFSET_CAN_FRAME_LEN 7
+#define MAVLINK_OFFSET_CAN_FRAME_ID 0
+#define MAVLINK_OFFSET_CAN_FRAME_DATA 8
+#define MAVLINK_OFFSET_CANFD_FRAME_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_CANFD_FRAME_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_CANFD_FRAME_BUS 6
+#define MAVLINK_OFFSET_CANFD_FRAME_LEN 7
+#define MAVLINK_OFFSET_CANFD_FRAME_ID 0
+#define MAVLINK_OFFSET_CANFD_FRAME_DATA 8
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_TARGET_SYSTEM 32
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_TARGET_COMPONENT 33
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_BUS 34
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_OPERATION 35
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_NUM_IDS 36
+#define MAVLINK_OFFSET_CAN_FILTER_MODIFY_IDS 0
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_UPTIME 8
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_TYPE 196
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_CPU_CORES 197
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_CPU_COMBINED 205
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_GPU_CORES 215
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_GPU_COMBINED 219
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_TEMPERATURE_BOARD 229
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_TEMPERATURE_CORE 230
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_FAN_SPEED 188
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_RAM_USAGE 12
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_RAM_TOTAL 16
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_STORAGE_TYPE 20
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_STORAGE_USAGE 36
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_STORAGE_TOTAL 52
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_LINK_TYPE 68
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_LINK_TX_RATE 92
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_LINK_RX_RATE 116
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_LINK_TX_MAX 140
+#define MAVLINK_OFFSET_ONBOARD_COMPUTER_STATUS_LINK_RX_MAX 164
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_GENERAL_METADATA_FILE_CRC 4
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_GENERAL_METADATA_URI 12
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_PERIPHERALS_METADATA_FILE_CRC 8
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_PERIPHERALS_METADATA_URI 112
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_TIME_BOOT_MS 8
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_CAPABILITIES 0
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_TIME_MANUFACTURE_S 12
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_VENDOR_NAME 16
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_MODEL_NAME 48
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_SOFTWARE_VERSION 80
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_HARDWARE_VERSION 104
+#define MAVLINK_OFFSET_COMPONENT_INFORMATION_BASIC_SERIAL_NUMBER 128
+#define MAVLINK_OFFSET_COMPONENT_METADATA_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_COMPONENT_METADATA_FILE_CRC 4
+#define MAVLINK_OFFSET_COMPONENT_METADATA_URI 8
+#define MAVLINK_OFFSET_PLAY_TUNE_V2_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_PLAY_TUNE_V2_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_PLAY_TUNE_V2_FORMAT 0
+#define MAVLINK_OFFSET_PLAY_TUNE_V2_TUNE 6
+#define MAVLINK_OFFSET_SUPPORTED_TUNES_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_SUPPORTED_TUNES_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_SUPPORTED_TUNES_FORMAT 0
+#define MAVLINK_OFFSET_EVENT_DESTINATION_COMPONENT 10
+#define MAVLINK_OFFSET_EVENT_DESTINATION_SYSTEM 11
+#define MAVLINK_OFFSET_EVENT_ID 0
+#define MAVLINK_OFFSET_EVENT_EVENT_TIME_BOOT_MS 4
+#define MAVLINK_OFFSET_EVENT_SEQUENCE 8
+#define MAVLINK_OFFSET_EVENT_LOG_LEVELS 12
+#define MAVLINK_OFFSET_EVENT_ARGUMENTS 13
+#define MAVLINK_OFFSET_CURRENT_EVENT_SEQUENCE_SEQUENCE 0
+#define MAVLINK_OFFSET_CURRENT_EVENT_SEQUENCE_FLAGS 2
+#define MAVLINK_OFFSET_REQUEST_EVENT_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_REQUEST_EVENT_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_REQUEST_EVENT_FIRST_SEQUENCE 0
+#define MAVLINK_OFFSET_REQUEST_EVENT_LAST_SEQUENCE 2
+#define MAVLINK_OFFSET_RESPONSE_EVENT_ERROR_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_RESPONSE_EVENT_ERROR_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_RESPONSE_EVENT_ERROR_SEQUENCE 0
+#define MAVLINK_OFFSET_RESPONSE_EVENT_ERROR_SEQUENCE_OLDEST_AVAILABLE 2
+#define MAVLINK_OFFSET_RESPONSE_EVENT_ERROR_REASON 6
+#define MAVLINK_OFFSET_AVAILABLE_MODES_NUMBER_MODES 8
+#define MAVLINK_OFFSET_AVAILABLE_MODES_MODE_INDEX 9
+#define MAVLINK_OFFSET_AVAILABLE_MODES_STANDARD_MODE 10
+#define MAVLINK_OFFSET_AVAILABLE_MODES_CUSTOM_MODE 0
+#define MAVLINK_OFFSET_AVAILABLE_MODES_PROPERTIES 4
+#define MAVLINK_OFFSET_AVAILABLE_MODES_MODE_NAME 11
+#define MAVLINK_OFFSET_CURRENT_MODE_STANDARD_MODE 8
+#define MAVLINK_OFFSET_CURRENT_MODE_CUSTOM_MODE 0
+#define MAVLINK_OFFSET_CURRENT_MODE_INTENDED_CUSTOM_MODE 4
+#define MAVLINK_OFFSET_AVAILABLE_MODES_MONITOR_SEQ 0
+#define MAVLINK_OFFSET_WHEEL_DISTANCE_TIME_USEC 0
+#define MAVLINK_OFFSET_WHEEL_DISTANCE_COUNT 136
+#define MAVLINK_OFFSET_WHEEL_DISTANCE_DISTANCE 8
+#define MAVLINK_OFFSET_WINCH_STATUS_TIME_USEC 0
+#define MAVLINK_OFFSET_WINCH_STATUS_LINE_LENGTH 8
+#define MAVLINK_OFFSET_WINCH_STATUS_SPEED 12
+#define MAVLINK_OFFSET_WINCH_STATUS_TENSION 16
+#define MAVLINK_OFFSET_WINCH_STATUS_VOLTAGE 20
+#define MAVLINK_OFFSET_WINCH_STATUS_CURRENT 24
+#define MAVLINK_OFFSET_WINCH_STATUS_TEMPERATURE 32
+#define MAVLINK_OFFSET_WINCH_STATUS_STATUS 28
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_ICAO 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_CALLSIGN 6
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_EMITTERTYPE 15
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_AIRCRAFTSIZE 16
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_GPSOFFSETLAT 17
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_GPSOFFSETLON 18
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_STALLSPEED 4
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_RFSELECT 19
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_UTCTIME 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_GPSLAT 4
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_GPSLON 8
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_GPSALT 12
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_GPSFIX 38
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_NUMSATS 39
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_BAROALTMSL 16
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_ACCURACYHOR 20
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_ACCURACYVERT 24
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_ACCURACYVEL 26
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_VELVERT 28
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_VELNS 30
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_VELEW 32
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_EMERGENCYSTATUS 40
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_STATE 34
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_DYNAMIC_SQUAWK 36
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT_RFHEALTH 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_REGISTRATION_REGISTRATION 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CFG_FLIGHTID_FLIGHT_ID 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_GET_REQMESSAGEID 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_STATE 6
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_BAROALTMSL 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_SQUAWK 4
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_EMERGENCYSTATUS 7
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_FLIGHT_ID 8
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_CONTROL_X_BIT 16
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_STATE 2
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_SQUAWK 0
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_NIC_NACP 3
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_BOARDTEMP 4
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_FAULT 5
+#define MAVLINK_OFFSET_UAVIONIX_ADSB_OUT_STATUS_FLIGHT_ID 6
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_VOLT_BATT 0
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_CURR_BATT 4
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_CURR_GEN 8
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_CURR_ROT 12
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_FUEL_LEVEL 16
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_THROTTLE 20
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_RUNTIME 24
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_UNTIL_MAINTENANCE 28
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_RECTIFIER_TEMP 32
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_GENERATOR_TEMP 36
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_BATT 40
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_RPM 44
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_PW 48
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_FUEL_FLOW 52
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_FUEL_CONSUMED 56
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_BARO 60
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_MAT 64
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_CLT 68
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_TPS 72
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_EXHAUST_GAS_TEMPERATURE 76
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_INDEX 84
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_GENERATOR_STATUS 80
+#define MAVLINK_OFFSET_LOWEHEISER_GOV_EFI_EFI_STATUS 82
+#define MAVLINK_OFFSET_DEVICE_OP_READ_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_DEVICE_OP_READ_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REQUEST_ID 0
+#define MAVLINK_OFFSET_DEVICE_OP_READ_BUSTYPE 6
+#define MAVLINK_OFFSET_DEVICE_OP_READ_BUS 7
+#define MAVLINK_OFFSET_DEVICE_OP_READ_ADDRESS 8
+#define MAVLINK_OFFSET_DEVICE_OP_READ_BUSNAME 9
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REGSTART 49
+#define MAVLINK_OFFSET_DEVICE_OP_READ_COUNT 50
+#define MAVLINK_OFFSET_DEVICE_OP_READ_BANK 51
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_REQUEST_ID 0
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_RESULT 4
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_REGSTART 5
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_COUNT 6
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_DATA 7
+#define MAVLINK_OFFSET_DEVICE_OP_READ_REPLY_BANK 135
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_REQUEST_ID 0
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_BUSTYPE 6
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_BUS 7
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_ADDRESS 8
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_BUSNAME 9
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_REGSTART 49
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_COUNT 50
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_DATA 51
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_BANK 179
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_REPLY_REQUEST_ID 0
+#define MAVLINK_OFFSET_DEVICE_OP_WRITE_REPLY_RESULT 4
+#define MAVLINK_OFFSET_SECURE_COMMAND_TARGET_SYSTEM 8
+#define MAVLINK_OFFSET_SECURE_COMMAND_TARGET_COMPONENT 9
+#define MAVLINK_OFFSET_SECURE_COMMAND_SEQUENCE 0
+#define MAVLINK_OFFSET_SECURE_COMMAND_OPERATION 4
+#define MAVLINK_OFFSET_SECURE_COMMAND_DATA_LENGTH 10
+#define MAVLINK_OFFSET_SECURE_COMMAND_SIG_LENGTH 11
+#define MAVLINK_OFFSET_SECURE_COMMAND_DATA 12
+#define MAVLINK_OFFSET_SECURE_COMMAND_REPLY_SEQUENCE 0
+#define MAVLINK_OFFSET_SECURE_COMMAND_REPLY_OPERATION 4
+#define MAVLINK_OFFSET_SECURE_COMMAND_REPLY_RESULT 8
+#define MAVLINK_OFFSET_SECURE_COMMAND_REPLY_DATA_LENGTH 9
+#define MAVLINK_OFFSET_SECURE_COMMAND_REPLY_DATA 10
+#define MAVLINK_OFFSET_ADAP_TUNING_AXIS 48
+#define MAVLINK_OFFSET_ADAP_TUNING_DESIRED 0
+#define MAVLINK_OFFSET_ADAP_TUNING_ACHIEVED 4
+#define MAVLINK_OFFSET_ADAP_TUNING_ERROR 8
+#define MAVLINK_OFFSET_ADAP_TUNING_THETA 12
+#define MAVLINK_OFFSET_ADAP_TUNING_OMEGA 16
+#define MAVLINK_OFFSET_ADAP_TUNING_SIGMA 20
+#define MAVLINK_OFFSET_ADAP_TUNING_THETA_DOT 24
+#define MAVLINK_OFFSET_ADAP_TUNING_OMEGA_DOT 28
+#define MAVLINK_OFFSET_ADAP_TUNING_SIGMA_DOT 32
+#define MAVLINK_OFFSET_ADAP_TUNING_F 36
+#define MAVLINK_OFFSET_ADAP_TUNING_F_DOT 40
+#define MAVLINK_OFFSET_ADAP_TUNING_U 44
+#define MAVLINK_OFFSET_VISION_POSITION_DELTA_TIME_USEC 0
+#define MAVLINK_OFFSET_VISION_POSITION_DELTA_TIME_DELTA_USEC 8
+#define MAVLINK_OFFSET_VISION_POSITION_DELTA_ANGLE_DELTA 16
+#define MAVLINK_OFFSET_VISION_POSITION_DELTA_POSITION_DELTA 28
+#define MAVLINK_OFFSET_VISION_POSITION_DELTA_CONFIDENCE 40
+#define MAVLINK_OFFSET_AOA_SSA_TIME_USEC 0
+#define MAVLINK_OFFSET_AOA_SSA_AOA 8
+#define MAVLINK_OFFSET_AOA_SSA_SSA 12
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_1_TO_4_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_5_TO_8_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_9_TO_12_COUNT 32
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_TARGET_SYSTEM 16
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_TARGET_COMPONENT 17
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_REQUEST_ID 0
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_OSD_SCREEN 18
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_OSD_INDEX 19
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_PARAM_ID 20
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_CONFIG_TYPE 36
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_MIN_VALUE 4
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_MAX_VALUE 8
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_INCREMENT 12
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_REPLY_REQUEST_ID 0
+#define MAVLINK_OFFSET_OSD_PARAM_CONFIG_REPLY_RESULT 4
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REQUEST_ID 0
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_OSD_SCREEN 6
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_OSD_INDEX 7
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_REQUEST_ID 0
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_RESULT 16
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_PARAM_ID 17
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_CONFIG_TYPE 33
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_MIN_VALUE 4
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_MAX_VALUE 8
+#define MAVLINK_OFFSET_OSD_PARAM_SHOW_CONFIG_REPLY_INCREMENT 12
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_SENSOR_TYPE 26
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_FRAME 27
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_OBSTACLE_ID 24
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_X 4
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_Y 8
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_Z 12
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_MIN_DISTANCE 16
+#define MAVLINK_OFFSET_OBSTACLE_DISTANCE_3D_MAX_DISTANCE 20
+#define MAVLINK_OFFSET_WATER_DEPTH_TIME_BOOT_MS 0
+#define MAVLINK_OFFSET_WATER_DEPTH_ID 36
+#define MAVLINK_OFFSET_WATER_DEPTH_HEALTHY 37
+#define MAVLINK_OFFSET_WATER_DEPTH_LAT 4
+#define MAVLINK_OFFSET_WATER_DEPTH_LNG 8
+#define MAVLINK_OFFSET_WATER_DEPTH_ALT 12
+#define MAVLINK_OFFSET_WATER_DEPTH_ROLL 16
+#define MAVLINK_OFFSET_WATER_DEPTH_PITCH 20
+#define MAVLINK_OFFSET_WATER_DEPTH_YAW 24
+#define MAVLINK_OFFSET_WATER_DEPTH_DISTANCE 28
+#define MAVLINK_OFFSET_WATER_DEPTH_TEMPERATURE 32
+#define MAVLINK_OFFSET_MCU_STATUS_ID 8
+#define MAVLINK_OFFSET_MCU_STATUS_MCU_TEMPERATURE 0
+#define MAVLINK_OFFSET_MCU_STATUS_MCU_VOLTAGE 2
+#define MAVLINK_OFFSET_MCU_STATUS_MCU_VOLTAGE_MIN 4
+#define MAVLINK_OFFSET_MCU_STATUS_MCU_VOLTAGE_MAX 6
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_13_TO_16_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_17_TO_20_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_21_TO_24_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_25_TO_28_COUNT 32
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_TEMPERATURE 40
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_VOLTAGE 0
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_CURRENT 8
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_TOTALCURRENT 16
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_RPM 24
+#define MAVLINK_OFFSET_ESC_TELEMETRY_29_TO_32_COUNT 32
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_ID_OR_MAC 2
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_ID_TYPE 22
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_UA_TYPE 23
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_BASIC_ID_UAS_ID 24
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_TARGET_SYSTEM 30
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_TARGET_COMPONENT 31
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_ID_OR_MAC 32
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_STATUS 52
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_DIRECTION 24
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_SPEED_HORIZONTAL 26
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_SPEED_VERTICAL 28
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_LATITUDE 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_LONGITUDE 4
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_ALTITUDE_BAROMETRIC 8
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_ALTITUDE_GEODETIC 12
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_HEIGHT_REFERENCE 53
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_HEIGHT 16
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_HORIZONTAL_ACCURACY 54
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_VERTICAL_ACCURACY 55
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_BAROMETER_ACCURACY 56
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_SPEED_ACCURACY 57
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_TIMESTAMP 20
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_LOCATION_TIMESTAMP_ACCURACY 58
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_ID_OR_MAC 6
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_AUTHENTICATION_TYPE 26
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_DATA_PAGE 27
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_LAST_PAGE_INDEX 28
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_LENGTH 29
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_TIMESTAMP 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_AUTHENTICATION_AUTHENTICATION_DATA 30
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SELF_ID_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SELF_ID_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SELF_ID_ID_OR_MAC 2
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SELF_ID_DESCRIPTION_TYPE 22
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SELF_ID_DESCRIPTION 23
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_TARGET_SYSTEM 28
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_TARGET_COMPONENT 29
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_ID_OR_MAC 30
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_OPERATOR_LOCATION_TYPE 50
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_CLASSIFICATION_TYPE 51
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_OPERATOR_LATITUDE 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_OPERATOR_LONGITUDE 4
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_AREA_COUNT 24
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_AREA_RADIUS 26
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_AREA_CEILING 8
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_AREA_FLOOR 12
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_CATEGORY_EU 52
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_CLASS_EU 53
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_OPERATOR_ALTITUDE_GEO 16
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_TIMESTAMP 20
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_OPERATOR_ID_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_OPERATOR_ID_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_OPERATOR_ID_ID_OR_MAC 2
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_OPERATOR_ID_OPERATOR_ID_TYPE 22
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_OPERATOR_ID_OPERATOR_ID 23
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_TARGET_SYSTEM 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_TARGET_COMPONENT 1
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_ID_OR_MAC 2
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_SINGLE_MESSAGE_SIZE 22
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_MSG_PACK_SIZE 23
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_MESSAGE_PACK_MESSAGES 24
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_ARM_STATUS_STATUS 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_ARM_STATUS_ERROR 1
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_TARGET_SYSTEM 16
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_TARGET_COMPONENT 17
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_OPERATOR_LATITUDE 0
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_OPERATOR_LONGITUDE 4
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_OPERATOR_ALTITUDE_GEO 8
+#define MAVLINK_OFFSET_OPEN_DRONE_ID_SYSTEM_UPDATE_TIMESTAMP 12
+#define MAVLINK_OFFSET_HYGROMETER_SENSOR_ID 4
+#define MAVLINK_OFFSET_HYGROMETER_SENSOR_TEMPERATURE 0
+#define MAVLINK_OFFSET_HYGROMETER_SENSOR_HUMIDITY 2
+#define MAVLINK_OFFSET_ICAROUS_HEARTBEAT_STATUS 0
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_NUMBANDS 40
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_TYPE1 41
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MIN1 0
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MAX1 4
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_TYPE2 42
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MIN2 8
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MAX2 12
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_TYPE3 43
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MIN3 16
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MAX3 20
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_TYPE4 44
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MIN4 24
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MAX4 28
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_TYPE5 45
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MIN5 32
+#define MAVLINK_OFFSET_ICAROUS_KINEMATIC_BANDS_MAX5 36
+#define MAVLINK_OFFSET_CUBEPILOT_RAW_RC_RC_RAW 0
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_CAMERA_ID 14
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_STATUS 15
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_FRAMERATE 0
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_RESOLUTION_H 8
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_RESOLUTION_V 10
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_BITRATE 4
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_ROTATION 12
+#define MAVLINK_OFFSET_HERELINK_VIDEO_STREAM_INFORMATION_URI 16
+#define MAVLINK_OFFSET_HERELINK_TELEM_RSSI 16
+#define MAVLINK_OFFSET_HERELINK_TELEM_SNR 0
+#define MAVLINK_OFFSET_HERELINK_TELEM_RF_FREQ 4
+#define MAVLINK_OFFSET_HERELINK_TELEM_LINK_BW 8
+#define MAVLINK_OFFSET_HERELINK_TELEM_ANGLE 12
+#define MAVLINK_OFFSET_HERELINK_TELEM_CPU_TEMP 17
+#define MAVLINK_OFFSET_HERELINK_TELEM_BOARD_TEMP 18
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_START_TARGET_SYSTEM 8
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_START_TARGET_COMPONENT 9
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_START_SIZE 0
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_START_CRC 4
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_RESP_TARGET_SYSTEM 4
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_RESP_TARGET_COMPONENT 5
+#define MAVLINK_OFFSET_CUBEPILOT_FIRMWARE_UPDATE_RESP_OFFSET 0
+#define MAVLINK_OFFSET_AIRLINK_AUTH_LOGIN 0
+#define MAVLINK_OFFSET_AIRLINK_AUTH_PASSWORD 50
+#define MAVLINK_OFFSET_AIRLINK_AUTH_RESPONSE_RESP_TYPE 0
+
+#endif /* MAVLINK_MSGDEFS_H */
@@ -0,0 +1,69 @@
+/*
+ * mavlink_msgs.c - MAVLink消息元数据表
+ * 表本身由scripts/gen_msgdefs.py根据mavlink目录下的XML方言生成（mavlink_msgdefs.c），这里只建立索引
+ *
+ * 查找采用两级索引：消息ID高位定位页，低8位定位页内表项。
+ * 未使用的页和页内空位都指向0号占位项，查找过程没有分支判断。
+ */
+
+#include "mavlink_msgs.h"
+
+#define MSG_PAGE_BITS 8             // 每页覆盖256个消息ID
+#define MSG_PAGE_COUNT 256          // 一级索引覆盖0~65535（已定义消息均在此范围）
+#define MSG_MAX_PAGES MAVLINK_MSGDEF_PAGES // 使用的页数（0号为空页），由生成器统计
+
+static const char *g_category_names[MAVLINK_CAT_COUNT] = {
+    "未知消息",
+    "连接管理",
+    "系统信息",
+    "遥测数据",
+    "参数操作",
+    "任务操作",
+    "命令控制",
+    "位置控制",
+    "手动控制",
+    "数据请求",
+    "地形信息",
+    "其他消息",
+};
+
+static uint8_t g_page_index[MSG_PAGE_COUNT];              // 高位 -> 页号
+static uint16_t g_pages[MSG_MAX_PAGES][1 << MSG_PAGE_BITS]; // 低8位 -> 表项下标
+
+void mavlink_msgs_init(void) {
+    int used_pages = 1;
+    
+    for (size_t i = 1; i < MAVLINK_MSGDEF_COUNT; i++) {
+        uint32_t msgid = g_mavlink_msg_info[i].msgid;
+        uint32_t high = msgid >> MSG_PAGE_BITS;
+        
+        if (high >= MSG_PAGE_COUNT) {
+            continue;
+        }
+        if (g_page_index[high] == 0) {
+            if (used_pages == MSG_MAX_PAGES) {
+                continue;
+            }
+            g_page_index[high] = (uint8_t)used_pages++;
+        }
+        g_pages[g_page_index[high]][msgid & 0xFF] = (uint16_t)i;
+    }
+}
+
+const mavlink_msg_info_t *mavlink_msg_lookup(uint32_t msgid) {
+    // 超出一级索引范围的ID映射到0号空页
+    uint32_t high = msgid >> MSG_PAGE_BITS;
+    uint8_t page = (high < MSG_PAGE_COUNT) ? g_page_index[high] : 0;
+    return &g_mavlink_msg_info[g_pages[page][msgid & 0xFF]];
+}
+
+const mavlink_field_info_t *mavlink_msg_fields(const mavlink_msg_info_t *info) {
+    return g_mavlink_msg_fields[info - g_mavlink_msg_info];
+}
+
+const char *mavlink_category_name(uint8_t category) {
+    if (category >= MAVLINK_CAT_COUNT) {
+        category = MAVLINK_CAT_UNKNOWN;
+    }
+    return g_category_names[category];
+}
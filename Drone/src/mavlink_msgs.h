@@ -0,0 +1,19 @@
+/*
+ * mavlink_msgs.h - MAVLink消息元数据表
+ */
+
+#ifndef MAVLINK_MSGS_H
+#define MAVLINK_MSGS_H
+
+#include "mavlink.h"
+
+/* 生成的元数据表和字段描述符（src/mavlink_msgdefs.c），两者下标一一对应 */
+extern const mavlink_msg_info_t g_mavlink_msg_info[MAVLINK_MSGDEF_COUNT];
+extern const mavlink_field_info_t *const g_mavlink_msg_fields[MAVLINK_MSGDEF_COUNT];
+
+/**
+ * 建立消息ID到元数据的索引（由mavlink_init调用）
+ */
+void mavlink_msgs_init(void);
+
+#endif /* MAVLINK_MSGS_H */
@@ -0,0 +1,109 @@
+/*
+ * mavlink_scan.c - MAVLink帧起始标志（STX）扫描实现
+ * 噪声数据中STX候选约每128字节出现一次，向量化比较可一次跳过整块垃圾
+ */
+
+#include "mavlink_scan.h"
+#include "mavlink.h"
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define SCAN_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+static size_t scan_stx_scalar(const uint8_t *data, size_t len);
+
+static size_t (*g_scan_stx)(const uint8_t *, size_t) = scan_stx_scalar;
+static mavlink_scan_impl_t g_scan_impl = MAVLINK_SCAN_IMPL_SCALAR;
+
+static size_t scan_stx_scalar(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] == MAVLINK_STX_V1 || data[i] == MAVLINK_STX_V2) {
+            return i;
+        }
+    }
+    return len;
+}
+
+#ifdef SCAN_HAVE_X86
+static size_t scan_stx_sse2(const uint8_t *data, size_t len) {
+    const __m128i stx_v1 = _mm_set1_epi8((char)MAVLINK_STX_V1);
+    const __m128i stx_v2 = _mm_set1_epi8((char)MAVLINK_STX_V2);
+    size_t i = 0;
+    
+    for (; i + 16 <= len; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(block, stx_v1), _mm_cmpeq_epi8(block, stx_v2));
+        int mask = _mm_movemask_epi8(hit);
+        if (mask) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    
+    return i + scan_stx_scalar(data + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static size_t scan_stx_avx2(const uint8_t *data, size_t len) {
+    const __m256i stx_v1 = _mm256_set1_epi8((char)MAVLINK_STX_V1);
+    const __m256i stx_v2 = _mm256_set1_epi8((char)MAVLINK_STX_V2);
+    size_t i = 0;
+    
+    for (; i + 32 <= len; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(block, stx_v1), _mm256_cmpeq_epi8(block, stx_v2));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(hit);
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    
+    return i + scan_stx_sse2(data + i, len - i);
+}
+#endif
+
+void mavlink_scan_init(void) {
+    mavlink_scan_select(MAVLINK_SCAN_IMPL_AUTO);
+}
+
+mavlink_scan_impl_t mavlink_scan_select(mavlink_scan_impl_t impl) {
+#ifdef SCAN_HAVE_X86
+    __builtin_cpu_init();
+    int have_avx2 = __builtin_cpu_supports("avx2");
+    
+    if (impl == MAVLINK_SCAN_IMPL_AUTO || (impl == MAVLINK_SCAN_IMPL_AVX2 && !have_avx2)) {
+        impl = have_avx2 ? MAVLINK_SCAN_IMPL_AVX2 : MAVLINK_SCAN_IMPL_SSE2;
+    }
+    
+    switch (impl) {
+        case MAVLINK_SCAN_IMPL_AVX2:
+            g_scan_stx = scan_stx_avx2;
+            break;
+        case MAVLINK_SCAN_IMPL_SSE2:
+            g_scan_stx = scan_stx_sse2;
+            break;
+        default:
+            impl = MAVLINK_SCAN_IMPL_SCALAR;
+            g_scan_stx = scan_stx_scalar;
+            break;
+    }
+#else
+    impl = MAVLINK_SCAN_IMPL_SCALAR;
+    g_scan_stx = scan_stx_scalar;
+#endif
+    
+    g_scan_impl = impl;
+    return impl;
+}
+
+const char *mavlink_scan_impl_name(void) {
+    switch (g_scan_impl) {
+        case MAVLINK_SCAN_IMPL_AVX2: return "avx2";
+        case MAVLINK_SCAN_IMPL_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+size_t mavlink_scan_stx(const uint8_t *data, size_t len) {
+    return g_scan_stx(data, len);
+}
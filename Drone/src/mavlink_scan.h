@@ -0,0 +1,45 @@
+/*
+ * mavlink_scan.h - MAVLink帧起始标志（STX）扫描
+ */
+
+#ifndef MAVLINK_SCAN_H
+#define MAVLINK_SCAN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* 扫描实现 */
+typedef enum {
+    MAVLINK_SCAN_IMPL_AUTO = 0,     // 按CPU特性自动选择
+    MAVLINK_SCAN_IMPL_SCALAR,       // 逐字节比较
+    MAVLINK_SCAN_IMPL_SSE2,         // 每次比较16字节
+    MAVLINK_SCAN_IMPL_AVX2          // 每次比较32字节
+} mavlink_scan_impl_t;
+
+/**
+ * 按CPU特性选择扫描实现（由mavlink_init调用）
+ */
+void mavlink_scan_init(void);
+
+/**
+ * 切换扫描实现，CPU不支持时退回可用的最快实现
+ * @param impl 实现类型
+ * @return 实际使用的实现
+ */
+mavlink_scan_impl_t mavlink_scan_select(mavlink_scan_impl_t impl);
+
+/**
+ * 获取当前实现名称
+ * @return 实现名称
+ */
+const char *mavlink_scan_impl_name(void);
+
+/**
+ * 查找第一个STX候选字节（0xFE或0xFD）
+ * @param data 数据
+ * @param len 数据长度
+ * @return 候选字节的偏移，没有找到返回len
+ */
+size_t mavlink_scan_stx(const uint8_t *data, size_t len);
+
+#endif /* MAVLINK_SCAN_H */
@@ -0,0 +1,247 @@
+/*
+ * mavlink_sign.c - MAVLink v2签名识别与校验
+ *
+ * 签名 = SHA-256(密钥 + 帧头 + 载荷 + 校验和 + 链路ID + 时间戳) 的前6字节。
+ * 每条链路缓存验证通过的密钥和上一帧时间戳，后续帧只需一次SHA-256。
+ */
+
+#include "mavlink_sign.h"
+#include "sha256.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#define SIGN_TIMESTAMP_OFFSET 1     // 签名块内时间戳偏移
+#define SIGN_DIGEST_OFFSET 7        // 签名块内签名偏移
+#define SIGN_DIGEST_LEN 6           // 签名长度
+
+typedef struct {
+    char name[MAVLINK_SIGN_KEY_NAME_LEN];
+    uint8_t key[MAVLINK_SIGN_KEY_LEN];
+} sign_key_t;
+
+static sign_key_t g_keys[MAVLINK_SIGN_MAX_KEYS];
+static int g_key_count = 0;
+
+static int hex_value(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c = tolower(c);
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * 解析密钥文本：64位十六进制，或passphrase:口令
+ * @return 0成功，-1格式错误
+ */
+static int parse_key(const char *text, uint8_t key[MAVLINK_SIGN_KEY_LEN]) {
+    if (strncmp(text, "passphrase:", 11) == 0) {
+        sha256(text + 11, strlen(text + 11), key);
+        return 0;
+    }
+    if (strlen(text) != MAVLINK_SIGN_KEY_LEN * 2) {
+        return -1;
+    }
+    for (int i = 0; i < MAVLINK_SIGN_KEY_LEN; i++) {
+        int hi = hex_value((unsigned char)text[i * 2]);
+        int lo = hex_value((unsigned char)text[i * 2 + 1]);
+        if (hi < 0 || lo < 0) {
+            return -1;
+        }
+        key[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return 0;
+}
+
+int mavlink_sign_load_keys(const char *path) {
+    FILE *fp = fopen(path, "re");
+    if (!fp) {
+        perror("无法打开签名密钥文件");
+        return -1;
+    }
+    
+    char line[256];
+    int lineno = 0;
+    g_key_count = 0;
+    
+    while (fgets(line, sizeof(line), fp)) {
+        char name[MAVLINK_SIGN_KEY_NAME_LEN];
+        char key_text[160];
+        lineno++;
+        
+        char *p = line;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        if (sscanf(p, "%31s %159s", name, key_text) != 2 ||
+            g_key_count == MAVLINK_SIGN_MAX_KEYS ||
+            parse_key(key_text, g_keys[g_key_count].key) < 0) {
+            fprintf(stderr, "[签名] %s:%d 无效的密钥行（最多%d个密钥）\n", path, lineno, MAVLINK_SIGN_MAX_KEYS);
+            fclose(fp);
+            g_key_count = 0;
+            return -1;
+        }
+        snprintf(g_keys[g_key_count].name, sizeof(g_keys[g_key_count].name), "%s", name);
+        g_key_count++;
+    }
+    
+    fclose(fp);
+    return g_key_count;
+}
+
+int mavlink_sign_key_count(void) {
+    return g_key_count;
+}
+
+const char *mavlink_sign_key_name(int index) {
+    return (index >= 0 && index < g_key_count) ? g_keys[index].name : "-";
+}
+
+const char *mavlink_sign_status_name(uint8_t status) {
+    switch (status) {
+        case MAVLINK_SIGN_VALID: return "签名有效";
+        case MAVLINK_SIGN_NO_KEYS: return "未配置密钥";
+        case MAVLINK_SIGN_BAD: return "签名无效";
+        case MAVLINK_SIGN_REPLAY: return "时间戳重放";
+    }
+    return "未知";
+}
+
+void mavlink_sign_cache_init(mavlink_sign_cache_t *cache) {
+    memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * 用指定密钥计算签名并比较
+ * 签名覆盖从STX到签名块时间戳结束的全部字节
+ */
+static int sign_verify(const uint8_t key[MAVLINK_SIGN_KEY_LEN], const mavlink_frame_t *frame) {
+    uint8_t digest[SHA256_DIGEST_LEN];
+    sha256_ctx_t ctx;
+    
+    sha256_init(&ctx);
+    sha256_update(&ctx, key, MAVLINK_SIGN_KEY_LEN);
+    sha256_update(&ctx, frame->data, (size_t)(frame->signature - frame->data) + SIGN_DIGEST_OFFSET);
+    sha256_final(&ctx, digest);
+    return memcmp(digest, frame->signature + SIGN_DIGEST_OFFSET, SIGN_DIGEST_LEN) == 0;
+}
+
+/* 尝试全部密钥，返回匹配的下标或-1 */
+static int sign_find_key(const mavlink_frame_t *frame) {
+    for (int i = 0; i < g_key_count; i++) {
+        if (sign_verify(g_keys[i].key, frame)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint32_t sign_link_hash(uint32_t addr, uint16_t port, uint8_t sysid, uint8_t compid, uint8_t link_id) {
+    uint64_t h = ((uint64_t)addr << 32) ^ ((uint64_t)port << 24) ^
+                 ((uint32_t)sysid << 16) ^ ((uint32_t)compid << 8) ^ link_id;
+    h *= 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(h >> 32);
+}
+
+/**
+ * 查找或分配链路缓存项（线性探测，探测范围内都被占用时替换起始项）
+ * @return 缓存项，*is_new为1表示新分配
+ */
+static mavlink_sign_link_t *sign_link_get(mavlink_sign_cache_t *cache, uint32_t addr, uint16_t port,
+                                          uint8_t sysid, uint8_t compid, uint8_t link_id, int *is_new) {
+    uint32_t home = sign_link_hash(addr, port, sysid, compid, link_id) & (MAVLINK_SIGN_CACHE_SIZE - 1);
+    mavlink_sign_link_t *free_slot = NULL;
+    
+    for (uint32_t i = 0; i < MAVLINK_SIGN_CACHE_PROBES; i++) {
+        mavlink_sign_link_t *link = &cache->links[(home + i) & (MAVLINK_SIGN_CACHE_SIZE - 1)];
+        if (!link->used) {
+            if (!free_slot) {
+                free_slot = link;
+            }
+            continue;
+        }
+        if (link->addr == addr && link->port == port && link->sysid == sysid &&
+            link->compid == compid && link->link_id == link_id) {
+            *is_new = 0;
+            return link;
+        }
+    }
+    
+    if (!free_slot) {
+        free_slot = &cache->links[home];
+        cache->evictions++;
+    }
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->addr = addr;
+    free_slot->port = port;
+    free_slot->sysid = sysid;
+    free_slot->compid = compid;
+    free_slot->link_id = link_id;
+    free_slot->used = 1;
+    free_slot->key_index = -1;
+    *is_new = 1;
+    return free_slot;
+}
+
+void mavlink_sign_check(mavlink_sign_cache_t *cache, uint32_t addr, uint16_t port,
+                        const mavlink_frame_t *frame, mavlink_sign_result_t *result) {
+    const uint8_t *sig = frame->signature;
+    uint64_t timestamp = 0;
+    int is_new;
+    
+    for (int i = SIGN_DIGEST_OFFSET - 1; i >= SIGN_TIMESTAMP_OFFSET; i--) {
+        timestamp = (timestamp << 8) | sig[i];
+    }
+    
+    mavlink_sign_link_t *link = sign_link_get(cache, addr, port, frame->sysid, frame->compid, sig[0], &is_new);
+    uint8_t prev_status = link->status;
+    uint8_t status;
+    
+    int key_index = -1;             // 本帧匹配的密钥
+    
+    if (g_key_count == 0) {
+        status = MAVLINK_SIGN_NO_KEYS;
+    } else if (link->key_index >= 0) {
+        // 快速路径：链路已验证过，只用缓存的密钥算一次
+        cache->fast_checks++;
+        if (sign_verify(g_keys[link->key_index].key, frame)) {
+            key_index = link->key_index;
+        } else {
+            // 缓存的密钥不匹配：可能是对方换了密钥，也可能只是一帧伪造或损坏的数据，重新尝试全部密钥；
+            // 都不匹配时保留缓存的密钥，只把这一帧判为无效
+            cache->full_checks++;
+            key_index = sign_find_key(frame);
+            if (key_index >= 0) {
+                link->key_index = (int8_t)key_index;
+            }
+        }
+        status = MAVLINK_SIGN_BAD;
+    } else if (is_new) {
+        // 新链路：尝试全部密钥
+        cache->full_checks++;
+        key_index = sign_find_key(frame);
+        link->key_index = (int8_t)key_index;
+        status = MAVLINK_SIGN_BAD;
+    } else {
+        // 曾经无法验证的链路不再重复尝试
+        status = MAVLINK_SIGN_BAD;
+    }
+    
+    // 签名通过的帧（包括换密钥后重新匹配的）都要检查时间戳，只有有效帧推进时间戳
+    if (key_index >= 0) {
+        status = (timestamp > link->last_timestamp) ? MAVLINK_SIGN_VALID : MAVLINK_SIGN_REPLAY;
+    }
+    if (status == MAVLINK_SIGN_VALID) {
+        link->last_timestamp = timestamp;
+    }
+    link->status = status;
+    
+    result->status = status;
+    result->changed = is_new || status != prev_status;
+    result->key_index = (int8_t)key_index;
+    result->link_id = sig[0];
+    result->timestamp = timestamp;
+}
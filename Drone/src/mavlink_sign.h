@@ -0,0 +1,101 @@
+/*
+ * mavlink_sign.h - MAVLink v2签名识别与校验
+ */
+
+#ifndef MAVLINK_SIGN_H
+#define MAVLINK_SIGN_H
+
+#include "mavlink.h"
+
+#define MAVLINK_SIGN_KEY_LEN 32         // 签名密钥长度
+#define MAVLINK_SIGN_MAX_KEYS 16        // 密钥集合上限
+#define MAVLINK_SIGN_KEY_NAME_LEN 32    // 密钥名称长度上限
+#define MAVLINK_SIGN_CACHE_SIZE 256     // 链路缓存项数（2的幂）
+#define MAVLINK_SIGN_CACHE_PROBES 8     // 链路缓存最大探测次数
+
+/* 签名校验结果 */
+typedef enum {
+    MAVLINK_SIGN_VALID = 0,         // 签名正确，时间戳递增
+    MAVLINK_SIGN_NO_KEYS,           // 未配置密钥，只识别不校验
+    MAVLINK_SIGN_BAD,               // 没有密钥能验证该签名
+    MAVLINK_SIGN_REPLAY             // 签名正确但时间戳没有递增（重放）
+} mavlink_sign_status_t;
+
+/* 链路缓存项：同一来源、系统ID、组件ID、链路ID的签名流 */
+typedef struct {
+    uint32_t addr;                  // 来源IPv4地址（网络字节序）
+    uint16_t port;                  // 来源端口（网络字节序）
+    uint8_t sysid;                  // 系统ID
+    uint8_t compid;                 // 组件ID
+    uint8_t link_id;                // 签名链路ID
+    uint8_t used;                   // 1表示已占用
+    uint8_t status;                 // 上一帧的mavlink_sign_status_t
+    int8_t key_index;               // 验证通过的密钥下标，-1表示没有匹配的密钥
+    uint64_t last_timestamp;        // 最近一个有效帧的签名时间戳（10微秒，自2015-01-01起）
+} mavlink_sign_link_t;
+
+/* 链路缓存：已知链路只用缓存的密钥校验一次，新链路才尝试全部密钥 */
+typedef struct {
+    mavlink_sign_link_t links[MAVLINK_SIGN_CACHE_SIZE];
+    uint64_t full_checks;           // 尝试全部密钥的次数
+    uint64_t fast_checks;           // 用缓存密钥校验的次数
+    uint64_t evictions;             // 缓存已满时替换的链路数
+} mavlink_sign_cache_t;
+
+/* 单帧校验结果 */
+typedef struct {
+    uint8_t status;                 // mavlink_sign_status_t
+    uint8_t changed;                // 1表示新链路或状态变化（需要记录日志）
+    int8_t key_index;               // 匹配的密钥下标，-1表示无
+    uint8_t link_id;                // 签名链路ID
+    uint64_t timestamp;             // 签名时间戳（10微秒，自2015-01-01起）
+} mavlink_sign_result_t;
+
+/**
+ * 从文件加载签名密钥集合
+ * 每行“名称 密钥”，密钥为64位十六进制，或“passphrase:口令”（取口令的SHA-256，与地面站一致）；
+ * #开头为注释
+ * @param path 密钥文件路径
+ * @return 加载的密钥数，-1失败
+ */
+int mavlink_sign_load_keys(const char *path);
+
+/**
+ * 获取已加载的密钥数
+ */
+int mavlink_sign_key_count(void);
+
+/**
+ * 获取密钥名称
+ * @param index 密钥下标
+ * @return 名称，下标无效时返回"-"
+ */
+const char *mavlink_sign_key_name(int index);
+
+/**
+ * 获取校验结果的中文描述
+ * @param status mavlink_sign_status_t
+ */
+const char *mavlink_sign_status_name(uint8_t status);
+
+/**
+ * 初始化链路缓存
+ * @param cache 链路缓存
+ */
+void mavlink_sign_cache_init(mavlink_sign_cache_t *cache);
+
+/**
+ * 校验一帧签名帧（frame->signature不为NULL）
+ * 已知链路只用缓存的密钥计算一次SHA-256并检查时间戳；新链路尝试全部密钥；
+ * 曾经无法验证的链路不再重复计算。缓存的密钥不匹配时重新尝试全部密钥（匹配到新密钥同样检查时间戳），
+ * 都不匹配则保留缓存的密钥，只把这一帧判为无效。只有有效帧推进链路的时间戳。
+ * @param cache 链路缓存
+ * @param addr 来源IPv4地址（网络字节序）
+ * @param port 来源端口（网络字节序）
+ * @param frame 签名帧
+ * @param result 输出的校验结果
+ */
+void mavlink_sign_check(mavlink_sign_cache_t *cache, uint32_t addr, uint16_t port,
+                        const mavlink_frame_t *frame, mavlink_sign_result_t *result);
+
+#endif /* MAVLINK_SIGN_H */
@@ -5,30 +5,132 @@
 
 #include "proxy.h"
 #include "mavlink.h"
+#include "mavlink_sign.h"
+#include "filter.h"
+#include "session.h"
+#include "backend.h"
 #include "logger.h"
+#include "config.h"
+#include "evloop.h"
+#include "uring.h"
+#include "decoy.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
 #include <sys/socket.h>
-#include <sys/select.h>
+#include <sys/uio.h>
+#include <sys/eventfd.h>
 #include <arpa/inet.h>
+#include <netdb.h>
 #include <time.h>
+#include <signal.h>
+#include <pthread.h>
+
+/*
+ * 本轮收到的发往SITL的数据报（指向接收缓冲区）。一轮接收处理完后按连接合并成一次writev，
+ * 没写完的拷贝进该连接的发送队列，之后接收缓冲区即可重用
+ */
+typedef struct {
+    backend_t *backend;             // 后端池实例，NULL表示共享SITL
+    int fd;                         // 排队时实例的连接，发送前确认没有变化
+    const uint8_t *data;
+    uint16_t len;                   // 0表示已随同一连接的前一个数据报发出
+    uint8_t prio;                   // txq_prio_t
+} proxy_sitl_send_t;
+
+/*
+ * 工作线程：各自持有一个SO_REUSEPORT的UDP socket、事件循环、会话表、后端池和统计分片。
+ * 内核按来源地址把数据报固定分给某个socket，同一客户端始终由同一个线程处理，热路径上无锁。
+ * worker 0运行在主线程，另外负责信号、统计输出和共享SITL连接。
+ */
+typedef struct proxy_worker {
+    int id;                         // 编号，0为主线程
+    pthread_t thread;
+    int sock;                       // 外部UDP socket
+    evloop_t loop;                  // 本线程的事件循环
+    evloop_source_t external_src;   // 外部UDP socket事件源
+    evloop_source_t session_timer;  // 空闲会话回收
+    session_table_t sessions;       // 客户端会话（每个来源地址独立的解析器和过滤状态）
+    pthread_mutex_t session_lock;   // 增删会话时持有；共享SITL模式下worker 0扇出时读取其他线程的会话
+    mavlink_sign_cache_t sign_cache; // 签名链路缓存
+    backend_pool_t pool;            // 本线程的SITL实例
+    proxy_stats_t stats;            // 统计分片
+    uint8_t *egress_buf;            // 待发往客户端的数据报，udp_batch个MTU连续存放
+    size_t egress_len;              // 已写入的字节数
+    size_t egress_start;            // 当前未封口数据报的起点
+    struct iovec tx_iovs[PROXY_MAX_UDP_BATCH];
+    struct mmsghdr tx_msgs[PROXY_MAX_UDP_BATCH];
+    unsigned tx_count;              // 已封口、等待sendmmsg的数据报数
+    session_t *egress_target;       // 非NULL时只发给该会话（后端池模式），NULL时发给所有会话
+    uint8_t rx_bufs[PROXY_MAX_UDP_BATCH][PROXY_BUFFER_SIZE]; // recvmmsg接收缓冲区
+    struct sockaddr_in rx_addrs[PROXY_MAX_UDP_BATCH];
+    struct iovec rx_iovs[PROXY_MAX_UDP_BATCH];
+    struct mmsghdr rx_msgs[PROXY_MAX_UDP_BATCH];
+    int use_uring;                  // 客户端数据路径使用io_uring（否则为recvmmsg）
+    uring_t ring;                   // 本线程的io_uring
+    uring_bufs_t ring_bufs;         // 多次接收使用的provided buffer
+    evloop_source_t ring_src;       // io_uring描述符事件源（有完成事件时可读）
+    struct msghdr recv_msg;         // 多次接收的模板，只用到地址和控制信息长度
+    int recv_armed;                 // 多次接收仍有效
+    int recv_seen;                  // 收到过数据（用于判断内核是否支持多次recvmsg）
+    proxy_sitl_send_t sitl_sends[PROXY_URING_BUFS]; // 本轮等待合并发往SITL的数据报
+    unsigned sitl_send_count;
+} proxy_worker_t;
+
+/* 发往客户端的目标：UDP地址及发出的socket（代理主端口或诱饵端口），或诱饵端口上的TCP连接 */
+typedef struct {
+    struct sockaddr_in addr;
+    int fd;
+    decoy_conn_t *conn;             // 非NULL时经该连接发出，addr和fd不使用
+} proxy_egress_target_t;
 
 /* 全局变量 */
-static int g_external_sock = -1;    // 外部socket（监听客户端）
-static int g_internal_sock = -1;    // 内部socket（连接SITL）
-static struct sockaddr_in g_sitl_addr; // SITL地址
-static proxy_client_t g_client;     // 客户端信息
-static proxy_stats_t g_stats;       // 统计信息
-static volatile int g_proxy_running = 1;
+static proxy_worker_t *g_workers[PROXY_MAX_WORKERS];
+static unsigned g_worker_count = 0;
+static int g_internal_sock = -1;    // 内部socket（连接共享SITL，由worker 0接收）
+static pthread_mutex_t g_sitl_lock = PTHREAD_MUTEX_INITIALIZER; // 各线程向共享SITL发送时持有
+static mavlink_parser_t g_sitl_parser;   // SITL TCP流重组解析器
+static proxy_egress_target_t *g_fanout_targets = NULL; // 共享SITL模式下扇出的目标快照（所有线程的会话）
+static proxy_stats_t g_stats_total;  // proxy_get_stats()的汇总结果
+static evloop_source_t g_internal_src;  // SITL TCP连接事件源
+static evloop_source_t g_stats_timer;   // 周期统计输出
+static evloop_source_t g_signal_src;    // SIGINT/SIGTERM
+static txq_t g_sitl_txq;                // 共享SITL的发送队列（持g_sitl_lock）
+static txq_stats_t g_sitl_txq_stats;
+static int g_sitl_want_write = 0;       // 共享连接上关注了EPOLLOUT（持g_sitl_lock）
+static evloop_source_t g_reconnect_timer; // 共享SITL重连退避和连接超时
+static uint64_t g_reconnect_delay_ms;   // 下次重连前的等待
+static int g_sitl_connecting = 0;       // 非阻塞连接进行中（g_internal_src关注EPOLLOUT）
+static struct timespec g_sitl_down_at;  // 最近一次断开（或启动）的时刻（CLOCK_MONOTONIC）
+static struct sockaddr_in g_sitl_addr;  // 缓存的SITL地址（worker 0），连接失败后才在后台重新解析
+static int g_sitl_addr_valid = 0;       // 0表示还没有解析出地址
+static pthread_t g_resolve_thread;      // 后台解析线程（同一时间最多一个）
+static int g_resolving = 0;             // 后台解析进行中（worker 0）
+static evloop_source_t g_resolve_src;   // 后台解析完成通知（eventfd，挂在worker 0上）
+static struct sockaddr_in g_resolve_addr; // 后台解析的结果，worker 0在join之后读取
+static int g_resolve_ok;
+static decoy_engine_t g_decoys;         // 诱饵端口（挂在worker 0的事件循环上，其会话也属于worker 0）
+
+/* 占位心跳（SITL未就绪时代答客户端）：默认为ArduPilot固定翼、启动中，收到过SITL心跳后照抄其内容（持g_sitl_lock） */
+#define HEARTBEAT_PAYLOAD_LEN 9
+#define MAV_AUTOPILOT_ARDUPILOTMEGA 3
+#define MAV_AUTOPILOT_INVALID 8
+#define MAV_MODE_FLAG_CUSTOM_MODE_ENABLED 1
+#define MAV_STATE_BOOT 1
+static uint8_t g_placeholder_payload[HEARTBEAT_PAYLOAD_LEN] = {
+    0, 0, 0, 0, PROXY_PLACEHOLDER_TYPE, MAV_AUTOPILOT_ARDUPILOTMEGA, MAV_MODE_FLAG_CUSTOM_MODE_ENABLED,
+    MAV_STATE_BOOT, 3
+};
+static uint8_t g_placeholder_sysid = 1;
+static uint8_t g_placeholder_compid = 1;
 
 /**
  * 创建UDP socket
  */
-static int create_udp_socket(uint16_t port, int reuse) {
-    int sockfd = socket(AF_INET, SOCK_DGRAM, 0);
+static int create_udp_socket(uint16_t port, int reuse, int reuseport) {
+    int sockfd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
     if (sockfd < 0) {
         perror("UDP socket创建失败");
         return -1;
@@ -42,6 +144,16 @@ static int create_udp_socket(uint16_t port, int reuse) {
         }
     }
     
+    // 多个工作线程绑定同一端口
+    if (reuseport) {
+        int opt = 1;
+        if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) < 0) {
+            perror("setsockopt(SO_REUSEPORT)失败");
+            close(sockfd);
+            return -1;
+        }
+    }
+    
     // 绑定端口
     if (port > 0) {
         struct sockaddr_in addr;
@@ -61,336 +173,1747 @@ static int create_udp_socket(uint16_t port, int reuse) {
 }
 
 /**
- * 创建TCP socket并连接到SITL
+ * 解析SITL地址（支持docker-compose中的服务名）。getaddrinfo会阻塞，只在启动时和后台解析线程中调用
+ * @return 0成功，-1无效地址
  */
-static int create_tcp_connection(const char *host, uint16_t port) {
-    int sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    if (sockfd < 0) {
-        perror("TCP socket创建失败");
-        return -1;
-    }
+static int resolve_sitl_addr(const char *host, uint16_t port, struct sockaddr_in *addr) {
+    struct addrinfo hints;
+    struct addrinfo *res = NULL;
     
-    // 设置地址
-    struct sockaddr_in addr;
-    memset(&addr, 0, sizeof(addr));
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    if (inet_pton(AF_INET, host, &addr.sin_addr) <= 0) {
-        fprintf(stderr, "无效的地址: %s\n", host);
-        close(sockfd);
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, NULL, &hints, &res) != 0 || !res) {
         return -1;
     }
+    memcpy(addr, res->ai_addr, sizeof(*addr));
+    addr->sin_port = htons(port);
+    freeaddrinfo(res);
+    return 0;
+}
+
+/**
+ * 后台解析线程：解析完成后通过eventfd通知worker 0
+ */
+static void *resolve_main(void *arg) {
+    const honeypot_config_t *config = config_get();
+    uint64_t one = 1;
+    (void)arg;
     
-    // 连接
-    printf("正在连接 SITL (%s:%d)...\n", host, port);
-    if (connect(sockfd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
-        perror("TCP连接失败");
-        close(sockfd);
-        return -1;
+    g_resolve_ok = resolve_sitl_addr(config->sitl_host, config->sitl_port, &g_resolve_addr) == 0;
+    if (write(g_resolve_src.fd, &one, sizeof(one)) < 0) {
+        // eventfd计数溢出才会失败，同一时间只有一个解析线程，不会发生
     }
-    
-    printf("TCP连接成功\n");
-    return sockfd;
+    return NULL;
 }
 
-static int g_sitl_connected = 0;    // SITL连接状态
-
 /**
- * 转发数据到SITL（通过TCP）
+ * 连接失败后在后台重新解析SITL地址（worker 0；容器重建后地址可能变化），正在解析时不重复发起
  */
-static void forward_to_sitl(const uint8_t *data, size_t len) {
-    if (!g_sitl_connected || g_internal_sock < 0) {
+static void sitl_resolve_start(void) {
+    if (g_resolving || g_resolve_src.fd < 0) {
         return;
     }
     
-    ssize_t sent = send(g_internal_sock, data, len, 0);
-    if (sent < 0) {
-        perror("发送到SITL失败");
-        g_sitl_connected = 0;
+    // 解析线程屏蔽所有信号，退出信号只由主线程的signalfd读取
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    int err = pthread_create(&g_resolve_thread, NULL, resolve_main, NULL);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (err != 0) {
+        errno = err;
+        perror("创建地址解析线程失败");
         return;
     }
-    
-    g_stats.bytes_to_sitl += sent;
-    g_stats.messages_from_client++;
+    g_resolving = 1;
 }
 
+static volatile int g_sitl_connected = 0; // SITL连接状态
+
 /**
- * 转发数据到客户端
+ * 共享SITL：按发送队列是否为空切换EPOLLOUT（持g_sitl_lock；epoll_ctl可以从其他线程调用）
  */
-static void forward_to_client(const uint8_t *data, size_t len) {
-    if (!g_client.active) {
-        return; // 没有活跃的客户端
-    }
+static void sitl_update_interest(void) {
+    int want = !txq_empty(&g_sitl_txq);
     
-    ssize_t sent = sendto(g_external_sock, data, len, 0,
-                         (struct sockaddr*)&g_client.addr, g_client.addr_len);
-    if (sent < 0) {
-        perror("发送到客户端失败");
-        return;
+    if (want != g_sitl_want_write &&
+        evloop_mod(&g_workers[0]->loop, &g_internal_src, want ? EPOLLIN | EPOLLOUT : EPOLLIN) == 0) {
+        g_sitl_want_write = want;
     }
+}
+
+/**
+ * 共享SITL发送失败（持g_sitl_lock）：关闭连接的两个方向，worker 0读到EOF后按断开处理
+ */
+static void sitl_link_broken(void) {
+    perror("发送到SITL失败");
+    g_sitl_connected = 0;
+    shutdown(g_internal_sock, SHUT_RDWR);
+    txq_clear(&g_sitl_txq);
+}
+
+/**
+ * 共享SITL：在锁内写出或排队，各线程的数据报整条进入同一个队列，不会交错
+ * @return 直接写出的字节数，-1为未连接或发送失败
+ */
+static ssize_t sitl_sendv(const struct iovec *iov, const uint8_t *prio, unsigned count) {
+    ssize_t sent = -1;
     
-    g_stats.bytes_to_client += sent;
-    g_stats.messages_to_client++;
+    pthread_mutex_lock(&g_sitl_lock);
+    if (g_sitl_connected && g_internal_sock >= 0) {
+        sent = txq_sendv(&g_sitl_txq, g_internal_sock, iov, prio, count);
+        if (sent < 0) {
+            sitl_link_broken();
+        } else {
+            sitl_update_interest();
+        }
+    }
+    pthread_mutex_unlock(&g_sitl_lock);
+    return sent;
 }
 
 /**
- * 处理来自客户端的数据
+ * 发出本轮排队的发往SITL的数据：每个连接一次writev（共享连接只加一次锁），没写完的进入该连接的发送队列
  */
-static void handle_client_data(const uint8_t *data, size_t len,
-                                const struct sockaddr_in *client_addr,
-                                socklen_t addr_len) {
-    // 更新客户端信息
-    if (!g_client.active || 
-        memcmp(&g_client.addr, client_addr, sizeof(struct sockaddr_in)) != 0) {
-        memcpy(&g_client.addr, client_addr, sizeof(struct sockaddr_in));
-        g_client.addr_len = addr_len;
-        g_client.active = 1;
-        
-        char ip_str[INET_ADDRSTRLEN];
-        inet_ntop(AF_INET, &client_addr->sin_addr, ip_str, sizeof(ip_str));
-        printf("客户端连接: %s:%d\n", ip_str, ntohs(client_addr->sin_port));
+static void flush_sitl_sends(proxy_worker_t *worker) {
+    struct iovec iov[PROXY_URING_BUFS];
+    uint8_t prio[PROXY_URING_BUFS];
+    unsigned count = worker->sitl_send_count;
+    
+    for (unsigned i = 0; i < count; i++) {
+        backend_t *backend = worker->sitl_sends[i].backend;
+        int fd = worker->sitl_sends[i].fd;
+        unsigned n = 0;
+        size_t bytes = 0;
         
-        // 记录连接日志
-        client_info_t log_client;
-        memcpy(&log_client.addr, client_addr, sizeof(struct sockaddr_in));
-        log_client.addr_len = addr_len;
-        strcpy(log_client.ip_str, ip_str);
-        log_client.port = ntohs(client_addr->sin_port);
-        logger_connection(&log_client);
-    }
-    
-    g_client.last_seen = time(NULL);
-    g_stats.bytes_from_client += len;
-    
-
-    
-    // 解析MAVLink消息（用于日志）- 支持多个消息
-    client_info_t log_client;
-    memcpy(&log_client.addr, client_addr, sizeof(struct sockaddr_in));
-    log_client.addr_len = addr_len;
-    inet_ntop(AF_INET, &client_addr->sin_addr, log_client.ip_str, sizeof(log_client.ip_str));
-    log_client.port = ntohs(client_addr->sin_port);
-    
-    size_t offset = 0;
-    int msg_count = 0;
-    static uint16_t last_cmd_id = 0;  // 跟踪上一条命令ID，用于过滤
-    
-    while (offset < len) {
-        mavlink_message_t msg;
-        if (mavlink_parse_message(data + offset, len - offset, &msg)) {
-            // 计算消息总长度（根据协议版本）
-            int header_len = (msg.magic == 0xFD) ? MAVLINK_HEADER_LEN_V2 : MAVLINK_HEADER_LEN_V1;
-            size_t msg_len = header_len + msg.len + MAVLINK_CHECKSUM_LEN;
-            msg_count++;
-            
-
-            
-            // 根据消息类型记录
-            switch (msg.msgid) {
-                case MAVLINK_MSG_ID_HEARTBEAT:
-                    // 心跳消息太频繁，跳过不记录
-                    break;
-                case 2:   // SYSTEM_TIME - 系统时间同步
-                case 66:  // REQUEST_DATA_STREAM - 数据流请求
-                case 110: // TIMESYNC - 时间同步
-                case 134: // TERRAIN_DATA - 地形数据
-                    // 这些消息太频繁，跳过不记录
-                    break;
-                case 43:  // MISSION_REQUEST - 任务请求
-                case 47:  // MISSION_COUNT - 任务计数
-                case 51:  // MISSION_SET_CURRENT - 设置当前任务
-                    // 任务初始化消息，跳过不记录
-                    break;
-                case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
-                case MAVLINK_MSG_ID_PARAM_REQUEST_READ:
-                    logger_request(&log_client, &msg);
-                    break;
-                case 76: // COMMAND_LONG
-                    // 过滤频繁的状态轮询命令，只保留真正的控制命令
-                    {
-                        uint16_t command = msg.payload[28] | (msg.payload[29] << 8);
-                        float param1;
-                        memcpy(&param1, &msg.payload[0], 4);
-                        int req_msg_id = (int)param1;
-                        
-                        // 过滤状态轮询命令
-                        if (command == 512) {
-                            // 命令512：请求自动驾驶仪能力，跳过
-                            break;
-                        }
-                        if (command == 511 && (req_msg_id == 242 || req_msg_id == 245)) {
-                            // 命令511请求消息242(返航位置)/245(扩展状态)，跳过
-                            break;
-                        }
-                        if (command == 521 && req_msg_id == 1) {
-                            // 命令521请求消息1(系统状态)，跳过
-                            break;
-                        }
-                        
-                        // 过滤紧随位置命令后的模式确认命令
-                        if (command == 176 && last_cmd_id == 192) {
-                            // 命令176(设置模式)紧随命令192(设置位置)后，跳过
-                            last_cmd_id = command;
-                            break;
-                        }
-                        
-                        last_cmd_id = command;
-                        logger_command(&log_client, &msg);
-                    }
-                    break;
-                case 75: // COMMAND_INT
-                    {
-                        // 获取COMMAND_INT中的命令ID
-                        uint16_t cmd_int = msg.payload[28] | (msg.payload[29] << 8);
-                        last_cmd_id = cmd_int;
-                        logger_command(&log_client, &msg);
-                    }
-                    break;
-                default:
-                    logger_unknown(&log_client, &msg);
-                    break;
+        if (worker->sitl_sends[i].len == 0) {
+            continue;
+        }
+        for (unsigned j = i; j < count; j++) {
+            proxy_sitl_send_t *item = &worker->sitl_sends[j];
+            if (item->len == 0 || item->backend != backend || item->fd != fd) {
+                continue;
             }
-            
-            offset += msg_len;
+            iov[n].iov_base = (void *)item->data;
+            iov[n].iov_len = item->len;
+            prio[n] = item->prio;
+            bytes += item->len;
+            item->len = 0;
+            n++;
+        }
+        
+        ssize_t sent;
+        if (backend) {
+            // 本轮中实例可能已被回收或重新连接
+            sent = (backend->state == BACKEND_BUSY && backend->fd == fd) ? backend_sendv(backend, iov, prio, n) : -1;
         } else {
-            // 无法解析，跳出循环
-            if (offset < len) {
+            sent = sitl_sendv(iov, prio, n);
+        }
+        if (sent >= 0) {
+            worker->stats.bytes_to_sitl += bytes;
+            worker->stats.messages_from_client += n;
+        }
+    }
+    worker->sitl_send_count = 0;
+}
 
-            }
-            break;
+/**
+ * 转发数据到SITL（通过TCP）：记入本轮，由flush_sitl_sends合并发出
+ * 后端池模式发往会话独占的实例，还没有分配到实例时丢弃；否则发往共享SITL
+ */
+static void forward_to_sitl(proxy_worker_t *worker, session_t *session, const uint8_t *data, size_t len,
+                            uint8_t prio) {
+    backend_t *backend = NULL;
+    int fd = -1;
+    
+    if (backend_pool_enabled()) {
+        if (!session->backend) {
+            worker->stats.no_backend_drops++;
+            return;
         }
+        backend = session->backend;
+        fd = backend->fd;
+        if (fd < 0) {
+            return;
+        }
+    } else if (!g_sitl_connected) {
+        return;
     }
     
+    if (worker->sitl_send_count == PROXY_URING_BUFS) {
+        flush_sitl_sends(worker);
+    }
+    proxy_sitl_send_t *item = &worker->sitl_sends[worker->sitl_send_count++];
+    item->backend = backend;
+    item->fd = fd;
+    item->data = data;
+    item->len = (uint16_t)len;
+    item->prio = prio;
+}
 
+/**
+ * 共享SITL断开期间：把命令数据报缓存到会话中，重新连接后由worker 0补发。
+ * 持本线程的session_lock写入并在锁内再确认一次连接状态，worker 0补发时持同一把锁，不会漏掉
+ */
+static void hold_for_replay(proxy_worker_t *worker, session_t *session, const uint8_t *data, size_t len,
+                            uint8_t prio) {
+    int held = 0;
     
-    // 转发到SITL
-    forward_to_sitl(data, len);
+    pthread_mutex_lock(&worker->session_lock);
+    if (!g_sitl_connected) {
+        worker->stats.replay_dropped += session_replay_push(&session->replay, data, len);
+        worker->stats.replay_held++;
+        held = 1;
+    }
+    pthread_mutex_unlock(&worker->session_lock);
+    
+    // 刚好已经重新连接：正常转发
+    if (!held) {
+        forward_to_sitl(worker, session, data, len, prio);
+    }
 }
 
 /**
- * 处理来自SITL的数据
+ * 校验签名帧，每条签名链路首次出现或校验结果变化时记录
  */
-static void handle_sitl_data(const uint8_t *data, size_t len) {
-    g_stats.bytes_from_sitl += len;
+static void handle_signed_frame(proxy_worker_t *worker, const mavlink_frame_t *frame,
+                                const client_info_t *log_client) {
+    mavlink_sign_result_t result;
     
-    // 转发到客户端
-    forward_to_client(data, len);
+    worker->stats.signed_from_client++;
+    mavlink_sign_check(&worker->sign_cache, log_client->addr.sin_addr.s_addr, log_client->addr.sin_port,
+                       frame, &result);
+    if (result.status == MAVLINK_SIGN_BAD || result.status == MAVLINK_SIGN_REPLAY) {
+        worker->stats.signed_invalid++;
+    }
+    if (result.changed) {
+        logger_signed(log_client, frame, &result);
+    }
 }
 
-int proxy_init(void) {
-    memset(&g_stats, 0, sizeof(g_stats));
-    memset(&g_client, 0, sizeof(g_client));
+/* 客户端帧回调的上下文 */
+typedef struct {
+    proxy_worker_t *worker;
+    session_t *session;
+    uint8_t prio;                   // 数据报中各帧的最高发送优先级
+    uint8_t command;                // 数据报中有命令帧（SITL断开期间需要缓存）
+    uint8_t v2;                     // 数据报中有v2帧（占位心跳用相同的协议版本）
+} client_frame_ctx_t;
+
+/**
+ * 帧的发送优先级：SITL连接拥塞时先丢遥测和数据请求，命令和控制尽量保留
+ */
+static uint8_t frame_priority(const mavlink_frame_t *frame) {
+    if (frame->info->log_policy == MAVLINK_LOG_COMMAND) {
+        return TXQ_PRIO_HIGH;
+    }
+    if (frame->info->log_policy == MAVLINK_LOG_REQUEST) {
+        return TXQ_PRIO_LOW;
+    }
+    switch (frame->info->category) {
+        case MAVLINK_CAT_COMMAND:
+        case MAVLINK_CAT_POSITION:
+        case MAVLINK_CAT_MANUAL:
+            return TXQ_PRIO_HIGH;
+        case MAVLINK_CAT_TELEMETRY:
+        case MAVLINK_CAT_REQUEST:
+        case MAVLINK_CAT_TERRAIN:
+            return TXQ_PRIO_LOW;
+        default:
+            return TXQ_PRIO_NORMAL;
+    }
+}
+
+/**
+ * 处理客户端发来的单条MAVLink消息（记录日志）
+ * 过滤和记录都直接作用于接收缓冲区上的帧视图，被跳过的消息不产生任何拷贝
+ */
+static void handle_client_message(const mavlink_frame_t *frame, void *ctx) {
+    client_frame_ctx_t *frame_ctx = (client_frame_ctx_t *)ctx;
+    session_t *session = frame_ctx->session;
+    const client_info_t *log_client = &session->info;
+    uint8_t prio = frame_priority(frame);
     
-    // 创建外部UDP socket（监听客户端）
-    printf("创建外部UDP socket (端口 %d)...\n", PROXY_EXTERNAL_PORT);
-    g_external_sock = create_udp_socket(PROXY_EXTERNAL_PORT, 1);
-    if (g_external_sock < 0) {
-        return -1;
+    if (prio > frame_ctx->prio) {
+        frame_ctx->prio = prio;
+    }
+    if (frame->info->log_policy == MAVLINK_LOG_COMMAND || frame->info->category == MAVLINK_CAT_COMMAND) {
+        frame_ctx->command = 1;
+    }
+    if (frame->magic == MAVLINK_STX_V2) {
+        frame_ctx->v2 = 1;
     }
     
-    // 创建TCP连接到SITL
-    g_internal_sock = create_tcp_connection(PROXY_SITL_HOST, PROXY_INTERNAL_PORT);
-    if (g_internal_sock < 0) {
-        close(g_external_sock);
-        return -1;
+    // 未签名帧只多一次指针判断
+    if (frame->signature) {
+        handle_signed_frame(frame_ctx->worker, frame, log_client);
     }
     
-    g_sitl_connected = 1;
+    switch (filter_classify(&session->filter, frame)) {
+        case FILTER_LOG_REQUEST:
+            logger_request(log_client, frame);
+            break;
+        case FILTER_LOG_COMMAND:
+            logger_command(log_client, frame);
+            break;
+        case FILTER_LOG_OTHER:
+            logger_unknown(log_client, frame);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * 会话结束（空闲超时或被挤出）
+ */
+static void on_session_removed(session_t *session, void *ctx) {
+    (void)ctx;
+    printf("客户端会话结束: %s:%d (%llu个数据报, 持续%ld秒)\n",
+           session->info.ip_str, session->info.port,
+           (unsigned long long)session->datagrams_in,
+           (long)(session->last_seen - session->first_seen));
     
-    printf("初始化完成\n");
-    printf("外部端口: UDP %d (等待QGroundControl连接)\n", PROXY_EXTERNAL_PORT);
-    printf("内部连接: TCP %s:%d (已连接SITL)\n", PROXY_SITL_HOST, PROXY_INTERNAL_PORT);
+    // 实例状态已被该会话改动过，直接回收
+    if (session->backend) {
+        backend_release(session->backend);
+        session->backend = NULL;
+    }
     
-    return 0;
+    // 诱饵端口上的TCP连接随会话关闭（先解除关联，关闭时不再回调）
+    if (session->conn) {
+        decoy_conn_t *conn = session->conn;
+        session->conn = NULL;
+        conn->owner = NULL;
+        decoy_conn_close(conn);
+    }
 }
 
-void proxy_run(void) {
-    uint8_t buffer[PROXY_BUFFER_SIZE];
-    struct sockaddr_in from_addr;
-    socklen_t from_len;
+/**
+ * 确定会话的发送目标：TCP连接，或从会话所在端口的socket发出
+ */
+static void session_egress_target(proxy_worker_t *worker, const session_t *session, proxy_egress_target_t *target) {
+    target->addr = session->info.addr;
+    target->fd = session->listener ? session->listener->src.fd : worker->sock;
+    target->conn = session->conn;
+}
+
+/**
+ * 向会话代答一个占位心跳（直接发出，不经过批量发送）
+ */
+static void send_placeholder_heartbeat(proxy_worker_t *worker, session_t *session, int is_v2) {
+    uint8_t payload[HEARTBEAT_PAYLOAD_LEN];
+    uint8_t frame[MAVLINK_MAX_FRAME_LEN];
+    uint8_t sysid, compid;
     
-    printf("开始运行...\n\n");
+    pthread_mutex_lock(&g_sitl_lock);
+    memcpy(payload, g_placeholder_payload, sizeof(payload));
+    sysid = g_placeholder_sysid;
+    compid = g_placeholder_compid;
+    pthread_mutex_unlock(&g_sitl_lock);
     
-    while (g_proxy_running) {
-        fd_set readfds;
-        struct timeval tv;
-        int max_fd;
-        
-        FD_ZERO(&readfds);
-        FD_SET(g_external_sock, &readfds);
-        
-        if (g_sitl_connected && g_internal_sock >= 0) {
-            FD_SET(g_internal_sock, &readfds);
+    size_t len = mavlink_frame_encode(frame, is_v2, session->placeholder_seq++, sysid, compid,
+                                      MAVLINK_MSG_ID_HEARTBEAT, payload, sizeof(payload));
+    if (len == 0) {
+        return;
+    }
+    
+    proxy_egress_target_t target;
+    session_egress_target(worker, session, &target);
+    if (target.conn) {
+        struct iovec iov = { frame, len };
+        decoy_conn_sendv(target.conn, &iov, 1);
+    } else if (sendto(target.fd, frame, len, MSG_DONTWAIT, (const struct sockaddr *)&target.addr,
+                      sizeof(target.addr)) != (ssize_t)len) {
+        return;
+    }
+    worker->stats.placeholder_heartbeats++;
+    worker->stats.bytes_to_client += len;
+}
+
+/**
+ * 处理来自客户端的数据
+ * @param listener 收到数据的诱饵端口，NULL为代理主端口
+ * @param conn 诱饵端口上的TCP MAVLink连接，NULL为UDP
+ */
+static void handle_client_data(proxy_worker_t *worker, const uint8_t *data, size_t len,
+                               const struct sockaddr_in *client_addr, socklen_t addr_len,
+                               decoy_listener_t *listener, decoy_conn_t *conn) {
+    time_t now = time(NULL);
+    
+    // 每个来源地址一个会话，字节流和过滤状态互不干扰
+    session_t *session = session_lookup(&worker->sessions, client_addr);
+    if (session && (session->listener != listener || session->conn != conn)) {
+        // 同一来源地址出现在另一个端口或连接上（如TCP源端口恰好与某个UDP会话相同）：结束旧会话
+        pthread_mutex_lock(&worker->session_lock);
+        on_session_removed(session, worker);
+        session_remove(&worker->sessions, session);
+        pthread_mutex_unlock(&worker->session_lock);
+        session = NULL;
+    }
+    if (!session) {
+        pthread_mutex_lock(&worker->session_lock);
+        session = session_create(&worker->sessions, client_addr, addr_len, now, on_session_removed, worker);
+        session->listener = listener;
+        session->conn = conn;
+        pthread_mutex_unlock(&worker->session_lock);
+        if (listener) {
+            session->info.local_port = listener->port;
+            printf("客户端连接: %s:%d (诱饵端口%s/%u, 当前%zu个会话)\n", session->info.ip_str, session->info.port,
+                   conn ? "TCP" : "UDP", listener->port, session_count(&worker->sessions));
+        } else {
+            printf("客户端连接: %s:%d (线程%d, 当前%zu个会话)\n", session->info.ip_str, session->info.port,
+                   worker->id, session_count(&worker->sessions));
+        }
+        if (conn) {
+            conn->owner = session;
         }
         
-        max_fd = (g_external_sock > g_internal_sock) ? g_external_sock : g_internal_sock;
-        
-        // 设置超时时间（1秒）
-        tv.tv_sec = 1;
-        tv.tv_usec = 0;
-        
-        int ret = select(max_fd + 1, &readfds, NULL, NULL, &tv);
-        if (ret < 0) {
+        // 记录连接日志
+        logger_connection(&session->info);
+    }
+    
+    session->last_seen = now;
+    session->bytes_in += len;
+    session->datagrams_in++;
+    worker->stats.bytes_from_client += len;
+    
+    // 解析MAVLink消息（用于日志）- 流式解析，跳过垃圾字节并保留跨包的不完整帧
+    client_frame_ctx_t frame_ctx = { worker, session, TXQ_PRIO_LOW, 0, 0 };
+    uint64_t frames = session->parser.frames;
+    uint64_t skipped = session->parser.bytes_skipped;
+    uint64_t crc_errors = session->parser.crc_errors;
+    uint64_t unchecked = session->parser.unchecked;
+    mavlink_parser_feed(&session->parser, data, len, handle_client_message, &frame_ctx);
+    worker->stats.junk_bytes_from_client += session->parser.bytes_skipped - skipped;
+    worker->stats.crc_errors_from_client += session->parser.crc_errors - crc_errors;
+    worker->stats.unchecked_from_client += session->parser.unchecked - unchecked;
+    if (session->parser.frames == frames) {
+        frame_ctx.prio = TXQ_PRIO_NORMAL; // 没有完整帧的数据报（分段的帧、垃圾）按普通优先级
+    }
+    
+    // 后端池模式：首个数据报（或实例失效后）分配独占实例
+    if (backend_pool_enabled() && !session->backend) {
+        session->backend = backend_acquire(&worker->pool, session);
+        if (session->backend) {
+            printf("会话 %s:%d 分配到SITL实例%d\n", session->info.ip_str, session->info.port,
+                   session->backend->instance);
+        }
+    }
+    
+    // SITL还没就绪（启动中、断开或等待实例）：对发来MAVLink帧的客户端代答占位心跳，扫描器不会因为没有应答而离开
+    int ready = backend_pool_enabled() ? session->backend != NULL : g_sitl_connected;
+    if (!ready && session->parser.frames != frames && now - session->placeholder_at >= PROXY_PLACEHOLDER_INTERVAL) {
+        session->placeholder_at = now;
+        send_placeholder_heartbeat(worker, session, frame_ctx.v2);
+    }
+    
+    // 共享SITL断开期间只保留命令，其余丢弃
+    if (!backend_pool_enabled() && !g_sitl_connected) {
+        if (frame_ctx.command) {
+            hold_for_replay(worker, session, data, len, frame_ctx.prio);
+        }
+        return;
+    }
+    
+    // 转发到SITL
+    forward_to_sitl(worker, session, data, len, frame_ctx.prio);
+}
+
+/**
+ * 批量填充分布的桶号：floor(log2(n))
+ */
+static int batch_bucket(unsigned n) {
+    int bucket = 0;
+    while (n > 1 && bucket < PROXY_BATCH_HIST_BUCKETS - 1) {
+        n >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * 从fd发出tx_msgs中已填好的count个消息（部分发送时继续发剩下的）
+ */
+static void send_tx_msgs(proxy_worker_t *worker, int fd, unsigned count) {
+    unsigned done = 0;
+    
+    while (done < count) {
+        int sent = sendmmsg(fd, worker->tx_msgs + done, count - done, 0);
+        if (sent < 0) {
             if (errno == EINTR) {
                 continue;
             }
-            perror("select失败");
+            perror("发送到客户端失败");
             break;
         }
-        
-        if (ret == 0) {
-            // 超时，继续循环
-            continue;
+        worker->stats.tx_batches++;
+        worker->stats.tx_datagrams += sent;
+        worker->stats.tx_batch_fill[batch_bucket(sent)]++;
+        for (int i = 0; i < sent; i++) {
+            worker->stats.bytes_to_client += worker->tx_msgs[done + i].msg_len;
         }
-        
-        // 检查外部UDP socket（来自客户端）
-        if (FD_ISSET(g_external_sock, &readfds)) {
-            from_len = sizeof(from_addr);
-            ssize_t recv_len = recvfrom(g_external_sock, buffer, sizeof(buffer), 0,
-                                       (struct sockaddr*)&from_addr, &from_len);
-            if (recv_len > 0) {
-                handle_client_data(buffer, recv_len, &from_addr, from_len);
+        worker->stats.messages_to_client += sent;
+        done += sent;
+    }
+}
+
+/**
+ * 共享SITL模式：复制所有线程的会话的发送目标（各线程的会话表只在持锁时增删）
+ * 主端口的会话都从本线程的socket发出（同一端口的socket发出的源端口相同）；诱饵端口的会话只在worker 0上
+ * @return 目标个数
+ */
+static size_t collect_fanout_targets(proxy_worker_t *sender) {
+    size_t count = 0;
+    
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        proxy_worker_t *worker = g_workers[w];
+        pthread_mutex_lock(&worker->session_lock);
+        for (size_t s = 0; s < session_count(&worker->sessions); s++) {
+            session_egress_target(sender, session_at(&worker->sessions, s), &g_fanout_targets[count++]);
+        }
+        pthread_mutex_unlock(&worker->session_lock);
+    }
+    return count;
+}
+
+/**
+ * 把所有已封口的数据报发给egress_target，未指定时发给每个线程的每个活跃会话
+ * (会话, 数据报)组合按udp_batch分段，每段一次sendmmsg，换socket时先发出前一段；TCP连接一次写出全部数据报
+ */
+static void send_egress_batch(proxy_worker_t *worker) {
+    unsigned batch = config_get()->udp_batch;
+    proxy_egress_target_t single;
+    const proxy_egress_target_t *targets;
+    size_t target_count;
+    unsigned queued = 0;
+    int fd = worker->sock;
+    
+    if (worker->tx_count == 0) {
+        return;
+    }
+    
+    if (worker->egress_target) {
+        session_egress_target(worker, worker->egress_target, &single);
+        targets = &single;
+        target_count = 1;
+    } else {
+        targets = g_fanout_targets;
+        target_count = collect_fanout_targets(worker);
+    }
+    
+    for (size_t s = 0; s < target_count; s++) {
+        if (targets[s].conn) {
+            decoy_conn_sendv(targets[s].conn, worker->tx_iovs, worker->tx_count);
+            for (unsigned i = 0; i < worker->tx_count; i++) {
+                worker->stats.bytes_to_client += worker->tx_iovs[i].iov_len;
             }
+            worker->stats.messages_to_client += worker->tx_count;
+            continue;
         }
-        
-        // 检查内部TCP socket（来自SITL）
-        if (g_sitl_connected && FD_ISSET(g_internal_sock, &readfds)) {
-            ssize_t recv_len = recv(g_internal_sock, buffer, sizeof(buffer), 0);
-            if (recv_len > 0) {
-                handle_sitl_data(buffer, recv_len);
-            } else if (recv_len == 0) {
-                printf("SITL连接断开\n");
-                g_sitl_connected = 0;
-                close(g_internal_sock);
-                g_internal_sock = -1;
-                break;
-            } else {
-                perror("接收SITL数据失败");
-                g_sitl_connected = 0;
+        if (targets[s].fd != fd) {
+            send_tx_msgs(worker, fd, queued);
+            queued = 0;
+            fd = targets[s].fd;
+        }
+        for (unsigned i = 0; i < worker->tx_count; i++) {
+            struct mmsghdr *msg = &worker->tx_msgs[queued];
+            memset(msg, 0, sizeof(*msg));
+            msg->msg_hdr.msg_name = (void *)&targets[s].addr;
+            msg->msg_hdr.msg_namelen = sizeof(targets[s].addr);
+            msg->msg_hdr.msg_iov = &worker->tx_iovs[i];
+            msg->msg_hdr.msg_iovlen = 1;
+            if (++queued == batch) {
+                send_tx_msgs(worker, fd, queued);
+                queued = 0;
             }
         }
     }
+    send_tx_msgs(worker, fd, queued);
+    worker->tx_count = 0;
 }
 
-void proxy_close(void) {
+/**
+ * 封口当前数据报，攒满一批时发出
+ */
+static void close_egress_datagram(proxy_worker_t *worker) {
+    if (worker->egress_len == worker->egress_start) {
+        return;
+    }
+    
+    worker->tx_iovs[worker->tx_count].iov_base = worker->egress_buf + worker->egress_start;
+    worker->tx_iovs[worker->tx_count].iov_len = worker->egress_len - worker->egress_start;
+    worker->tx_count++;
+    worker->egress_start = worker->egress_len;
+    
+    if (worker->tx_count >= config_get()->udp_batch) {
+        send_egress_batch(worker);
+        worker->egress_len = 0;
+        worker->egress_start = 0;
+    }
+}
+
+/**
+ * 发出已打包的完整帧（包括未装满的最后一个数据报）
+ */
+static void flush_egress(proxy_worker_t *worker) {
+    close_egress_datagram(worker);
+    send_egress_batch(worker);
+    worker->egress_len = 0;
+    worker->egress_start = 0;
+}
 
-    if (g_external_sock >= 0) {
-        close(g_external_sock);
-        g_external_sock = -1;
+/**
+ * 记下SITL的心跳内容，之后的占位心跳与真实飞控一致（SITL每秒一次，加锁开销可以忽略）
+ */
+static void remember_sitl_heartbeat(const mavlink_frame_t *frame) {
+    if (mavlink_frame_u8(frame, MAVLINK_OFFSET_HEARTBEAT_AUTOPILOT) == MAV_AUTOPILOT_INVALID) {
+        return; // 不是飞控（如云台、相机）
+    }
+    pthread_mutex_lock(&g_sitl_lock);
+    for (size_t i = 0; i < HEARTBEAT_PAYLOAD_LEN; i++) {
+        g_placeholder_payload[i] = mavlink_frame_u8(frame, i);
     }
+    g_placeholder_sysid = frame->sysid;
+    g_placeholder_compid = frame->compid;
+    pthread_mutex_unlock(&g_sitl_lock);
+}
+
+/**
+ * 处理SITL发来的单条完整帧：按MTU打包，装不下时先封口当前数据报
+ * 每个数据报不超过MTU、每批不超过udp_batch个，缓冲区不会溢出
+ */
+static void handle_sitl_frame(const mavlink_frame_t *frame, void *ctx) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
     
-    if (g_internal_sock >= 0) {
-        close(g_internal_sock);
-        g_internal_sock = -1;
+    if (worker->egress_len - worker->egress_start + frame->frame_len > config_get()->egress_mtu) {
+        close_egress_datagram(worker);
     }
     
-    printf("关闭完成\n");
+    memcpy(worker->egress_buf + worker->egress_len, frame->data, frame->frame_len);
+    worker->egress_len += frame->frame_len;
+    worker->stats.frames_from_sitl++;
+    if (frame->msgid == MAVLINK_MSG_ID_HEARTBEAT) {
+        remember_sitl_heartbeat(frame);
+    }
 }
 
-proxy_stats_t* proxy_get_stats(void) {
-    return &g_stats;
+/**
+ * 处理来自SITL的数据
+ * TCP流在任意位置分段，先重组成完整帧再转发，保证每个UDP数据报都可独立解析
+ */
+static void handle_sitl_data(proxy_worker_t *worker, mavlink_parser_t *parser, const uint8_t *data, size_t len) {
+    worker->stats.bytes_from_sitl += len;
+    
+    uint64_t skipped = parser->bytes_skipped;
+    uint64_t crc_errors = parser->crc_errors;
+    uint64_t unchecked = parser->unchecked;
+    mavlink_parser_feed(parser, data, len, handle_sitl_frame, worker);
+    worker->stats.junk_bytes_from_sitl += parser->bytes_skipped - skipped;
+    worker->stats.crc_errors_from_sitl += parser->crc_errors - crc_errors;
+    worker->stats.unchecked_from_sitl += parser->unchecked - unchecked;
+    
+    // 不完整的帧留在解析器中，等下一段TCP数据；完整帧在本轮读完后统一发出
 }
 
-void proxy_stop(void) {
-    g_proxy_running = 0;
+/**
+ * 后端池：会话独占实例的数据只发给该会话（实例和会话属于同一个线程）
+ */
+static void on_backend_data(backend_t *backend, const uint8_t *data, size_t len) {
+    proxy_worker_t *worker = (proxy_worker_t *)backend->pool->ctx;
+    
+    worker->egress_target = (session_t *)backend->owner;
+    handle_sitl_data(worker, &backend->parser, data, len);
+    worker->egress_target = NULL;
+}
+
+static void on_backend_drained(backend_t *backend) {
+    proxy_worker_t *worker = (proxy_worker_t *)backend->pool->ctx;
+    
+    worker->egress_target = (session_t *)backend->owner;
+    flush_egress(worker);
+    worker->egress_target = NULL;
+}
+
+/**
+ * 后端池：实例异常，会话解除绑定，下一个数据报重新分配
+ */
+static void on_backend_lost(backend_t *backend) {
+    session_t *session = (session_t *)backend->owner;
+    
+    on_backend_drained(backend);
+    printf("会话 %s:%d 的SITL实例%d失效\n", session->info.ip_str, session->info.port, backend->instance);
+    session->backend = NULL;
+}
+
+static const backend_ops_t g_backend_ops = {
+    on_backend_data,
+    on_backend_drained,
+    on_backend_lost
+};
+
+/**
+ * 外部UDP socket可读：用recvmmsg成批收完所有排队的数据报再返回
+ */
+static void on_external_readable(void *ctx, int fd, uint32_t events) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    unsigned batch = config_get()->udp_batch;
+    (void)events;
+    
+    for (;;) {
+        for (unsigned i = 0; i < batch; i++) {
+            worker->rx_msgs[i].msg_hdr.msg_namelen = sizeof(worker->rx_addrs[i]);
+        }
+        int count = recvmmsg(fd, worker->rx_msgs, batch, MSG_DONTWAIT, NULL);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("接收客户端数据失败");
+            }
+            return;
+        }
+        
+        worker->stats.rx_batches++;
+        worker->stats.rx_datagrams += count;
+        worker->stats.rx_batch_fill[batch_bucket(count)]++;
+        for (int i = 0; i < count; i++) {
+            if (worker->rx_msgs[i].msg_len > 0) {
+                handle_client_data(worker, worker->rx_bufs[i], worker->rx_msgs[i].msg_len,
+                                   &worker->rx_addrs[i], worker->rx_msgs[i].msg_hdr.msg_namelen, NULL, NULL);
+            }
+        }
+        flush_sitl_sends(worker); // 下一批会覆盖接收缓冲区
+        
+        // 没收满说明队列已空，省掉一次必然返回EAGAIN的调用（水平触发，遗漏的数据报会再次唤醒）
+        if ((unsigned)count < batch) {
+            return;
+        }
+    }
+}
+
+/* io_uring的user_data：只有多次接收一种操作 */
+#define URING_OP_RECV 1ULL
+
+/**
+ * 提交多次接收：一个SQE持续接收，每个数据报占一个provided buffer
+ */
+static int uring_arm_recv(proxy_worker_t *worker) {
+    struct io_uring_sqe *sqe = uring_get_sqe(&worker->ring);
+    if (!sqe) {
+        return -1;
+    }
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = worker->sock;
+    sqe->addr = (uint64_t)(uintptr_t)&worker->recv_msg;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = worker->ring_bufs.group;
+    sqe->user_data = URING_OP_RECV;
+    worker->recv_armed = 1;
+    return 0;
+}
+
+/**
+ * 多次接收的完成事件：缓冲区中依次为io_uring_recvmsg_out、来源地址和数据
+ */
+static int uring_on_recv(proxy_worker_t *worker, struct io_uring_cqe *cqe) {
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        worker->recv_armed = 0;
+    }
+    if (cqe->res < 0) {
+        if (cqe->res == -ENOBUFS) {
+            worker->stats.uring_nobufs++; // 本轮结束时缓冲区全部归还，随后重新提交
+        } else if (!worker->recv_seen && (cqe->res == -EINVAL || cqe->res == -EOPNOTSUPP)) {
+            return -1; // 内核不支持多次recvmsg
+        } else {
+            errno = -cqe->res;
+            perror("io_uring接收失败");
+        }
+        return 0;
+    }
+    if (!(cqe->flags & IORING_CQE_F_BUFFER)) {
+        return 0;
+    }
+    
+    uint16_t bid = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+    uint8_t *buf = uring_buf(&worker->ring_bufs, bid);
+    struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buf;
+    size_t header = sizeof(*out) + worker->recv_msg.msg_namelen + worker->recv_msg.msg_controllen;
+    size_t avail = (size_t)cqe->res > header ? (size_t)cqe->res - header : 0;
+    size_t len = out->payloadlen < avail ? out->payloadlen : avail;
+    
+    worker->recv_seen = 1;
+    if (len > 0 && out->namelen >= sizeof(struct sockaddr_in)) {
+        handle_client_data(worker, buf + header, len, (const struct sockaddr_in *)(buf + sizeof(*out)),
+                           sizeof(struct sockaddr_in), NULL, NULL);
+    }
+    
+    // 归还的缓冲区在uring_bufs_commit之后内核才会重用，本轮排队的发送在那之前发出或拷贝
+    uring_bufs_recycle(&worker->ring_bufs, bid);
+    return 1;
+}
+
+/**
+ * 内核不支持多次recvmsg时改回recvmmsg
+ */
+static void uring_fallback(proxy_worker_t *worker) {
+    printf("线程%d: 内核不支持io_uring多次接收，改用epoll\n", worker->id);
+    worker->use_uring = 0;
+    evloop_del(&worker->loop, &worker->ring_src);
+    if (evloop_add(&worker->loop, &worker->external_src, worker->sock, EPOLLIN,
+                   on_external_readable, worker) < 0) {
+        proxy_stop();
+    }
+}
+
+/**
+ * io_uring描述符可读：收割完成事件，处理数据报，本轮发往SITL的数据合并发出后再归还接收缓冲区
+ */
+static void on_ring_readable(void *ctx, int fd, uint32_t events) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    struct io_uring_cqe *cqe;
+    unsigned datagrams = 0;
+    unsigned handled = 0;
+    (void)fd;
+    (void)events;
+    
+    // 每次最多处理一轮缓冲区的量，其余留给下一次唤醒（水平触发），避免长时间占住事件循环
+    while (handled < PROXY_URING_BUFS && (cqe = uring_peek_cqe(&worker->ring)) != NULL) {
+        handled++;
+        int ret = uring_on_recv(worker, cqe);
+        uring_cqe_seen(&worker->ring);
+        if (ret < 0) {
+            flush_sitl_sends(worker);
+            uring_fallback(worker);
+            return;
+        }
+        datagrams += ret;
+    }
+    flush_sitl_sends(worker);
+    uring_bufs_commit(&worker->ring_bufs);
+    
+    if (datagrams) {
+        worker->stats.rx_batches++;
+        worker->stats.rx_datagrams += datagrams;
+        worker->stats.rx_batch_fill[batch_bucket(datagrams)]++;
+    }
+    
+    int submit = 0;
+    if (!worker->recv_armed && uring_arm_recv(worker) == 0) {
+        submit = 1;
+    }
+    // 没有取到完成事件也调用一次，把内核积压的完成事件搬回CQ
+    if (submit || handled == 0) {
+        if (uring_submit(&worker->ring, 0) < 0) {
+            perror("io_uring提交失败");
+        }
+        worker->stats.uring_submits++;
+    }
+}
+
+/**
+ * 初始化本线程的io_uring数据路径，不可用时返回-1，由调用者改用epoll
+ */
+static int uring_start(proxy_worker_t *worker) {
+    // 接收缓冲区：io_uring_recvmsg_out + 来源地址 + 最大数据报
+    worker->recv_msg.msg_namelen = sizeof(struct sockaddr_in);
+    size_t buf_size = sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_in) + PROXY_BUFFER_SIZE;
+    
+    // SQ只放重新接收；CQ（SQ的两倍）放得下每个接收缓冲区一个完成事件
+    if (uring_init(&worker->ring, PROXY_URING_BUFS / 2) < 0) {
+        return -1;
+    }
+    if (uring_bufs_init(&worker->ring, &worker->ring_bufs, 0, PROXY_URING_BUFS, buf_size) < 0) {
+        int err = errno;
+        uring_close(&worker->ring);
+        errno = err;
+        return -1;
+    }
+    if (evloop_add(&worker->loop, &worker->ring_src, worker->ring.fd, EPOLLIN, on_ring_readable, worker) < 0 ||
+        uring_arm_recv(worker) < 0 || uring_submit(&worker->ring, 0) < 0) {
+        int err = errno;
+        evloop_del(&worker->loop, &worker->ring_src);
+        uring_bufs_close(&worker->ring, &worker->ring_bufs);
+        uring_close(&worker->ring);
+        errno = err;
+        return -1;
+    }
+    worker->use_uring = 1;
+    return 0;
+}
+
+/**
+ * 诱饵端口的UDP MAVLink数据报：与主端口相同处理，应答从该端口发出
+ * 数据在诱饵引擎的接收缓冲区中，下一个数据报会覆盖，发往SITL的部分立即发出
+ */
+static void on_decoy_datagram(void *ctx, decoy_listener_t *listener, const uint8_t *data, size_t len,
+                              const struct sockaddr_in *addr, socklen_t addr_len) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    
+    handle_client_data(worker, data, len, addr, addr_len, listener, NULL);
+    flush_sitl_sends(worker);
+}
+
+/**
+ * 诱饵端口的TCP MAVLink数据：会话按连接的对端地址区分，会话的解析器负责重组字节流
+ */
+static void on_decoy_stream(void *ctx, decoy_conn_t *conn, const uint8_t *data, size_t len) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    
+    handle_client_data(worker, data, len, &conn->client.addr, conn->client.addr_len, conn->listener, conn);
+    flush_sitl_sends(worker);
+}
+
+/**
+ * 诱饵端口的TCP MAVLink连接关闭：会话随之结束
+ */
+static void on_decoy_stream_closed(void *ctx, decoy_conn_t *conn) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    session_t *session = (session_t *)conn->owner;
+    
+    pthread_mutex_lock(&worker->session_lock);
+    session->conn = NULL;
+    on_session_removed(session, worker);
+    session_remove(&worker->sessions, session);
+    pthread_mutex_unlock(&worker->session_lock);
+}
+
+static const decoy_ops_t g_decoy_ops = {
+    on_decoy_datagram,
+    on_decoy_stream,
+    on_decoy_stream_closed
+};
+
+/**
+ * 从某个时刻到现在的毫秒数（CLOCK_MONOTONIC）
+ */
+static uint64_t elapsed_ms(const struct timespec *since) {
+    struct timespec now;
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - since->tv_sec) * 1000 + (now.tv_nsec - since->tv_nsec) / 1000000;
+}
+
+/**
+ * 按当前退避时间安排下一次重连，之后等待时间翻倍（不超过上限）
+ */
+static void sitl_schedule_reconnect(void) {
+    evloop_timer_set(&g_reconnect_timer, g_reconnect_delay_ms, 0);
+    g_reconnect_delay_ms *= 2;
+    if (g_reconnect_delay_ms > PROXY_RECONNECT_MAX_MS) {
+        g_reconnect_delay_ms = PROXY_RECONNECT_MAX_MS;
+    }
+}
+
+/**
+ * 共享SITL连接断开（worker 0）：关闭连接并开始重连，UDP监听和会话不受影响
+ */
+static void sitl_link_down(proxy_worker_t *worker) {
+    flush_egress(worker);
+    evloop_del(&worker->loop, &g_internal_src);
+    pthread_mutex_lock(&g_sitl_lock);
+    g_sitl_connected = 0;
+    close(g_internal_sock);
+    g_internal_sock = -1;
+    txq_clear(&g_sitl_txq);
+    g_sitl_want_write = 0;
+    pthread_mutex_unlock(&g_sitl_lock);
+    
+    worker->stats.sitl_disconnects++;
+    clock_gettime(CLOCK_MONOTONIC, &g_sitl_down_at);
+    g_reconnect_delay_ms = PROXY_RECONNECT_MIN_MS;
+    printf("开始重连SITL，期间继续接收客户端数据，命令缓存到重新连接后补发\n");
+    sitl_schedule_reconnect();
+}
+
+/**
+ * 共享SITL连接事件（worker 0）：可写时发出排队的数据；可读时读到EAGAIN为止，连接断开时转入重连
+ */
+static void on_internal_event(void *ctx, int fd, uint32_t events) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    uint8_t buffer[PROXY_BUFFER_SIZE];
+    
+    if (events & EPOLLOUT) {
+        pthread_mutex_lock(&g_sitl_lock);
+        if (g_sitl_connected) {
+            if (txq_flush(&g_sitl_txq, fd) < 0) {
+                sitl_link_broken();
+            } else {
+                sitl_update_interest();
+            }
+        }
+        pthread_mutex_unlock(&g_sitl_lock);
+        if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+            return;
+        }
+    }
+    
+    for (;;) {
+        ssize_t recv_len = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (recv_len > 0) {
+            handle_sitl_data(worker, &g_sitl_parser, buffer, recv_len);
+            continue;
+        }
+        if (recv_len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            flush_egress(worker);
+            return;
+        }
+        if (recv_len < 0 && errno == EINTR) {
+            continue;
+        }
+        
+        if (recv_len == 0) {
+            printf("SITL连接断开\n");
+        } else {
+            perror("接收SITL数据失败");
+        }
+        sitl_link_down(worker);
+        return;
+    }
+}
+
+/**
+ * 补发各线程会话在断开期间缓存的命令（持g_sitl_lock，重新连接后的新数据只能排在它们后面）
+ * @return 补发的数据报数
+ */
+static uint64_t sitl_replay_held(void) {
+    struct iovec iov[SESSION_REPLAY_MAX];
+    uint8_t prio[SESSION_REPLAY_MAX];
+    uint64_t sent = 0;
+    
+    memset(prio, TXQ_PRIO_HIGH, sizeof(prio));
+    for (unsigned w = 0; w < g_worker_count && g_sitl_connected; w++) {
+        proxy_worker_t *worker = g_workers[w];
+        pthread_mutex_lock(&worker->session_lock);
+        for (size_t s = 0; s < session_count(&worker->sessions) && g_sitl_connected; s++) {
+            session_replay_t *replay = &session_at(&worker->sessions, s)->replay;
+            size_t offset = 0;
+            if (replay->count == 0) {
+                continue;
+            }
+            for (unsigned i = 0; i < replay->count; i++) {
+                iov[i].iov_base = replay->data + offset;
+                iov[i].iov_len = replay->lens[i];
+                offset += replay->lens[i];
+            }
+            if (txq_sendv(&g_sitl_txq, g_internal_sock, iov, prio, replay->count) < 0) {
+                // 连接又断了：缓存保持原样，等下次重新连接再补发
+                sitl_link_broken();
+                break;
+            }
+            sent += replay->count;
+            replay->count = 0;
+            replay->bytes = 0;
+        }
+        pthread_mutex_unlock(&worker->session_lock);
+    }
+    if (g_sitl_connected) {
+        sitl_update_interest();
+    }
+    return sent;
+}
+
+/**
+ * 共享SITL连接成功（worker 0，启动时或断开后）：开始接收，补发缓存的命令，断开后的重连记录恢复用时
+ */
+static void sitl_link_up(proxy_worker_t *worker, int fd) {
+    if (evloop_add(&worker->loop, &g_internal_src, fd, EPOLLIN, on_internal_event, worker) < 0) {
+        pthread_mutex_lock(&g_sitl_lock);
+        close(g_internal_sock);
+        g_internal_sock = -1;
+        pthread_mutex_unlock(&g_sitl_lock);
+        sitl_schedule_reconnect();
+        return;
+    }
+    evloop_timer_set(&g_reconnect_timer, 0, 0);
+    mavlink_parser_init(&g_sitl_parser); // 丢掉旧连接上没收完的半帧
+    
+    pthread_mutex_lock(&g_sitl_lock);
+    g_sitl_connected = 1;
+    uint64_t replayed = sitl_replay_held();
+    pthread_mutex_unlock(&g_sitl_lock);
+    
+    uint64_t recovery = elapsed_ms(&g_sitl_down_at);
+    if (worker->stats.sitl_disconnects == 0) {
+        printf("SITL连接成功 (启动后%llums, 补发%llu个命令数据报)\n",
+               (unsigned long long)recovery, (unsigned long long)replayed);
+        worker->stats.replay_sent += replayed;
+        return;
+    }
+    worker->stats.sitl_reconnects++;
+    worker->stats.sitl_recovery_last_ms = recovery;
+    worker->stats.sitl_recovery_total_ms += recovery;
+    if (recovery > worker->stats.sitl_recovery_max_ms) {
+        worker->stats.sitl_recovery_max_ms = recovery;
+    }
+    worker->stats.replay_sent += replayed;
+    printf("SITL重新连接成功 (断开%llums, 补发%llu个命令数据报)\n",
+           (unsigned long long)recovery, (unsigned long long)replayed);
+}
+
+/**
+ * 放弃进行中的连接（失败或超时）
+ */
+static void sitl_connect_abort(proxy_worker_t *worker) {
+    evloop_del(&worker->loop, &g_internal_src);
+    pthread_mutex_lock(&g_sitl_lock);
+    close(g_internal_sock);
+    g_internal_sock = -1;
+    pthread_mutex_unlock(&g_sitl_lock);
+    g_sitl_connecting = 0;
+}
+
+/**
+ * 非阻塞连接完成（worker 0）
+ */
+static void on_sitl_connect(void *ctx, int fd, uint32_t events) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    int err = 0;
+    socklen_t err_len = sizeof(err);
+    (void)events;
+    
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &err_len) < 0) {
+        err = errno;
+    }
+    if (err == EINPROGRESS) {
+        return;
+    }
+    if (err != 0) {
+        sitl_connect_abort(worker);
+        sitl_resolve_start();
+        sitl_schedule_reconnect();
+        return;
+    }
+    evloop_del(&worker->loop, &g_internal_src);
+    g_sitl_connecting = 0;
+    sitl_link_up(worker, fd);
+}
+
+/**
+ * 发起一次非阻塞连接；失败时按退避时间再试，进行中时定时器兼作连接超时
+ */
+static void sitl_try_connect(proxy_worker_t *worker) {
+    worker->stats.sitl_connect_attempts++;
+    if (!g_sitl_addr_valid) {
+        // 启动时没能解析出地址：在后台继续解析，解析出来后立即连接
+        sitl_resolve_start();
+        sitl_schedule_reconnect();
+        return;
+    }
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("TCP socket创建失败");
+        sitl_schedule_reconnect();
+        return;
+    }
+    pthread_mutex_lock(&g_sitl_lock);
+    g_internal_sock = fd;
+    pthread_mutex_unlock(&g_sitl_lock);
+    
+    if (connect(fd, (struct sockaddr *)&g_sitl_addr, sizeof(g_sitl_addr)) == 0) {
+        sitl_link_up(worker, fd);
+        return;
+    }
+    if (errno == EINPROGRESS &&
+        evloop_add(&worker->loop, &g_internal_src, fd, EPOLLOUT, on_sitl_connect, worker) == 0) {
+        g_sitl_connecting = 1;
+        evloop_timer_set(&g_reconnect_timer, PROXY_CONNECT_TIMEOUT_MS, 0);
+        return;
+    }
+    pthread_mutex_lock(&g_sitl_lock);
+    close(fd);
+    g_internal_sock = -1;
+    pthread_mutex_unlock(&g_sitl_lock);
+    sitl_resolve_start();
+    sitl_schedule_reconnect();
+}
+
+/**
+ * 后台解析完成（worker 0）：更新缓存的地址；地址有变化且还没连上时立即用新地址重连
+ */
+static void on_resolve_done(void *ctx, int fd, uint32_t events) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    char ip[INET_ADDRSTRLEN];
+    uint64_t value;
+    (void)events;
+    
+    if (read(fd, &value, sizeof(value)) < 0) {
+        return;
+    }
+    pthread_join(g_resolve_thread, NULL);
+    g_resolving = 0;
+    
+    // 解析失败时继续使用旧地址
+    if (!g_resolve_ok ||
+        (g_sitl_addr_valid && g_resolve_addr.sin_addr.s_addr == g_sitl_addr.sin_addr.s_addr)) {
+        return;
+    }
+    g_sitl_addr = g_resolve_addr;
+    g_sitl_addr_valid = 1;
+    inet_ntop(AF_INET, &g_sitl_addr.sin_addr, ip, sizeof(ip));
+    printf("SITL地址解析为 %s\n", ip);
+    
+    // 只在等待重连或连接进行中时介入（g_sitl_connected可能已被其他线程清零而连接还没关闭）
+    if (g_sitl_connecting) {
+        sitl_connect_abort(worker); // 进行中的连接用的是旧地址
+    } else if (g_internal_src.fd >= 0) {
+        return;
+    }
+    g_reconnect_delay_ms = PROXY_RECONNECT_MIN_MS;
+    sitl_try_connect(worker);
+}
+
+/**
+ * 重连定时器（worker 0）：到时发起连接；连接还在进行时说明已超时，放弃后立即重试
+ */
+static void on_reconnect_timer(void *ctx, int fd, uint32_t expirations) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    (void)fd;
+    (void)expirations;
+    
+    if (g_sitl_connected) {
+        return;
+    }
+    if (g_sitl_connecting) {
+        sitl_connect_abort(worker);
+        sitl_resolve_start();
+    }
+    sitl_try_connect(worker);
+}
+
+/**
+ * 输出一个方向的批量填充情况
+ */
+static void print_batch_stats(const char *dir, uint64_t batches, uint64_t datagrams, const uint64_t *fill) {
+    static const char *labels[PROXY_BATCH_HIST_BUCKETS] = { "1", "2-3", "4-7", "8-15", "16-31", "32-63", "64" };
+    
+    printf("[统计] UDP%s: %llu批/%llu个数据报, 平均每批%.1f个, 分布",
+           dir, (unsigned long long)batches, (unsigned long long)datagrams,
+           batches ? (double)datagrams / batches : 0.0);
+    for (int i = 0; i < PROXY_BATCH_HIST_BUCKETS; i++) {
+        if (fill[i]) {
+            printf(" %s:%llu", labels[i], (unsigned long long)fill[i]);
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * 输出后端池统计（各线程的池合计）
+ */
+static void print_pool_stats(const proxy_stats_t *stats) {
+    backend_pool_stats_t total;
+    size_t counts[BACKEND_STATE_COUNT] = { 0 };
+    
+    memset(&total, 0, sizeof(total));
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        const backend_pool_t *pool = &g_workers[w]->pool;
+        size_t worker_counts[BACKEND_STATE_COUNT];
+        backend_pool_counts(pool, worker_counts);
+        for (int i = 0; i < BACKEND_STATE_COUNT; i++) {
+            counts[i] += worker_counts[i];
+        }
+        total.spawned += pool->stats.spawned;
+        total.acquired += pool->stats.acquired;
+        total.misses += pool->stats.misses;
+        total.recycled += pool->stats.recycled;
+        total.failures += pool->stats.failures;
+    }
+    
+    printf("[统计] SITL池: 空闲%zu个, 占用%zu个, 启动/预热中%zu个; 累计启动%llu次, 分配%llu次, "
+           "无空闲实例%llu次, 回收%llu次, 失败%llu次; 等待实例时丢弃%llu个数据报, 代答占位心跳%llu个\n",
+           counts[BACKEND_IDLE], counts[BACKEND_BUSY], counts[BACKEND_STARTING] + counts[BACKEND_WARMING],
+           (unsigned long long)total.spawned, (unsigned long long)total.acquired,
+           (unsigned long long)total.misses, (unsigned long long)total.recycled,
+           (unsigned long long)total.failures, (unsigned long long)stats->no_backend_drops,
+           (unsigned long long)stats->placeholder_heartbeats);
+}
+
+/**
+ * 输出发往SITL的发送队列统计（共享连接和各线程后端池合计；当前深度是近似快照）
+ */
+static void print_txq_stats(void) {
+    txq_stats_t total = g_sitl_txq_stats;
+    unsigned depth = g_sitl_txq.count;
+    size_t bytes = g_sitl_txq.bytes;
+    
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        const backend_pool_t *pool = &g_workers[w]->pool;
+        total.queued += pool->txq_stats.queued;
+        total.writev_calls += pool->txq_stats.writev_calls;
+        total.writev_datagrams += pool->txq_stats.writev_datagrams;
+        total.dropped_bytes += pool->txq_stats.dropped_bytes;
+        for (int p = 0; p < TXQ_PRIO_COUNT; p++) {
+            total.dropped[p] += pool->txq_stats.dropped[p];
+        }
+        if (pool->txq_stats.peak_depth > total.peak_depth) {
+            total.peak_depth = pool->txq_stats.peak_depth;
+        }
+        for (size_t i = 0; i < pool->count; i++) {
+            depth += pool->backends[i].txq.count;
+            bytes += pool->backends[i].txq.bytes;
+        }
+    }
+    
+    printf("[统计] SITL发送队列: 当前%u个/%zu字节, 峰值%llu个, 累计排队%llu个; writev %llu次/%llu个数据报; "
+           "队列满丢弃 遥测/请求%llu个, 普通%llu个, 命令%llu个 (%llu字节)\n",
+           depth, bytes, (unsigned long long)total.peak_depth, (unsigned long long)total.queued,
+           (unsigned long long)total.writev_calls, (unsigned long long)total.writev_datagrams,
+           (unsigned long long)total.dropped[TXQ_PRIO_LOW], (unsigned long long)total.dropped[TXQ_PRIO_NORMAL],
+           (unsigned long long)total.dropped[TXQ_PRIO_HIGH], (unsigned long long)total.dropped_bytes);
+}
+
+/**
+ * 输出共享SITL连接的断开、重连和命令补发统计
+ */
+static void print_sitl_link_stats(const proxy_stats_t *stats) {
+    printf("[统计] SITL连接: %s, 断开%llu次, 重连成功%llu次/尝试%llu次, 恢复用时 最近%llums 最长%llums 平均%llums; "
+           "断开期间缓存命令%llu个, 补发%llu个, 缓存满丢弃%llu个; 代答占位心跳%llu个\n",
+           g_sitl_connected ? "已连接" : "未连接",
+           (unsigned long long)stats->sitl_disconnects, (unsigned long long)stats->sitl_reconnects,
+           (unsigned long long)stats->sitl_connect_attempts, (unsigned long long)stats->sitl_recovery_last_ms,
+           (unsigned long long)stats->sitl_recovery_max_ms,
+           (unsigned long long)(stats->sitl_reconnects ? stats->sitl_recovery_total_ms / stats->sitl_reconnects : 0),
+           (unsigned long long)stats->replay_held, (unsigned long long)stats->replay_sent,
+           (unsigned long long)stats->replay_dropped, (unsigned long long)stats->placeholder_heartbeats);
+}
+
+/**
+ * 输出诱饵端口统计
+ */
+static void print_decoy_stats(void) {
+    const decoy_stats_t *stats = &g_decoys.stats;
+    
+    printf("[统计] 诱饵端口: %zu个, 当前TCP连接%zu个; 探测 UDP%llu个/TCP%llu个, 固定应答%llu个, "
+           "MAVLink UDP%llu个/TCP连接%llu个; 连接数满关闭%llu个, 发送队列满丢弃%llu个\n",
+           g_decoys.count, g_decoys.conn_count, (unsigned long long)stats->udp_probes,
+           (unsigned long long)stats->tcp_probes, (unsigned long long)stats->replies,
+           (unsigned long long)stats->mavlink_datagrams, (unsigned long long)stats->mavlink_conns,
+           (unsigned long long)stats->evicted, (unsigned long long)stats->stream_drops);
+}
+
+/**
+ * 输出日志队列统计
+ */
+static void print_logger_stats(void) {
+    logger_stats_t stats;
+    
+    logger_get_stats(&stats);
+    printf("[统计] 日志队列: 当前%llu条, 峰值%llu条, 累计%llu条, 队列满丢弃%llu条; 写出%llu次/%llu字节, 失败%llu次, 超长丢弃%llu条\n",
+           (unsigned long long)stats.depth, (unsigned long long)stats.peak_depth,
+           (unsigned long long)stats.queued, (unsigned long long)stats.dropped,
+           (unsigned long long)stats.writes, (unsigned long long)stats.bytes,
+           (unsigned long long)stats.write_errors, (unsigned long long)stats.format_errors);
+    
+    logarchive_stats_t archive;
+    logarchive_get_stats(&archive);
+    printf("[统计] 日志归档: 轮转%llu次, 压缩%llu个 (%llu -> %llu字节), 删除%llu个, 失败%llu次\n",
+           (unsigned long long)stats.rotations, (unsigned long long)archive.compressed,
+           (unsigned long long)archive.bytes_in, (unsigned long long)archive.bytes_out,
+           (unsigned long long)archive.deleted, (unsigned long long)archive.errors);
+}
+
+/**
+ * 周期输出转发统计（worker 0汇总所有线程）
+ */
+static void on_stats_timer(void *ctx, int fd, uint32_t expirations) {
+    const proxy_stats_t *stats = proxy_get_stats();
+    size_t sessions = 0;
+    uint64_t created = 0, expired = 0, evicted = 0;
+    (void)ctx;
+    (void)fd;
+    (void)expirations;
+    
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        const session_table_t *table = &g_workers[w]->sessions;
+        sessions += session_count(table);
+        created += table->created;
+        expired += table->expired;
+        evicted += table->evicted;
+    }
+    
+    printf("[统计] 客户端->SITL: %llu条/%llu字节, SITL->客户端: %llu帧/%llu字节, 垃圾字节: %llu/%llu\n",
+           (unsigned long long)stats->messages_from_client,
+           (unsigned long long)stats->bytes_to_sitl,
+           (unsigned long long)stats->frames_from_sitl,
+           (unsigned long long)stats->bytes_to_client,
+           (unsigned long long)stats->junk_bytes_from_client,
+           (unsigned long long)stats->junk_bytes_from_sitl);
+    printf("[统计] 校验和: 客户端 失败%llu帧/未知消息%llu帧, SITL 失败%llu帧/未知消息%llu帧\n",
+           (unsigned long long)stats->crc_errors_from_client,
+           (unsigned long long)stats->unchecked_from_client,
+           (unsigned long long)stats->crc_errors_from_sitl,
+           (unsigned long long)stats->unchecked_from_sitl);
+    printf("[统计] 客户端会话: 当前%zu个, 累计%llu个, 超时回收%llu个, 表满挤出%llu个\n",
+           sessions, (unsigned long long)created, (unsigned long long)expired, (unsigned long long)evicted);
+    if (backend_pool_enabled()) {
+        print_pool_stats(stats);
+    }
+    if (!backend_pool_enabled()) {
+        print_sitl_link_stats(stats);
+    }
+    print_txq_stats();
+    if (g_decoys.count > 0) {
+        print_decoy_stats();
+    }
+    print_logger_stats();
+    print_batch_stats("接收", stats->rx_batches, stats->rx_datagrams, stats->rx_batch_fill);
+    print_batch_stats("发送", stats->tx_batches, stats->tx_datagrams, stats->tx_batch_fill);
+    if (g_workers[0]->use_uring) {
+        printf("[统计] io_uring: 提交%llu次, 接收缓冲区耗尽%llu次\n",
+               (unsigned long long)stats->uring_submits, (unsigned long long)stats->uring_nobufs);
+    }
+    
+    // 各线程分到的流量，用于确认内核分流是否均匀
+    if (g_worker_count > 1) {
+        printf("[统计] 工作线程接收数据报:");
+        for (unsigned w = 0; w < g_worker_count; w++) {
+            printf(" #%u:%llu", w, (unsigned long long)g_workers[w]->stats.rx_datagrams);
+        }
+        printf("\n");
+    }
+}
+
+/**
+ * 回收空闲会话
+ */
+static void on_session_timer(void *ctx, int fd, uint32_t expirations) {
+    proxy_worker_t *worker = (proxy_worker_t *)ctx;
+    (void)fd;
+    (void)expirations;
+    
+    pthread_mutex_lock(&worker->session_lock);
+    session_expire(&worker->sessions, time(NULL), SESSION_IDLE_TIMEOUT, on_session_removed, worker);
+    pthread_mutex_unlock(&worker->session_lock);
+}
+
+/**
+ * 退出信号
+ */
+static void on_signal(void *ctx, int fd, uint32_t signo) {
+    (void)ctx;
+    (void)fd;
+    
+    if (signo == SIGINT || signo == SIGTERM) {
+        printf("\n系统接收到退出信号\n");
+        proxy_stop();
+    }
+}
+
+/**
+ * 创建工作线程的状态：socket、事件循环、会话表和本线程的SITL实例段
+ */
+static proxy_worker_t *worker_create(int id) {
+    const honeypot_config_t *config = config_get();
+    proxy_worker_t *worker = calloc(1, sizeof(*worker));
+    
+    if (!worker) {
+        perror("分配工作线程失败");
+        return NULL;
+    }
+    worker->id = id;
+    worker->sock = -1;
+    worker->loop.epfd = -1;
+    worker->loop.wake.fd = -1;
+    worker->external_src.fd = -1;
+    worker->session_timer.fd = -1;
+    worker->ring.fd = -1;
+    worker->ring_src.fd = -1;
+    session_table_init(&worker->sessions);
+    pthread_mutex_init(&worker->session_lock, NULL);
+    mavlink_sign_cache_init(&worker->sign_cache);
+    
+    // 批量接收：每个槽位固定指向自己的缓冲区和地址
+    for (unsigned i = 0; i < PROXY_MAX_UDP_BATCH; i++) {
+        worker->rx_iovs[i].iov_base = worker->rx_bufs[i];
+        worker->rx_iovs[i].iov_len = PROXY_BUFFER_SIZE;
+        worker->rx_msgs[i].msg_hdr.msg_name = &worker->rx_addrs[i];
+        worker->rx_msgs[i].msg_hdr.msg_iov = &worker->rx_iovs[i];
+        worker->rx_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    
+    // 批量发送：一批数据报连续存放，每个不超过MTU
+    worker->egress_buf = malloc(config->egress_mtu * config->udp_batch);
+    if (!worker->egress_buf) {
+        perror("分配发送缓冲区失败");
+        return worker;
+    }
+    
+    if (evloop_init(&worker->loop) < 0) {
+        return worker;
+    }
+    worker->sock = create_udp_socket(config->listen_port, 1, config->workers > 1);
+    return worker;
+}
+
+/**
+ * 注册工作线程的事件源；后端池模式按线程编号划分实例段
+ */
+static int worker_start(proxy_worker_t *worker) {
+    const honeypot_config_t *config = config_get();
+    unsigned workers = config->workers;
+    
+    if (!worker->egress_buf || worker->loop.epfd < 0 || worker->sock < 0) {
+        return -1;
+    }
+    
+    if (backend_pool_enabled()) {
+        // 第w个线程使用[w*max/n, (w+1)*max/n)号实例，空闲实例数向上取整分摊
+        unsigned first = worker->id * config->pool_max / workers;
+        unsigned count = (worker->id + 1) * config->pool_max / workers - first;
+        unsigned idle = (config->pool_idle + workers - 1) / workers;
+        if (backend_pool_init(&worker->pool, &worker->loop, &g_backend_ops, worker,
+                              (int)first, count, idle < count ? idle : count) < 0) {
+            return -1;
+        }
+    }
+    
+    // io_uring不可用（旧内核、容器的seccomp策略）时退回recvmmsg
+    if (config->io_uring && uring_start(worker) < 0) {
+        fprintf(stderr, "线程%d: io_uring不可用(%s)，使用epoll\n", worker->id, strerror(errno));
+    }
+    
+    if ((!worker->use_uring &&
+         evloop_add(&worker->loop, &worker->external_src, worker->sock, EPOLLIN, on_external_readable, worker) < 0) ||
+        evloop_add_timer(&worker->loop, &worker->session_timer, PROXY_SESSION_SWEEP_MS,
+                         on_session_timer, worker) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static void worker_destroy(proxy_worker_t *worker) {
+    evloop_del(&worker->loop, &worker->external_src);
+    evloop_del(&worker->loop, &worker->session_timer);
+    evloop_del(&worker->loop, &worker->ring_src);
+    if (worker->ring.fd >= 0) {
+        uring_bufs_close(&worker->ring, &worker->ring_bufs);
+        uring_close(&worker->ring);
+    }
+    backend_pool_close(&worker->pool);
+    evloop_close(&worker->loop);
+    
+    if (worker->sock >= 0) {
+        close(worker->sock);
+    }
+    pthread_mutex_destroy(&worker->session_lock);
+    free(worker->egress_buf);
+    free(worker);
+}
+
+static void *worker_main(void *arg) {
+    proxy_worker_t *worker = (proxy_worker_t *)arg;
+    evloop_run(&worker->loop);
+    return NULL;
+}
+
+int proxy_init(void) {
+    static const int exit_signals[] = { SIGINT, SIGTERM };
+    const honeypot_config_t *config = config_get();
+    
+    memset(&g_stats_total, 0, sizeof(g_stats_total));
+    mavlink_parser_init(&g_sitl_parser);
+    txq_init(&g_sitl_txq, &g_sitl_txq_stats);
+    g_internal_src.fd = -1;
+    g_reconnect_timer.fd = -1;
+    g_sitl_connecting = 0;
+    g_resolve_src.fd = -1;
+    g_resolving = 0;
+    g_sitl_addr_valid = 0;
+    g_stats_timer.fd = -1;
+    g_signal_src.fd = -1;
+    g_worker_count = 0;
+    
+    if (backend_pool_configure() < 0) {
+        return -1;
+    }
+    
+    printf("创建外部UDP socket (端口 %d, %u个工作线程)...\n", config->listen_port, config->workers);
+    for (unsigned w = 0; w < config->workers; w++) {
+        g_workers[w] = worker_create((int)w);
+        if (!g_workers[w]) {
+            proxy_close();
+            return -1;
+        }
+        g_worker_count++;
+        if (g_workers[w]->sock < 0) {
+            proxy_close();
+            return -1;
+        }
+    }
+    
+    proxy_worker_t *main_worker = g_workers[0];
+    
+    // 尽早接管退出信号：初始化期间收到的信号留到事件循环中处理。
+    // 此时其他线程还没创建，它们继承屏蔽字，信号只会由worker 0的signalfd读取
+    if (evloop_add_signals(&main_worker->loop, &g_signal_src, exit_signals, 2, on_signal, NULL) < 0) {
+        proxy_close();
+        return -1;
+    }
+    
+    if (!backend_pool_enabled()) {
+        // 共享SITL：所有线程的会话都会收到SITL数据，扇出目标快照按最多会话数分配
+        g_fanout_targets = malloc(sizeof(*g_fanout_targets) * SESSION_MAX * g_worker_count);
+        if (!g_fanout_targets) {
+            perror("分配扇出目标失败");
+            proxy_close();
+            return -1;
+        }
+        
+        // 共享SITL在后台连接（与断开后的重连相同），UDP端口先开始服务，连上之前代答占位心跳
+        if (evloop_add_timer(&main_worker->loop, &g_reconnect_timer, 0, on_reconnect_timer, main_worker) < 0) {
+            proxy_close();
+            return -1;
+        }
+        int resolve_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (resolve_fd < 0) {
+            perror("eventfd失败");
+            proxy_close();
+            return -1;
+        }
+        if (evloop_add(&main_worker->loop, &g_resolve_src, resolve_fd, EPOLLIN, on_resolve_done, main_worker) < 0) {
+            close(resolve_fd);
+            proxy_close();
+            return -1;
+        }
+        
+        // 地址在启动时解析一次并缓存（事件循环还没运行，阻塞无妨），之后只在连接失败后由后台线程重新解析
+        g_sitl_addr_valid = resolve_sitl_addr(config->sitl_host, config->sitl_port, &g_sitl_addr) == 0;
+        if (!g_sitl_addr_valid) {
+            printf("暂时无法解析SITL地址 %s，后台继续解析\n", config->sitl_host);
+        }
+        printf("后台连接 SITL (%s:%d)...\n", config->sitl_host, config->sitl_port);
+        clock_gettime(CLOCK_MONOTONIC, &g_sitl_down_at);
+        g_reconnect_delay_ms = PROXY_RECONNECT_MIN_MS;
+        sitl_try_connect(main_worker);
+    }
+    
+    // 诱饵端口全部挂在worker 0上（大多数时间空闲，一个线程足够）
+    if (decoy_init(&g_decoys, &main_worker->loop, config->decoys, config->listen_port, &g_decoy_ops,
+                   main_worker) < 0) {
+        proxy_close();
+        return -1;
+    }
+    
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        if (worker_start(g_workers[w]) < 0) {
+            proxy_close();
+            return -1;
+        }
+    }
+    
+    if (evloop_add_timer(&main_worker->loop, &g_stats_timer, PROXY_STATS_INTERVAL_MS, on_stats_timer, NULL) < 0) {
+        proxy_close();
+        return -1;
+    }
+    
+    printf("初始化完成\n");
+    printf("外部端口: UDP %d (等待QGroundControl连接)\n", config->listen_port);
+    if (backend_pool_enabled()) {
+        printf("内部连接: SITL后端池 (%s)\n", config->sitl_bin);
+    } else {
+        printf("内部连接: TCP %s:%d (%s)\n", config->sitl_host, config->sitl_port,
+               g_sitl_connected ? "已连接SITL" : "后台连接中");
+    }
+    printf("发往客户端的数据报上限: %zu字节\n", config->egress_mtu);
+    if (g_workers[0]->use_uring) {
+        printf("客户端数据路径: io_uring (多次接收, %d个接收缓冲区)\n", PROXY_URING_BUFS);
+    } else {
+        printf("UDP批量收发: 每次最多%u个数据报\n", config->udp_batch);
+    }
+    if (g_worker_count > 1) {
+        printf("工作线程: %u个 (SO_REUSEPORT, 按来源地址分流)\n", g_worker_count);
+    }
+    if (g_decoys.count > 0) {
+        printf("诱饵端口: %zu个 (%s)\n", g_decoys.count, config->decoys);
+    }
+    
+    return 0;
+}
+
+void proxy_run(void) {
+    unsigned started = 1;
+    
+    printf("开始运行...\n\n");
+    for (; started < g_worker_count; started++) {
+        proxy_worker_t *worker = g_workers[started];
+        if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+            perror("创建工作线程失败");
+            break;
+        }
+    }
+    
+    // worker 0在主线程运行，收到退出信号时通知其他线程
+    if (started == g_worker_count) {
+        evloop_run(&g_workers[0]->loop);
+    }
+    proxy_stop();
+    for (unsigned w = 1; w < started; w++) {
+        pthread_join(g_workers[w]->thread, NULL);
+    }
+    
+    // 退出前输出一次统计
+    on_stats_timer(NULL, -1, 0);
+}
+
+void proxy_close(void) {
+    if (g_worker_count > 0) {
+        evloop_t *main_loop = &g_workers[0]->loop;
+        decoy_close(&g_decoys); // 连接关闭时结束对应会话，需在会话表和后端池销毁之前
+        evloop_del(main_loop, &g_internal_src);
+        evloop_del(main_loop, &g_reconnect_timer);
+        if (g_resolving) {
+            pthread_join(g_resolve_thread, NULL); // 解析线程还要写eventfd，等它结束再关闭
+            g_resolving = 0;
+        }
+        if (g_resolve_src.fd >= 0) {
+            int resolve_fd = g_resolve_src.fd;
+            evloop_del(main_loop, &g_resolve_src);
+            close(resolve_fd);
+        }
+        evloop_del(main_loop, &g_stats_timer);
+        evloop_del(main_loop, &g_signal_src);
+    }
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        worker_destroy(g_workers[w]);
+        g_workers[w] = NULL;
+    }
+    g_worker_count = 0;
+    
+    if (g_internal_sock >= 0) {
+        close(g_internal_sock);
+        g_internal_sock = -1;
+    }
+    g_sitl_connected = 0;
+    txq_clear(&g_sitl_txq);
+    
+    free(g_fanout_targets);
+    g_fanout_targets = NULL;
+    
+    printf("关闭完成\n");
+}
+
+proxy_stats_t* proxy_get_stats(void) {
+    // 统计字段都是uint64_t，逐项累加各线程的分片；读取时其他线程可能正在计数，结果是近似快照
+    const size_t fields = sizeof(proxy_stats_t) / sizeof(uint64_t);
+    uint64_t *total = (uint64_t *)&g_stats_total;
+    
+    memset(&g_stats_total, 0, sizeof(g_stats_total));
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        const uint64_t *shard = (const uint64_t *)&g_workers[w]->stats;
+        for (size_t i = 0; i < fields; i++) {
+            total[i] += shard[i];
+        }
+    }
+    return &g_stats_total;
+}
+
+void proxy_stop(void) {
+    for (unsigned w = 0; w < g_worker_count; w++) {
+        evloop_stop(&g_workers[w]->loop);
+    }
 }
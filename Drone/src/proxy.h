@@ -13,23 +13,58 @@
 #define PROXY_INTERNAL_PORT 5760   // 内部端口（SITL TCP端口）
 #define PROXY_SITL_HOST "127.0.0.1" // SITL地址
 #define PROXY_BUFFER_SIZE 2048      // 缓冲区大小
-
-/* 客户端连接信息 */
-typedef struct {
-    struct sockaddr_in addr;
-    socklen_t addr_len;
-    time_t last_seen;
-    int active;
-} proxy_client_t;
+#define PROXY_EGRESS_MTU 1400       // 发往客户端的数据报默认上限（只打包完整帧）
+#define PROXY_MAX_EGRESS_MTU 65507  // UDP数据报载荷上限
+#define PROXY_STATS_INTERVAL_MS 60000 // 统计输出周期（毫秒）
+#define PROXY_SESSION_SWEEP_MS 5000 // 空闲会话检查周期（毫秒）
+#define PROXY_UDP_BATCH 32          // 每次recvmmsg/sendmmsg最多处理的数据报数（默认）
+#define PROXY_MAX_UDP_BATCH 64      // 批量上限
+#define PROXY_BATCH_HIST_BUCKETS 7  // 批量填充分布：1, 2-3, 4-7, 8-15, 16-31, 32-63, 64
+#define PROXY_WORKERS 1             // 默认工作线程数
+#define PROXY_MAX_WORKERS 64        // 工作线程数上限
+#define PROXY_RECONNECT_MIN_MS 50   // 共享SITL断开后首次重连的等待（毫秒），之后每次翻倍
+#define PROXY_RECONNECT_MAX_MS 250  // 重连等待上限（毫秒），SITL恢复后最多这么久重新连上
+#define PROXY_CONNECT_TIMEOUT_MS 3000 // 单次非阻塞连接的超时（毫秒）
+#define PROXY_PLACEHOLDER_INTERVAL 1 // SITL未就绪时每个会话代答占位心跳的最小间隔（秒）
+#define PROXY_PLACEHOLDER_TYPE 1    // 占位心跳的机型（MAV_TYPE_FIXED_WING），连上过SITL后改用其心跳内容
+#define PROXY_URING_BUFS 256        // io_uring模式下每个线程的接收缓冲区数（2的幂），也是每轮合并发往SITL的上限
 
 /* 代理统计信息 */
 typedef struct {
     uint64_t bytes_from_client;     // 来自客户端的字节数
     uint64_t bytes_to_client;       // 发往客户端的字节数
     uint64_t bytes_from_sitl;       // 来自SITL的字节数
-    uint64_t bytes_to_sitl;         // 发往SITL的字节数
-    uint64_t messages_from_client;  // 来自客户端的消息数
+    uint64_t bytes_to_sitl;         // 交给SITL连接的字节数（直接写出或进入发送队列）
+    uint64_t messages_from_client;  // 交给SITL连接的客户端数据报数
     uint64_t messages_to_client;    // 发往客户端的消息数
+    uint64_t junk_bytes_from_client; // 来自客户端的无法识别字节数
+    uint64_t frames_from_sitl;      // 来自SITL的完整帧数
+    uint64_t junk_bytes_from_sitl;  // SITL流中无法识别的字节数
+    uint64_t crc_errors_from_client; // 客户端数据中校验失败的候选帧数
+    uint64_t unchecked_from_client; // 客户端发来的消息ID不在消息表中、无法校验的帧数
+    uint64_t crc_errors_from_sitl;  // SITL流中校验失败的候选帧数
+    uint64_t unchecked_from_sitl;   // SITL发来的无法校验的帧数
+    uint64_t signed_from_client;    // 来自客户端的v2签名帧数
+    uint64_t signed_invalid;        // 签名无法验证或时间戳重放的帧数
+    uint64_t no_backend_drops;      // 后端池模式下会话还没有分配到实例时丢弃的数据报数
+    uint64_t rx_batches;            // 收到数据的recvmmsg调用次数
+    uint64_t rx_datagrams;          // recvmmsg收到的数据报数
+    uint64_t tx_batches;            // sendmmsg调用次数
+    uint64_t tx_datagrams;          // sendmmsg发出的数据报数
+    uint64_t rx_batch_fill[PROXY_BATCH_HIST_BUCKETS]; // 每批接收数据报数的分布（按2的幂分桶）
+    uint64_t tx_batch_fill[PROXY_BATCH_HIST_BUCKETS]; // 每批发送数据报数的分布
+    uint64_t uring_submits;         // io_uring模式：io_uring_enter调用次数
+    uint64_t uring_nobufs;          // io_uring模式：接收缓冲区耗尽、多次接收被内核终止的次数
+    uint64_t sitl_disconnects;      // 共享SITL连接断开次数
+    uint64_t sitl_connect_attempts; // 连接尝试次数（启动时和断开后）
+    uint64_t sitl_reconnects;       // 重新连接成功次数
+    uint64_t sitl_recovery_last_ms; // 最近一次从断开到重新连接的用时（毫秒）
+    uint64_t sitl_recovery_max_ms;  // 最长的一次
+    uint64_t sitl_recovery_total_ms; // 累计用时（求平均）
+    uint64_t replay_held;           // 断开期间缓存的命令数据报数
+    uint64_t replay_dropped;        // 缓存已满被挤掉的命令数据报数
+    uint64_t replay_sent;           // 重新连接后补发的命令数据报数
+    uint64_t placeholder_heartbeats; // SITL未就绪时代答的占位心跳数
 } proxy_stats_t;
 
 /**
@@ -39,7 +74,7 @@ typedef struct {
 int proxy_init(void);
 
 /**
- * 运行代理主循环
+ * 运行代理主循环（epoll事件循环，SIGINT/SIGTERM通过signalfd处理；共享SITL断开时在循环内重连，不退出）
  */
 void proxy_run(void);
 
@@ -55,7 +90,7 @@ void proxy_close(void);
 proxy_stats_t* proxy_get_stats(void);
 
 /**
- * 停止代理运行
+ * 停止代理运行（在事件回调中调用，当前事件处理完后退出主循环）
  */
 void proxy_stop(void);
 
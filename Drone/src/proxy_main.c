@@ -4,31 +4,46 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <signal.h>
 #include <unistd.h>
 #include "proxy.h"
 #include "mavlink.h"
 #include "logger.h"
-
-static volatile int g_running = 1;
-
-void signal_handler(int sig) {
-    if (sig == SIGINT || sig == SIGTERM) {
-        printf("\n系统接收到退出信号\n");
-        proxy_stop();  // 停止代理运行
-        g_running = 0;
-    }
-}
+#include "config.h"
+#include "timestamp.h"
+#include "mavlink_sign.h"
 
 int main(int argc, char *argv[]) {
     
-    // 注册信号处理
-    signal(SIGINT, signal_handler);
-    signal(SIGTERM, signal_handler);
+    // SIGINT/SIGTERM由代理的事件循环通过signalfd接收（见proxy_init）
     
-    // MAVLink解析器不需要初始化
+    // 加载配置
+    if (config_load() < 0) {
+        fprintf(stderr, "[错误] 配置无效\n");
+        return 1;
+    }
+    
+    // 初始化MAVLink解析器（校验和查找表）
+    mavlink_init();
+    
+    // 加载v2签名密钥（未配置时签名帧只识别、记录，不校验）
+    const honeypot_config_t *config = config_get();
+    if (config->signing_keys[0]) {
+        int keys = mavlink_sign_load_keys(config->signing_keys);
+        if (keys < 0) {
+            fprintf(stderr, "[错误] 签名密钥加载失败\n");
+            return 1;
+        }
+        printf("已加载 %d 个签名密钥\n", keys);
+    }
     
-    // 初始化日志系统
+    // 初始化日志系统（后台线程写文件）
+    logger_set_policy(config->log_flush_ms, config->log_sync);
+    logger_set_format(config->log_format);
+    timestamp_set_precision(config->log_time_precision);
+    logarchive_policy_t archive = {
+        config->log_compress_level, config->log_retention_days, (uint64_t)config->log_quota_mb << 20
+    };
+    logger_set_rotation((uint64_t)config->log_rotate_mb << 20, &archive);
     if (logger_init() < 0) {
         fprintf(stderr, "[错误] 日志系统初始化失败\n");
         return 1;
@@ -0,0 +1,191 @@
+/*
+ * session.c - 客户端会话表
+ */
+
+#include "session.h"
+#include <string.h>
+#include <arpa/inet.h>
+
+#define SESSION_SLOT_EMPTY 0
+#define SESSION_MASK (SESSION_TABLE_SIZE - 1)
+
+/* 地址键：IPv4地址和端口（均为网络字节序）拼成48位 */
+static uint64_t session_key(const struct sockaddr_in *addr) {
+    return ((uint64_t)addr->sin_addr.s_addr << 16) | addr->sin_port;
+}
+
+static uint32_t session_hash(uint64_t key) {
+    key *= 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(key >> 32);
+}
+
+static uint16_t slot_index(uint64_t slot) {
+    return (uint16_t)((slot & 0xFFFF) - 1);
+}
+
+void session_table_init(session_table_t *table) {
+    memset(table->slots, 0, sizeof(table->slots));
+    table->live_count = 0;
+    table->free_count = SESSION_MAX;
+    for (uint16_t i = 0; i < SESSION_MAX; i++) {
+        table->free_list[i] = SESSION_MAX - 1 - i; // 从0号开始分配
+    }
+    table->created = 0;
+    table->expired = 0;
+    table->evicted = 0;
+}
+
+/**
+ * 查找地址键所在的槽
+ * @return 槽号，不存在时返回-1
+ */
+static int session_find_slot(const session_table_t *table, uint64_t key) {
+    uint32_t pos = session_hash(key) & SESSION_MASK;
+    
+    // 会话数不超过槽数的一半，总能遇到空槽
+    for (;;) {
+        uint64_t slot = table->slots[pos];
+        if (slot == SESSION_SLOT_EMPTY) {
+            return -1;
+        }
+        if ((slot >> 16) == key) {
+            return (int)pos;
+        }
+        pos = (pos + 1) & SESSION_MASK;
+    }
+}
+
+session_t *session_lookup(session_table_t *table, const struct sockaddr_in *addr) {
+    int pos = session_find_slot(table, session_key(addr));
+    if (pos < 0) {
+        return NULL;
+    }
+    return &table->sessions[slot_index(table->slots[pos])];
+}
+
+/**
+ * 删除槽，并把后面探测链上的项前移（不使用墓碑，查找长度不会随增删退化）
+ */
+static void session_clear_slot(session_table_t *table, uint32_t hole) {
+    uint32_t pos = hole;
+    
+    for (;;) {
+        pos = (pos + 1) & SESSION_MASK;
+        uint64_t slot = table->slots[pos];
+        if (slot == SESSION_SLOT_EMPTY) {
+            break;
+        }
+        // 该项的起始槽不在(hole, pos]之间时，才能移到空出的位置
+        uint32_t home = session_hash(slot >> 16) & SESSION_MASK;
+        if (((pos - home) & SESSION_MASK) >= ((pos - hole) & SESSION_MASK)) {
+            table->slots[hole] = slot;
+            hole = pos;
+        }
+    }
+    table->slots[hole] = SESSION_SLOT_EMPTY;
+}
+
+void session_remove(session_table_t *table, session_t *session) {
+    uint16_t index = (uint16_t)(session - table->sessions);
+    int pos = session_find_slot(table, session_key(&session->info.addr));
+    
+    if (pos >= 0) {
+        session_clear_slot(table, (uint32_t)pos);
+    }
+    
+    // 用最后一个活跃会话填补live[]中的空位
+    uint16_t last = table->live[--table->live_count];
+    table->live[session->live_index] = last;
+    table->sessions[last].live_index = session->live_index;
+    
+    table->free_list[table->free_count++] = index;
+}
+
+session_t *session_create(session_table_t *table, const struct sockaddr_in *addr, socklen_t addr_len,
+                          time_t now, session_handler_t on_remove, void *ctx) {
+    if (table->free_count == 0) {
+        // 会话表已满：挤出最久没有流量的会话
+        session_t *oldest = session_at(table, 0);
+        for (size_t i = 1; i < table->live_count; i++) {
+            session_t *candidate = session_at(table, i);
+            if (candidate->last_seen < oldest->last_seen) {
+                oldest = candidate;
+            }
+        }
+        if (on_remove) {
+            on_remove(oldest, ctx);
+        }
+        session_remove(table, oldest);
+        table->evicted++;
+    }
+    
+    uint16_t index = table->free_list[--table->free_count];
+    session_t *session = &table->sessions[index];
+    
+    memset(session, 0, sizeof(*session));
+    memcpy(&session->info.addr, addr, sizeof(*addr));
+    session->info.addr_len = addr_len;
+    inet_ntop(AF_INET, &addr->sin_addr, session->info.ip_str, sizeof(session->info.ip_str));
+    session->info.port = ntohs(addr->sin_port);
+    session->first_seen = now;
+    session->last_seen = now;
+    mavlink_parser_init(&session->parser);
+    filter_init(&session->filter);
+    
+    session->live_index = table->live_count;
+    table->live[table->live_count++] = index;
+    
+    uint64_t key = session_key(addr);
+    uint32_t pos = session_hash(key) & SESSION_MASK;
+    while (table->slots[pos] != SESSION_SLOT_EMPTY) {
+        pos = (pos + 1) & SESSION_MASK;
+    }
+    table->slots[pos] = (key << 16) | (uint64_t)(index + 1);
+    
+    table->created++;
+    return session;
+}
+
+size_t session_expire(session_table_t *table, time_t now, time_t timeout,
+                      session_handler_t on_remove, void *ctx) {
+    size_t removed = 0;
+    size_t i = 0;
+    
+    while (i < table->live_count) {
+        session_t *session = session_at(table, i);
+        if (now - session->last_seen < timeout) {
+            i++;
+            continue;
+        }
+        if (on_remove) {
+            on_remove(session, ctx);
+        }
+        session_remove(table, session); // 最后一个会话移到位置i，不前进
+        table->expired++;
+        removed++;
+    }
+    return removed;
+}
+
+unsigned session_replay_push(session_replay_t *replay, const uint8_t *data, size_t len) {
+    unsigned dropped = 0;
+    
+    if (len == 0 || len > SESSION_REPLAY_BYTES) {
+        return 1;
+    }
+    
+    // 挤掉最旧的数据报，剩余的前移（缓存很小，断开期间才会用到）
+    while (replay->count == SESSION_REPLAY_MAX || replay->bytes + len > SESSION_REPLAY_BYTES) {
+        uint16_t first = replay->lens[0];
+        memmove(replay->data, replay->data + first, replay->bytes - first);
+        memmove(replay->lens, replay->lens + 1, (replay->count - 1) * sizeof(replay->lens[0]));
+        replay->bytes -= first;
+        replay->count--;
+        dropped++;
+    }
+    
+    memcpy(replay->data + replay->bytes, data, len);
+    replay->lens[replay->count++] = (uint16_t)len;
+    replay->bytes += (uint16_t)len;
+    return dropped;
+}
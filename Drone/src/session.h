@@ -0,0 +1,140 @@
+/*
+ * session.h - 客户端会话表
+ * 按来源地址（IP+端口）区分会话，每个会话有独立的解析器和过滤状态
+ */
+
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#include <netinet/in.h>
+#include "mavlink.h"
+#include "filter.h"
+#include "logger.h"
+
+#define SESSION_MAX 128                 // 同时存在的会话上限
+#define SESSION_TABLE_SIZE 256          // 哈希槽数（2的幂，不小于会话上限的2倍）
+#define SESSION_IDLE_TIMEOUT 120        // 无流量多少秒后回收会话
+#define SESSION_REPLAY_MAX 16           // SITL断开期间每个会话最多缓存的命令数据报数
+#define SESSION_REPLAY_BYTES 2048       // 同上，字节数上限
+
+/* SITL断开期间缓存的命令数据报，重新连接后按原顺序补发 */
+typedef struct {
+    uint8_t data[SESSION_REPLAY_BYTES]; // 数据报依次连续存放
+    uint16_t lens[SESSION_REPLAY_MAX];
+    uint16_t count;
+    uint16_t bytes;
+} session_replay_t;
+
+/* 会话 */
+typedef struct {
+    client_info_t info;             // 来源地址和预先格式化的IP字符串（日志直接使用）
+    time_t first_seen;              // 首个数据报时间
+    time_t last_seen;               // 最近数据报时间
+    mavlink_parser_t parser;        // 该来源的字节流解析器
+    filter_state_t filter;          // 该来源的消息过滤状态
+    uint64_t bytes_in;              // 收到的字节数
+    uint64_t datagrams_in;          // 收到的数据报数
+    struct backend *backend;        // 独占的SITL实例（后端池模式），NULL表示未分配
+    struct decoy_listener *listener; // 收到数据的诱饵端口，NULL表示代理主端口
+    struct decoy_conn *conn;        // 诱饵端口上的TCP MAVLink连接，NULL表示UDP
+    session_replay_t replay;        // 共享SITL断开期间缓存的命令
+    time_t placeholder_at;          // 最近一次代答占位心跳的时间（SITL未就绪时）
+    uint8_t placeholder_seq;        // 占位心跳的序列号
+    uint16_t live_index;            // 在live[]中的位置
+} session_t;
+
+/*
+ * 会话表：线性探测的开放寻址哈希。
+ * 每个槽是一个uint64：高48位为地址键，低16位为会话下标+1（0表示空槽），
+ * 查找只扫描紧凑的槽数组，命中后才访问会话本体。
+ */
+typedef struct {
+    uint64_t slots[SESSION_TABLE_SIZE];
+    session_t sessions[SESSION_MAX];
+    uint16_t live[SESSION_MAX];     // 活跃会话下标（紧凑数组，用于遍历）
+    uint16_t free_list[SESSION_MAX];// 空闲会话下标
+    uint16_t live_count;
+    uint16_t free_count;
+    uint64_t created;               // 累计创建的会话数
+    uint64_t expired;               // 超时回收的会话数
+    uint64_t evicted;               // 会话表满时挤出的会话数
+} session_table_t;
+
+/* 会话回收回调 */
+typedef void (*session_handler_t)(session_t *session, void *ctx);
+
+/**
+ * 初始化会话表
+ * @param table 会话表
+ */
+void session_table_init(session_table_t *table);
+
+/**
+ * 按来源地址查找会话
+ * @param table 会话表
+ * @param addr 来源地址
+ * @return 会话，不存在时返回NULL
+ */
+session_t *session_lookup(session_table_t *table, const struct sockaddr_in *addr);
+
+/**
+ * 创建会话（调用者已确认不存在）
+ * 会话表满时挤出最久没有流量的会话，挤出前调用on_remove
+ * @param table 会话表
+ * @param addr 来源地址
+ * @param addr_len 地址长度
+ * @param now 当前时间
+ * @param on_remove 被挤出会话的回调，可为NULL
+ * @param ctx 回调上下文
+ * @return 新会话（解析器和过滤状态已初始化）
+ */
+session_t *session_create(session_table_t *table, const struct sockaddr_in *addr, socklen_t addr_len,
+                          time_t now, session_handler_t on_remove, void *ctx);
+
+/**
+ * 删除会话
+ * @param table 会话表
+ * @param session 会话
+ */
+void session_remove(session_table_t *table, session_t *session);
+
+/**
+ * 回收超过timeout秒没有流量的会话，回收前调用on_remove
+ * @param table 会话表
+ * @param now 当前时间
+ * @param timeout 空闲超时（秒）
+ * @param on_remove 回调，可为NULL
+ * @param ctx 回调上下文
+ * @return 回收的会话数
+ */
+size_t session_expire(session_table_t *table, time_t now, time_t timeout,
+                      session_handler_t on_remove, void *ctx);
+
+/**
+ * 获取活跃会话数
+ */
+static inline size_t session_count(const session_table_t *table) {
+    return table->live_count;
+}
+
+/**
+ * 按遍历顺序获取第i个活跃会话（0 <= i < session_count）
+ * 遍历期间不能增删会话
+ */
+static inline session_t *session_at(session_table_t *table, size_t i) {
+    return &table->sessions[table->live[i]];
+}
+
+/**
+ * 缓存一个数据报，空间不够时挤掉最旧的
+ * @param replay 缓存
+ * @param data 数据
+ * @param len 长度（超过SESSION_REPLAY_BYTES时直接丢弃）
+ * @return 因此丢弃的数据报数（含被挤掉的）
+ */
+unsigned session_replay_push(session_replay_t *replay, const uint8_t *data, size_t len);
+
+#endif /* SESSION_H */
@@ -0,0 +1,51 @@
+/*
+ * sha256.h - SHA-256摘要（MAVLink v2签名校验用）
+ */
+
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHA256_DIGEST_LEN 32
+#define SHA256_BLOCK_LEN 64
+
+/* 增量计算状态 */
+typedef struct {
+    uint32_t state[8];
+    uint64_t total_len;             // 已输入的字节数
+    uint8_t block[SHA256_BLOCK_LEN]; // 未满一块的输入
+    size_t block_len;
+} sha256_ctx_t;
+
+/**
+ * 初始化摘要状态
+ * @param ctx 摘要状态
+ */
+void sha256_init(sha256_ctx_t *ctx);
+
+/**
+ * 输入数据
+ * @param ctx 摘要状态
+ * @param data 数据
+ * @param len 数据长度
+ */
+void sha256_update(sha256_ctx_t *ctx, const void *data, size_t len);
+
+/**
+ * 结束计算并输出摘要
+ * @param ctx 摘要状态
+ * @param digest 输出的32字节摘要
+ */
+void sha256_final(sha256_ctx_t *ctx, uint8_t digest[SHA256_DIGEST_LEN]);
+
+/**
+ * 一次性计算摘要
+ * @param data 数据
+ * @param len 数据长度
+ * @param digest 输出的32字节摘要
+ */
+void sha256(const void *data, size_t len, uint8_t digest[SHA256_DIGEST_LEN]);
+
+#endif /* SHA256_H */
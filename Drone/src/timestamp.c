@@ -0,0 +1,91 @@
+/*
+ * timestamp.c - 日志时间戳
+ */
+
+#include "timestamp.h"
+#include <string.h>
+
+/* 每个线程的格式化缓存 */
+typedef struct {
+    time_t sec;                     // text对应的秒
+    unsigned generation;             // 对应的g_generation，偏移改变后缓存失效
+    int valid;
+    size_t base_len;                // “YYYY-mm-dd HH:MM:SS”部分的长度
+    char text[TIMESTAMP_MAX];
+} timestamp_cache_t;
+
+static int g_precision = TIMESTAMP_SEC;
+static int g_fixed_offset = 0;      // 1表示按g_utc_offset格式化，不用本地时区
+static long g_utc_offset = 0;
+static unsigned g_generation = 0;
+static __thread timestamp_cache_t t_cache;
+
+void timestamp_set_precision(int precision) {
+    g_precision = precision;
+}
+
+int timestamp_precision(void) {
+    return g_precision;
+}
+
+void timestamp_now(struct timespec *ts) {
+    // 粗粒度时钟的分辨率是一个节拍（1~4ms），微秒位会一直是0，此时改用精确时钟
+    clock_gettime(g_precision == TIMESTAMP_US ? CLOCK_REALTIME : CLOCK_REALTIME_COARSE, ts);
+}
+
+void timestamp_set_utc_offset(long offset) {
+    if (!g_fixed_offset || g_utc_offset != offset) {
+        g_fixed_offset = 1;
+        g_utc_offset = offset;
+        g_generation++;
+    }
+}
+
+long timestamp_utc_offset(time_t sec) {
+    struct tm tm_info;
+    localtime_r(&sec, &tm_info);
+    return tm_info.tm_gmtoff;
+}
+
+/* 把value写成width位十进制（不足补0） */
+static void put_digits(char *out, unsigned long value, int width) {
+    for (int i = width - 1; i >= 0; i--) {
+        out[i] = (char)('0' + value % 10);
+        value /= 10;
+    }
+}
+
+const char *timestamp_format(const struct timespec *ts) {
+    timestamp_cache_t *cache = &t_cache;
+    
+    if (!cache->valid || cache->sec != ts->tv_sec || cache->generation != g_generation) {
+        struct tm tm_info;
+        if (g_fixed_offset) {
+            time_t local = ts->tv_sec + g_utc_offset;
+            gmtime_r(&local, &tm_info);
+        } else {
+            localtime_r(&ts->tv_sec, &tm_info);
+        }
+        cache->base_len = strftime(cache->text, sizeof(cache->text), "%Y-%m-%d %H:%M:%S", &tm_info);
+        cache->text[cache->base_len] = '\0';
+        cache->sec = ts->tv_sec;
+        cache->generation = g_generation;
+        cache->valid = 1;
+    }
+    
+    // 同一秒内只改写小数部分
+    char *frac = cache->text + cache->base_len;
+    switch (g_precision) {
+        case TIMESTAMP_MS:
+            frac[0] = '.';
+            put_digits(frac + 1, (unsigned long)ts->tv_nsec / 1000000, 3);
+            frac[4] = '\0';
+            break;
+        case TIMESTAMP_US:
+            frac[0] = '.';
+            put_digits(frac + 1, (unsigned long)ts->tv_nsec / 1000, 6);
+            frac[7] = '\0';
+            break;
+    }
+    return cache->text;
+}
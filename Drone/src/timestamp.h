@@ -0,0 +1,60 @@
+/*
+ * timestamp.h - 日志时间戳
+ * 取时间用CLOCK_REALTIME_COARSE（vDSO读取，不进内核）；格式化按线程缓存“YYYY-mm-dd HH:MM:SS”，
+ * 秒变化时才调用localtime_r和strftime，同一秒内只改写末尾的毫秒/微秒位。
+ */
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include <time.h>
+
+#define TIMESTAMP_MAX 40                // 格式化结果的长度上限（含结尾的0）
+
+/* 秒以下的精度 */
+typedef enum {
+    TIMESTAMP_SEC = 0,              // 2024-01-01 12:00:00（默认，与此前的日志格式相同）
+    TIMESTAMP_MS,                   // 2024-01-01 12:00:00.123
+    TIMESTAMP_US                    // 2024-01-01 12:00:00.123456
+} timestamp_precision_t;
+
+/**
+ * 设置精度（在各线程开始取时间之前调用）
+ * @param precision timestamp_precision_t
+ */
+void timestamp_set_precision(int precision);
+
+/**
+ * 获取当前精度
+ * @return timestamp_precision_t
+ */
+int timestamp_precision(void);
+
+/**
+ * 取当前时间（秒和毫秒精度用CLOCK_REALTIME_COARSE，分辨率为一个时钟节拍；
+ * 微秒精度用CLOCK_REALTIME，同样走vDSO）
+ * @param ts 输出
+ */
+void timestamp_now(struct timespec *ts);
+
+/**
+ * 改为按固定的UTC偏移格式化（drone_logcat按日志中记录的偏移还原传感器的本地时间）
+ * @param offset 相对UTC的秒数（东区为正）
+ */
+void timestamp_set_utc_offset(long offset);
+
+/**
+ * 查询本地时区在某一时刻相对UTC的偏移
+ * @param sec 时间
+ * @return 秒数（东区为正，随夏令时变化）
+ */
+long timestamp_utc_offset(time_t sec);
+
+/**
+ * 格式化为本地时间（线程安全，每个线程有自己的缓存；设置了固定偏移时按该偏移）
+ * @param ts 时间
+ * @return 以0结尾的字符串，在本线程下一次调用前有效
+ */
+const char *timestamp_format(const struct timespec *ts);
+
+#endif /* TIMESTAMP_H */
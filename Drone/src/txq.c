@@ -0,0 +1,197 @@
+/*
+ * txq.c - 到SITL的TCP发送队列
+ */
+
+#include "txq.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+void txq_init(txq_t *q, txq_stats_t *stats) {
+    memset(q, 0, sizeof(*q));
+    q->stats = stats;
+}
+
+/* 合并写出：即writev，但用sendmsg带上MSG_NOSIGNAL（对端关闭时不产生SIGPIPE）和MSG_DONTWAIT */
+static ssize_t txq_writev(int fd, const struct iovec *iov, unsigned count) {
+    struct msghdr msg;
+    
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = (struct iovec *)iov;
+    msg.msg_iovlen = count;
+    for (;;) {
+        ssize_t n = sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n >= 0 || errno != EINTR) {
+            return n;
+        }
+    }
+}
+
+/* 移除下标i的数据报 */
+static void txq_remove(txq_t *q, unsigned i) {
+    q->bytes -= q->entries[i].len;
+    free(q->entries[i].data);
+    memmove(&q->entries[i], &q->entries[i + 1], (q->count - i - 1) * sizeof(q->entries[0]));
+    q->count--;
+}
+
+/**
+ * 找一个可以让位的数据报：优先级低于prio的最旧的一个（写了一部分的队首除外）
+ * @return 下标，-1表示没有
+ */
+static int txq_find_victim(const txq_t *q, uint8_t prio) {
+    int victim = -1;
+    
+    for (unsigned i = q->head_sent ? 1 : 0; i < q->count; i++) {
+        uint8_t p = q->entries[i].prio;
+        if (p < prio && (victim < 0 || p < q->entries[victim].prio)) {
+            victim = (int)i;
+        }
+    }
+    return victim;
+}
+
+static void txq_count_drop(txq_t *q, uint8_t prio, size_t len) {
+    if (q->stats) {
+        q->stats->dropped[prio]++;
+        q->stats->dropped_bytes += len;
+    }
+}
+
+int txq_push(txq_t *q, const uint8_t *data, size_t len, uint8_t prio) {
+    if (prio >= TXQ_PRIO_COUNT) {
+        prio = TXQ_PRIO_HIGH;
+    }
+    
+    // 空间不够时让低优先级的数据报让位，同级或更高的不动（保持已排队数据的顺序和完整）
+    while (q->count == TXQ_MAX_ENTRIES || q->bytes + len > TXQ_MAX_BYTES) {
+        int victim = txq_find_victim(q, prio);
+        if (victim < 0) {
+            txq_count_drop(q, prio, len);
+            return -1;
+        }
+        txq_count_drop(q, q->entries[victim].prio, q->entries[victim].len);
+        txq_remove(q, (unsigned)victim);
+    }
+    
+    uint8_t *copy = malloc(len);
+    if (!copy) {
+        txq_count_drop(q, prio, len);
+        return -1;
+    }
+    memcpy(copy, data, len);
+    
+    txq_entry_t *entry = &q->entries[q->count++];
+    entry->data = copy;
+    entry->len = (uint16_t)len;
+    entry->prio = prio;
+    q->bytes += len;
+    
+    if (q->stats) {
+        q->stats->queued++;
+        if (q->count > q->stats->peak_depth) {
+            q->stats->peak_depth = q->count;
+        }
+    }
+    return 0;
+}
+
+ssize_t txq_sendv(txq_t *q, int fd, const struct iovec *iov, const uint8_t *prio, unsigned count) {
+    ssize_t sent = 0;
+    unsigned i = 0;
+    
+    // 有排队数据时不能插队
+    if (q->count == 0) {
+        sent = txq_writev(fd, iov, count);
+        if (sent < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                return -1;
+            }
+            sent = 0;
+        }
+        if (q->stats) {
+            q->stats->writev_calls++;
+        }
+        
+        // 跳过写完的数据报
+        size_t left = (size_t)sent;
+        while (i < count && left >= iov[i].iov_len) {
+            left -= iov[i].iov_len;
+            i++;
+        }
+        if (q->stats) {
+            q->stats->writev_datagrams += i;
+        }
+        
+        // 写了一部分的数据报整条入队成为队首，记下已写出的字节数（否则TCP流中留下半帧），不参与丢弃
+        if (left > 0) {
+            if (txq_push(q, iov[i].iov_base, iov[i].iov_len, prio[i]) == 0) {
+                q->head_sent = left;
+            }
+            i++;
+        }
+    }
+    
+    for (; i < count; i++) {
+        txq_push(q, iov[i].iov_base, iov[i].iov_len, prio[i]);
+    }
+    return sent;
+}
+
+ssize_t txq_flush(txq_t *q, int fd) {
+    struct iovec iov[TXQ_WRITEV_MAX];
+    ssize_t total = 0;
+    
+    while (q->count > 0) {
+        unsigned n = q->count < TXQ_WRITEV_MAX ? q->count : TXQ_WRITEV_MAX;
+        for (unsigned i = 0; i < n; i++) {
+            iov[i].iov_base = q->entries[i].data;
+            iov[i].iov_len = q->entries[i].len;
+        }
+        iov[0].iov_base = q->entries[0].data + q->head_sent;
+        iov[0].iov_len -= q->head_sent;
+        
+        ssize_t written = txq_writev(fd, iov, n);
+        if (written < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            return -1;
+        }
+        if (q->stats) {
+            q->stats->writev_calls++;
+        }
+        total += written;
+        
+        // 出队写完的数据报，最后一个可能只写了一部分
+        size_t left = (size_t)written + q->head_sent;
+        unsigned done = 0;
+        while (done < q->count && left >= q->entries[done].len) {
+            left -= q->entries[done].len;
+            q->bytes -= q->entries[done].len;
+            free(q->entries[done].data);
+            done++;
+        }
+        memmove(&q->entries[0], &q->entries[done], (q->count - done) * sizeof(q->entries[0]));
+        q->count -= done;
+        q->head_sent = left;
+        if (q->stats) {
+            q->stats->writev_datagrams += done;
+        }
+        if (left > 0 || done < n) {
+            break; // 没写完说明发送缓冲区已满
+        }
+    }
+    return total;
+}
+
+void txq_clear(txq_t *q) {
+    for (unsigned i = 0; i < q->count; i++) {
+        free(q->entries[i].data);
+    }
+    q->count = 0;
+    q->bytes = 0;
+    q->head_sent = 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * txq.h - 到SITL的TCP发送队列
+ * 发送不阻塞：队列为空时直接发送，发不完的部分按数据报拷贝排队，可写时用writev合并发出。
+ * 队列有条数和字节上限，满时先丢优先级低的数据报（遥测/数据请求），命令尽量保留。
+ */
+
+#ifndef TXQ_H
+#define TXQ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#define TXQ_MAX_ENTRIES 256             // 每个连接最多排队的数据报数
+#define TXQ_MAX_BYTES (256 * 1024)      // 每个连接最多排队的字节数
+#define TXQ_WRITEV_MAX 64               // 队列可写时每次writev最多合并的数据报数
+
+/* 数据报优先级（取数据报中各帧的最高值） */
+typedef enum {
+    TXQ_PRIO_LOW = 0,               // 遥测、数据请求，最先丢弃
+    TXQ_PRIO_NORMAL,                // 心跳、参数、任务等
+    TXQ_PRIO_HIGH,                  // 命令、位置和手动控制
+    TXQ_PRIO_COUNT
+} txq_prio_t;
+
+/* 队列统计（同一线程的多个队列可以共用一份） */
+typedef struct {
+    uint64_t queued;                // 进入队列的数据报数（直接发完的不计）
+    uint64_t writev_calls;          // writev调用次数
+    uint64_t writev_datagrams;      // 经writev写完的数据报数
+    uint64_t dropped[TXQ_PRIO_COUNT]; // 队列满时按优先级丢弃的数据报数
+    uint64_t dropped_bytes;         // 丢弃的字节数
+    uint64_t peak_depth;            // 队列长度峰值
+} txq_stats_t;
+
+/* 排队的数据报（拷贝） */
+typedef struct {
+    uint8_t *data;
+    uint16_t len;
+    uint8_t prio;                   // txq_prio_t
+} txq_entry_t;
+
+/* 发送队列 */
+typedef struct {
+    txq_entry_t entries[TXQ_MAX_ENTRIES]; // 按发送顺序排列，下标0为队首
+    unsigned count;                 // 排队的数据报数
+    size_t bytes;                   // 排队的字节数
+    size_t head_sent;               // 队首数据报已写出的字节数（写了一部分的数据报不能丢弃）
+    txq_stats_t *stats;             // 统计，可为NULL
+} txq_t;
+
+/**
+ * 初始化队列
+ * @param q 队列
+ * @param stats 统计（可为NULL）
+ */
+void txq_init(txq_t *q, txq_stats_t *stats);
+
+/**
+ * 队列是否为空
+ * @param q 队列
+ * @return 1为空
+ */
+static inline int txq_empty(const txq_t *q) {
+    return q->count == 0;
+}
+
+/**
+ * 发送一组数据报：队列为空时用一次writev直接发送，没写完的部分排队；队列不空时全部排在后面，保证顺序
+ * @param q 队列
+ * @param fd TCP连接（总以MSG_DONTWAIT写出，不会阻塞）
+ * @param iov 数据报
+ * @param prio 各数据报的优先级
+ * @param count 数据报数
+ * @return 直接写出的字节数（其余已排队或被丢弃），-1为连接错误（errno）
+ */
+ssize_t txq_sendv(txq_t *q, int fd, const struct iovec *iov, const uint8_t *prio, unsigned count);
+
+/**
+ * 把数据报拷贝进队列，满时按优先级丢弃
+ * @param q 队列
+ * @param data 数据
+ * @param len 长度
+ * @param prio 优先级
+ * @return 0已排队，-1被丢弃（队列中没有更低优先级的数据报可以让位）
+ */
+int txq_push(txq_t *q, const uint8_t *data, size_t len, uint8_t prio);
+
+/**
+ * 连接可写：用writev合并发出排队的数据报，直到发完或EAGAIN
+ * @param q 队列
+ * @param fd TCP连接（总以MSG_DONTWAIT写出，不会阻塞）
+ * @return 写出的字节数，-1为连接错误（errno）
+ */
+ssize_t txq_flush(txq_t *q, int fd);
+
+/**
+ * 清空队列（连接断开时）
+ * @param q 队列
+ */
+void txq_clear(txq_t *q);
+
+#endif /* TXQ_H */
@@ -0,0 +1,222 @@
+/*
+ * uring.c - io_uring的最小封装
+ */
+
+#include "uring.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(SYS_io_uring_setup, entries, params);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return (int)syscall(SYS_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, void *arg, unsigned nr_args) {
+    return (int)syscall(SYS_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+int uring_init(uring_t *ring, unsigned entries) {
+    struct io_uring_params params;
+    
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+    ring->fd = sys_io_uring_setup(entries, &params);
+    if (ring->fd < 0) {
+        ring->fd = -1;
+        return -1;
+    }
+    
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+    }
+    
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        ring->sq_ring = NULL;
+        uring_close(ring);
+        return -1;
+    }
+    
+    uint8_t *cq_base = (uint8_t *)ring->sq_ring;
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            ring->cq_ring = NULL;
+            uring_close(ring);
+            return -1;
+        }
+        cq_base = (uint8_t *)ring->cq_ring;
+    }
+    
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        uring_close(ring);
+        return -1;
+    }
+    
+    uint8_t *sq_base = (uint8_t *)ring->sq_ring;
+    ring->sq_entries = params.sq_entries;
+    ring->sq_head = (unsigned *)(sq_base + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq_base + params.sq_off.tail);
+    ring->sq_mask = *(unsigned *)(sq_base + params.sq_off.ring_mask);
+    ring->sq_pending_tail = *ring->sq_tail;
+    ring->cq_head = (unsigned *)(cq_base + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq_base + params.cq_off.tail);
+    ring->cq_mask = *(unsigned *)(cq_base + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_base + params.cq_off.cqes);
+    
+    // SQ下标数组固定为恒等映射，SQE按环上的顺序提交
+    unsigned *array = (unsigned *)(sq_base + params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; i++) {
+        array[i] = i;
+    }
+    return 0;
+}
+
+struct io_uring_sqe *uring_get_sqe(uring_t *ring) {
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    
+    if (ring->sq_pending_tail - head >= ring->sq_entries) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = &ring->sqes[ring->sq_pending_tail & ring->sq_mask];
+    ring->sq_pending_tail++;
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+int uring_submit(uring_t *ring, unsigned wait_nr) {
+    unsigned to_submit = ring->sq_pending_tail - *ring->sq_tail;
+    
+    // SQE内容写完后再发布尾指针
+    __atomic_store_n(ring->sq_tail, ring->sq_pending_tail, __ATOMIC_RELEASE);
+    for (;;) {
+        // 总是带GETEVENTS：即使不等待，也会把内核积压（CQ溢出）的完成事件搬回CQ
+        int ret = sys_io_uring_enter(ring->fd, to_submit, wait_nr, IORING_ENTER_GETEVENTS);
+        if (ret >= 0) {
+            return ret;
+        }
+        if (errno != EINTR) {
+            return -1;
+        }
+        // 被信号打断时SQE已被取走的部分不会重复提交
+        to_submit = ring->sq_pending_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    }
+}
+
+struct io_uring_cqe *uring_peek_cqe(uring_t *ring) {
+    unsigned head = *ring->cq_head;
+    
+    if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &ring->cqes[head & ring->cq_mask];
+}
+
+void uring_cqe_seen(uring_t *ring) {
+    __atomic_store_n(ring->cq_head, *ring->cq_head + 1, __ATOMIC_RELEASE);
+}
+
+void uring_close(uring_t *ring) {
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqes_size);
+        ring->sqes = NULL;
+    }
+    if (ring->cq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+        ring->cq_ring = NULL;
+    }
+    if (ring->sq_ring) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+        ring->sq_ring = NULL;
+    }
+    if (ring->fd >= 0) {
+        close(ring->fd);
+        ring->fd = -1;
+    }
+}
+
+int uring_bufs_init(uring_t *ring, uring_bufs_t *bufs, uint16_t group, uint16_t entries, size_t buf_size) {
+    struct io_uring_buf_reg reg;
+    size_t ring_size = entries * sizeof(struct io_uring_buf);
+    
+    memset(bufs, 0, sizeof(*bufs));
+    bufs->buf_size = buf_size;
+    bufs->entries = entries;
+    bufs->group = group;
+    bufs->ring = mmap(NULL, ring_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bufs->ring == MAP_FAILED) {
+        bufs->ring = NULL;
+        return -1;
+    }
+    bufs->bufs = malloc((size_t)entries * buf_size);
+    if (!bufs->bufs) {
+        munmap(bufs->ring, ring_size);
+        bufs->ring = NULL;
+        return -1;
+    }
+    
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)bufs->ring;
+    reg.ring_entries = entries;
+    reg.bgid = group;
+    if (sys_io_uring_register(ring->fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        int err = errno;
+        free(bufs->bufs);
+        bufs->bufs = NULL;
+        munmap(bufs->ring, ring_size);
+        bufs->ring = NULL;
+        errno = err;
+        return -1;
+    }
+    
+    for (uint16_t bid = 0; bid < entries; bid++) {
+        uring_bufs_recycle(bufs, bid);
+    }
+    uring_bufs_commit(bufs);
+    return 0;
+}
+
+void uring_bufs_recycle(uring_bufs_t *bufs, uint16_t bid) {
+    // 只写addr/len/bid：0号表项的resv与环的tail字段重叠
+    struct io_uring_buf *buf = &bufs->ring->bufs[bufs->tail & (bufs->entries - 1)];
+    buf->addr = (uint64_t)(uintptr_t)uring_buf(bufs, bid);
+    buf->len = (uint32_t)bufs->buf_size;
+    buf->bid = bid;
+    bufs->tail++;
+}
+
+void uring_bufs_commit(uring_bufs_t *bufs) {
+    __atomic_store_n(&bufs->ring->tail, bufs->tail, __ATOMIC_RELEASE);
+}
+
+void uring_bufs_close(uring_t *ring, uring_bufs_t *bufs) {
+    if (bufs->ring) {
+        struct io_uring_buf_reg reg;
+        memset(&reg, 0, sizeof(reg));
+        reg.bgid = bufs->group;
+        if (ring->fd >= 0) {
+            sys_io_uring_register(ring->fd, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+        }
+        munmap(bufs->ring, bufs->entries * sizeof(struct io_uring_buf));
+        bufs->ring = NULL;
+    }
+    free(bufs->bufs);
+    bufs->bufs = NULL;
+}
@@ -0,0 +1,126 @@
+/*
+ * uring.h - io_uring的最小封装（直接使用系统调用，不依赖liburing）
+ * 提供SQ/CQ环的映射、提交和收割，以及接收用的provided buffer环
+ */
+
+#ifndef URING_H
+#define URING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/io_uring.h>
+
+/* io_uring实例 */
+typedef struct {
+    int fd;                         // io_uring描述符，-1表示未初始化
+    unsigned sq_entries;            // SQ大小
+    unsigned *sq_head;              // 内核已取走的位置
+    unsigned *sq_tail;              // 已提交给内核的位置
+    unsigned sq_mask;
+    unsigned sq_pending_tail;       // 已填写、尚未提交的位置
+    struct io_uring_sqe *sqes;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    void *sq_ring;                  // mmap区域（SQ与CQ共用时cq_ring为NULL）
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} uring_t;
+
+/* 接收用的provided buffer环：内核取空闲缓冲区写入数据，用户处理完后归还 */
+typedef struct {
+    struct io_uring_buf_ring *ring; // 与内核共享的环（页对齐）
+    uint8_t *bufs;                  // 缓冲区，entries个buf_size连续存放
+    size_t buf_size;
+    uint16_t entries;               // 2的幂
+    uint16_t group;                 // 缓冲区组号（SQE的buf_group）
+    uint16_t tail;                  // 本地尾指针，uring_bufs_commit时发布
+} uring_bufs_t;
+
+/**
+ * 创建io_uring并映射环
+ * @param ring 实例
+ * @param entries SQ大小（CQ为其两倍）
+ * @return 0成功，-1失败（errno为内核返回的错误，ENOSYS/EPERM表示不可用）
+ */
+int uring_init(uring_t *ring, unsigned entries);
+
+/**
+ * 取一个空闲SQE（已清零），填写后由uring_submit提交
+ * @param ring 实例
+ * @return SQE，SQ已满时返回NULL
+ */
+struct io_uring_sqe *uring_get_sqe(uring_t *ring);
+
+/**
+ * 提交已填写的SQE，可选等待完成（同时取回内核积压的完成事件）
+ * @param ring 实例
+ * @param wait_nr 至少等待的完成数，0表示不等待
+ * @return 提交的SQE数，-1失败
+ */
+int uring_submit(uring_t *ring, unsigned wait_nr);
+
+/**
+ * 取下一个完成事件（不等待）
+ * @param ring 实例
+ * @return CQE，没有时返回NULL；处理完后调用uring_cqe_seen
+ */
+struct io_uring_cqe *uring_peek_cqe(uring_t *ring);
+
+/**
+ * 标记一个CQE已处理
+ * @param ring 实例
+ */
+void uring_cqe_seen(uring_t *ring);
+
+/**
+ * 销毁io_uring
+ * @param ring 实例
+ */
+void uring_close(uring_t *ring);
+
+/**
+ * 注册provided buffer环并放入全部缓冲区
+ * @param ring 实例
+ * @param bufs 缓冲区环
+ * @param group 缓冲区组号
+ * @param entries 缓冲区个数（2的幂，不超过32768）
+ * @param buf_size 每个缓冲区的字节数
+ * @return 0成功，-1失败（旧内核不支持时errno为EINVAL）
+ */
+int uring_bufs_init(uring_t *ring, uring_bufs_t *bufs, uint16_t group, uint16_t entries, size_t buf_size);
+
+/**
+ * 取缓冲区地址
+ * @param bufs 缓冲区环
+ * @param bid 缓冲区编号（CQE flags >> IORING_CQE_BUFFER_SHIFT）
+ * @return 缓冲区地址
+ */
+static inline uint8_t *uring_buf(const uring_bufs_t *bufs, uint16_t bid) {
+    return bufs->bufs + (size_t)bid * bufs->buf_size;
+}
+
+/**
+ * 归还一个缓冲区（uring_bufs_commit后内核可见）
+ * @param bufs 缓冲区环
+ * @param bid 缓冲区编号
+ */
+void uring_bufs_recycle(uring_bufs_t *bufs, uint16_t bid);
+
+/**
+ * 发布已归还的缓冲区
+ * @param bufs 缓冲区环
+ */
+void uring_bufs_commit(uring_bufs_t *bufs);
+
+/**
+ * 注销并释放缓冲区环
+ * @param ring 实例
+ * @param bufs 缓冲区环
+ */
+void uring_bufs_close(uring_t *ring, uring_bufs_t *bufs);
+
+#endif /* URING_H */
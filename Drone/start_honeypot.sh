@@ -47,21 +47,33 @@ sleep 1
 # 构建SITL参数
 SITL_ARGS="--model plane --home $HOME_LOCATION --speedup $SPEEDUP"
 SITL_ARGS="$SITL_ARGS --defaults $SCRIPT_DIR/sitl/plane.parm"
-SITL_ARGS="$SITL_ARGS -I0"
 
 if [ "$DISABLE_SITL_LOG" = true ]; then
     echo "LOG_BACKEND_TYPE 0" > "$SCRIPT_DIR/sitl/no_log.parm"
     SITL_ARGS="$SITL_ARGS --defaults $SCRIPT_DIR/sitl/no_log.parm"
 fi
 
+# 后端池模式：SITL由代理按需启动，每个实例在 sitl/pool/<n> 下运行
+if [ "$SITL_POOL" = true ]; then
+    cd "$SCRIPT_DIR"
+    export PROXY_PORT
+    export PROXY_SITL_PORT="$SITL_PORT"
+    export PROXY_DECOYS="$DECOYS"
+    export PROXY_SITL_BIN="$SITL_BIN"
+    export PROXY_SITL_ARGS="$SITL_ARGS"
+    export PROXY_POOL_DIR="$SCRIPT_DIR/sitl/pool"
+    export PROXY_POOL_IDLE="$POOL_IDLE"
+    export PROXY_POOL_MAX="$POOL_MAX"
+    export PROXY_POOL_WARMUP="$POOL_WARMUP"
+    exec $PROXY_BIN
+fi
+
 # 启动 SITL
 cd "$SCRIPT_DIR/sitl"
-$SITL_BIN $SITL_ARGS > "$SCRIPT_DIR/sitl/sitl.log" 2>&1 &
+$SITL_BIN $SITL_ARGS -I0 > "$SCRIPT_DIR/sitl/sitl.log" 2>&1 &
 SITL_PID=$!
 
-# 等待 SITL 就绪
-sleep 3
-
+# 代理在后台连接SITL，不需要等待SITL就绪；这里只检查SITL进程是否立即退出
 if ! kill -0 $SITL_PID 2>/dev/null; then
     echo "SITL 启动失败"
     exit 1
@@ -69,6 +81,9 @@ fi
 
 echo "$SITL_PID" > "$SCRIPT_DIR/.sitl.pid"
 
-# 启动代理
+# 启动代理（配置通过环境变量传递）
 cd "$SCRIPT_DIR"
+export PROXY_PORT
+export PROXY_SITL_PORT="$SITL_PORT"
+export PROXY_DECOYS="$DECOYS"
 exec $PROXY_BIN
@@ -0,0 +1,155 @@
+/*
+ * drone_logcat.c - 二进制日志转换工具
+ * 把PROXY_LOG_FORMAT=binary写出的日志（.bin或压缩后的.bin.gz）转换成中文JSON行，
+ * 格式化代码与代理的JSON格式共用（logfmt.c），输出逐字节相同。
+ *
+ * 用法: drone_logcat [-o 输出文件] [日志文件...]
+ * 不指定文件（或文件为"-"）时读标准输入，按命令行顺序依次转换。
+ */
+
+#include "logfmt.h"
+#include "logbin.h"
+#include "jsonw.h"
+#include "timestamp.h"
+#include "mavlink.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#define LOGCAT_CHUNK (256 * 1024)       // 每次读取的字节数
+
+static uint8_t g_in[LOGCAT_CHUNK];
+static char g_line[LOGGER_LINE_MAX];
+static logbin_reader_t g_reader;
+static logger_record_t g_record;
+
+static void usage(const char *prog) {
+    fprintf(stderr, "用法: %s [-o 输出文件] [日志文件...]\n", prog);
+    fprintf(stderr, "把二进制日志（.bin或.bin.gz）转换成中文JSON行，不指定文件时读标准输入\n");
+}
+
+/* 输出一个事件（超过单行上限的事件代理也不会写出，这里同样跳过） */
+static int put_event(FILE *out, const logger_record_t *record) {
+    jsonw_t w;
+    
+    timestamp_set_precision(g_reader.precision);
+    timestamp_set_utc_offset(g_reader.utc_offset);
+    jsonw_init(&w, g_line, sizeof(g_line) - 1);
+    if (logfmt_json(&w, record) < 0) {
+        return -1;
+    }
+    g_line[w.len] = '\n';
+    fwrite(g_line, 1, w.len + 1, out);
+    return 0;
+}
+
+/**
+ * 转换一个文件（gzread同时支持压缩和未压缩的文件）
+ * @return 0成功，-1无法读取
+ */
+static int convert(const char *path, FILE *out) {
+    int is_stdin = strcmp(path, "-") == 0;
+    gzFile in = is_stdin ? gzdopen(dup(STDIN_FILENO), "rb") : gzopen(path, "rb");
+    unsigned long long events = 0, too_long = 0;
+    size_t len = 0;
+    int eof = 0;
+    
+    if (!in) {
+        perror(path);
+        return -1;
+    }
+    gzbuffer(in, LOGCAT_CHUNK);
+    logbin_reader_init(&g_reader);
+    
+    while (!eof || len > 0) {
+        if (!eof && len < sizeof(g_in)) {
+            int n = gzread(in, g_in + len, (unsigned)(sizeof(g_in) - len));
+            if (n < 0) {
+                int err;
+                fprintf(stderr, "%s: 读取失败: %s\n", path, gzerror(in, &err));
+                gzclose(in);
+                return -1;
+            }
+            eof = n == 0;
+            len += (size_t)n;
+        }
+        
+        // 解出缓冲区中所有完整的记录，剩下的半条记录移到开头
+        size_t pos = 0;
+        for (;;) {
+            size_t used;
+            int ret = logbin_decode(&g_reader, g_in + pos, len - pos, &g_record, &used);
+            if (ret == LOGBIN_MORE) {
+                break;
+            }
+            pos += used;
+            if (ret == LOGBIN_EVENT) {
+                if (put_event(out, &g_record) < 0) {
+                    too_long++;
+                } else {
+                    events++;
+                }
+            }
+        }
+        memmove(g_in, g_in + pos, len - pos);
+        len -= pos;
+        
+        // 文件末尾不完整的记录（进程崩溃时留下的半条）
+        if (eof && len > 0) {
+            g_reader.skipped += len;
+            len = 0;
+        }
+    }
+    gzclose(in);
+    
+    if (g_reader.skipped || g_reader.bad_records || too_long) {
+        fprintf(stderr, "%s: 转换%llu条事件，跳过损坏数据%llu字节，无法还原%llu条，超长%llu条\n", path, events,
+                (unsigned long long)g_reader.skipped, (unsigned long long)g_reader.bad_records, too_long);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *output = NULL;
+    FILE *out = stdout;
+    int opt;
+    int ret = 0;
+    
+    while ((opt = getopt(argc, argv, "o:h")) != -1) {
+        switch (opt) {
+            case 'o':
+                output = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    
+    if (output && !(out = fopen(output, "w"))) {
+        perror(output);
+        return 1;
+    }
+    setvbuf(out, NULL, _IOFBF, LOGCAT_CHUNK);
+    
+    // 帧按本程序的消息表重新解析，键名转义一次
+    mavlink_init();
+    if (logfmt_init() < 0) {
+        return 1;
+    }
+    
+    if (optind == argc) {
+        ret |= convert("-", out);
+    }
+    for (int i = optind; i < argc; i++) {
+        ret |= convert(argv[i], out);
+    }
+    
+    if (fclose(out) != 0) {
+        perror(output ? output : "stdout");
+        return 1;
+    }
+    return ret ? 1 : 0;
+}